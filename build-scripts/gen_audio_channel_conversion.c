@@ -20,6 +20,7 @@
 */
 
 #include <stdio.h>
+#include <string.h>
 
 /*
 
@@ -231,25 +232,15 @@ static char *lowercase(const char *str)  /* this is NOT robust. */
     return retval;
 }
 
-static void write_converter(const int fromchans, const int tochans)
+static void count_input_channel_uses(const int fromchans, const int tochans, int *input_channel_used)
 {
-    const char *fromstr = layout_names[fromchans-1];
-    const char *tostr = layout_names[tochans-1];
-    const float *cvtmatrix = channel_conversion_matrix[fromchans-1][tochans-1];
-    const float *fptr;
-    const int convert_backwards = (tochans > fromchans);
-    int input_channel_used[NUM_CHANNELS];
+    const float *fptr = channel_conversion_matrix[fromchans-1][tochans-1];
     int i, j;
 
-    if (tochans == fromchans) {
-        return;  /* nothing to convert, don't generate a converter. */
-    }
-
     for (i = 0; i < fromchans; i++) {
         input_channel_used[i] = 0;
     }
 
-    fptr = cvtmatrix;
     for (j = 0; j < tochans; j++) {
         for (i = 0; i < fromchans; i++) {
             #if 0
@@ -260,6 +251,84 @@ static void write_converter(const int fromchans, const int tochans)
             }
         }
     }
+}
+
+/* writes the scalar math for one frame, at src[0] and dst[0]. */
+static void write_frame(const int fromchans, const int tochans, const int backwards)
+{
+    const float *cvtmatrix = channel_conversion_matrix[fromchans-1][tochans-1];
+    int input_channel_used[NUM_CHANNELS];
+    int i, j;
+
+    count_input_channel_uses(fromchans, tochans, input_channel_used);
+
+    for (i = 0; i < fromchans; i++) {
+        if (input_channel_used[i] > 1) {  /* don't read it from src more than once. */
+            printf("        const float src%s = src[%d];\n", channel_names[fromchans-1][i], i);
+        }
+    }
+
+    for (j = backwards ? (tochans - 1) : 0; backwards ? (j >= 0) : (j < tochans); j += backwards ? -1 : 1) {
+        const float *fptr = cvtmatrix + (fromchans * j);
+        int has_input = 0;
+        printf("        dst[%d] /* %s */ =", j, channel_names[tochans-1][j]);
+        for (i = backwards ? (fromchans - 1) : 0; backwards ? (i >= 0) : (i < fromchans); i += backwards ? -1 : 1) {
+            const float coefficient = fptr[i];
+            char srcname[32];
+            if (coefficient == 0.0f) {
+                continue;
+            } else if (input_channel_used[i] > 1) {
+                snprintf(srcname, sizeof (srcname), "src%s", channel_names[fromchans-1][i]);
+            } else {
+                snprintf(srcname, sizeof (srcname), "src[%d]", i);
+            }
+
+            if (has_input) {
+                printf(" +");
+            }
+
+            has_input = 1;
+
+            if (coefficient == 1.0f) {
+                printf(" %s", srcname);
+            } else {
+                printf(" (%s * %.9ff)", srcname, coefficient);
+            }
+        }
+
+        if (!has_input) {
+            printf(" 0.0f");
+        }
+
+        printf(";\n");
+    }
+}
+
+static void write_len_update(const int fromchans, const int tochans)
+{
+    if ((fromchans > 1) && (tochans > 1)) {
+        printf("    cvt->len_cvt = (cvt->len_cvt / %d) * %d;\n", fromchans, tochans);
+    } else if (tochans == 1) {
+        printf("    cvt->len_cvt = cvt->len_cvt / %d;\n", fromchans);
+    } else /* if (fromchans == 1) */ {
+        printf("    cvt->len_cvt = cvt->len_cvt * %d;\n", tochans);
+    }
+
+    printf("    if (cvt->filters[++cvt->filter_index]) {\n"
+           "        cvt->filters[cvt->filter_index] (cvt, format);\n"
+           "    }\n"
+           "}\n\n");
+}
+
+static void write_converter(const int fromchans, const int tochans)
+{
+    const char *fromstr = layout_names[fromchans-1];
+    const char *tostr = layout_names[tochans-1];
+    const int convert_backwards = (tochans > fromchans);
+
+    if (tochans == fromchans) {
+        return;  /* nothing to convert, don't generate a converter. */
+    }
 
     printf("static void SDLCALL\n"
            "SDL_Convert%sTo%s(SDL_AudioCVT *cvt, SDL_AudioFormat format)\n"
@@ -282,116 +351,277 @@ static void write_converter(const int fromchans, const int tochans)
     if (convert_backwards) {
         printf("    /* convert backwards, since output is growing in-place. */\n");
         printf("    for (i = cvt->len_cvt / (sizeof (float) * %d); i; i--, src -= %d, dst -= %d) {\n", fromchans, fromchans, tochans);
-        fptr = cvtmatrix;
-        for (i = 0; i < fromchans; i++) {
-            if (input_channel_used[i] > 1) {  /* don't read it from src more than once. */
-                printf("        const float src%s = src[%d];\n", channel_names[fromchans-1][i], i);
-            }
-        }
+    } else {
+        printf("    for (i = cvt->len_cvt / (sizeof (float) * %d); i; i--, src += %d, dst += %d) {\n", fromchans, fromchans, tochans);
+    }
+    write_frame(fromchans, tochans, convert_backwards);
+    printf("    }\n\n");
 
-        for (j = tochans - 1; j >= 0; j--) {
-            int has_input = 0;
-            fptr = cvtmatrix + (fromchans * j);
-            printf("        dst[%d] /* %s */ =", j, channel_names[tochans-1][j]);
-            for (i = fromchans - 1; i >= 0; i--) {
-                const float coefficient = fptr[i];
-                char srcname[32];
-                if (coefficient == 0.0f) {
-                    continue;
-                } else if (input_channel_used[i] > 1) {
-                    snprintf(srcname, sizeof (srcname), "src%s", channel_names[fromchans-1][i]);
-                } else {
-                    snprintf(srcname, sizeof (srcname), "src[%d]", i);
-                }
+    write_len_update(fromchans, tochans);
+}
 
-                if (has_input) {
-                    printf(" +");
-                }
 
-                has_input = 1;
+/* The SIMD converters treat the conversion as a matrix multiply over a
+   block of frames: rows of up to four channels are transposed so each
+   register holds one channel across the whole block, every output channel
+   is a weighted sum of those registers, and the results are transposed
+   back into frames. Each row is loaded and stored by channel count, so a
+   block never reads or writes outside of its own frames, and blocks are
+   walked in the same direction as the scalar code, so they're safe to run
+   in-place. Leftover frames go through the scalar math. */
+typedef struct SimdTarget
+{
+    const char *name;       /* function suffix and table name */
+    const char *guard;      /* preprocessor condition this code builds under */
+    const char *targeting;  /* attribute for runtime-selected instruction sets */
+    const char *vectype;
+    int block_frames;       /* frames per block; each row holds block_frames / 4 frames */
+    const char *load_row;   /* args: offset(s), count */
+    const char *store_row;  /* args: offset(s), value, count */
+    const char *load_block;
+    const char *store_block;
+    const char *transpose;
+    const char *mul;        /* args: vector, coefficient */
+    const char *add;
+    const char *zero;
+} SimdTarget;
+
+static const SimdTarget simd_targets[] = {
+    {
+        "SSE", "HAVE_SSE_INTRINSICS", "", "__m128", 4,
+        "SDL_LoadChannels_SSE(%s, %d)", "SDL_StoreChannels_SSE(%s, %s, %d)",
+        "_mm_loadu_ps(%s)", "_mm_storeu_ps(%s, %s)", "_MM_TRANSPOSE4_PS",
+        "_mm_mul_ps(%s, _mm_set1_ps(%.9ff))", "_mm_add_ps(%s, %s)", "_mm_setzero_ps()"
+    },
+    {
+        "AVX", "HAVE_AVX_INTRINSICS", " SDL_TARGETING(\"avx\")", "__m256", 8,
+        "SDL_LoadChannels_AVX(%s, %s, %d)", "SDL_StoreChannels_AVX(%s, %s, %s, %d)",
+        "_mm256_loadu_ps(%s)", "_mm256_storeu_ps(%s, %s)", "SDL_TRANSPOSE4_AVX",
+        "_mm256_mul_ps(%s, _mm256_set1_ps(%.9ff))", "_mm256_add_ps(%s, %s)", "_mm256_setzero_ps()"
+    },
+    {
+        "NEON", "HAVE_NEON_INTRINSICS", "", "float32x4_t", 4,
+        "SDL_LoadChannels_NEON(%s, %d)", "SDL_StoreChannels_NEON(%s, %s, %d)",
+        "vld1q_f32(%s)", "vst1q_f32(%s, %s)", "SDL_TRANSPOSE4_NEON",
+        "vmulq_n_f32(%s, %.9ff)", "vaddq_f32(%s, %s)", "vdupq_n_f32(0.0f)"
+    }
+};
+
+/* "src + 4", "src - 18", "src" ... */
+static char *pointer_offset(const char *ptr, const int offset)
+{
+    static char retval[4][32];
+    static int idx = 0;
+    char *str = retval[(idx++) & 3];
+    if (offset == 0) {
+        snprintf(str, 32, "%s", ptr);
+    } else {
+        snprintf(str, 32, "%s %c %d", ptr, (offset < 0) ? '-' : '+', (offset < 0) ? -offset : offset);
+    }
+    return str;
+}
 
-                if (coefficient == 1.0f) {
-                    printf(" %s", srcname);
-                } else {
-                    printf(" (%s * %.9ff)", srcname, coefficient);
-                }
-            }
+/* SDL_audiocvt.c has hand-written versions of these, so we use those instead. */
+static int is_hand_written(const SimdTarget *target, const int fromchans, const int tochans)
+{
+    return (strcmp(target->name, "SSE") == 0) && (fromchans == 1) && (tochans == 2);
+}
 
-            if (!has_input) {
-                printf(" 0.0f");
-            }
+static void write_simd_converter(const SimdTarget *target, const int fromchans, const int tochans)
+{
+    const char *fromstr = layout_names[fromchans-1];
+    const char *tostr = layout_names[tochans-1];
+    const float *cvtmatrix = channel_conversion_matrix[fromchans-1][tochans-1];
+    const int convert_backwards = (tochans > fromchans);
+    const int block = target->block_frames;
+    const int rows = 4;  /* rows per transpose */
+    const int halves = block / rows;  /* frames per row */
+    /* in-block offsets are relative to the first frame going forwards, the last frame going backwards. */
+    const int first_frame = convert_backwards ? -(block - 1) : 0;
+    const int ingroups = (fromchans + 3) / 4;
+    const int outgroups = (tochans + 3) / 4;
+    int input_channel_used[NUM_CHANNELS];
+    int i, j, g, k;
 
-            printf(";\n");
-        }
+    if (tochans == fromchans) {
+        return;  /* nothing to convert, don't generate a converter. */
+    } else if (is_hand_written(target, fromchans, tochans)) {
+        return;
+    }
 
-        printf("    }\n");
+    count_input_channel_uses(fromchans, tochans, input_channel_used);
+
+    printf("static void SDLCALL%s\n"
+           "SDL_Convert%sTo%s_%s(SDL_AudioCVT *cvt, SDL_AudioFormat format)\n"
+           "{\n", target->targeting, remove_dots(fromstr), remove_dots(tostr), target->name);
+
+    if (convert_backwards) {  /* must convert backwards when growing the output in-place. */
+        printf("    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / %d) * %d))) - %d;\n", fromchans, tochans, tochans);
+        printf("    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - %d;\n", fromchans);
     } else {
-        printf("    for (i = cvt->len_cvt / (sizeof (float) * %d); i; i--, src += %d, dst += %d) {\n", fromchans, fromchans, tochans);
+        printf("    float *dst = (float *) cvt->buf;\n");
+        printf("    const float *src = dst;\n");
+    }
 
-        fptr = cvtmatrix;
-        for (i = 0; i < fromchans; i++) {
-            if (input_channel_used[i] > 1) {  /* don't read it from src more than once. */
-                printf("        const float src%s = src[%d];\n", channel_names[fromchans-1][i], i);
+    printf("    int i;\n"
+           "\n"
+           "    LOG_DEBUG_CONVERT(\"%s\", \"%s (using %s)\");\n"
+           "    SDL_assert(format == AUDIO_F32SYS);\n"
+           "\n", lowercase(fromstr), lowercase(tostr), target->name);
+
+    if (convert_backwards) {
+        printf("    /* convert backwards, since output is growing in-place. */\n");
+        printf("    for (i = cvt->len_cvt / (sizeof (float) * %d); i >= %d; i -= %d, src -= %d, dst -= %d) {\n", fromchans, block, block, block * fromchans, block * tochans);
+    } else {
+        printf("    for (i = cvt->len_cvt / (sizeof (float) * %d); i >= %d; i -= %d, src += %d, dst += %d) {\n", fromchans, block, block, block * fromchans, block * tochans);
+    }
+
+    printf("        %s in[%d], out[%d];\n", target->vectype, (fromchans == 1) ? 1 : (ingroups * rows), (tochans == 1) ? 1 : (outgroups * rows));
+    if (fromchans == 1) {
+        printf("        in[0] = ");
+        printf(target->load_block, pointer_offset("src", first_frame));
+        printf(";\n");
+    }
+    for (g = 0; (fromchans > 1) && (g < ingroups); g++) {
+        const int count = ((g * 4) + 4 <= fromchans) ? 4 : (fromchans % 4);
+        int used = 0;
+        for (i = g * 4; i < (g * 4) + count; i++) {
+            used += input_channel_used[i];
+        }
+        if (!used) {
+            continue;  /* nothing reads this group, don't load it. */
+        }
+        for (k = 0; k < rows; k++) {
+            printf("        in[%d] = ", (g * rows) + k);
+            if (halves == 1) {
+                printf(target->load_row, pointer_offset("src", ((first_frame + k) * fromchans) + (g * 4)), count);
+            } else {
+                printf(target->load_row, pointer_offset("src", ((first_frame + k) * fromchans) + (g * 4)),
+                       pointer_offset("src", ((first_frame + k + rows) * fromchans) + (g * 4)), count);
             }
+            printf(";\n");
         }
+        printf("        %s(in[%d], in[%d], in[%d], in[%d]);\n", target->transpose, g * rows, (g * rows) + 1, (g * rows) + 2, (g * rows) + 3);
+    }
 
-        for (j = 0; j < tochans; j++) {
-            int has_input = 0;
-            fptr = cvtmatrix + (fromchans * j);
-            printf("        dst[%d] /* %s */ =", j, channel_names[tochans-1][j]);
-            for (i = 0; i < fromchans; i++) {
-                const float coefficient = fptr[i];
+    for (j = 0; j < tochans; j++) {
+        const float *fptr = cvtmatrix + (fromchans * j);
+        int has_input = 0;
+        for (i = 0; i < fromchans; i++) {
+            const float coefficient = fptr[i];
+            char term[128];
+            char accum[32];
+            if (coefficient == 0.0f) {
+                continue;
+            } else if (coefficient == 1.0f) {
+                snprintf(term, sizeof (term), "in[%d]", i);
+            } else {
                 char srcname[32];
-                if (coefficient == 0.0f) {
-                    continue;
-                } else if (input_channel_used[i] > 1) {
-                    snprintf(srcname, sizeof (srcname), "src%s", channel_names[fromchans-1][i]);
-                } else {
-                    snprintf(srcname, sizeof (srcname), "src[%d]", i);
-                }
+                snprintf(srcname, sizeof (srcname), "in[%d]", i);
+                snprintf(term, sizeof (term), target->mul, srcname, coefficient);
+            }
 
-                if (has_input) {
-                    printf(" +");
-                }
+            if (!has_input) {
+                printf("        out[%d] /* %s */ = %s;\n", j, channel_names[tochans-1][j], term);
+            } else {
+                snprintf(accum, sizeof (accum), "out[%d]", j);
+                printf("        out[%d] = ", j);
+                printf(target->add, accum, term);
+                printf(";\n");
+            }
+            has_input = 1;
+        }
 
-                has_input = 1;
+        if (!has_input) {
+            printf("        out[%d] /* %s */ = %s;\n", j, channel_names[tochans-1][j], target->zero);
+        }
+    }
 
-                if (coefficient == 1.0f) {
-                    printf(" %s", srcname);
-                } else {
-                    printf(" (%s * %.9ff)", srcname, coefficient);
-                }
+    if (tochans == 1) {
+        char value[32];
+        snprintf(value, sizeof (value), "out[0]");
+        printf("        ");
+        printf(target->store_block, pointer_offset("dst", first_frame), value);
+        printf(";\n");
+    } else {
+        if (tochans < outgroups * rows) {
+            printf("       ");
+            for (j = tochans; j < outgroups * rows; j++) {
+                printf(" out[%d] =", j);
             }
+            printf(" %s;  /* padding for the transpose. */\n", target->zero);
+        }
+    }
 
-            if (!has_input) {
-                printf(" 0.0f");
+    for (g = 0; (tochans > 1) && (g < outgroups); g++) {
+        const int count = ((g * 4) + 4 <= tochans) ? 4 : (tochans % 4);
+        int silent = 1;
+        for (j = g * 4; j < (g * 4) + count; j++) {
+            for (i = 0; i < fromchans; i++) {
+                if (cvtmatrix[(fromchans * j) + i] != 0.0f) {
+                    silent = 0;
+                }
+            }
+        }
+        if (!silent) {  /* all zeros are the same transposed, skip it. */
+            printf("        %s(out[%d], out[%d], out[%d], out[%d]);\n", target->transpose, g * rows, (g * rows) + 1, (g * rows) + 2, (g * rows) + 3);
+        }
+        for (k = 0; k < rows; k++) {
+            char value[32];
+            snprintf(value, sizeof (value), "out[%d]", (g * rows) + k);
+            printf("        ");
+            if (halves == 1) {
+                printf(target->store_row, pointer_offset("dst", ((first_frame + k) * tochans) + (g * 4)), value, count);
+            } else {
+                printf(target->store_row, pointer_offset("dst", ((first_frame + k) * tochans) + (g * 4)),
+                       pointer_offset("dst", ((first_frame + k + rows) * tochans) + (g * 4)), value, count);
             }
-
             printf(";\n");
         }
-        printf("    }\n");
     }
 
-    printf("\n");
+    printf("    }\n\n");
 
-    if ((fromchans > 1) && (tochans > 1)) {
-        printf("    cvt->len_cvt = (cvt->len_cvt / %d) * %d;\n", fromchans, tochans);
-    } else if (tochans == 1) {
-        printf("    cvt->len_cvt = cvt->len_cvt / %d;\n", fromchans);
-    } else /* if (fromchans == 1) */ {
-        printf("    cvt->len_cvt = cvt->len_cvt * %d;\n", tochans);
+    printf("    /* Finish off any leftovers with scalar operations. */\n");
+    if (convert_backwards) {
+        printf("    for (; i; i--, src -= %d, dst -= %d) {\n", fromchans, tochans);
+    } else {
+        printf("    for (; i; i--, src += %d, dst += %d) {\n", fromchans, tochans);
     }
+    write_frame(fromchans, tochans, convert_backwards);
+    printf("    }\n\n");
 
-    printf("    if (cvt->filters[++cvt->filter_index]) {\n"
-           "        cvt->filters[cvt->filter_index] (cvt, format);\n"
-           "    }\n"
-           "}\n\n");
+    write_len_update(fromchans, tochans);
 }
 
-int main(void)
+static void write_converter_table(const char *suffix)
 {
     int ini, outi;
 
+    printf("static const SDL_AudioFilter channel_converters%s[%d][%d] = {   /* [from][to] */\n", suffix, NUM_CHANNELS, NUM_CHANNELS);
+    for (ini = 1; ini <= NUM_CHANNELS; ini++) {
+        const char *comma = "";
+        printf("    {");
+        for (outi = 1; outi <= NUM_CHANNELS; outi++) {
+            const char *fromstr = layout_names[ini-1];
+            const char *tostr = layout_names[outi-1];
+            if (ini == outi) {
+                printf("%s NULL", comma);
+            } else {
+                printf("%s SDL_Convert%sTo%s%s", comma, remove_dots(fromstr), remove_dots(tostr), suffix);
+            }
+            comma = ",";
+        }
+        printf(" }%s\n", (ini == NUM_CHANNELS) ? "" : ",");
+    }
+
+    printf("};\n\n");
+}
+
+int main(void)
+{
+    int ini, outi, i;
+
     printf(
         "/*\n"
         "  Simple DirectMedia Layer\n"
@@ -424,24 +654,22 @@ int main(void)
         }
     }
 
-    printf("static const SDL_AudioFilter channel_converters[%d][%d] = {   /* [from][to] */\n", NUM_CHANNELS, NUM_CHANNELS);
-    for (ini = 1; ini <= NUM_CHANNELS; ini++) {
-        const char *comma = "";
-        printf("    {");
-        for (outi = 1; outi <= NUM_CHANNELS; outi++) {
-            const char *fromstr = layout_names[ini-1];
-            const char *tostr = layout_names[outi-1];
-            if (ini == outi) {
-                printf("%s NULL", comma);
-            } else {
-                printf("%s SDL_Convert%sTo%s", comma, remove_dots(fromstr), remove_dots(tostr));
+    write_converter_table("");
+
+    for (i = 0; i < (int) (sizeof (simd_targets) / sizeof (simd_targets[0])); i++) {
+        const SimdTarget *target = &simd_targets[i];
+        char suffix[16];
+        printf("#if %s\n\n", target->guard);
+        for (ini = 1; ini <= NUM_CHANNELS; ini++) {
+            for (outi = 1; outi <= NUM_CHANNELS; outi++) {
+                write_simd_converter(target, ini, outi);
             }
-            comma = ",";
         }
-        printf(" }%s\n", (ini == NUM_CHANNELS) ? "" : ",");
+        snprintf(suffix, sizeof (suffix), "_%s", target->name);
+        write_converter_table(suffix);
+        printf("#endif\n\n");
     }
 
-    printf("};\n\n");
     printf("/* vi: set ts=4 sw=4 expandtab: */\n\n");
 
     return 0;
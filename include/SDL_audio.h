@@ -722,6 +722,96 @@ extern DECLSPEC SDL_AudioStatus SDLCALL SDL_GetAudioStatus(void);
 extern DECLSPEC SDL_AudioStatus SDLCALL SDL_GetAudioDeviceStatus(SDL_AudioDeviceID dev);
 /* @} *//* Audio State */
 
+/**
+ *  \name Audio device statistics
+ *
+ *  Timing and buffer telemetry gathered by an audio device's thread.
+ */
+/* @{ */
+
+/**
+ * The number of histogram buckets in SDL_AudioTimingStats.
+ */
+#define SDL_AUDIO_STATS_BUCKETS 20
+
+/**
+ * Timing of one part of an audio device's processing loop.
+ *
+ * `histogram[i]` counts the measurements that took at least 2^i and less
+ * than 2^(i+1) microseconds. The first bucket also counts anything shorter
+ * than a microsecond, and the last bucket counts anything longer.
+ */
+typedef struct SDL_AudioTimingStats
+{
+    Uint64 count;       /**< Number of measurements */
+    Uint64 total_ns;    /**< Sum of all measurements, in nanoseconds */
+    Uint64 max_ns;      /**< Longest measurement, in nanoseconds */
+    Uint32 histogram[SDL_AUDIO_STATS_BUCKETS];  /**< Measurements by log2 of their microseconds */
+} SDL_AudioTimingStats;
+
+/**
+ * Telemetry for an opened audio device, as reported by
+ * SDL_GetAudioDeviceStats().
+ *
+ * The fill level is the number of bytes waiting between the app and the
+ * device: the SDL_QueueAudio()/SDL_DequeueAudio() queue if the device was
+ * opened without a callback, the buffers prepared ahead of the device with
+ * SDL_HINT_AUDIO_CALLBACK_LOOKAHEAD, or otherwise the data left over in the
+ * internal format conversion stream.
+ */
+typedef struct SDL_AudioDeviceStats
+{
+    Uint64 iterations;      /**< Buffers processed by the audio thread */
+    Uint32 underruns;       /**< Times a playback queue fed by SDL_QueueAudio(), or by SDL_HINT_AUDIO_CALLBACK_LOOKAHEAD, ran dry */
+    Uint32 late_buffers;    /**< Buffers whose callback and conversion took longer than the buffer plays */
+    Uint32 stalls;          /**< Times the device had no buffer to fill, so the thread slept for a buffer's duration instead */
+    Uint32 fill_bytes;      /**< Fill level after the latest buffer */
+    Uint32 fill_min_bytes;  /**< Lowest fill level seen */
+    Uint32 fill_max_bytes;  /**< Highest fill level seen */
+    SDL_AudioTimingStats callback;    /**< Time in the app's callback, or in the queue that replaces it */
+    SDL_AudioTimingStats conversion;  /**< Time converting between the callback's and the device's formats */
+    SDL_AudioTimingStats wait;        /**< Time handing buffers to the device and waiting on it */
+    Uint64 unpaused_frames; /**< Sample frames the audio thread went through while the device was unpaused */
+    Uint64 unpaused_ns;     /**< Wall clock time those frames took; their duration over this is the real-time factor, above 1 when the device runs faster than it plays (such as the disk driver's freewheel mode) */
+} SDL_AudioDeviceStats;
+
+/**
+ * Get the telemetry gathered by an audio device's thread.
+ *
+ * Every opened device keeps these statistics from the moment it starts,
+ * and they are cheap enough to leave running in production: watching the
+ * callback times against the buffer duration, the late buffer and underrun
+ * counts, and the fill levels is a good way to choose `spec.samples`.
+ *
+ * This function may be called from any thread; the values are a consistent
+ * snapshot.
+ *
+ * \param dev the ID of an audio device previously opened with
+ *            SDL_OpenAudioDevice()
+ * \param stats the structure to fill in
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_ResetAudioDeviceStats
+ */
+extern DECLSPEC int SDLCALL SDL_GetAudioDeviceStats(SDL_AudioDeviceID dev,
+                                                    SDL_AudioDeviceStats *stats);
+
+/**
+ * Reset the telemetry gathered by an audio device's thread.
+ *
+ * \param dev the ID of an audio device previously opened with
+ *            SDL_OpenAudioDevice()
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_GetAudioDeviceStats
+ */
+extern DECLSPEC void SDLCALL SDL_ResetAudioDeviceStats(SDL_AudioDeviceID dev);
+/* @} *//* Audio device statistics */
+
 /**
  *  \name Pause audio functions
  *
@@ -880,6 +970,60 @@ extern DECLSPEC SDL_AudioSpec *SDLCALL SDL_LoadWAV_RW(SDL_RWops * src,
 #define SDL_LoadWAV(file, spec, audio_buf, audio_len) \
     SDL_LoadWAV_RW(SDL_RWFromFile(file, "rb"),1, spec,audio_buf,audio_len)
 
+/**
+ * Load a WAVE from a data source without copying the audio data if possible.
+ *
+ * This works like SDL_LoadWAV_RW(), but for WAVE data that doesn't need to be
+ * decoded (8, 16 and 32-bit PCM, and 32-bit float), `audio_buf` points
+ * straight into the data chunk instead of a copy of it:
+ *
+ * - if `src` was created with SDL_RWFromMem() or SDL_RWFromConstMem(), the
+ *   memory buffer is borrowed; it must stay valid and unchanged until the
+ *   data is freed with SDL_FreeWAV().
+ * - if `src` was created with SDL_RWFromFile() or SDL_RWFromFP(), the file
+ *   is memory-mapped where the platform supports it, so only the parts of
+ *   the data that are actually used get read from disk. The file must not be
+ *   changed until the data is freed with SDL_FreeWAV().
+ *
+ * In all other cases the data is loaded the same way as with
+ * SDL_LoadWAV_RW(). Either way, the data must be treated as read-only and
+ * freed with SDL_FreeWAV(), which knows whether to unmap it, leave it to
+ * its owner, or free it.
+ *
+ * \param src The data source for the WAVE data
+ * \param freesrc If non-zero, SDL will _always_ free the data source; a
+ *                mapped file stays mapped until SDL_FreeWAV() is called
+ * \param spec An SDL_AudioSpec that will be filled in with the wave file's
+ *             format details
+ * \param audio_buf A pointer filled with the audio data, which must not be
+ *                  modified
+ * \param audio_len A pointer filled with the length of the audio data buffer
+ *                  in bytes
+ * \returns This function, if successfully called, returns `spec`, which will
+ *          be filled with the audio data format of the wave source data.
+ *          When the application is done with the data returned in
+ *          `audio_buf`, it should call SDL_FreeWAV() to dispose of it.
+ *          This function returns NULL on failure; call SDL_GetError() for
+ *          more information.
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_FreeWAV
+ * \sa SDL_LoadWAV_RW
+ */
+extern DECLSPEC SDL_AudioSpec *SDLCALL SDL_LoadWAVMapped_RW(SDL_RWops * src,
+                                                            int freesrc,
+                                                            SDL_AudioSpec * spec,
+                                                            Uint8 ** audio_buf,
+                                                            Uint32 * audio_len);
+
+/**
+ *  Loads a WAV from a file without copying the audio data if possible.
+ *  Compatibility convenience function.
+ */
+#define SDL_LoadWAVMapped(file, spec, audio_buf, audio_len) \
+    SDL_LoadWAVMapped_RW(SDL_RWFromFile(file, "rb"),1, spec,audio_buf,audio_len)
+
 /**
  * Free data previously allocated with SDL_LoadWAV() or SDL_LoadWAV_RW().
  *
@@ -887,16 +1031,146 @@ extern DECLSPEC SDL_AudioSpec *SDLCALL SDL_LoadWAV_RW(SDL_RWops * src,
  * its data can eventually be freed with SDL_FreeWAV(). It is safe to call
  * this function with a NULL pointer.
  *
- * \param audio_buf a pointer to the buffer created by SDL_LoadWAV() or
- *                  SDL_LoadWAV_RW()
+ * Data returned by SDL_LoadWAVMapped_RW() is also released with this
+ * function, which unmaps or frees it as needed.
+ *
+ * \param audio_buf a pointer to the buffer created by SDL_LoadWAV(),
+ *                  SDL_LoadWAV_RW() or SDL_LoadWAVMapped_RW()
  *
  * \since This function is available since SDL 2.0.0.
  *
  * \sa SDL_LoadWAV
  * \sa SDL_LoadWAV_RW
+ * \sa SDL_LoadWAVMapped_RW
  */
 extern DECLSPEC void SDLCALL SDL_FreeWAV(Uint8 * audio_buf);
 
+/**
+ * An incremental WAVE decoder, created with SDL_OpenWAVDecoder_RW().
+ */
+struct _SDL_WAVDecoder;
+typedef struct _SDL_WAVDecoder SDL_WAVDecoder;
+
+/**
+ * Open a WAVE file for incremental decoding.
+ *
+ * Unlike SDL_LoadWAV_RW(), this only parses the headers of the WAVE file.
+ * The audio data stays in the data source and is decoded on demand with
+ * SDL_WAVDecoderRead(), one ADPCM block or a run of sample frames at a time,
+ * so long files can be played without decoding them into memory up front.
+ * The data source must stay valid and seekable until the decoder is closed.
+ *
+ * The supported encodings, the SDL_AudioSpec and the decoded data are the
+ * same as with SDL_LoadWAV_RW(), and the same hints apply.
+ *
+ * \param src The data source for the WAVE data
+ * \param freesrc If non-zero, SDL will _always_ free the data source, even
+ *                on failure
+ * \param spec An SDL_AudioSpec that will be filled in with the format of the
+ *             decoded audio data
+ * \returns a new SDL_WAVDecoder on success or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_CloseWAVDecoder
+ * \sa SDL_LoadWAV_RW
+ * \sa SDL_WAVDecoderRead
+ * \sa SDL_WAVDecoderSeek
+ */
+extern DECLSPEC SDL_WAVDecoder *SDLCALL SDL_OpenWAVDecoder_RW(SDL_RWops * src,
+                                                              int freesrc,
+                                                              SDL_AudioSpec * spec);
+
+/**
+ * Open a WAVE file for incremental decoding from a named file.
+ *
+ * This is a convenience macro that calls SDL_OpenWAVDecoder_RW() with an
+ * SDL_RWops that is freed with the decoder.
+ */
+#define SDL_OpenWAVDecoder(file, spec) \
+    SDL_OpenWAVDecoder_RW(SDL_RWFromFile(file, "rb"),1, spec)
+
+/**
+ * Decode the next sample frames of a WAVE file.
+ *
+ * Only whole sample frames are decoded, so fewer than `len` bytes may be
+ * returned even before the end of the data.
+ *
+ * \param decoder the decoder returned by SDL_OpenWAVDecoder_RW()
+ * \param buf a buffer to fill with decoded audio data, in the format
+ *            reported by SDL_OpenWAVDecoder_RW()
+ * \param len the maximum number of bytes to fill
+ * \returns the number of bytes written to `buf`, 0 at the end of the data,
+ *          or -1 on error; call SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_OpenWAVDecoder_RW
+ */
+extern DECLSPEC int SDLCALL SDL_WAVDecoderRead(SDL_WAVDecoder * decoder,
+                                               void *buf, int len);
+
+/**
+ * Move the decoding position of a WAVE decoder to a sample frame.
+ *
+ * For ADPCM data, only the block containing the sample frame is decoded on
+ * the next read.
+ *
+ * \param decoder the decoder returned by SDL_OpenWAVDecoder_RW()
+ * \param frame the sample frame to decode next, between 0 and the value
+ *              returned by SDL_WAVDecoderFrames()
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_WAVDecoderTell
+ */
+extern DECLSPEC int SDLCALL SDL_WAVDecoderSeek(SDL_WAVDecoder * decoder,
+                                               Sint64 frame);
+
+/**
+ * Get the sample frame a WAVE decoder will decode next.
+ *
+ * \param decoder the decoder returned by SDL_OpenWAVDecoder_RW()
+ * \returns the sample frame position or a negative error code on failure;
+ *          call SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_WAVDecoderSeek
+ */
+extern DECLSPEC Sint64 SDLCALL SDL_WAVDecoderTell(SDL_WAVDecoder * decoder);
+
+/**
+ * Get the number of sample frames a WAVE decoder can decode.
+ *
+ * This can shrink while decoding if the data turns out to be truncated.
+ *
+ * \param decoder the decoder returned by SDL_OpenWAVDecoder_RW()
+ * \returns the number of sample frames or a negative error code on failure;
+ *          call SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.24.0.
+ */
+extern DECLSPEC Sint64 SDLCALL SDL_WAVDecoderFrames(SDL_WAVDecoder * decoder);
+
+/**
+ * Close a WAVE decoder.
+ *
+ * If the decoder was opened with `freesrc` set, the data source is freed.
+ * Otherwise it is left at the end of the WAVE file. It is safe to call this
+ * function with a NULL pointer.
+ *
+ * \param decoder the decoder returned by SDL_OpenWAVDecoder_RW()
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_OpenWAVDecoder_RW
+ */
+extern DECLSPEC void SDLCALL SDL_CloseWAVDecoder(SDL_WAVDecoder * decoder);
+
 /**
  * Initialize an SDL_AudioCVT structure for conversion.
  *
@@ -977,6 +1251,41 @@ extern DECLSPEC int SDLCALL SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
  */
 extern DECLSPEC int SDLCALL SDL_ConvertAudio(SDL_AudioCVT * cvt);
 
+/**
+ * The companding laws understood by SDL_DecodeG711().
+ */
+typedef enum
+{
+    SDL_G711_ULAW,  /**< ITU-T G.711 mu-law, as used in North America and Japan */
+    SDL_G711_ALAW   /**< ITU-T G.711 A-law, as used in Europe */
+} SDL_G711Law;
+
+/**
+ * Expand G.711 companded audio to 16-bit signed samples.
+ *
+ * Each byte of `src` becomes one AUDIO_S16SYS sample in `dst`. This is the
+ * same decoder SDL_LoadWAV_RW() uses for mu-law and A-law WAVE files, and is
+ * meant for raw G.711 streams (telephony, RTP payloads, .au files) that
+ * should be fed to an SDL_AudioStream or an audio device as AUDIO_S16SYS.
+ *
+ * The conversion may be done in place: `dst` may point to the same memory as
+ * `src`, as long as that buffer is `samples * 2` bytes long. Otherwise the
+ * two buffers must not overlap.
+ *
+ * \param law the companding law of the source data.
+ * \param src the companded samples, one byte each.
+ * \param dst a buffer with room for `samples` 16-bit samples.
+ * \param samples the number of samples to expand.
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_AudioStreamPut
+ */
+extern DECLSPEC int SDLCALL SDL_DecodeG711(SDL_G711Law law, const void *src,
+                                           Sint16 *dst, int samples);
+
 /* SDL_AudioStream is a new audio conversion interface.
    The benefits vs SDL_AudioCVT:
     - it can handle resampling data in chunks without generating
@@ -1015,6 +1324,75 @@ extern DECLSPEC SDL_AudioStream * SDLCALL SDL_NewAudioStream(const SDL_AudioForm
                                            const Uint8 dst_channels,
                                            const int dst_rate);
 
+/**
+ * The resampling filters an SDL_AudioStream can use, from cheapest to best.
+ *
+ * \sa SDL_AudioStreamSetResampleQuality
+ */
+typedef enum
+{
+    SDL_AUDIO_RESAMPLE_NEAREST,   /**< Repeat or drop the nearest sample frame; aliases badly. */
+    SDL_AUDIO_RESAMPLE_LINEAR,    /**< Linear interpolation between two frames. */
+    SDL_AUDIO_RESAMPLE_CUBIC,     /**< Catmull-Rom cubic interpolation over four frames. */
+    SDL_AUDIO_RESAMPLE_DEFAULT,   /**< SDL's built-in windowed sinc filter. */
+    SDL_AUDIO_RESAMPLE_BEST       /**< A longer Kaiser-windowed sinc that also low-passes when downsampling. */
+} SDL_AudioResampleQuality;
+
+/**
+ * Choose the filter an audio stream resamples with.
+ *
+ * Cheaper filters trade fidelity for CPU time; streams start out with
+ * SDL_AUDIO_RESAMPLE_DEFAULT. This can be changed at any time, and takes
+ * effect with the next data put into the stream. Streams that don't change
+ * the sample rate accept any quality and ignore it.
+ *
+ * If SDL was built with libsamplerate and SDL_HINT_AUDIO_RESAMPLING_MODE
+ * picked it for this stream, calling this switches the stream over to SDL's
+ * own resampler.
+ *
+ * \param stream the stream to change
+ * \param quality one of the SDL_AudioResampleQuality values
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_NewAudioStream
+ * \sa SDL_AudioStreamPut
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamSetResampleQuality(SDL_AudioStream *stream, SDL_AudioResampleQuality quality);
+
+/**
+ * Mix an audio stream's channels through a custom matrix of gains.
+ *
+ * By default, a stream converts between channel layouts with SDL's built-in
+ * upmix and downmix tables. This replaces those with your own matrix, for
+ * example to feed a custom speaker rig or to apply per-channel gains,
+ * without a separate pass over the data.
+ *
+ * The matrix has one row per output channel and one column per input
+ * channel, so it holds `dst_channels * src_channels` floats, and output
+ * channel `o` of each sample frame is the sum of `matrix[o * src_channels +
+ * i]` times input channel `i`. This works even if the stream has the same
+ * number of channels on both sides. The matrix is copied, so it doesn't
+ * need to stay around after this call.
+ *
+ * The new matrix applies to data put into the stream after this call; data
+ * that has already been converted is left alone. Pass NULL to go back to
+ * SDL's built-in conversion.
+ *
+ * \param stream the stream to change
+ * \param matrix `dst_channels * src_channels` gains, or NULL
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_NewAudioStream
+ * \sa SDL_AudioStreamPut
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamSetChannelMatrix(SDL_AudioStream *stream, const float *matrix);
+
 /**
  * Add data to be converted/resampled to the stream.
  *
@@ -1053,6 +1431,87 @@ extern DECLSPEC int SDLCALL SDL_AudioStreamPut(SDL_AudioStream *stream, const vo
  */
 extern DECLSPEC int SDLCALL SDL_AudioStreamGet(SDL_AudioStream *stream, void *buf, int len);
 
+/**
+ * Reserve space in the stream to write new audio data into.
+ *
+ * This is SDL_AudioStreamPut() in two steps, so the data can be generated
+ * in place instead of copied in. Write up to the returned number of bytes to
+ * `*buf`, then call SDL_AudioStreamEndPut() with how many you wrote.
+ *
+ * When the stream doesn't convert or resample anything, the buffer is the
+ * stream's own output queue and the data never gets copied. Otherwise it is
+ * a scratch buffer that SDL_AudioStreamEndPut() converts from.
+ *
+ * The stream may hand out less space than requested (but always at least one
+ * sample frame); call this again to write more. Don't use the stream for
+ * anything else until you call SDL_AudioStreamEndPut().
+ *
+ * \param stream The stream the audio data is being added to
+ * \param len The number of bytes you would like to write
+ * \param buf Filled in with a pointer to write the audio data to
+ * \returns the number of bytes you may write, or -1 on error.
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_AudioStreamEndPut
+ * \sa SDL_AudioStreamPut
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamBeginPut(SDL_AudioStream *stream, int len, void **buf);
+
+/**
+ * Finish adding audio data written by SDL_AudioStreamBeginPut().
+ *
+ * \param stream The stream the audio data is being added to
+ * \param len The number of bytes written, which may be zero, up to the
+ *            amount SDL_AudioStreamBeginPut() returned
+ * \returns 0 on success, or -1 on error.
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_AudioStreamBeginPut
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamEndPut(SDL_AudioStream *stream, int len);
+
+/**
+ * Look at converted/resampled data in the stream without copying it out.
+ *
+ * This sets `*buf` to the oldest contiguous piece of converted data in the
+ * stream and returns its size, which is always whole sample frames. There may
+ * be more data available after it; call SDL_AudioStreamEndGet() to consume
+ * what you used, then call this again for the next piece.
+ *
+ * The data stays valid until the next call that takes data out of or clears
+ * the stream.
+ *
+ * \param stream The stream the audio is being requested from
+ * \param buf Filled in with a pointer to the audio data, or NULL if the
+ *            stream has no data available
+ * \returns the number of bytes at `*buf`, or -1 on error.
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_AudioStreamEndGet
+ * \sa SDL_AudioStreamGet
+ * \sa SDL_AudioStreamAvailable
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamBeginGet(SDL_AudioStream *stream, const void **buf);
+
+/**
+ * Consume converted/resampled data from the stream without copying it.
+ *
+ * This is SDL_AudioStreamGet() without the copy, to use after you're done
+ * with the data from SDL_AudioStreamBeginGet().
+ *
+ * \param stream The stream the audio is being consumed from
+ * \param len The number of bytes to consume
+ * \returns the number of bytes consumed, or -1 on error
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_AudioStreamBeginGet
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamEndGet(SDL_AudioStream *stream, int len);
+
 /**
  * Get the number of converted/resampled bytes available.
  *
@@ -1180,6 +1639,51 @@ extern DECLSPEC void SDLCALL SDL_MixAudioFormat(Uint8 * dst,
                                                 SDL_AudioFormat format,
                                                 Uint32 len, int volume);
 
+/**
+ * One buffer of audio to mix with SDL_MixAudioSources().
+ *
+ * \sa SDL_MixAudioSources
+ */
+typedef struct SDL_AudioMixSource
+{
+    const Uint8 *src;   /**< `len` bytes of audio in the destination's format; NULL is skipped */
+    int volume;         /**< 0 to SDL_MIX_MAXVOLUME; values outside that are clamped */
+    float pan;          /**< stereo only: -1.0f plays only the left channel, 1.0f only the right, 0.0f both as-is */
+} SDL_AudioMixSource;
+
+/**
+ * Mix many audio buffers into one in a single pass.
+ *
+ * This does the same as calling SDL_MixAudioFormat() for each source, but
+ * works through `dst` a piece at a time, adding every source to that piece
+ * before moving on, so `dst` is only read and written once no matter how
+ * many sources there are.
+ *
+ * For AUDIO_S16SYS and AUDIO_F32SYS, sources are added up with more range
+ * than the samples have and clipped once at the end, instead of after every
+ * source, so loud sources that cancel out don't distort. These formats also
+ * support `pan` when `channels` is 2. Other formats are mixed one source at a
+ * time with SDL_MixAudioFormat() and ignore `pan`.
+ *
+ * \param dst the destination for the mixed audio
+ * \param sources an array of `num_sources` sources to mix into `dst`
+ * \param num_sources the number of elements in `sources`
+ * \param format the SDL_AudioFormat of `dst` and every source
+ * \param channels the number of interleaved channels in the audio
+ * \param len the length of `dst` and each source buffer in bytes
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_MixAudioFormat
+ */
+extern DECLSPEC int SDLCALL SDL_MixAudioSources(Uint8 * dst,
+                                                const SDL_AudioMixSource * sources,
+                                                int num_sources,
+                                                SDL_AudioFormat format,
+                                                Uint8 channels, Uint32 len);
+
 /**
  * Queue more audio on non-callback devices.
  *
@@ -1344,6 +1848,59 @@ extern DECLSPEC Uint32 SDLCALL SDL_GetQueuedAudioSize(SDL_AudioDeviceID dev);
  */
 extern DECLSPEC void SDLCALL SDL_ClearQueuedAudio(SDL_AudioDeviceID dev);
 
+/**
+ * Bind an audio stream to a playback device, so the device plays from it.
+ *
+ * Each time the device needs more audio, SDL runs the device's callback (or
+ * drains its SDL_QueueAudio() queue) as usual, then pulls one buffer's worth
+ * of data from every bound stream and mixes it in. This lets several sounds
+ * at different formats and rates share one device: each stream converts and
+ * resamples its own data, and there is a single mixing pass per buffer. A
+ * stream that doesn't have enough data available contributes what it has
+ * and is silent for the rest of that buffer.
+ *
+ * The stream's output format, channels and frequency must match the spec
+ * the device was opened with (the one the callback sees), and a stream can
+ * only be bound to one device at a time. Audio is mixed at full volume, in
+ * one pass over the buffer with SDL_MixAudioSources().
+ *
+ * This works with every backend, including those that call the callback from
+ * a thread of their own, and with SDL_HINT_AUDIO_CALLBACK_LOOKAHEAD, where
+ * bound streams are mixed on the lookahead thread right after the callback.
+ *
+ * The device's audio thread reads from bound streams, so you must wrap any
+ * other use of a bound stream, such as SDL_AudioStreamPut(), in
+ * SDL_LockAudioDevice() and SDL_UnlockAudioDevice().
+ *
+ * Streams are unbound when the device is closed or the stream is freed.
+ *
+ * \param dev the playback device to bind the stream to
+ * \param stream the stream to bind
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_NewAudioStream
+ * \sa SDL_UnbindAudioStream
+ */
+extern DECLSPEC int SDLCALL SDL_BindAudioStream(SDL_AudioDeviceID dev, SDL_AudioStream *stream);
+
+/**
+ * Unbind an audio stream from the device it is bound to.
+ *
+ * Once this returns, the device's audio thread no longer touches the stream.
+ * Any data still in the stream stays there. It is safe to call this on a
+ * stream that isn't bound.
+ *
+ * \param stream the stream to unbind
+ *
+ * \since This function is available since SDL 2.24.0.
+ *
+ * \sa SDL_BindAudioStream
+ */
+extern DECLSPEC void SDLCALL SDL_UnbindAudioStream(SDL_AudioStream *stream);
+
 
 /**
  *  \name Audio lock functions
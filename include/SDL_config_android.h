@@ -133,6 +133,7 @@
 #define HAVE_SETJMP 1
 #define HAVE_NANOSLEEP  1
 #define HAVE_SYSCONF    1
+#define HAVE_MMAP       1
 #define HAVE_CLOCK_GETTIME  1
 
 #ifdef __LP64__
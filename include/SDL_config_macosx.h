@@ -137,6 +137,7 @@
 #define HAVE_SETJMP 1
 #define HAVE_NANOSLEEP  1
 #define HAVE_SYSCONF    1
+#define HAVE_MMAP       1
 #define HAVE_SYSCTLBYNAME 1
 
 #if defined(__has_include) && (defined(__i386__) || defined(__x86_64))
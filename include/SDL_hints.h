@@ -193,6 +193,31 @@ extern "C" {
  */
 #define SDL_HINT_APPLE_TV_REMOTE_ALLOW_ROTATION "SDL_APPLE_TV_REMOTE_ALLOW_ROTATION"
 
+/**
+ *  \brief  A variable controlling how many buffers ahead of a playback device the audio callback runs.
+ *
+ *  By default the audio callback runs on the device's thread, just before each
+ *  buffer is handed to the device, so the time spent in the callback adds to
+ *  the latency of every buffer and a single slow callback makes the device
+ *  run dry.
+ *
+ *  Setting this to a number N runs the callback on a thread of its own, which
+ *  keeps up to N buffers prepared while the device plays. The device thread
+ *  only copies finished buffers, so a callback that occasionally takes longer
+ *  than a buffer's duration no longer glitches, at the cost of N buffers of
+ *  extra latency. This makes very small buffers, such as 64 sample frames,
+ *  usable. SDL_LockAudioDevice() and SDL_PauseAudioDevice() still
+ *  synchronize with the callback.
+ *
+ *  This hint only applies to playback devices opened with a callback, and is
+ *  checked when the device is opened.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Run the callback on the device's thread (default)
+ *    "1"-"16"  - Prepare up to this many buffers ahead on a callback thread
+ */
+#define SDL_HINT_AUDIO_CALLBACK_LOOKAHEAD "SDL_AUDIO_CALLBACK_LOOKAHEAD"
+
 /**
  *  \brief  A variable controlling the audio category on iOS and Mac OS X
  *
@@ -1287,6 +1312,48 @@ extern "C" {
  */
 #define SDL_HINT_RENDER_SCALE_QUALITY       "SDL_RENDER_SCALE_QUALITY"
 
+/**
+ *  \brief  A variable controlling how many threads the software renderer draws with.
+ *
+ *  By default the software renderer runs every queued command on the thread
+ *  that flushes the queue, one command at a time. With more than one thread,
+ *  the target is split into tiles and the threads draw the tiles in parallel,
+ *  each running the commands that touch it in order. The result is identical
+ *  to drawing on one thread.
+ *
+ *  Clears, points, filled rectangles, unscaled copies and geometry are drawn
+ *  in tiles; lines, scaled and rotated copies are drawn on the calling thread
+ *  between the tiled runs. Tiles pay off most when many commands are drawn at
+ *  once, so also set SDL_HINT_RENDER_BATCHING to "1" for renderers made with
+ *  SDL_CreateSoftwareRenderer(), which otherwise draw each command as it is
+ *  made.
+ *
+ *  This variable can be set to the following values:
+ *    "0" or "1" - Draw on the calling thread (default)
+ *    "2"-"64"   - Draw in tiles with this many threads, counting the calling one
+ *
+ *  This hint is checked each time the render queue is flushed.
+ */
+#define SDL_HINT_RENDER_SOFTWARE_THREADS    "SDL_RENDER_SOFTWARE_THREADS"
+
+/**
+ *  \brief  A variable limiting the SIMD instructions the software renderer draws geometry with.
+ *
+ *  By default SDL_RenderGeometry() triangles are drawn with the widest SIMD
+ *  instructions the CPU supports that the software renderer has code for:
+ *  AVX2 or SSE4.1 on x86, and NEON on ARM. Every choice draws the same
+ *  pixels, so this is a supported way to rule out the SIMD code when tracking
+ *  down a rendering problem, or to compare the speed of each choice.
+ *
+ *  This variable can be set to the following values:
+ *    "0"      - Draw with plain C
+ *    "sse4.1" - Use SSE4.1 at most on x86; the same as "1" elsewhere
+ *    "1"      - Use whatever the CPU supports (default)
+ *
+ *  This hint is checked when the renderer is created.
+ */
+#define SDL_HINT_RENDER_SOFTWARE_SIMD    "SDL_RENDER_SOFTWARE_SIMD"
+
 /**
  *  \brief  A variable controlling whether updates to the SDL screen surface should be synchronized with the vertical refresh, to avoid tearing.
  *
@@ -1692,6 +1759,23 @@ extern "C" {
  */
 #define SDL_HINT_VIDEO_X11_XVIDMODE         "SDL_VIDEO_X11_XVIDMODE"
 
+/**
+ *  \brief  A variable controlling how many threads decode MS and IMA ADPCM WAVE data.
+ *
+ *  ADPCM data is made of independent blocks, so when SDL_LoadWAV_RW() loads
+ *  enough of them, it splits the blocks into runs decoded on several threads
+ *  at once. The result is the same either way. At most 8 threads are used, and
+ *  each gets at least 32 blocks.
+ *
+ *  This variable can be set to the following values:
+ *    "0" or "1" - Decode on the calling thread only
+ *    "N"        - Decode on up to N threads
+ *
+ *  By default, this is the number of CPU cores. This hint is checked each time
+ *  a WAVE file is loaded.
+ */
+#define SDL_HINT_WAVE_DECODE_THREADS   "SDL_WAVE_DECODE_THREADS"
+
 /**
  *  \brief  Controls how the fact chunk affects the loading of a WAVE file.
  *
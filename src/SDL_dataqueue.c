@@ -249,12 +249,11 @@ SDL_PeekIntoDataQueue(SDL_DataQueue *queue, void *_buf, const size_t _len)
     return (size_t) (ptr - buf);
 }
 
-size_t
-SDL_ReadFromDataQueue(SDL_DataQueue *queue, void *_buf, const size_t _len)
+/* buf can be NULL to just throw the data away. */
+static size_t
+ReadFromDataQueueInternal(SDL_DataQueue *queue, Uint8 *buf, const size_t _len)
 {
     size_t len = _len;
-    Uint8 *buf = (Uint8 *) _buf;
-    Uint8 *ptr = buf;
     SDL_DataQueuePacket *packet;
 
     if (!queue) {
@@ -266,9 +265,11 @@ SDL_ReadFromDataQueue(SDL_DataQueue *queue, void *_buf, const size_t _len)
         const size_t cpy = SDL_min(len, avail);
         SDL_assert(queue->queued_bytes >= avail);
 
-        SDL_memcpy(ptr, packet->data + packet->startpos, cpy);
+        if (buf) {
+            SDL_memcpy(buf, packet->data + packet->startpos, cpy);
+            buf += cpy;
+        }
         packet->startpos += cpy;
-        ptr += cpy;
         queue->queued_bytes -= cpy;
         len -= cpy;
 
@@ -286,7 +287,99 @@ SDL_ReadFromDataQueue(SDL_DataQueue *queue, void *_buf, const size_t _len)
         queue->tail = NULL;  /* in case we drained the queue entirely. */
     }
 
-    return (size_t) (ptr - buf);
+    return _len - len;
+}
+
+size_t
+SDL_ReadFromDataQueue(SDL_DataQueue *queue, void *buf, const size_t len)
+{
+    return ReadFromDataQueueInternal(queue, (Uint8 *) buf, len);
+}
+
+size_t
+SDL_DiscardFromDataQueue(SDL_DataQueue *queue, const size_t len)
+{
+    return ReadFromDataQueueInternal(queue, NULL, len);
+}
+
+const void *
+SDL_GetDataQueueReadSpan(SDL_DataQueue *queue, size_t *len)
+{
+    SDL_DataQueuePacket *packet = queue ? queue->head : NULL;
+
+    if (!packet) {
+        *len = 0;
+        return NULL;
+    }
+
+    *len = packet->datalen - packet->startpos;
+    return packet->data + packet->startpos;
+}
+
+void *
+SDL_GetDataQueueWriteSpan(SDL_DataQueue *queue, const size_t minlen, size_t *len)
+{
+    SDL_DataQueuePacket *packet;
+
+    if (!queue) {
+        SDL_InvalidParamError("queue");
+        return NULL;
+    } else if ((minlen == 0) || (minlen > queue->packet_size)) {
+        SDL_InvalidParamError("minlen");
+        return NULL;
+    }
+
+    packet = queue->tail;
+    if (packet && ((queue->packet_size - packet->datalen) >= minlen)) {
+        *len = queue->packet_size - packet->datalen;
+        return packet->data + packet->datalen;
+    }
+
+    /* The tail can't hold it. Hand out the packet at the front of the pool,
+       since that's the one AllocateDataQueuePacket() will take on commit. */
+    if (!queue->pool) {
+        packet = (SDL_DataQueuePacket *) SDL_malloc(sizeof (SDL_DataQueuePacket) + queue->packet_size);
+        if (!packet) {
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        packet->datalen = 0;
+        packet->startpos = 0;
+        packet->next = NULL;
+        queue->pool = packet;
+    }
+
+    *len = queue->packet_size;
+    return queue->pool->data;
+}
+
+int
+SDL_CommitDataQueueWrite(SDL_DataQueue *queue, const size_t minlen, const size_t len)
+{
+    SDL_DataQueuePacket *packet;
+
+    if (!queue) {
+        return SDL_InvalidParamError("queue");
+    } else if (len > queue->packet_size) {
+        return SDL_InvalidParamError("len");
+    } else if (len == 0) {
+        return 0;
+    }
+
+    /* this has to make the same choice SDL_GetDataQueueWriteSpan() did. */
+    packet = queue->tail;
+    if (!packet || ((queue->packet_size - packet->datalen) < minlen)) {
+        packet = AllocateDataQueuePacket(queue);
+        if (!packet) {
+            return SDL_OutOfMemory();
+        }
+    } else if (len > (queue->packet_size - packet->datalen)) {
+        return SDL_InvalidParamError("len");
+    }
+
+    packet->datalen += len;
+    queue->queued_bytes += len;
+    return 0;
 }
 
 size_t
@@ -334,5 +427,275 @@ SDL_ReserveSpaceInDataQueue(SDL_DataQueue *queue, const size_t len)
     return packet->data;
 }
 
+/* SDL_SPSCDataQueue is the same idea, for exactly one thread writing and one
+   thread reading at the same time, without any locks.
+
+   Packets form a single list, oldest first:
+
+     first -> ... -> head -> ... -> tail
+
+   The reader consumes from head and moves head forward once a packet is
+   full and used up. Everything from first up to (not including) head has
+   been read, so the writer recycles those packets instead of allocating new
+   ones; in the steady state the list is a ring of preallocated packets. The
+   writer owns first and tail, the reader owns each packet's startpos, and
+   head, each packet's datalen and next pointer, and the byte count are the
+   only things they share. */
+
+typedef struct SDL_SPSCDataQueuePacket
+{
+    SDL_atomic_t datalen;  /* bytes written to this packet; set by the writer. */
+    size_t startpos;  /* bytes consumed from this packet; reader only. */
+    void *next;  /* next SDL_SPSCDataQueuePacket in the list; set by the writer. */
+    Uint8 data[SDL_VARIABLE_LENGTH_ARRAY];  /* packet data */
+} SDL_SPSCDataQueuePacket;
+
+struct SDL_SPSCDataQueue
+{
+    void *head;  /* SDL_SPSCDataQueuePacket the reader is on; set by the reader. */
+    SDL_SPSCDataQueuePacket *tail;  /* writer only. */
+    SDL_SPSCDataQueuePacket *first;  /* oldest packet in the list; writer only. */
+    size_t packet_size;   /* size of new packets */
+    SDL_atomic_t queued_bytes;  /* number of bytes of data in the queue. */
+};
+
+static SDL_SPSCDataQueuePacket *
+NewSPSCDataQueuePacket(const size_t packet_size)
+{
+    SDL_SPSCDataQueuePacket *packet = (SDL_SPSCDataQueuePacket *) SDL_malloc(sizeof (SDL_SPSCDataQueuePacket) + packet_size);
+    if (packet) {
+        SDL_AtomicSet(&packet->datalen, 0);
+        packet->startpos = 0;
+        packet->next = NULL;
+    }
+    return packet;
+}
+
+static void
+SDL_FreeSPSCDataQueueList(SDL_SPSCDataQueuePacket *packet)
+{
+    while (packet) {
+        SDL_SPSCDataQueuePacket *next = (SDL_SPSCDataQueuePacket *) packet->next;
+        SDL_free(packet);
+        packet = next;
+    }
+}
+
+/* (packets) is a list of at least one packet; the last one becomes the head. */
+static void
+ResetSPSCDataQueue(SDL_SPSCDataQueue *queue, SDL_SPSCDataQueuePacket *packets)
+{
+    SDL_SPSCDataQueuePacket *packet;
+
+    for (packet = packets; packet->next; packet = (SDL_SPSCDataQueuePacket *) packet->next) {
+        SDL_AtomicSet(&packet->datalen, 0);
+        packet->startpos = 0;
+    }
+    SDL_AtomicSet(&packet->datalen, 0);
+    packet->startpos = 0;
+
+    queue->first = packets;
+    queue->tail = packet;
+    SDL_AtomicSetPtr(&queue->head, packet);
+    SDL_AtomicSet(&queue->queued_bytes, 0);
+}
+
+SDL_SPSCDataQueue *
+SDL_NewSPSCDataQueue(const size_t _packetlen, const size_t initialslack)
+{
+    const size_t packetlen = _packetlen ? _packetlen : 1024;
+    const size_t wantpackets = (initialslack + (packetlen - 1)) / packetlen;
+    SDL_SPSCDataQueue *queue = (SDL_SPSCDataQueue *) SDL_malloc(sizeof (SDL_SPSCDataQueue));
+    SDL_SPSCDataQueuePacket *packets;
+    size_t i;
+
+    if (!queue) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    SDL_zerop(queue);
+    queue->packet_size = packetlen;
+
+    /* we always need one packet for the reader to sit on. */
+    packets = NewSPSCDataQueuePacket(packetlen);
+    if (!packets) {
+        SDL_free(queue);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    for (i = 1; i < wantpackets; i++) {
+        SDL_SPSCDataQueuePacket *packet = NewSPSCDataQueuePacket(packetlen);
+        if (packet) { /* don't care if this fails, we'll deal later. */
+            packet->next = packets;
+            packets = packet;
+        }
+    }
+
+    ResetSPSCDataQueue(queue, packets);
+    return queue;
+}
+
+void
+SDL_FreeSPSCDataQueue(SDL_SPSCDataQueue *queue)
+{
+    if (queue) {
+        SDL_FreeSPSCDataQueueList(queue->first);
+        SDL_free(queue);
+    }
+}
+
+void
+SDL_ClearSPSCDataQueue(SDL_SPSCDataQueue *queue, const size_t slack)
+{
+    size_t slackpackets;
+    SDL_SPSCDataQueuePacket *packet;
+    size_t i;
+
+    if (!queue) {
+        return;
+    }
+
+    /* keep at least the one packet the reader sits on. */
+    slackpackets = SDL_max((slack + (queue->packet_size - 1)) / queue->packet_size, 1);
+    packet = queue->first;
+    for (i = 1; packet->next && (i < slackpackets); i++) {
+        packet = (SDL_SPSCDataQueuePacket *) packet->next;
+    }
+
+    SDL_FreeSPSCDataQueueList((SDL_SPSCDataQueuePacket *) packet->next);  /* free extra packets */
+    packet->next = NULL;
+
+    ResetSPSCDataQueue(queue, queue->first);
+}
+
+/* Writer only. Reuses a packet the reader is done with, if there is one. */
+static SDL_SPSCDataQueuePacket *
+AllocateSPSCDataQueuePacket(SDL_SPSCDataQueue *queue)
+{
+    SDL_SPSCDataQueuePacket *packet = queue->first;
+
+    if (packet != (SDL_SPSCDataQueuePacket *) SDL_AtomicGetPtr(&queue->head)) {
+        SDL_MemoryBarrierAcquire();  /* the reader is done with it, don't write before that. */
+        queue->first = (SDL_SPSCDataQueuePacket *) SDL_AtomicGetPtr(&packet->next);
+        SDL_AtomicSet(&packet->datalen, 0);
+        packet->startpos = 0;
+        packet->next = NULL;
+        return packet;
+    }
+
+    return NewSPSCDataQueuePacket(queue->packet_size);
+}
+
+int
+SDL_WriteToSPSCDataQueue(SDL_SPSCDataQueue *queue, const void *_data, const size_t _len)
+{
+    size_t len = _len;
+    const Uint8 *data = (const Uint8 *) _data;
+    SDL_SPSCDataQueuePacket *packets = NULL;
+    SDL_SPSCDataQueuePacket *packet;
+    size_t datalen, avail, cpy;
+
+    if (!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+
+    packet = queue->tail;
+    datalen = (size_t) SDL_AtomicGet(&packet->datalen);
+    avail = queue->packet_size - datalen;
+
+    /* get every packet we need up front, so running out of memory doesn't
+       leave half of this write visible to the reader. */
+    if (len > avail) {
+        size_t wantpackets = ((len - avail) + (queue->packet_size - 1)) / queue->packet_size;
+        SDL_SPSCDataQueuePacket *last = NULL;
+        while (wantpackets--) {
+            SDL_SPSCDataQueuePacket *newpacket = AllocateSPSCDataQueuePacket(queue);
+            if (!newpacket) {
+                SDL_FreeSPSCDataQueueList(packets);  /* give back what we can. */
+                return SDL_OutOfMemory();
+            }
+            if (last) {
+                last->next = newpacket;
+            } else {
+                packets = newpacket;
+            }
+            last = newpacket;
+        }
+    }
+
+    while (len > 0) {
+        if (datalen == queue->packet_size) {
+            SDL_SPSCDataQueuePacket *next = packets;
+            SDL_assert(next != NULL);
+            packets = (SDL_SPSCDataQueuePacket *) next->next;
+            next->next = NULL;
+            SDL_MemoryBarrierRelease();
+            SDL_AtomicSetPtr(&packet->next, next);  /* the reader can move on to it now. */
+            packet = queue->tail = next;
+            datalen = 0;
+        }
+
+        cpy = SDL_min(len, queue->packet_size - datalen);
+        SDL_memcpy(packet->data + datalen, data, cpy);
+        datalen += cpy;
+        SDL_MemoryBarrierRelease();  /* publish after the data is in place. */
+        SDL_AtomicSet(&packet->datalen, (int) datalen);
+        SDL_AtomicAdd(&queue->queued_bytes, (int) cpy);
+        data += cpy;
+        len -= cpy;
+    }
+
+    SDL_assert(packets == NULL);
+    return 0;
+}
+
+size_t
+SDL_ReadFromSPSCDataQueue(SDL_SPSCDataQueue *queue, void *_buf, const size_t _len)
+{
+    size_t len = _len;
+    Uint8 *buf = (Uint8 *) _buf;
+    SDL_SPSCDataQueuePacket *packet;
+
+    if (!queue) {
+        return 0;
+    }
+
+    packet = (SDL_SPSCDataQueuePacket *) SDL_AtomicGetPtr(&queue->head);
+    while (len > 0) {
+        const size_t datalen = (size_t) SDL_AtomicGet(&packet->datalen);
+        const size_t cpy = SDL_min(len, datalen - packet->startpos);
+
+        SDL_MemoryBarrierAcquire();  /* don't read data older than datalen. */
+
+        if (cpy == 0) {
+            /* a full packet never gets more data; see if the writer moved on. */
+            SDL_SPSCDataQueuePacket *next = (packet->startpos == queue->packet_size) ? (SDL_SPSCDataQueuePacket *) SDL_AtomicGetPtr(&packet->next) : NULL;
+            if (!next) {
+                break;  /* we've read everything there is right now. */
+            }
+            packet = next;
+            SDL_MemoryBarrierRelease();  /* finish reading before the writer can recycle what's behind us. */
+            SDL_AtomicSetPtr(&queue->head, packet);
+            continue;
+        }
+
+        SDL_memcpy(buf, packet->data + packet->startpos, cpy);
+        packet->startpos += cpy;
+        buf += cpy;
+        len -= cpy;
+        SDL_AtomicAdd(&queue->queued_bytes, -((int) cpy));
+    }
+
+    return _len - len;
+}
+
+size_t
+SDL_CountSPSCDataQueue(SDL_SPSCDataQueue *queue)
+{
+    return queue ? (size_t) SDL_AtomicGet(&queue->queued_bytes) : 0;
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
 
@@ -32,8 +32,27 @@ void SDL_ClearDataQueue(SDL_DataQueue *queue, const size_t slack);
 int SDL_WriteToDataQueue(SDL_DataQueue *queue, const void *data, const size_t len);
 size_t SDL_ReadFromDataQueue(SDL_DataQueue *queue, void *buf, const size_t len);
 size_t SDL_PeekIntoDataQueue(SDL_DataQueue *queue, void *buf, const size_t len);
+size_t SDL_DiscardFromDataQueue(SDL_DataQueue *queue, const size_t len);
 size_t SDL_CountDataQueue(SDL_DataQueue *queue);
 
+/* Returns a pointer to the oldest contiguous run of queued data, without
+   consuming it, and sets (len) to its size in bytes. Returns NULL, and sets
+   (len) to zero, if the queue is empty. There might be more data queued after
+   this run; use SDL_DiscardFromDataQueue() to consume it and get the next one.
+   The pointer is valid until the next call that reads or clears the queue. */
+const void *SDL_GetDataQueueReadSpan(SDL_DataQueue *queue, size_t *len);
+
+/* Two-step version of SDL_WriteToDataQueue(), to let you produce data
+   directly in the queue's memory. SDL_GetDataQueueWriteSpan() returns a
+   buffer of (len) bytes, at least (minlen), that will be appended to the
+   queue once you call SDL_CommitDataQueueWrite() with the same (minlen) and
+   the number of bytes you actually wrote. Nothing is queued until then, and
+   you must not otherwise touch the queue in between. (minlen) can't be larger
+   than the packetlen requested in SDL_NewDataQueue. There is no thread safety.
+   Returns NULL on error. */
+void *SDL_GetDataQueueWriteSpan(SDL_DataQueue *queue, const size_t minlen, size_t *len);
+int SDL_CommitDataQueueWrite(SDL_DataQueue *queue, const size_t minlen, const size_t len);
+
 /* this sets a section of the data queue aside (possibly allocating memory for it)
    as if it's been written to, but returns a pointer to that space. You may write
    to this space until a read would consume it. Writes (and other calls to this
@@ -49,6 +68,22 @@ size_t SDL_CountDataQueue(SDL_DataQueue *queue);
 */
 void *SDL_ReserveSpaceInDataQueue(SDL_DataQueue *queue, const size_t len);
 
+/* A version of SDL_DataQueue for one thread writing while another one reads,
+   without locks. Only one thread may write (or clear) and only one thread may
+   read at a time. Count can be called from anywhere. Clearing needs both
+   sides to be idle. Packets that have been read are reused for new writes,
+   so after the initial slack it only allocates if the queue grows. */
+
+struct SDL_SPSCDataQueue;
+typedef struct SDL_SPSCDataQueue SDL_SPSCDataQueue;
+
+SDL_SPSCDataQueue *SDL_NewSPSCDataQueue(const size_t packetlen, const size_t initialslack);
+void SDL_FreeSPSCDataQueue(SDL_SPSCDataQueue *queue);
+void SDL_ClearSPSCDataQueue(SDL_SPSCDataQueue *queue, const size_t slack);
+int SDL_WriteToSPSCDataQueue(SDL_SPSCDataQueue *queue, const void *data, const size_t len);
+size_t SDL_ReadFromSPSCDataQueue(SDL_SPSCDataQueue *queue, void *buf, const size_t len);
+size_t SDL_CountSPSCDataQueue(SDL_SPSCDataQueue *queue);
+
 #endif /* SDL_dataqueue_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
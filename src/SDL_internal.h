@@ -120,6 +120,49 @@
 #define SDL_HAVE_YUV                    !SDL_LEAN_AND_MEAN
 #endif
 
+/* SIMD code that's picked at runtime (see SDL_HasAVX2() and friends) has to
+   build even when the rest of its file isn't compiled for that instruction
+   set. SDL_TARGETING() enables one for a single function, on compilers that
+   can do that, and HAVE_*_INTRINSICS say which x86 sets can be built at all. */
+#if defined(__clang__)
+#if __has_attribute(target)
+#define SDL_HAVE_TARGET_ATTRIBUTE 1
+#endif
+#elif defined(__GNUC__)
+#if (__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)
+#define SDL_HAVE_TARGET_ATTRIBUTE 1
+#endif
+#endif
+
+#ifdef SDL_HAVE_TARGET_ATTRIBUTE
+#define SDL_TARGETING(x) __attribute__((target(x)))
+#else
+#define SDL_TARGETING(x)
+#endif
+
+#if defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H)
+#if defined(__clang__) && (defined(_MSC_VER) || defined(__SCE__))
+/* these only declare the intrinsics the whole build is compiled for. */
+#ifdef __SSE4_1__
+#define HAVE_SSE41_INTRINSICS 1
+#endif
+#ifdef __AVX__
+#define HAVE_AVX_INTRINSICS 1
+#endif
+#ifdef __AVX2__
+#define HAVE_AVX2_INTRINSICS 1
+#endif
+#ifdef __AVX512F__
+#define HAVE_AVX512F_INTRINSICS 1
+#endif
+#elif defined(SDL_HAVE_TARGET_ATTRIBUTE) || defined(_MSC_VER)
+#define HAVE_SSE41_INTRINSICS 1
+#define HAVE_AVX_INTRINSICS 1
+#define HAVE_AVX2_INTRINSICS 1
+#define HAVE_AVX512F_INTRINSICS 1
+#endif
+#endif /* HAVE_IMMINTRIN_H */
+
 #include "SDL_assert.h"
 #include "SDL_log.h"
 
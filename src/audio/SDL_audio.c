@@ -24,6 +24,7 @@
 
 #include "SDL.h"
 #include "SDL_audio.h"
+#include "SDL_bits.h"
 #include "SDL_audio_c.h"
 #include "SDL_sysaudio.h"
 #include "../thread/SDL_systhread.h"
@@ -34,6 +35,24 @@
 static SDL_AudioDriver current_audio;
 static SDL_AudioDevice *open_devices[16];
 
+#define SDL_AUDIO_MAX_LOOKAHEAD 16
+
+/* The app's callback, run ahead of a playback device; see SDL_HINT_AUDIO_CALLBACK_LOOKAHEAD.
+   The buffers form a ring: the lookahead thread fills them in order, the device's
+   callback empties them in the same order, and `filled` is the only shared state. */
+typedef struct SDL_AudioLookahead
+{
+    SDL_AudioCallback callback;  /* the app's callback and userdata. */
+    void *userdata;
+    SDL_mutex *lock;  /* held around the app's callback; this is what SDL_LockAudioDevice() takes. */
+    SDL_sem *free_buffers;  /* the lookahead thread waits on this for a buffer to fill. */
+    SDL_Thread *thread;
+    Uint8 *buffers;
+    int depth;
+    int read_index;  /* only used by the device's callback. */
+    SDL_atomic_t filled;
+} SDL_AudioLookahead;
+
 /* Available audio drivers */
 static const AudioBootStrap *const bootstrap[] = {
 #if SDL_AUDIO_DRIVER_PULSEAUDIO
@@ -570,12 +589,33 @@ SDL_RemoveAudioDevice(const SDL_bool iscapture, void *handle)
 
 
 
+/* Counts an underrun the first time a playback queue (or the lookahead buffers) can't fill a buffer. */
+static void
+SDL_AudioStatsNoteQueue(SDL_AudioDevice *device, SDL_bool ran_dry)
+{
+    if (ran_dry && !device->queue_starved) {
+        SDL_AtomicLock(&device->stats_lock);
+        device->stats.underruns++;
+        SDL_AtomicUnlock(&device->stats_lock);
+    }
+    device->queue_starved = ran_dry;
+}
+
 /* buffer queueing support... */
 
+/* The callback the device was opened with, even when SDL_BoundStreamsCallback wraps it. */
+static SDL_AudioCallback
+get_device_callback(SDL_AudioDevice *device)
+{
+    return device->bound_callback ? device->bound_callback : device->callbackspec.callback;
+}
+
 static void SDLCALL
 SDL_BufferQueueDrainCallback(void *userdata, Uint8 *stream, int len)
 {
-    /* this function always holds the mixer lock before being called. */
+    /* this function always holds the mixer lock before being called, but
+       SDL_QueueAudio() doesn't take it; the queue is safe for one reader and
+       one writer at a time. */
     SDL_AudioDevice *device = (SDL_AudioDevice *) userdata;
     size_t dequeued;
 
@@ -583,20 +623,23 @@ SDL_BufferQueueDrainCallback(void *userdata, Uint8 *stream, int len)
     SDL_assert(!device->iscapture);  /* this shouldn't ever happen, right?! */
     SDL_assert(len >= 0);  /* this shouldn't ever happen, right?! */
 
-    dequeued = SDL_ReadFromDataQueue(device->buffer_queue, stream, len);
+    dequeued = SDL_ReadFromSPSCDataQueue(device->buffer_queue, stream, len);
     stream += dequeued;
     len -= (int) dequeued;
 
     if (len > 0) {  /* fill any remaining space in the stream with silence. */
-        SDL_assert(SDL_CountDataQueue(device->buffer_queue) == 0);
         SDL_memset(stream, device->callbackspec.silence, len);
     }
+
+    SDL_AudioStatsNoteQueue(device, (len > 0) ? SDL_TRUE : SDL_FALSE);
 }
 
 static void SDLCALL
 SDL_BufferQueueFillCallback(void *userdata, Uint8 *stream, int len)
 {
-    /* this function always holds the mixer lock before being called. */
+    /* this function always holds the mixer lock before being called, but
+       SDL_DequeueAudio() doesn't take it; the queue is safe for one reader and
+       one writer at a time. */
     SDL_AudioDevice *device = (SDL_AudioDevice *) userdata;
 
     SDL_assert(device != NULL);  /* this shouldn't ever happen, right?! */
@@ -606,7 +649,7 @@ SDL_BufferQueueFillCallback(void *userdata, Uint8 *stream, int len)
     /* note that if this needs to allocate more space and run out of memory,
        we have no choice but to quietly drop the data and hope it works out
        later, but you probably have bigger problems in this case anyhow. */
-    SDL_WriteToDataQueue(device->buffer_queue, stream, len);
+    SDL_WriteToSPSCDataQueue(device->buffer_queue, stream, len);
 }
 
 int
@@ -619,14 +662,16 @@ SDL_QueueAudio(SDL_AudioDeviceID devid, const void *data, Uint32 len)
         return -1;  /* get_audio_device() will have set the error state */
     } else if (device->iscapture) {
         return SDL_SetError("This is a capture device, queueing not allowed");
-    } else if (device->callbackspec.callback != SDL_BufferQueueDrainCallback) {
+    } else if (get_device_callback(device) != SDL_BufferQueueDrainCallback) {
         return SDL_SetError("Audio device has a callback, queueing not allowed");
     }
 
     if (len > 0) {
-        current_audio.impl.LockDevice(device);
-        rc = SDL_WriteToDataQueue(device->buffer_queue, data, len);
-        current_audio.impl.UnlockDevice(device);
+        /* the audio thread doesn't take this lock, so we never wait on the
+           audio callback; this only keeps app threads out of each other's way. */
+        SDL_AtomicLock(&device->buffer_queue_lock);
+        rc = SDL_WriteToSPSCDataQueue(device->buffer_queue, data, len);
+        SDL_AtomicUnlock(&device->buffer_queue_lock);
     }
 
     return rc;
@@ -641,13 +686,15 @@ SDL_DequeueAudio(SDL_AudioDeviceID devid, void *data, Uint32 len)
     if ( (len == 0) ||  /* nothing to do? */
          (!device) ||  /* called with bogus device id */
          (!device->iscapture) ||  /* playback devices can't dequeue */
-         (device->callbackspec.callback != SDL_BufferQueueFillCallback) ) { /* not set for queueing */
+         (get_device_callback(device) != SDL_BufferQueueFillCallback) ) { /* not set for queueing */
         return 0;  /* just report zero bytes dequeued. */
     }
 
-    current_audio.impl.LockDevice(device);
-    rc = (Uint32) SDL_ReadFromDataQueue(device->buffer_queue, data, len);
-    current_audio.impl.UnlockDevice(device);
+    /* the audio thread doesn't take this lock, so we never wait on the
+       audio callback; this only keeps app threads out of each other's way. */
+    SDL_AtomicLock(&device->buffer_queue_lock);
+    rc = (Uint32) SDL_ReadFromSPSCDataQueue(device->buffer_queue, data, len);
+    SDL_AtomicUnlock(&device->buffer_queue_lock);
     return rc;
 }
 
@@ -662,12 +709,10 @@ SDL_GetQueuedAudioSize(SDL_AudioDeviceID devid)
     }
 
     /* Nothing to do unless we're set up for queueing. */
-    if (device->callbackspec.callback == SDL_BufferQueueDrainCallback ||
-        device->callbackspec.callback == SDL_BufferQueueFillCallback)
+    if (get_device_callback(device) == SDL_BufferQueueDrainCallback ||
+        get_device_callback(device) == SDL_BufferQueueFillCallback)
     {
-        current_audio.impl.LockDevice(device);
-        retval = (Uint32) SDL_CountDataQueue(device->buffer_queue);
-        current_audio.impl.UnlockDevice(device);
+        retval = (Uint32) SDL_CountSPSCDataQueue(device->buffer_queue);
     }
 
     return retval;
@@ -682,13 +727,422 @@ SDL_ClearQueuedAudio(SDL_AudioDeviceID devid)
         return;  /* nothing to do. */
     }
 
-    /* Blank out the device and release the mutex. Free it afterwards. */
+    /* Blank out the device and release the mutex. Free it afterwards.
+       The lock keeps the audio callback from touching the queue meanwhile. */
+    SDL_AtomicLock(&device->buffer_queue_lock);
     current_audio.impl.LockDevice(device);
 
     /* Keep up to two packets in the pool to reduce future memory allocation pressure. */
-    SDL_ClearDataQueue(device->buffer_queue, SDL_AUDIOBUFFERQUEUE_PACKETLEN * 2);
+    SDL_ClearSPSCDataQueue(device->buffer_queue, SDL_AUDIOBUFFERQUEUE_PACKETLEN * 2);
 
     current_audio.impl.UnlockDevice(device);
+    SDL_AtomicUnlock(&device->buffer_queue_lock);
+}
+
+
+/* audio device telemetry... */
+
+static Uint64
+SDL_AudioStatsElapsedNS(Uint64 start)
+{
+    const Uint64 ticks = SDL_GetPerformanceCounter() - start;
+    const Uint64 freq = SDL_GetPerformanceFrequency();
+    /* split the conversion so long waits don't overflow. */
+    return ((ticks / freq) * 1000000000) + (((ticks % freq) * 1000000000) / freq);
+}
+
+/* Adds the time since `start` to one of the device's timings, and returns it in nanoseconds. */
+static Uint64
+SDL_AudioStatsAddTime(SDL_AudioDevice *device, SDL_AudioTimingStats *timing, Uint64 start)
+{
+    const Uint64 ns = SDL_AudioStatsElapsedNS(start);
+    const Uint64 us = ns / 1000;
+    int bucket = (us > 0) ? SDL_MostSignificantBitIndex32((Uint32) SDL_min(us, 0xFFFFFFFF)) : 0;
+
+    if (bucket >= SDL_AUDIO_STATS_BUCKETS) {
+        bucket = SDL_AUDIO_STATS_BUCKETS - 1;
+    }
+
+    SDL_AtomicLock(&device->stats_lock);
+    timing->count++;
+    timing->total_ns += ns;
+    if (ns > timing->max_ns) {
+        timing->max_ns = ns;
+    }
+    timing->histogram[bucket]++;
+    SDL_AtomicUnlock(&device->stats_lock);
+    return ns;
+}
+
+/* Called once per buffer by the audio threads. `busy_ns` is the time spent in the callback and conversion. */
+static void
+SDL_AudioStatsEndIteration(SDL_AudioDevice *device, Uint64 busy_ns, SDL_bool stalled)
+{
+    const SDL_AudioSpec *spec = &device->callbackspec;
+    const Uint64 buffer_ns = ((Uint64) spec->samples * 1000000000) / spec->freq;
+    const Uint64 now = SDL_GetPerformanceCounter();
+    const Uint64 last = device->stats_last_ticks;
+    Uint32 fill;
+
+    if (get_device_callback(device) == SDL_BufferQueueDrainCallback ||
+        get_device_callback(device) == SDL_BufferQueueFillCallback) {
+        fill = (Uint32) SDL_CountSPSCDataQueue(device->buffer_queue);
+    } else if (device->lookahead) {
+        fill = (Uint32) SDL_AtomicGet(&device->lookahead->filled) * device->callbackspec.size;
+    } else if (device->stream) {
+        fill = (Uint32) SDL_max(SDL_AudioStreamAvailable(device->stream), 0);
+    } else {
+        fill = 0;
+    }
+
+    SDL_AtomicLock(&device->stats_lock);
+    if (device->stats.iterations == 0 || fill < device->stats.fill_min_bytes) {
+        device->stats.fill_min_bytes = fill;
+    }
+    if (fill > device->stats.fill_max_bytes) {
+        device->stats.fill_max_bytes = fill;
+    }
+    device->stats.fill_bytes = fill;
+    if (busy_ns > buffer_ns) {
+        device->stats.late_buffers++;
+    }
+    if (stalled) {
+        device->stats.stalls++;
+    }
+    if (last != 0 && !SDL_AtomicGet(&device->paused)) {
+        device->stats.unpaused_frames += spec->samples;
+        device->stats.unpaused_ns += SDL_AudioStatsElapsedNS(last);
+    }
+    device->stats.iterations++;
+    SDL_AtomicUnlock(&device->stats_lock);
+    device->stats_last_ticks = now;
+}
+
+int
+SDL_GetAudioDeviceStats(SDL_AudioDeviceID devid, SDL_AudioDeviceStats *stats)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+
+    if (!device) {
+        return -1;  /* get_audio_device() will have set the error state */
+    } else if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+
+    SDL_AtomicLock(&device->stats_lock);
+    SDL_memcpy(stats, &device->stats, sizeof (*stats));
+    SDL_AtomicUnlock(&device->stats_lock);
+    return 0;
+}
+
+void
+SDL_ResetAudioDeviceStats(SDL_AudioDeviceID devid)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+
+    if (!device) {
+        return;  /* nothing to do. */
+    }
+
+    SDL_AtomicLock(&device->stats_lock);
+    SDL_zero(device->stats);
+    SDL_AtomicUnlock(&device->stats_lock);
+}
+
+
+/* bound stream support... */
+
+/* Guards which device each stream is bound to, so binding can't race with itself across devices.
+   Taken before the callback's lock; the audio threads never take it. */
+static SDL_SpinLock bound_streams_lock = 0;
+
+/* Mixes a buffer's worth of every bound stream into what the callback just wrote, in one pass. Call with the callback's lock held. */
+static void
+SDL_MixBoundAudioStreams(SDL_AudioDevice *device, Uint8 *data, int len)
+{
+    SDL_AudioMixSource *sources = device->bound_stream_sources;
+    int i;
+
+    if (device->num_bound_streams == 0) {
+        return;
+    }
+
+    SDL_assert(len <= (int) device->callbackspec.size);
+
+    /* each stream gets its own slot, so a short one is padded out with silence rather than mixed short. */
+    for (i = 0; i < device->num_bound_streams; i++) {
+        Uint8 *buffer = device->bound_stream_buffer + (size_t) i * device->callbackspec.size;
+        const int got = SDL_AudioStreamGet(device->bound_streams[i], buffer, len);
+        if (got > 0) {
+            if (got < len) {
+                SDL_memset(buffer + got, device->callbackspec.silence, len - got);
+            }
+            sources[i].src = buffer;
+        } else {
+            sources[i].src = NULL;
+        }
+        sources[i].volume = SDL_MIX_MAXVOLUME;
+        sources[i].pan = 0.0f;
+    }
+
+    SDL_MixAudioSources(data, sources, device->num_bound_streams, device->callbackspec.format,
+                        device->callbackspec.channels, (Uint32) len);
+}
+
+/* Stands in for the callback on playback devices without a lookahead, to mix bound streams in after it.
+   Backends that call the callback from their own thread never go through SDL_RunAudio, so it can't be done there. */
+static void SDLCALL
+SDL_BoundStreamsCallback(void *userdata, Uint8 *stream, int len)
+{
+    SDL_AudioDevice *device = (SDL_AudioDevice *) userdata;
+
+    device->bound_callback(device->bound_userdata, stream, len);
+    SDL_MixBoundAudioStreams(device, stream, len);
+}
+
+
+/* callback lookahead support... */
+
+/* This replaces the app's callback on the device; it just hands over the oldest prepared buffer. */
+static void SDLCALL
+SDL_LookaheadDrainCallback(void *userdata, Uint8 *stream, int len)
+{
+    SDL_AudioDevice *device = (SDL_AudioDevice *) userdata;
+    SDL_AudioLookahead *lookahead = device->lookahead;
+
+    SDL_assert(len == (int) device->callbackspec.size);  /* this shouldn't ever happen, right?! */
+
+    if (SDL_AtomicGet(&lookahead->filled) > 0) {
+        SDL_memcpy(stream, lookahead->buffers + (size_t) lookahead->read_index * len, len);
+        lookahead->read_index = (lookahead->read_index + 1) % lookahead->depth;
+        SDL_AtomicAdd(&lookahead->filled, -1);
+        SDL_SemPost(lookahead->free_buffers);
+        SDL_AudioStatsNoteQueue(device, SDL_FALSE);
+    } else {
+        SDL_memset(stream, device->callbackspec.silence, len);
+        SDL_AudioStatsNoteQueue(device, SDL_TRUE);
+    }
+}
+
+static int SDLCALL
+SDL_RunAudioLookahead(void *devicep)
+{
+    SDL_AudioDevice *device = (SDL_AudioDevice *) devicep;
+    SDL_AudioLookahead *lookahead = device->lookahead;
+    const int len = (int) device->callbackspec.size;
+    int write_index = 0;
+
+    SDL_SetThreadPriority(SDL_THREAD_PRIORITY_HIGH);
+
+    for (;;) {
+        Uint8 *buffer;
+
+        SDL_SemWait(lookahead->free_buffers);
+        if (SDL_AtomicGet(&device->shutdown)) {
+            break;
+        }
+
+        /* a paused device doesn't take buffers, so this makes at most `depth` buffers of silence. */
+        buffer = lookahead->buffers + (size_t) write_index * len;
+        SDL_LockMutex(lookahead->lock);
+        if (SDL_AtomicGet(&device->paused)) {
+            SDL_memset(buffer, device->callbackspec.silence, len);
+        } else {
+            const Uint64 start = SDL_GetPerformanceCounter();
+            lookahead->callback(lookahead->userdata, buffer, len);
+            SDL_MixBoundAudioStreams(device, buffer, len);
+            SDL_AudioStatsAddTime(device, &device->stats.callback, start);
+        }
+        SDL_UnlockMutex(lookahead->lock);
+
+        write_index = (write_index + 1) % lookahead->depth;
+        SDL_AtomicAdd(&lookahead->filled, 1);
+    }
+
+    return 0;
+}
+
+/* Moves the app's callback to a lookahead thread, leaving SDL_LookaheadDrainCallback on the device. */
+static int
+SDL_StartAudioLookahead(SDL_AudioDevice *device, int depth)
+{
+    SDL_AudioLookahead *lookahead = (SDL_AudioLookahead *) SDL_calloc(1, sizeof (SDL_AudioLookahead));
+    char threadname[64];
+
+    if (!lookahead) {
+        return SDL_OutOfMemory();
+    }
+    device->lookahead = lookahead;
+
+    lookahead->callback = device->callbackspec.callback;
+    lookahead->userdata = device->callbackspec.userdata;
+    lookahead->depth = depth;
+    lookahead->buffers = (Uint8 *) SDL_malloc((size_t) depth * device->callbackspec.size);
+    lookahead->lock = SDL_CreateMutex();
+    lookahead->free_buffers = SDL_CreateSemaphore(depth);
+    if (!lookahead->buffers || !lookahead->lock || !lookahead->free_buffers) {
+        return SDL_OutOfMemory();
+    }
+
+    device->callbackspec.callback = SDL_LookaheadDrainCallback;
+    device->callbackspec.userdata = device;
+
+    SDL_snprintf(threadname, sizeof (threadname), "SDLAudioL%d", (int) device->id);
+    lookahead->thread = SDL_CreateThreadInternal(SDL_RunAudioLookahead, threadname, 0, device);
+    if (!lookahead->thread) {
+        return SDL_SetError("Couldn't create audio lookahead thread");
+    }
+    return 0;
+}
+
+static void
+SDL_StopAudioLookahead(SDL_AudioDevice *device)
+{
+    SDL_AudioLookahead *lookahead = device->lookahead;
+
+    /* device->shutdown is already set; wake the thread up so it sees it. */
+    if (lookahead->thread) {
+        SDL_SemPost(lookahead->free_buffers);
+        SDL_WaitThread(lookahead->thread, NULL);
+    }
+    if (lookahead->free_buffers) {
+        SDL_DestroySemaphore(lookahead->free_buffers);
+    }
+    if (lookahead->lock) {
+        SDL_DestroyMutex(lookahead->lock);
+    }
+    SDL_free(lookahead->buffers);
+    SDL_free(lookahead);
+    device->lookahead = NULL;
+}
+
+/* With a lookahead thread, the app's callback (and bound streams) run under the
+   lookahead's lock, and the device's lock only covers copying out a prepared
+   buffer. So only take the lookahead's lock; an app holding it, or waiting on a
+   slow callback for it, must never stall the device's thread. */
+static void
+lock_device_callback(SDL_AudioDevice *device)
+{
+    if (device->lookahead) {
+        SDL_LockMutex(device->lookahead->lock);
+    } else {
+        current_audio.impl.LockDevice(device);
+    }
+}
+
+static void
+unlock_device_callback(SDL_AudioDevice *device)
+{
+    if (device->lookahead) {
+        SDL_UnlockMutex(device->lookahead->lock);
+    } else {
+        current_audio.impl.UnlockDevice(device);
+    }
+}
+
+/* Returns the index of `stream` in the device's bound streams, or -1. Call with bound_streams_lock or the callback's lock held. */
+static int
+find_bound_stream(SDL_AudioDevice *device, SDL_AudioStream *stream)
+{
+    int i;
+
+    for (i = 0; i < device->num_bound_streams; i++) {
+        if (device->bound_streams[i] == stream) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int
+SDL_BindAudioStream(SDL_AudioDeviceID devid, SDL_AudioStream *stream)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    SDL_AudioFormat format;
+    Uint8 channels;
+    int rate;
+    int retval = 0;
+    int i;
+
+    if (!device) {
+        return -1;  /* get_audio_device() will have set the error state */
+    } else if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (device->iscapture) {
+        return SDL_SetError("Audio streams can only be bound to playback devices");
+    }
+
+    SDL_GetAudioStreamOutputSpec(stream, &format, &channels, &rate);
+    if ((format != device->callbackspec.format) ||
+        (channels != device->callbackspec.channels) ||
+        (rate != device->callbackspec.freq)) {
+        return SDL_SetError("Audio stream output doesn't match the device's format");
+    }
+
+    SDL_AtomicLock(&bound_streams_lock);
+    lock_device_callback(device);
+
+    /* other devices' bound streams only change under bound_streams_lock, which we hold. */
+    for (i = 0; i < SDL_arraysize(open_devices); i++) {
+        SDL_AudioDevice *other = open_devices[i];
+        if (other && (find_bound_stream(other, stream) >= 0)) {
+            retval = SDL_SetError("Audio stream is already bound to a device");
+            break;
+        }
+    }
+
+    if (retval == 0) {
+        const int count = device->num_bound_streams + 1;
+        Uint8 *buffer = (Uint8 *) SDL_realloc(device->bound_stream_buffer, (size_t) count * device->callbackspec.size);
+        SDL_AudioMixSource *sources = NULL;
+        SDL_AudioStream **streams = NULL;
+
+        /* growing these early is harmless, so keep whatever succeeded even if a later one fails. */
+        if (buffer) {
+            device->bound_stream_buffer = buffer;
+            sources = (SDL_AudioMixSource *) SDL_realloc(device->bound_stream_sources, count * sizeof (*sources));
+        }
+        if (sources) {
+            device->bound_stream_sources = sources;
+            streams = (SDL_AudioStream **) SDL_realloc(device->bound_streams, count * sizeof (*streams));
+        }
+        if (streams) {
+            streams[device->num_bound_streams++] = stream;
+            device->bound_streams = streams;
+        } else {
+            retval = SDL_OutOfMemory();
+        }
+    }
+
+    unlock_device_callback(device);
+    SDL_AtomicUnlock(&bound_streams_lock);
+
+    return retval;
+}
+
+void
+SDL_UnbindAudioStream(SDL_AudioStream *stream)
+{
+    int i;
+
+    if (!stream) {
+        return;  /* nothing to do. */
+    }
+
+    SDL_AtomicLock(&bound_streams_lock);
+    for (i = 0; i < SDL_arraysize(open_devices); i++) {
+        SDL_AudioDevice *device = open_devices[i];
+        const int index = device ? find_bound_stream(device, stream) : -1;
+        if (index >= 0) {
+            lock_device_callback(device);
+            device->num_bound_streams--;
+            SDL_memmove(&device->bound_streams[index], &device->bound_streams[index + 1],
+                        (device->num_bound_streams - index) * sizeof (*device->bound_streams));
+            unlock_device_callback(device);
+            break;  /* a stream is only ever bound to one device. */
+        }
+    }
+    SDL_AtomicUnlock(&bound_streams_lock);
 }
 
 
@@ -721,6 +1175,10 @@ SDL_RunAudio(void *devicep)
 
     /* Loop, filling the audio buffers */
     while (!SDL_AtomicGet(&device->shutdown)) {
+        Uint64 busy_ns = 0;
+        Uint64 start;
+        SDL_bool stalled = SDL_FALSE;
+
         data_len = device->callbackspec.size;
 
         /* Fill the current buffer with sound */
@@ -746,24 +1204,36 @@ SDL_RunAudio(void *devicep)
         if (SDL_AtomicGet(&device->paused)) {
             SDL_memset(data, device->callbackspec.silence, data_len);
         } else {
-            callback(udata, data, data_len);
+            start = SDL_GetPerformanceCounter();
+            callback(udata, data, data_len);  /* this mixes in bound streams, too. */
+            if (device->lookahead) {  /* the lookahead thread runs the app's callback and bound streams, and times them. */
+                busy_ns += SDL_AudioStatsElapsedNS(start);
+            } else {
+                busy_ns += SDL_AudioStatsAddTime(device, &device->stats.callback, start);
+            }
         }
         SDL_UnlockMutex(device->mixer_lock);
 
         if (device->stream) {
             /* Stream available audio to device, converting/resampling. */
             /* if this fails...oh well. We'll play silence here. */
+            start = SDL_GetPerformanceCounter();
             SDL_AudioStreamPut(device->stream, data, data_len);
+            busy_ns += SDL_AudioStatsAddTime(device, &device->stats.conversion, start);
 
             while (SDL_AudioStreamAvailable(device->stream) >= ((int) device->spec.size)) {
                 int got;
                 data = SDL_AtomicGet(&device->enabled) ? current_audio.impl.GetDeviceBuf(device) : NULL;
+                start = SDL_GetPerformanceCounter();
                 got = SDL_AudioStreamGet(device->stream, data ? data : device->work_buffer, device->spec.size);
+                busy_ns += SDL_AudioStatsAddTime(device, &device->stats.conversion, start);
                 SDL_assert((got <= 0) || (got == device->spec.size));
 
+                start = SDL_GetPerformanceCounter();
                 if (data == NULL) {  /* device is having issues... */
                     const Uint32 delay = ((device->spec.samples * 1000) / device->spec.freq);
                     SDL_Delay(delay);  /* wait for as long as this buffer would have played. Maybe device recovers later? */
+                    stalled = SDL_TRUE;
                 } else {
                     if (got != device->spec.size) {
                         SDL_memset(data, device->spec.silence, device->spec.size);
@@ -771,16 +1241,24 @@ SDL_RunAudio(void *devicep)
                     current_audio.impl.PlayDevice(device);
                     current_audio.impl.WaitDevice(device);
                 }
+                SDL_AudioStatsAddTime(device, &device->stats.wait, start);
             }
         } else if (data == device->work_buffer) {
             /* nothing to do; pause like we queued a buffer to play. */
             const Uint32 delay = ((device->spec.samples * 1000) / device->spec.freq);
+            start = SDL_GetPerformanceCounter();
             SDL_Delay(delay);
+            SDL_AudioStatsAddTime(device, &device->stats.wait, start);
+            stalled = SDL_TRUE;
         } else {  /* writing directly to the device. */
             /* queue this buffer and wait for it to finish playing. */
+            start = SDL_GetPerformanceCounter();
             current_audio.impl.PlayDevice(device);
             current_audio.impl.WaitDevice(device);
+            SDL_AudioStatsAddTime(device, &device->stats.wait, start);
         }
+
+        SDL_AudioStatsEndIteration(device, busy_ns, stalled);
     }
 
     /* Wait for the audio to drain. */
@@ -825,6 +1303,9 @@ SDL_CaptureAudio(void *devicep)
     while (!SDL_AtomicGet(&device->shutdown)) {
         int still_need;
         Uint8 *ptr;
+        Uint64 busy_ns = 0;
+        Uint64 start;
+        SDL_bool stalled = SDL_FALSE;
 
         if (SDL_AtomicGet(&device->paused)) {
             SDL_Delay(delay);  /* just so we don't cook the CPU. */
@@ -848,8 +1329,10 @@ SDL_CaptureAudio(void *devicep)
            and block when there isn't data so this thread isn't eating CPU.
            But we don't process it further or call the app's callback. */
 
+        start = SDL_GetPerformanceCounter();
         if (!SDL_AtomicGet(&device->enabled)) {
             SDL_Delay(delay);  /* try to keep callback firing at normal pace. */
+            stalled = SDL_TRUE;
         } else {
             while (still_need > 0) {
                 const int rc = current_audio.impl.CaptureFromDevice(device, ptr, still_need);
@@ -863,6 +1346,7 @@ SDL_CaptureAudio(void *devicep)
                 }
             }
         }
+        SDL_AudioStatsAddTime(device, &device->stats.wait, start);
 
         if (still_need > 0) {
             /* Keep any data we already read, silence the rest. */
@@ -871,10 +1355,15 @@ SDL_CaptureAudio(void *devicep)
 
         if (device->stream) {
             /* if this fails...oh well. */
+            start = SDL_GetPerformanceCounter();
             SDL_AudioStreamPut(device->stream, data, data_len);
+            busy_ns += SDL_AudioStatsAddTime(device, &device->stats.conversion, start);
 
             while (SDL_AudioStreamAvailable(device->stream) >= ((int) device->callbackspec.size)) {
-                const int got = SDL_AudioStreamGet(device->stream, device->work_buffer, device->callbackspec.size);
+                int got;
+                start = SDL_GetPerformanceCounter();
+                got = SDL_AudioStreamGet(device->stream, device->work_buffer, device->callbackspec.size);
+                busy_ns += SDL_AudioStatsAddTime(device, &device->stats.conversion, start);
                 SDL_assert((got < 0) || (got == device->callbackspec.size));
                 if (got != device->callbackspec.size) {
                     SDL_memset(device->work_buffer, device->spec.silence, device->callbackspec.size);
@@ -883,7 +1372,9 @@ SDL_CaptureAudio(void *devicep)
                 /* !!! FIXME: this should be LockDevice. */
                 SDL_LockMutex(device->mixer_lock);
                 if (!SDL_AtomicGet(&device->paused)) {
+                    start = SDL_GetPerformanceCounter();
                     callback(udata, device->work_buffer, device->callbackspec.size);
+                    busy_ns += SDL_AudioStatsAddTime(device, &device->stats.callback, start);
                 }
                 SDL_UnlockMutex(device->mixer_lock);
             }
@@ -891,10 +1382,14 @@ SDL_CaptureAudio(void *devicep)
             /* !!! FIXME: this should be LockDevice. */
             SDL_LockMutex(device->mixer_lock);
             if (!SDL_AtomicGet(&device->paused)) {
+                start = SDL_GetPerformanceCounter();
                 callback(udata, data, device->callbackspec.size);
+                busy_ns += SDL_AudioStatsAddTime(device, &device->stats.callback, start);
             }
             SDL_UnlockMutex(device->mixer_lock);
         }
+
+        SDL_AudioStatsEndIteration(device, busy_ns, stalled);
     }
 
     current_audio.impl.FlushCapture(device);
@@ -1202,11 +1697,20 @@ close_audio_device(SDL_AudioDevice * device)
 
     /* make sure the device is paused before we do anything else, so the
        audio callback definitely won't fire again. */
-    current_audio.impl.LockDevice(device);
+    SDL_AtomicLock(&bound_streams_lock);
+    lock_device_callback(device);
     SDL_AtomicSet(&device->paused, 1);
     SDL_AtomicSet(&device->shutdown, 1);
     SDL_AtomicSet(&device->enabled, 0);
-    current_audio.impl.UnlockDevice(device);
+    device->num_bound_streams = 0;  /* streams being freed won't look for themselves here anymore. */
+    unlock_device_callback(device);
+    SDL_AtomicUnlock(&bound_streams_lock);
+
+    if (device->lookahead) {
+        /* let a copy out of the lookahead that's already running finish; it's short. */
+        current_audio.impl.LockDevice(device);
+        current_audio.impl.UnlockDevice(device);
+    }
 
     if (device->thread != NULL) {
         SDL_WaitThread(device->thread, NULL);
@@ -1230,7 +1734,16 @@ close_audio_device(SDL_AudioDevice * device)
         current_audio.impl.CloseDevice(device);
     }
 
-    SDL_FreeDataQueue(device->buffer_queue);
+    /* backends with their own callback thread can still be draining the
+       lookahead buffers until CloseDevice, so it has to go after that. */
+    if (device->lookahead != NULL) {
+        SDL_StopAudioLookahead(device);
+    }
+    SDL_free(device->bound_streams);
+    SDL_free(device->bound_stream_sources);
+    SDL_free(device->bound_stream_buffer);
+
+    SDL_FreeSPSCDataQueue(device->buffer_queue);
 
     SDL_free(device);
 }
@@ -1406,6 +1919,7 @@ open_audio_device(const char *devname, int iscapture,
         return 0;
     }
     device->id = id + 1;
+    device->queue_starved = SDL_TRUE;  /* nothing queued yet isn't an underrun. */
     device->spec = *obtained;
     device->iscapture = iscapture ? SDL_TRUE : SDL_FALSE;
     device->handle = handle;
@@ -1494,7 +2008,7 @@ open_audio_device(const char *devname, int iscapture,
 
     if (device->spec.callback == NULL) {  /* use buffer queueing? */
         /* pool a few packets to start. Enough for two callbacks. */
-        device->buffer_queue = SDL_NewDataQueue(SDL_AUDIOBUFFERQUEUE_PACKETLEN, obtained->size * 2);
+        device->buffer_queue = SDL_NewSPSCDataQueue(SDL_AUDIOBUFFERQUEUE_PACKETLEN, obtained->size * 2);
         if (!device->buffer_queue) {
             close_audio_device(device);
             SDL_SetError("Couldn't create audio buffer queue");
@@ -1502,6 +2016,21 @@ open_audio_device(const char *devname, int iscapture,
         }
         device->callbackspec.callback = iscapture ? SDL_BufferQueueFillCallback : SDL_BufferQueueDrainCallback;
         device->callbackspec.userdata = device;
+    } else if (!iscapture) {
+        const char *hint = SDL_GetHint(SDL_HINT_AUDIO_CALLBACK_LOOKAHEAD);
+        const int depth = SDL_clamp(hint ? SDL_atoi(hint) : 0, 0, SDL_AUDIO_MAX_LOOKAHEAD);
+        if (depth > 0 && SDL_StartAudioLookahead(device, depth) < 0) {
+            close_audio_device(device);
+            return 0;
+        }
+    }
+
+    /* bound streams get mixed from the callback itself, so it's done the same way on every backend. */
+    if (!iscapture && !device->lookahead) {
+        device->bound_callback = device->callbackspec.callback;
+        device->bound_userdata = device->callbackspec.userdata;
+        device->callbackspec.callback = SDL_BoundStreamsCallback;
+        device->callbackspec.userdata = device;
     }
 
     /* Allocate a scratch audio buffer */
@@ -1613,9 +2142,9 @@ SDL_PauseAudioDevice(SDL_AudioDeviceID devid, int pause_on)
 {
     SDL_AudioDevice *device = get_audio_device(devid);
     if (device) {
-        current_audio.impl.LockDevice(device);
+        lock_device_callback(device);
         SDL_AtomicSet(&device->paused, pause_on ? 1 : 0);
-        current_audio.impl.UnlockDevice(device);
+        unlock_device_callback(device);
     }
 }
 
@@ -1632,7 +2161,7 @@ SDL_LockAudioDevice(SDL_AudioDeviceID devid)
     /* Obtain a lock on the mixing buffers */
     SDL_AudioDevice *device = get_audio_device(devid);
     if (device) {
-        current_audio.impl.LockDevice(device);
+        lock_device_callback(device);
     }
 }
 
@@ -1648,7 +2177,7 @@ SDL_UnlockAudioDevice(SDL_AudioDeviceID devid)
     /* Obtain a lock on the mixing buffers */
     SDL_AudioDevice *device = get_audio_device(devid);
     if (device) {
-        current_audio.impl.UnlockDevice(device);
+        unlock_device_callback(device);
     }
 }
 
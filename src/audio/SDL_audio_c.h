@@ -55,6 +55,9 @@ extern SDL_AudioFormat SDL_NextAudioFormat(void);
 extern Uint8 SDL_SilenceValueForFormat(const SDL_AudioFormat format);
 extern void SDL_CalculateAudioSpec(SDL_AudioSpec * spec);
 
+/* The format a stream hands out from SDL_AudioStreamGet(), for SDL_BindAudioStream() */
+extern void SDL_GetAudioStreamOutputSpec(SDL_AudioStream *stream, SDL_AudioFormat *format, Uint8 *channels, int *rate);
+
 /* Choose the audio filter functions below */
 extern void SDL_ChooseAudioConverters(void);
 
@@ -69,6 +72,20 @@ extern SDL_AudioFilter SDL_Convert_F32_to_U8;
 extern SDL_AudioFilter SDL_Convert_F32_to_S16;
 extern SDL_AudioFilter SDL_Convert_F32_to_U16;
 extern SDL_AudioFilter SDL_Convert_F32_to_S32;
+extern SDL_AudioFilter SDL_Convert_S8_to_S16;
+extern SDL_AudioFilter SDL_Convert_U8_to_S16;
+extern SDL_AudioFilter SDL_Convert_U16_to_S16;
+extern SDL_AudioFilter SDL_Convert_S32_to_S16;
+extern SDL_AudioFilter SDL_Convert_S16_to_S8;
+extern SDL_AudioFilter SDL_Convert_S16_to_U8;
+extern SDL_AudioFilter SDL_Convert_S16_to_U16;
+extern SDL_AudioFilter SDL_Convert_S16_to_S32;
+
+/* G.711 expanders: num_samples bytes in, num_samples AUDIO_S16SYS samples out.
+   dst may be the same buffer as src. */
+typedef void (*SDL_G711Converter)(const Uint8 *src, Sint16 *dst, size_t num_samples);
+extern SDL_G711Converter SDL_Convert_ULaw_to_S16;
+extern SDL_G711Converter SDL_Convert_ALaw_to_S16;
 
 #endif /* SDL_audio_c_h_ */
 
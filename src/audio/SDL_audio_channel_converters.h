@@ -1455,5 +1455,8785 @@ static const SDL_AudioFilter channel_converters[8][8] = {   /* [from][to] */
     { SDL_Convert71ToMono, SDL_Convert71ToStereo, SDL_Convert71To21, SDL_Convert71ToQuad, SDL_Convert71To41, SDL_Convert71To51, SDL_Convert71To61, NULL }
 };
 
+#if HAVE_SSE_INTRINSICS
+
+static void SDLCALL
+SDL_ConvertMonoTo21_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 1) * 3))) - 3;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("mono", "2.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 1); i >= 4; i -= 4, src -= 4, dst -= 12) {
+        __m128 in[1], out[4];
+        in[0] = _mm_loadu_ps(src - 3);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[0];
+        out[2] /* LFE */ = _mm_setzero_ps();
+        out[3] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 9, out[0], 3);
+        SDL_StoreChannels_SSE(dst - 6, out[1], 3);
+        SDL_StoreChannels_SSE(dst - 3, out[2], 3);
+        SDL_StoreChannels_SSE(dst, out[3], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 1, dst -= 3) {
+        const float srcFC = src[0];
+        dst[2] /* LFE */ = 0.0f;
+        dst[1] /* FR */ = srcFC;
+        dst[0] /* FL */ = srcFC;
+    }
+
+    cvt->len_cvt = cvt->len_cvt * 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertMonoToQuad_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 1) * 4))) - 4;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("mono", "quad (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 1); i >= 4; i -= 4, src -= 4, dst -= 16) {
+        __m128 in[1], out[4];
+        in[0] = _mm_loadu_ps(src - 3);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[0];
+        out[2] /* BL */ = _mm_setzero_ps();
+        out[3] /* BR */ = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 12, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 8, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 4, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 1, dst -= 4) {
+        const float srcFC = src[0];
+        dst[3] /* BR */ = 0.0f;
+        dst[2] /* BL */ = 0.0f;
+        dst[1] /* FR */ = srcFC;
+        dst[0] /* FL */ = srcFC;
+    }
+
+    cvt->len_cvt = cvt->len_cvt * 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertMonoTo41_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 1) * 5))) - 5;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("mono", "4.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 1); i >= 4; i -= 4, src -= 4, dst -= 20) {
+        __m128 in[1], out[8];
+        in[0] = _mm_loadu_ps(src - 3);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[0];
+        out[2] /* LFE */ = _mm_setzero_ps();
+        out[3] /* BL */ = _mm_setzero_ps();
+        out[4] /* BR */ = _mm_setzero_ps();
+        out[5] = out[6] = out[7] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 15, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 10, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 5, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+        SDL_StoreChannels_SSE(dst - 11, out[4], 1);
+        SDL_StoreChannels_SSE(dst - 6, out[5], 1);
+        SDL_StoreChannels_SSE(dst - 1, out[6], 1);
+        SDL_StoreChannels_SSE(dst + 4, out[7], 1);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 1, dst -= 5) {
+        const float srcFC = src[0];
+        dst[4] /* BR */ = 0.0f;
+        dst[3] /* BL */ = 0.0f;
+        dst[2] /* LFE */ = 0.0f;
+        dst[1] /* FR */ = srcFC;
+        dst[0] /* FL */ = srcFC;
+    }
+
+    cvt->len_cvt = cvt->len_cvt * 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertMonoTo51_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 1) * 6))) - 6;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("mono", "5.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 1); i >= 4; i -= 4, src -= 4, dst -= 24) {
+        __m128 in[1], out[8];
+        in[0] = _mm_loadu_ps(src - 3);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[0];
+        out[2] /* FC */ = _mm_setzero_ps();
+        out[3] /* LFE */ = _mm_setzero_ps();
+        out[4] /* BL */ = _mm_setzero_ps();
+        out[5] /* BR */ = _mm_setzero_ps();
+        out[6] = out[7] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 18, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 12, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 6, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+        SDL_StoreChannels_SSE(dst - 14, out[4], 2);
+        SDL_StoreChannels_SSE(dst - 8, out[5], 2);
+        SDL_StoreChannels_SSE(dst - 2, out[6], 2);
+        SDL_StoreChannels_SSE(dst + 4, out[7], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 1, dst -= 6) {
+        const float srcFC = src[0];
+        dst[5] /* BR */ = 0.0f;
+        dst[4] /* BL */ = 0.0f;
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = srcFC;
+        dst[0] /* FL */ = srcFC;
+    }
+
+    cvt->len_cvt = cvt->len_cvt * 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertMonoTo61_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 1) * 7))) - 7;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("mono", "6.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 1); i >= 4; i -= 4, src -= 4, dst -= 28) {
+        __m128 in[1], out[8];
+        in[0] = _mm_loadu_ps(src - 3);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[0];
+        out[2] /* FC */ = _mm_setzero_ps();
+        out[3] /* LFE */ = _mm_setzero_ps();
+        out[4] /* BC */ = _mm_setzero_ps();
+        out[5] /* SL */ = _mm_setzero_ps();
+        out[6] /* SR */ = _mm_setzero_ps();
+        out[7] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 21, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 14, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 7, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+        SDL_StoreChannels_SSE(dst - 17, out[4], 3);
+        SDL_StoreChannels_SSE(dst - 10, out[5], 3);
+        SDL_StoreChannels_SSE(dst - 3, out[6], 3);
+        SDL_StoreChannels_SSE(dst + 4, out[7], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 1, dst -= 7) {
+        const float srcFC = src[0];
+        dst[6] /* SR */ = 0.0f;
+        dst[5] /* SL */ = 0.0f;
+        dst[4] /* BC */ = 0.0f;
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = srcFC;
+        dst[0] /* FL */ = srcFC;
+    }
+
+    cvt->len_cvt = cvt->len_cvt * 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertMonoTo71_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 1) * 8))) - 8;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("mono", "7.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 1); i >= 4; i -= 4, src -= 4, dst -= 32) {
+        __m128 in[1], out[8];
+        in[0] = _mm_loadu_ps(src - 3);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[0];
+        out[2] /* FC */ = _mm_setzero_ps();
+        out[3] /* LFE */ = _mm_setzero_ps();
+        out[4] /* BL */ = _mm_setzero_ps();
+        out[5] /* BR */ = _mm_setzero_ps();
+        out[6] /* SL */ = _mm_setzero_ps();
+        out[7] /* SR */ = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 24, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 16, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 8, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+        SDL_StoreChannels_SSE(dst - 20, out[4], 4);
+        SDL_StoreChannels_SSE(dst - 12, out[5], 4);
+        SDL_StoreChannels_SSE(dst - 4, out[6], 4);
+        SDL_StoreChannels_SSE(dst + 4, out[7], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 1, dst -= 8) {
+        const float srcFC = src[0];
+        dst[7] /* SR */ = 0.0f;
+        dst[6] /* SL */ = 0.0f;
+        dst[5] /* BR */ = 0.0f;
+        dst[4] /* BL */ = 0.0f;
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = srcFC;
+        dst[0] /* FL */ = srcFC;
+    }
+
+    cvt->len_cvt = cvt->len_cvt * 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertStereoToMono_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("stereo", "mono (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 2); i >= 4; i -= 4, src += 8, dst += 4) {
+        __m128 in[4], out[1];
+        in[0] = SDL_LoadChannels_SSE(src, 2);
+        in[1] = SDL_LoadChannels_SSE(src + 2, 2);
+        in[2] = SDL_LoadChannels_SSE(src + 4, 2);
+        in[3] = SDL_LoadChannels_SSE(src + 6, 2);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        out[0] /* FC */ = _mm_mul_ps(in[0], _mm_set1_ps(0.500000000f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[1], _mm_set1_ps(0.500000000f)));
+        _mm_storeu_ps(dst, out[0]);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 2, dst += 1) {
+        dst[0] /* FC */ = (src[0] * 0.500000000f) + (src[1] * 0.500000000f);
+    }
+
+    cvt->len_cvt = cvt->len_cvt / 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertStereoTo21_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 2) * 3))) - 3;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 2;
+    int i;
+
+    LOG_DEBUG_CONVERT("stereo", "2.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 2); i >= 4; i -= 4, src -= 8, dst -= 12) {
+        __m128 in[4], out[4];
+        in[0] = SDL_LoadChannels_SSE(src - 6, 2);
+        in[1] = SDL_LoadChannels_SSE(src - 4, 2);
+        in[2] = SDL_LoadChannels_SSE(src - 2, 2);
+        in[3] = SDL_LoadChannels_SSE(src, 2);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* LFE */ = _mm_setzero_ps();
+        out[3] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 9, out[0], 3);
+        SDL_StoreChannels_SSE(dst - 6, out[1], 3);
+        SDL_StoreChannels_SSE(dst - 3, out[2], 3);
+        SDL_StoreChannels_SSE(dst, out[3], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 2, dst -= 3) {
+        dst[2] /* LFE */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 2) * 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertStereoToQuad_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 2) * 4))) - 4;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 2;
+    int i;
+
+    LOG_DEBUG_CONVERT("stereo", "quad (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 2); i >= 4; i -= 4, src -= 8, dst -= 16) {
+        __m128 in[4], out[4];
+        in[0] = SDL_LoadChannels_SSE(src - 6, 2);
+        in[1] = SDL_LoadChannels_SSE(src - 4, 2);
+        in[2] = SDL_LoadChannels_SSE(src - 2, 2);
+        in[3] = SDL_LoadChannels_SSE(src, 2);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* BL */ = _mm_setzero_ps();
+        out[3] /* BR */ = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 12, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 8, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 4, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 2, dst -= 4) {
+        dst[3] /* BR */ = 0.0f;
+        dst[2] /* BL */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 2) * 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertStereoTo41_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 2) * 5))) - 5;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 2;
+    int i;
+
+    LOG_DEBUG_CONVERT("stereo", "4.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 2); i >= 4; i -= 4, src -= 8, dst -= 20) {
+        __m128 in[4], out[8];
+        in[0] = SDL_LoadChannels_SSE(src - 6, 2);
+        in[1] = SDL_LoadChannels_SSE(src - 4, 2);
+        in[2] = SDL_LoadChannels_SSE(src - 2, 2);
+        in[3] = SDL_LoadChannels_SSE(src, 2);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* LFE */ = _mm_setzero_ps();
+        out[3] /* BL */ = _mm_setzero_ps();
+        out[4] /* BR */ = _mm_setzero_ps();
+        out[5] = out[6] = out[7] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 15, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 10, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 5, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+        SDL_StoreChannels_SSE(dst - 11, out[4], 1);
+        SDL_StoreChannels_SSE(dst - 6, out[5], 1);
+        SDL_StoreChannels_SSE(dst - 1, out[6], 1);
+        SDL_StoreChannels_SSE(dst + 4, out[7], 1);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 2, dst -= 5) {
+        dst[4] /* BR */ = 0.0f;
+        dst[3] /* BL */ = 0.0f;
+        dst[2] /* LFE */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 2) * 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertStereoTo51_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 2) * 6))) - 6;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 2;
+    int i;
+
+    LOG_DEBUG_CONVERT("stereo", "5.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 2); i >= 4; i -= 4, src -= 8, dst -= 24) {
+        __m128 in[4], out[8];
+        in[0] = SDL_LoadChannels_SSE(src - 6, 2);
+        in[1] = SDL_LoadChannels_SSE(src - 4, 2);
+        in[2] = SDL_LoadChannels_SSE(src - 2, 2);
+        in[3] = SDL_LoadChannels_SSE(src, 2);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = _mm_setzero_ps();
+        out[3] /* LFE */ = _mm_setzero_ps();
+        out[4] /* BL */ = _mm_setzero_ps();
+        out[5] /* BR */ = _mm_setzero_ps();
+        out[6] = out[7] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 18, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 12, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 6, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+        SDL_StoreChannels_SSE(dst - 14, out[4], 2);
+        SDL_StoreChannels_SSE(dst - 8, out[5], 2);
+        SDL_StoreChannels_SSE(dst - 2, out[6], 2);
+        SDL_StoreChannels_SSE(dst + 4, out[7], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 2, dst -= 6) {
+        dst[5] /* BR */ = 0.0f;
+        dst[4] /* BL */ = 0.0f;
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 2) * 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertStereoTo61_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 2) * 7))) - 7;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 2;
+    int i;
+
+    LOG_DEBUG_CONVERT("stereo", "6.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 2); i >= 4; i -= 4, src -= 8, dst -= 28) {
+        __m128 in[4], out[8];
+        in[0] = SDL_LoadChannels_SSE(src - 6, 2);
+        in[1] = SDL_LoadChannels_SSE(src - 4, 2);
+        in[2] = SDL_LoadChannels_SSE(src - 2, 2);
+        in[3] = SDL_LoadChannels_SSE(src, 2);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = _mm_setzero_ps();
+        out[3] /* LFE */ = _mm_setzero_ps();
+        out[4] /* BC */ = _mm_setzero_ps();
+        out[5] /* SL */ = _mm_setzero_ps();
+        out[6] /* SR */ = _mm_setzero_ps();
+        out[7] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 21, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 14, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 7, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+        SDL_StoreChannels_SSE(dst - 17, out[4], 3);
+        SDL_StoreChannels_SSE(dst - 10, out[5], 3);
+        SDL_StoreChannels_SSE(dst - 3, out[6], 3);
+        SDL_StoreChannels_SSE(dst + 4, out[7], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 2, dst -= 7) {
+        dst[6] /* SR */ = 0.0f;
+        dst[5] /* SL */ = 0.0f;
+        dst[4] /* BC */ = 0.0f;
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 2) * 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertStereoTo71_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 2) * 8))) - 8;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 2;
+    int i;
+
+    LOG_DEBUG_CONVERT("stereo", "7.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 2); i >= 4; i -= 4, src -= 8, dst -= 32) {
+        __m128 in[4], out[8];
+        in[0] = SDL_LoadChannels_SSE(src - 6, 2);
+        in[1] = SDL_LoadChannels_SSE(src - 4, 2);
+        in[2] = SDL_LoadChannels_SSE(src - 2, 2);
+        in[3] = SDL_LoadChannels_SSE(src, 2);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = _mm_setzero_ps();
+        out[3] /* LFE */ = _mm_setzero_ps();
+        out[4] /* BL */ = _mm_setzero_ps();
+        out[5] /* BR */ = _mm_setzero_ps();
+        out[6] /* SL */ = _mm_setzero_ps();
+        out[7] /* SR */ = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 24, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 16, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 8, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+        SDL_StoreChannels_SSE(dst - 20, out[4], 4);
+        SDL_StoreChannels_SSE(dst - 12, out[5], 4);
+        SDL_StoreChannels_SSE(dst - 4, out[6], 4);
+        SDL_StoreChannels_SSE(dst + 4, out[7], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 2, dst -= 8) {
+        dst[7] /* SR */ = 0.0f;
+        dst[6] /* SL */ = 0.0f;
+        dst[5] /* BR */ = 0.0f;
+        dst[4] /* BL */ = 0.0f;
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 2) * 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert21ToMono_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("2.1", "mono (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 3); i >= 4; i -= 4, src += 12, dst += 4) {
+        __m128 in[4], out[1];
+        in[0] = SDL_LoadChannels_SSE(src, 3);
+        in[1] = SDL_LoadChannels_SSE(src + 3, 3);
+        in[2] = SDL_LoadChannels_SSE(src + 6, 3);
+        in[3] = SDL_LoadChannels_SSE(src + 9, 3);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        out[0] /* FC */ = _mm_mul_ps(in[0], _mm_set1_ps(0.333333343f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[1], _mm_set1_ps(0.333333343f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.333333343f)));
+        _mm_storeu_ps(dst, out[0]);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 3, dst += 1) {
+        dst[0] /* FC */ = (src[0] * 0.333333343f) + (src[1] * 0.333333343f) + (src[2] * 0.333333343f);
+    }
+
+    cvt->len_cvt = cvt->len_cvt / 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert21ToStereo_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("2.1", "stereo (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 3); i >= 4; i -= 4, src += 12, dst += 8) {
+        __m128 in[4], out[4];
+        in[0] = SDL_LoadChannels_SSE(src, 3);
+        in[1] = SDL_LoadChannels_SSE(src + 3, 3);
+        in[2] = SDL_LoadChannels_SSE(src + 6, 3);
+        in[3] = SDL_LoadChannels_SSE(src + 9, 3);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.800000012f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.200000003f)));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.800000012f));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[2], _mm_set1_ps(0.200000003f)));
+        out[2] = out[3] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst, out[0], 2);
+        SDL_StoreChannels_SSE(dst + 2, out[1], 2);
+        SDL_StoreChannels_SSE(dst + 4, out[2], 2);
+        SDL_StoreChannels_SSE(dst + 6, out[3], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 3, dst += 2) {
+        const float srcLFE = src[2];
+        dst[0] /* FL */ = (src[0] * 0.800000012f) + (srcLFE * 0.200000003f);
+        dst[1] /* FR */ = (src[1] * 0.800000012f) + (srcLFE * 0.200000003f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 3) * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert21ToQuad_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 3) * 4))) - 4;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 3;
+    int i;
+
+    LOG_DEBUG_CONVERT("2.1", "quad (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 3); i >= 4; i -= 4, src -= 12, dst -= 16) {
+        __m128 in[4], out[4];
+        in[0] = SDL_LoadChannels_SSE(src - 9, 3);
+        in[1] = SDL_LoadChannels_SSE(src - 6, 3);
+        in[2] = SDL_LoadChannels_SSE(src - 3, 3);
+        in[3] = SDL_LoadChannels_SSE(src, 3);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.888888896f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.111111112f)));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.888888896f));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[2], _mm_set1_ps(0.111111112f)));
+        out[2] /* BL */ = _mm_mul_ps(in[2], _mm_set1_ps(0.111111112f));
+        out[3] /* BR */ = _mm_mul_ps(in[2], _mm_set1_ps(0.111111112f));
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 12, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 8, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 4, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 3, dst -= 4) {
+        const float srcLFE = src[2];
+        dst[3] /* BR */ = (srcLFE * 0.111111112f);
+        dst[2] /* BL */ = (srcLFE * 0.111111112f);
+        dst[1] /* FR */ = (srcLFE * 0.111111112f) + (src[1] * 0.888888896f);
+        dst[0] /* FL */ = (srcLFE * 0.111111112f) + (src[0] * 0.888888896f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 3) * 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert21To41_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 3) * 5))) - 5;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 3;
+    int i;
+
+    LOG_DEBUG_CONVERT("2.1", "4.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 3); i >= 4; i -= 4, src -= 12, dst -= 20) {
+        __m128 in[4], out[8];
+        in[0] = SDL_LoadChannels_SSE(src - 9, 3);
+        in[1] = SDL_LoadChannels_SSE(src - 6, 3);
+        in[2] = SDL_LoadChannels_SSE(src - 3, 3);
+        in[3] = SDL_LoadChannels_SSE(src, 3);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* LFE */ = in[2];
+        out[3] /* BL */ = _mm_setzero_ps();
+        out[4] /* BR */ = _mm_setzero_ps();
+        out[5] = out[6] = out[7] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 15, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 10, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 5, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+        SDL_StoreChannels_SSE(dst - 11, out[4], 1);
+        SDL_StoreChannels_SSE(dst - 6, out[5], 1);
+        SDL_StoreChannels_SSE(dst - 1, out[6], 1);
+        SDL_StoreChannels_SSE(dst + 4, out[7], 1);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 3, dst -= 5) {
+        dst[4] /* BR */ = 0.0f;
+        dst[3] /* BL */ = 0.0f;
+        dst[2] /* LFE */ = src[2];
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 3) * 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert21To51_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 3) * 6))) - 6;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 3;
+    int i;
+
+    LOG_DEBUG_CONVERT("2.1", "5.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 3); i >= 4; i -= 4, src -= 12, dst -= 24) {
+        __m128 in[4], out[8];
+        in[0] = SDL_LoadChannels_SSE(src - 9, 3);
+        in[1] = SDL_LoadChannels_SSE(src - 6, 3);
+        in[2] = SDL_LoadChannels_SSE(src - 3, 3);
+        in[3] = SDL_LoadChannels_SSE(src, 3);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = _mm_setzero_ps();
+        out[3] /* LFE */ = in[2];
+        out[4] /* BL */ = _mm_setzero_ps();
+        out[5] /* BR */ = _mm_setzero_ps();
+        out[6] = out[7] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 18, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 12, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 6, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+        SDL_StoreChannels_SSE(dst - 14, out[4], 2);
+        SDL_StoreChannels_SSE(dst - 8, out[5], 2);
+        SDL_StoreChannels_SSE(dst - 2, out[6], 2);
+        SDL_StoreChannels_SSE(dst + 4, out[7], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 3, dst -= 6) {
+        dst[5] /* BR */ = 0.0f;
+        dst[4] /* BL */ = 0.0f;
+        dst[3] /* LFE */ = src[2];
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 3) * 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert21To61_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 3) * 7))) - 7;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 3;
+    int i;
+
+    LOG_DEBUG_CONVERT("2.1", "6.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 3); i >= 4; i -= 4, src -= 12, dst -= 28) {
+        __m128 in[4], out[8];
+        in[0] = SDL_LoadChannels_SSE(src - 9, 3);
+        in[1] = SDL_LoadChannels_SSE(src - 6, 3);
+        in[2] = SDL_LoadChannels_SSE(src - 3, 3);
+        in[3] = SDL_LoadChannels_SSE(src, 3);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = _mm_setzero_ps();
+        out[3] /* LFE */ = in[2];
+        out[4] /* BC */ = _mm_setzero_ps();
+        out[5] /* SL */ = _mm_setzero_ps();
+        out[6] /* SR */ = _mm_setzero_ps();
+        out[7] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 21, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 14, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 7, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+        SDL_StoreChannels_SSE(dst - 17, out[4], 3);
+        SDL_StoreChannels_SSE(dst - 10, out[5], 3);
+        SDL_StoreChannels_SSE(dst - 3, out[6], 3);
+        SDL_StoreChannels_SSE(dst + 4, out[7], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 3, dst -= 7) {
+        dst[6] /* SR */ = 0.0f;
+        dst[5] /* SL */ = 0.0f;
+        dst[4] /* BC */ = 0.0f;
+        dst[3] /* LFE */ = src[2];
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 3) * 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert21To71_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 3) * 8))) - 8;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 3;
+    int i;
+
+    LOG_DEBUG_CONVERT("2.1", "7.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 3); i >= 4; i -= 4, src -= 12, dst -= 32) {
+        __m128 in[4], out[8];
+        in[0] = SDL_LoadChannels_SSE(src - 9, 3);
+        in[1] = SDL_LoadChannels_SSE(src - 6, 3);
+        in[2] = SDL_LoadChannels_SSE(src - 3, 3);
+        in[3] = SDL_LoadChannels_SSE(src, 3);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = _mm_setzero_ps();
+        out[3] /* LFE */ = in[2];
+        out[4] /* BL */ = _mm_setzero_ps();
+        out[5] /* BR */ = _mm_setzero_ps();
+        out[6] /* SL */ = _mm_setzero_ps();
+        out[7] /* SR */ = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 24, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 16, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 8, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+        SDL_StoreChannels_SSE(dst - 20, out[4], 4);
+        SDL_StoreChannels_SSE(dst - 12, out[5], 4);
+        SDL_StoreChannels_SSE(dst - 4, out[6], 4);
+        SDL_StoreChannels_SSE(dst + 4, out[7], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 3, dst -= 8) {
+        dst[7] /* SR */ = 0.0f;
+        dst[6] /* SL */ = 0.0f;
+        dst[5] /* BR */ = 0.0f;
+        dst[4] /* BL */ = 0.0f;
+        dst[3] /* LFE */ = src[2];
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 3) * 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertQuadToMono_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("quad", "mono (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 4); i >= 4; i -= 4, src += 16, dst += 4) {
+        __m128 in[4], out[1];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 4, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 8, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 12, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        out[0] /* FC */ = _mm_mul_ps(in[0], _mm_set1_ps(0.250000000f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[1], _mm_set1_ps(0.250000000f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.250000000f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[3], _mm_set1_ps(0.250000000f)));
+        _mm_storeu_ps(dst, out[0]);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 4, dst += 1) {
+        dst[0] /* FC */ = (src[0] * 0.250000000f) + (src[1] * 0.250000000f) + (src[2] * 0.250000000f) + (src[3] * 0.250000000f);
+    }
+
+    cvt->len_cvt = cvt->len_cvt / 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertQuadToStereo_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("quad", "stereo (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 4); i >= 4; i -= 4, src += 16, dst += 8) {
+        __m128 in[4], out[4];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 4, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 8, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 12, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.421000004f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.358999997f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[3], _mm_set1_ps(0.219999999f)));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.421000004f));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[2], _mm_set1_ps(0.219999999f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[3], _mm_set1_ps(0.358999997f)));
+        out[2] = out[3] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst, out[0], 2);
+        SDL_StoreChannels_SSE(dst + 2, out[1], 2);
+        SDL_StoreChannels_SSE(dst + 4, out[2], 2);
+        SDL_StoreChannels_SSE(dst + 6, out[3], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 4, dst += 2) {
+        const float srcBL = src[2];
+        const float srcBR = src[3];
+        dst[0] /* FL */ = (src[0] * 0.421000004f) + (srcBL * 0.358999997f) + (srcBR * 0.219999999f);
+        dst[1] /* FR */ = (src[1] * 0.421000004f) + (srcBL * 0.219999999f) + (srcBR * 0.358999997f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 4) * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertQuadTo21_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("quad", "2.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 4); i >= 4; i -= 4, src += 16, dst += 12) {
+        __m128 in[4], out[4];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 4, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 8, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 12, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.421000004f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.358999997f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[3], _mm_set1_ps(0.219999999f)));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.421000004f));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[2], _mm_set1_ps(0.219999999f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[3], _mm_set1_ps(0.358999997f)));
+        out[2] /* LFE */ = _mm_setzero_ps();
+        out[3] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst, out[0], 3);
+        SDL_StoreChannels_SSE(dst + 3, out[1], 3);
+        SDL_StoreChannels_SSE(dst + 6, out[2], 3);
+        SDL_StoreChannels_SSE(dst + 9, out[3], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 4, dst += 3) {
+        const float srcBL = src[2];
+        const float srcBR = src[3];
+        dst[0] /* FL */ = (src[0] * 0.421000004f) + (srcBL * 0.358999997f) + (srcBR * 0.219999999f);
+        dst[1] /* FR */ = (src[1] * 0.421000004f) + (srcBL * 0.219999999f) + (srcBR * 0.358999997f);
+        dst[2] /* LFE */ = 0.0f;
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 4) * 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertQuadTo41_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 4) * 5))) - 5;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 4;
+    int i;
+
+    LOG_DEBUG_CONVERT("quad", "4.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 4); i >= 4; i -= 4, src -= 16, dst -= 20) {
+        __m128 in[4], out[8];
+        in[0] = SDL_LoadChannels_SSE(src - 12, 4);
+        in[1] = SDL_LoadChannels_SSE(src - 8, 4);
+        in[2] = SDL_LoadChannels_SSE(src - 4, 4);
+        in[3] = SDL_LoadChannels_SSE(src, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* LFE */ = _mm_setzero_ps();
+        out[3] /* BL */ = in[2];
+        out[4] /* BR */ = in[3];
+        out[5] = out[6] = out[7] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 15, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 10, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 5, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+        _MM_TRANSPOSE4_PS(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_SSE(dst - 11, out[4], 1);
+        SDL_StoreChannels_SSE(dst - 6, out[5], 1);
+        SDL_StoreChannels_SSE(dst - 1, out[6], 1);
+        SDL_StoreChannels_SSE(dst + 4, out[7], 1);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 4, dst -= 5) {
+        dst[4] /* BR */ = src[3];
+        dst[3] /* BL */ = src[2];
+        dst[2] /* LFE */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 4) * 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertQuadTo51_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 4) * 6))) - 6;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 4;
+    int i;
+
+    LOG_DEBUG_CONVERT("quad", "5.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 4); i >= 4; i -= 4, src -= 16, dst -= 24) {
+        __m128 in[4], out[8];
+        in[0] = SDL_LoadChannels_SSE(src - 12, 4);
+        in[1] = SDL_LoadChannels_SSE(src - 8, 4);
+        in[2] = SDL_LoadChannels_SSE(src - 4, 4);
+        in[3] = SDL_LoadChannels_SSE(src, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = _mm_setzero_ps();
+        out[3] /* LFE */ = _mm_setzero_ps();
+        out[4] /* BL */ = in[2];
+        out[5] /* BR */ = in[3];
+        out[6] = out[7] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 18, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 12, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 6, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+        _MM_TRANSPOSE4_PS(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_SSE(dst - 14, out[4], 2);
+        SDL_StoreChannels_SSE(dst - 8, out[5], 2);
+        SDL_StoreChannels_SSE(dst - 2, out[6], 2);
+        SDL_StoreChannels_SSE(dst + 4, out[7], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 4, dst -= 6) {
+        dst[5] /* BR */ = src[3];
+        dst[4] /* BL */ = src[2];
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 4) * 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertQuadTo61_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 4) * 7))) - 7;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 4;
+    int i;
+
+    LOG_DEBUG_CONVERT("quad", "6.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 4); i >= 4; i -= 4, src -= 16, dst -= 28) {
+        __m128 in[4], out[8];
+        in[0] = SDL_LoadChannels_SSE(src - 12, 4);
+        in[1] = SDL_LoadChannels_SSE(src - 8, 4);
+        in[2] = SDL_LoadChannels_SSE(src - 4, 4);
+        in[3] = SDL_LoadChannels_SSE(src, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.939999998f));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.939999998f));
+        out[2] /* FC */ = _mm_setzero_ps();
+        out[3] /* LFE */ = _mm_setzero_ps();
+        out[4] /* BC */ = _mm_mul_ps(in[2], _mm_set1_ps(0.500000000f));
+        out[4] = _mm_add_ps(out[4], _mm_mul_ps(in[3], _mm_set1_ps(0.500000000f)));
+        out[5] /* SL */ = _mm_mul_ps(in[2], _mm_set1_ps(0.796000004f));
+        out[6] /* SR */ = _mm_mul_ps(in[3], _mm_set1_ps(0.796000004f));
+        out[7] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 21, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 14, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 7, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+        _MM_TRANSPOSE4_PS(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_SSE(dst - 17, out[4], 3);
+        SDL_StoreChannels_SSE(dst - 10, out[5], 3);
+        SDL_StoreChannels_SSE(dst - 3, out[6], 3);
+        SDL_StoreChannels_SSE(dst + 4, out[7], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 4, dst -= 7) {
+        const float srcBL = src[2];
+        const float srcBR = src[3];
+        dst[6] /* SR */ = (srcBR * 0.796000004f);
+        dst[5] /* SL */ = (srcBL * 0.796000004f);
+        dst[4] /* BC */ = (srcBR * 0.500000000f) + (srcBL * 0.500000000f);
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = (src[1] * 0.939999998f);
+        dst[0] /* FL */ = (src[0] * 0.939999998f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 4) * 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertQuadTo71_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 4) * 8))) - 8;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 4;
+    int i;
+
+    LOG_DEBUG_CONVERT("quad", "7.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 4); i >= 4; i -= 4, src -= 16, dst -= 32) {
+        __m128 in[4], out[8];
+        in[0] = SDL_LoadChannels_SSE(src - 12, 4);
+        in[1] = SDL_LoadChannels_SSE(src - 8, 4);
+        in[2] = SDL_LoadChannels_SSE(src - 4, 4);
+        in[3] = SDL_LoadChannels_SSE(src, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = _mm_setzero_ps();
+        out[3] /* LFE */ = _mm_setzero_ps();
+        out[4] /* BL */ = in[2];
+        out[5] /* BR */ = in[3];
+        out[6] /* SL */ = _mm_setzero_ps();
+        out[7] /* SR */ = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 24, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 16, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 8, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+        _MM_TRANSPOSE4_PS(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_SSE(dst - 20, out[4], 4);
+        SDL_StoreChannels_SSE(dst - 12, out[5], 4);
+        SDL_StoreChannels_SSE(dst - 4, out[6], 4);
+        SDL_StoreChannels_SSE(dst + 4, out[7], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 4, dst -= 8) {
+        dst[7] /* SR */ = 0.0f;
+        dst[6] /* SL */ = 0.0f;
+        dst[5] /* BR */ = src[3];
+        dst[4] /* BL */ = src[2];
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 4) * 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert41ToMono_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("4.1", "mono (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 5); i >= 4; i -= 4, src += 20, dst += 4) {
+        __m128 in[8], out[1];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 5, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 10, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 15, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src + 4, 1);
+        in[5] = SDL_LoadChannels_SSE(src + 9, 1);
+        in[6] = SDL_LoadChannels_SSE(src + 14, 1);
+        in[7] = SDL_LoadChannels_SSE(src + 19, 1);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FC */ = _mm_mul_ps(in[0], _mm_set1_ps(0.200000003f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[1], _mm_set1_ps(0.200000003f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.200000003f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[3], _mm_set1_ps(0.200000003f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[4], _mm_set1_ps(0.200000003f)));
+        _mm_storeu_ps(dst, out[0]);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 5, dst += 1) {
+        dst[0] /* FC */ = (src[0] * 0.200000003f) + (src[1] * 0.200000003f) + (src[2] * 0.200000003f) + (src[3] * 0.200000003f) + (src[4] * 0.200000003f);
+    }
+
+    cvt->len_cvt = cvt->len_cvt / 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert41ToStereo_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("4.1", "stereo (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 5); i >= 4; i -= 4, src += 20, dst += 8) {
+        __m128 in[8], out[4];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 5, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 10, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 15, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src + 4, 1);
+        in[5] = SDL_LoadChannels_SSE(src + 9, 1);
+        in[6] = SDL_LoadChannels_SSE(src + 14, 1);
+        in[7] = SDL_LoadChannels_SSE(src + 19, 1);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.374222219f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.111111112f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[3], _mm_set1_ps(0.319111109f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[4], _mm_set1_ps(0.195555553f)));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.374222219f));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[2], _mm_set1_ps(0.111111112f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[3], _mm_set1_ps(0.195555553f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[4], _mm_set1_ps(0.319111109f)));
+        out[2] = out[3] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst, out[0], 2);
+        SDL_StoreChannels_SSE(dst + 2, out[1], 2);
+        SDL_StoreChannels_SSE(dst + 4, out[2], 2);
+        SDL_StoreChannels_SSE(dst + 6, out[3], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 5, dst += 2) {
+        const float srcLFE = src[2];
+        const float srcBL = src[3];
+        const float srcBR = src[4];
+        dst[0] /* FL */ = (src[0] * 0.374222219f) + (srcLFE * 0.111111112f) + (srcBL * 0.319111109f) + (srcBR * 0.195555553f);
+        dst[1] /* FR */ = (src[1] * 0.374222219f) + (srcLFE * 0.111111112f) + (srcBL * 0.195555553f) + (srcBR * 0.319111109f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 5) * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert41To21_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("4.1", "2.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 5); i >= 4; i -= 4, src += 20, dst += 12) {
+        __m128 in[8], out[4];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 5, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 10, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 15, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src + 4, 1);
+        in[5] = SDL_LoadChannels_SSE(src + 9, 1);
+        in[6] = SDL_LoadChannels_SSE(src + 14, 1);
+        in[7] = SDL_LoadChannels_SSE(src + 19, 1);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.421000004f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[3], _mm_set1_ps(0.358999997f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[4], _mm_set1_ps(0.219999999f)));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.421000004f));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[3], _mm_set1_ps(0.219999999f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[4], _mm_set1_ps(0.358999997f)));
+        out[2] /* LFE */ = in[2];
+        out[3] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst, out[0], 3);
+        SDL_StoreChannels_SSE(dst + 3, out[1], 3);
+        SDL_StoreChannels_SSE(dst + 6, out[2], 3);
+        SDL_StoreChannels_SSE(dst + 9, out[3], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 5, dst += 3) {
+        const float srcBL = src[3];
+        const float srcBR = src[4];
+        dst[0] /* FL */ = (src[0] * 0.421000004f) + (srcBL * 0.358999997f) + (srcBR * 0.219999999f);
+        dst[1] /* FR */ = (src[1] * 0.421000004f) + (srcBL * 0.219999999f) + (srcBR * 0.358999997f);
+        dst[2] /* LFE */ = src[2];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 5) * 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert41ToQuad_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("4.1", "quad (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 5); i >= 4; i -= 4, src += 20, dst += 16) {
+        __m128 in[8], out[4];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 5, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 10, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 15, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src + 4, 1);
+        in[5] = SDL_LoadChannels_SSE(src + 9, 1);
+        in[6] = SDL_LoadChannels_SSE(src + 14, 1);
+        in[7] = SDL_LoadChannels_SSE(src + 19, 1);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.941176474f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.058823530f)));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.941176474f));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[2], _mm_set1_ps(0.058823530f)));
+        out[2] /* BL */ = _mm_mul_ps(in[2], _mm_set1_ps(0.058823530f));
+        out[2] = _mm_add_ps(out[2], _mm_mul_ps(in[3], _mm_set1_ps(0.941176474f)));
+        out[3] /* BR */ = _mm_mul_ps(in[2], _mm_set1_ps(0.058823530f));
+        out[3] = _mm_add_ps(out[3], _mm_mul_ps(in[4], _mm_set1_ps(0.941176474f)));
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst, out[0], 4);
+        SDL_StoreChannels_SSE(dst + 4, out[1], 4);
+        SDL_StoreChannels_SSE(dst + 8, out[2], 4);
+        SDL_StoreChannels_SSE(dst + 12, out[3], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 5, dst += 4) {
+        const float srcLFE = src[2];
+        dst[0] /* FL */ = (src[0] * 0.941176474f) + (srcLFE * 0.058823530f);
+        dst[1] /* FR */ = (src[1] * 0.941176474f) + (srcLFE * 0.058823530f);
+        dst[2] /* BL */ = (srcLFE * 0.058823530f) + (src[3] * 0.941176474f);
+        dst[3] /* BR */ = (srcLFE * 0.058823530f) + (src[4] * 0.941176474f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 5) * 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert41To51_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 5) * 6))) - 6;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 5;
+    int i;
+
+    LOG_DEBUG_CONVERT("4.1", "5.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 5); i >= 4; i -= 4, src -= 20, dst -= 24) {
+        __m128 in[8], out[8];
+        in[0] = SDL_LoadChannels_SSE(src - 15, 4);
+        in[1] = SDL_LoadChannels_SSE(src - 10, 4);
+        in[2] = SDL_LoadChannels_SSE(src - 5, 4);
+        in[3] = SDL_LoadChannels_SSE(src, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src - 11, 1);
+        in[5] = SDL_LoadChannels_SSE(src - 6, 1);
+        in[6] = SDL_LoadChannels_SSE(src - 1, 1);
+        in[7] = SDL_LoadChannels_SSE(src + 4, 1);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = _mm_setzero_ps();
+        out[3] /* LFE */ = in[2];
+        out[4] /* BL */ = in[3];
+        out[5] /* BR */ = in[4];
+        out[6] = out[7] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 18, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 12, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 6, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+        _MM_TRANSPOSE4_PS(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_SSE(dst - 14, out[4], 2);
+        SDL_StoreChannels_SSE(dst - 8, out[5], 2);
+        SDL_StoreChannels_SSE(dst - 2, out[6], 2);
+        SDL_StoreChannels_SSE(dst + 4, out[7], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 5, dst -= 6) {
+        dst[5] /* BR */ = src[4];
+        dst[4] /* BL */ = src[3];
+        dst[3] /* LFE */ = src[2];
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 5) * 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert41To61_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 5) * 7))) - 7;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 5;
+    int i;
+
+    LOG_DEBUG_CONVERT("4.1", "6.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 5); i >= 4; i -= 4, src -= 20, dst -= 28) {
+        __m128 in[8], out[8];
+        in[0] = SDL_LoadChannels_SSE(src - 15, 4);
+        in[1] = SDL_LoadChannels_SSE(src - 10, 4);
+        in[2] = SDL_LoadChannels_SSE(src - 5, 4);
+        in[3] = SDL_LoadChannels_SSE(src, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src - 11, 1);
+        in[5] = SDL_LoadChannels_SSE(src - 6, 1);
+        in[6] = SDL_LoadChannels_SSE(src - 1, 1);
+        in[7] = SDL_LoadChannels_SSE(src + 4, 1);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.939999998f));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.939999998f));
+        out[2] /* FC */ = _mm_setzero_ps();
+        out[3] /* LFE */ = in[2];
+        out[4] /* BC */ = _mm_mul_ps(in[3], _mm_set1_ps(0.500000000f));
+        out[4] = _mm_add_ps(out[4], _mm_mul_ps(in[4], _mm_set1_ps(0.500000000f)));
+        out[5] /* SL */ = _mm_mul_ps(in[3], _mm_set1_ps(0.796000004f));
+        out[6] /* SR */ = _mm_mul_ps(in[4], _mm_set1_ps(0.796000004f));
+        out[7] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 21, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 14, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 7, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+        _MM_TRANSPOSE4_PS(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_SSE(dst - 17, out[4], 3);
+        SDL_StoreChannels_SSE(dst - 10, out[5], 3);
+        SDL_StoreChannels_SSE(dst - 3, out[6], 3);
+        SDL_StoreChannels_SSE(dst + 4, out[7], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 5, dst -= 7) {
+        const float srcBL = src[3];
+        const float srcBR = src[4];
+        dst[6] /* SR */ = (srcBR * 0.796000004f);
+        dst[5] /* SL */ = (srcBL * 0.796000004f);
+        dst[4] /* BC */ = (srcBR * 0.500000000f) + (srcBL * 0.500000000f);
+        dst[3] /* LFE */ = src[2];
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = (src[1] * 0.939999998f);
+        dst[0] /* FL */ = (src[0] * 0.939999998f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 5) * 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert41To71_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 5) * 8))) - 8;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 5;
+    int i;
+
+    LOG_DEBUG_CONVERT("4.1", "7.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 5); i >= 4; i -= 4, src -= 20, dst -= 32) {
+        __m128 in[8], out[8];
+        in[0] = SDL_LoadChannels_SSE(src - 15, 4);
+        in[1] = SDL_LoadChannels_SSE(src - 10, 4);
+        in[2] = SDL_LoadChannels_SSE(src - 5, 4);
+        in[3] = SDL_LoadChannels_SSE(src, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src - 11, 1);
+        in[5] = SDL_LoadChannels_SSE(src - 6, 1);
+        in[6] = SDL_LoadChannels_SSE(src - 1, 1);
+        in[7] = SDL_LoadChannels_SSE(src + 4, 1);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = _mm_setzero_ps();
+        out[3] /* LFE */ = in[2];
+        out[4] /* BL */ = in[3];
+        out[5] /* BR */ = in[4];
+        out[6] /* SL */ = _mm_setzero_ps();
+        out[7] /* SR */ = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 24, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 16, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 8, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+        _MM_TRANSPOSE4_PS(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_SSE(dst - 20, out[4], 4);
+        SDL_StoreChannels_SSE(dst - 12, out[5], 4);
+        SDL_StoreChannels_SSE(dst - 4, out[6], 4);
+        SDL_StoreChannels_SSE(dst + 4, out[7], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 5, dst -= 8) {
+        dst[7] /* SR */ = 0.0f;
+        dst[6] /* SL */ = 0.0f;
+        dst[5] /* BR */ = src[4];
+        dst[4] /* BL */ = src[3];
+        dst[3] /* LFE */ = src[2];
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 5) * 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert51ToMono_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("5.1", "mono (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 6); i >= 4; i -= 4, src += 24, dst += 4) {
+        __m128 in[8], out[1];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 6, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 12, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 18, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src + 4, 2);
+        in[5] = SDL_LoadChannels_SSE(src + 10, 2);
+        in[6] = SDL_LoadChannels_SSE(src + 16, 2);
+        in[7] = SDL_LoadChannels_SSE(src + 22, 2);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FC */ = _mm_mul_ps(in[0], _mm_set1_ps(0.166666672f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[1], _mm_set1_ps(0.166666672f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.166666672f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[3], _mm_set1_ps(0.166666672f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[4], _mm_set1_ps(0.166666672f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[5], _mm_set1_ps(0.166666672f)));
+        _mm_storeu_ps(dst, out[0]);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 6, dst += 1) {
+        dst[0] /* FC */ = (src[0] * 0.166666672f) + (src[1] * 0.166666672f) + (src[2] * 0.166666672f) + (src[3] * 0.166666672f) + (src[4] * 0.166666672f) + (src[5] * 0.166666672f);
+    }
+
+    cvt->len_cvt = cvt->len_cvt / 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert51ToStereo_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("5.1", "stereo (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 6); i >= 4; i -= 4, src += 24, dst += 8) {
+        __m128 in[8], out[4];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 6, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 12, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 18, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src + 4, 2);
+        in[5] = SDL_LoadChannels_SSE(src + 10, 2);
+        in[6] = SDL_LoadChannels_SSE(src + 16, 2);
+        in[7] = SDL_LoadChannels_SSE(src + 22, 2);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.294545442f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.208181813f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[3], _mm_set1_ps(0.090909094f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[4], _mm_set1_ps(0.251818180f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[5], _mm_set1_ps(0.154545456f)));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.294545442f));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[2], _mm_set1_ps(0.208181813f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[3], _mm_set1_ps(0.090909094f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[4], _mm_set1_ps(0.154545456f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[5], _mm_set1_ps(0.251818180f)));
+        out[2] = out[3] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst, out[0], 2);
+        SDL_StoreChannels_SSE(dst + 2, out[1], 2);
+        SDL_StoreChannels_SSE(dst + 4, out[2], 2);
+        SDL_StoreChannels_SSE(dst + 6, out[3], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 6, dst += 2) {
+        const float srcFC = src[2];
+        const float srcLFE = src[3];
+        const float srcBL = src[4];
+        const float srcBR = src[5];
+        dst[0] /* FL */ = (src[0] * 0.294545442f) + (srcFC * 0.208181813f) + (srcLFE * 0.090909094f) + (srcBL * 0.251818180f) + (srcBR * 0.154545456f);
+        dst[1] /* FR */ = (src[1] * 0.294545442f) + (srcFC * 0.208181813f) + (srcLFE * 0.090909094f) + (srcBL * 0.154545456f) + (srcBR * 0.251818180f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 6) * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert51To21_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("5.1", "2.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 6); i >= 4; i -= 4, src += 24, dst += 12) {
+        __m128 in[8], out[4];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 6, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 12, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 18, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src + 4, 2);
+        in[5] = SDL_LoadChannels_SSE(src + 10, 2);
+        in[6] = SDL_LoadChannels_SSE(src + 16, 2);
+        in[7] = SDL_LoadChannels_SSE(src + 22, 2);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.324000001f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.229000002f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[4], _mm_set1_ps(0.277000010f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[5], _mm_set1_ps(0.170000002f)));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.324000001f));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[2], _mm_set1_ps(0.229000002f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[4], _mm_set1_ps(0.170000002f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[5], _mm_set1_ps(0.277000010f)));
+        out[2] /* LFE */ = in[3];
+        out[3] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst, out[0], 3);
+        SDL_StoreChannels_SSE(dst + 3, out[1], 3);
+        SDL_StoreChannels_SSE(dst + 6, out[2], 3);
+        SDL_StoreChannels_SSE(dst + 9, out[3], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 6, dst += 3) {
+        const float srcFC = src[2];
+        const float srcBL = src[4];
+        const float srcBR = src[5];
+        dst[0] /* FL */ = (src[0] * 0.324000001f) + (srcFC * 0.229000002f) + (srcBL * 0.277000010f) + (srcBR * 0.170000002f);
+        dst[1] /* FR */ = (src[1] * 0.324000001f) + (srcFC * 0.229000002f) + (srcBL * 0.170000002f) + (srcBR * 0.277000010f);
+        dst[2] /* LFE */ = src[3];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 6) * 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert51ToQuad_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("5.1", "quad (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 6); i >= 4; i -= 4, src += 24, dst += 16) {
+        __m128 in[8], out[4];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 6, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 12, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 18, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src + 4, 2);
+        in[5] = SDL_LoadChannels_SSE(src + 10, 2);
+        in[6] = SDL_LoadChannels_SSE(src + 16, 2);
+        in[7] = SDL_LoadChannels_SSE(src + 22, 2);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.558095276f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.394285709f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[3], _mm_set1_ps(0.047619049f)));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.558095276f));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[2], _mm_set1_ps(0.394285709f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[3], _mm_set1_ps(0.047619049f)));
+        out[2] /* BL */ = _mm_mul_ps(in[3], _mm_set1_ps(0.047619049f));
+        out[2] = _mm_add_ps(out[2], _mm_mul_ps(in[4], _mm_set1_ps(0.558095276f)));
+        out[3] /* BR */ = _mm_mul_ps(in[3], _mm_set1_ps(0.047619049f));
+        out[3] = _mm_add_ps(out[3], _mm_mul_ps(in[5], _mm_set1_ps(0.558095276f)));
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst, out[0], 4);
+        SDL_StoreChannels_SSE(dst + 4, out[1], 4);
+        SDL_StoreChannels_SSE(dst + 8, out[2], 4);
+        SDL_StoreChannels_SSE(dst + 12, out[3], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 6, dst += 4) {
+        const float srcFC = src[2];
+        const float srcLFE = src[3];
+        dst[0] /* FL */ = (src[0] * 0.558095276f) + (srcFC * 0.394285709f) + (srcLFE * 0.047619049f);
+        dst[1] /* FR */ = (src[1] * 0.558095276f) + (srcFC * 0.394285709f) + (srcLFE * 0.047619049f);
+        dst[2] /* BL */ = (srcLFE * 0.047619049f) + (src[4] * 0.558095276f);
+        dst[3] /* BR */ = (srcLFE * 0.047619049f) + (src[5] * 0.558095276f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 6) * 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert51To41_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("5.1", "4.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 6); i >= 4; i -= 4, src += 24, dst += 20) {
+        __m128 in[8], out[8];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 6, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 12, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 18, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src + 4, 2);
+        in[5] = SDL_LoadChannels_SSE(src + 10, 2);
+        in[6] = SDL_LoadChannels_SSE(src + 16, 2);
+        in[7] = SDL_LoadChannels_SSE(src + 22, 2);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.586000025f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.414000005f)));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.586000025f));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[2], _mm_set1_ps(0.414000005f)));
+        out[2] /* LFE */ = in[3];
+        out[3] /* BL */ = _mm_mul_ps(in[4], _mm_set1_ps(0.586000025f));
+        out[4] /* BR */ = _mm_mul_ps(in[5], _mm_set1_ps(0.586000025f));
+        out[5] = out[6] = out[7] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst, out[0], 4);
+        SDL_StoreChannels_SSE(dst + 5, out[1], 4);
+        SDL_StoreChannels_SSE(dst + 10, out[2], 4);
+        SDL_StoreChannels_SSE(dst + 15, out[3], 4);
+        _MM_TRANSPOSE4_PS(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_SSE(dst + 4, out[4], 1);
+        SDL_StoreChannels_SSE(dst + 9, out[5], 1);
+        SDL_StoreChannels_SSE(dst + 14, out[6], 1);
+        SDL_StoreChannels_SSE(dst + 19, out[7], 1);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 6, dst += 5) {
+        const float srcFC = src[2];
+        dst[0] /* FL */ = (src[0] * 0.586000025f) + (srcFC * 0.414000005f);
+        dst[1] /* FR */ = (src[1] * 0.586000025f) + (srcFC * 0.414000005f);
+        dst[2] /* LFE */ = src[3];
+        dst[3] /* BL */ = (src[4] * 0.586000025f);
+        dst[4] /* BR */ = (src[5] * 0.586000025f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 6) * 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert51To61_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 6) * 7))) - 7;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 6;
+    int i;
+
+    LOG_DEBUG_CONVERT("5.1", "6.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 6); i >= 4; i -= 4, src -= 24, dst -= 28) {
+        __m128 in[8], out[8];
+        in[0] = SDL_LoadChannels_SSE(src - 18, 4);
+        in[1] = SDL_LoadChannels_SSE(src - 12, 4);
+        in[2] = SDL_LoadChannels_SSE(src - 6, 4);
+        in[3] = SDL_LoadChannels_SSE(src, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src - 14, 2);
+        in[5] = SDL_LoadChannels_SSE(src - 8, 2);
+        in[6] = SDL_LoadChannels_SSE(src - 2, 2);
+        in[7] = SDL_LoadChannels_SSE(src + 4, 2);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.939999998f));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.939999998f));
+        out[2] /* FC */ = _mm_mul_ps(in[2], _mm_set1_ps(0.939999998f));
+        out[3] /* LFE */ = in[3];
+        out[4] /* BC */ = _mm_mul_ps(in[4], _mm_set1_ps(0.500000000f));
+        out[4] = _mm_add_ps(out[4], _mm_mul_ps(in[5], _mm_set1_ps(0.500000000f)));
+        out[5] /* SL */ = _mm_mul_ps(in[4], _mm_set1_ps(0.796000004f));
+        out[6] /* SR */ = _mm_mul_ps(in[5], _mm_set1_ps(0.796000004f));
+        out[7] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 21, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 14, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 7, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+        _MM_TRANSPOSE4_PS(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_SSE(dst - 17, out[4], 3);
+        SDL_StoreChannels_SSE(dst - 10, out[5], 3);
+        SDL_StoreChannels_SSE(dst - 3, out[6], 3);
+        SDL_StoreChannels_SSE(dst + 4, out[7], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 6, dst -= 7) {
+        const float srcBL = src[4];
+        const float srcBR = src[5];
+        dst[6] /* SR */ = (srcBR * 0.796000004f);
+        dst[5] /* SL */ = (srcBL * 0.796000004f);
+        dst[4] /* BC */ = (srcBR * 0.500000000f) + (srcBL * 0.500000000f);
+        dst[3] /* LFE */ = src[3];
+        dst[2] /* FC */ = (src[2] * 0.939999998f);
+        dst[1] /* FR */ = (src[1] * 0.939999998f);
+        dst[0] /* FL */ = (src[0] * 0.939999998f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 6) * 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert51To71_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 6) * 8))) - 8;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 6;
+    int i;
+
+    LOG_DEBUG_CONVERT("5.1", "7.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 6); i >= 4; i -= 4, src -= 24, dst -= 32) {
+        __m128 in[8], out[8];
+        in[0] = SDL_LoadChannels_SSE(src - 18, 4);
+        in[1] = SDL_LoadChannels_SSE(src - 12, 4);
+        in[2] = SDL_LoadChannels_SSE(src - 6, 4);
+        in[3] = SDL_LoadChannels_SSE(src, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src - 14, 2);
+        in[5] = SDL_LoadChannels_SSE(src - 8, 2);
+        in[6] = SDL_LoadChannels_SSE(src - 2, 2);
+        in[7] = SDL_LoadChannels_SSE(src + 4, 2);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = in[2];
+        out[3] /* LFE */ = in[3];
+        out[4] /* BL */ = in[4];
+        out[5] /* BR */ = in[5];
+        out[6] /* SL */ = _mm_setzero_ps();
+        out[7] /* SR */ = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 24, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 16, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 8, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+        _MM_TRANSPOSE4_PS(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_SSE(dst - 20, out[4], 4);
+        SDL_StoreChannels_SSE(dst - 12, out[5], 4);
+        SDL_StoreChannels_SSE(dst - 4, out[6], 4);
+        SDL_StoreChannels_SSE(dst + 4, out[7], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 6, dst -= 8) {
+        dst[7] /* SR */ = 0.0f;
+        dst[6] /* SL */ = 0.0f;
+        dst[5] /* BR */ = src[5];
+        dst[4] /* BL */ = src[4];
+        dst[3] /* LFE */ = src[3];
+        dst[2] /* FC */ = src[2];
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 6) * 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert61ToMono_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("6.1", "mono (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 7); i >= 4; i -= 4, src += 28, dst += 4) {
+        __m128 in[8], out[1];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 7, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 14, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 21, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src + 4, 3);
+        in[5] = SDL_LoadChannels_SSE(src + 11, 3);
+        in[6] = SDL_LoadChannels_SSE(src + 18, 3);
+        in[7] = SDL_LoadChannels_SSE(src + 25, 3);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FC */ = _mm_mul_ps(in[0], _mm_set1_ps(0.143142849f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[1], _mm_set1_ps(0.143142849f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.143142849f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[3], _mm_set1_ps(0.142857149f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[4], _mm_set1_ps(0.143142849f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[5], _mm_set1_ps(0.143142849f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[6], _mm_set1_ps(0.143142849f)));
+        _mm_storeu_ps(dst, out[0]);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 7, dst += 1) {
+        dst[0] /* FC */ = (src[0] * 0.143142849f) + (src[1] * 0.143142849f) + (src[2] * 0.143142849f) + (src[3] * 0.142857149f) + (src[4] * 0.143142849f) + (src[5] * 0.143142849f) + (src[6] * 0.143142849f);
+    }
+
+    cvt->len_cvt = cvt->len_cvt / 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert61ToStereo_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("6.1", "stereo (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 7); i >= 4; i -= 4, src += 28, dst += 8) {
+        __m128 in[8], out[4];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 7, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 14, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 21, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src + 4, 3);
+        in[5] = SDL_LoadChannels_SSE(src + 11, 3);
+        in[6] = SDL_LoadChannels_SSE(src + 18, 3);
+        in[7] = SDL_LoadChannels_SSE(src + 25, 3);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.247384623f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.174461529f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[3], _mm_set1_ps(0.076923080f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[4], _mm_set1_ps(0.174461529f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[5], _mm_set1_ps(0.226153851f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[6], _mm_set1_ps(0.100615382f)));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.247384623f));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[2], _mm_set1_ps(0.174461529f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[3], _mm_set1_ps(0.076923080f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[4], _mm_set1_ps(0.174461529f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[5], _mm_set1_ps(0.100615382f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[6], _mm_set1_ps(0.226153851f)));
+        out[2] = out[3] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst, out[0], 2);
+        SDL_StoreChannels_SSE(dst + 2, out[1], 2);
+        SDL_StoreChannels_SSE(dst + 4, out[2], 2);
+        SDL_StoreChannels_SSE(dst + 6, out[3], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 7, dst += 2) {
+        const float srcFC = src[2];
+        const float srcLFE = src[3];
+        const float srcBC = src[4];
+        const float srcSL = src[5];
+        const float srcSR = src[6];
+        dst[0] /* FL */ = (src[0] * 0.247384623f) + (srcFC * 0.174461529f) + (srcLFE * 0.076923080f) + (srcBC * 0.174461529f) + (srcSL * 0.226153851f) + (srcSR * 0.100615382f);
+        dst[1] /* FR */ = (src[1] * 0.247384623f) + (srcFC * 0.174461529f) + (srcLFE * 0.076923080f) + (srcBC * 0.174461529f) + (srcSL * 0.100615382f) + (srcSR * 0.226153851f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 7) * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert61To21_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("6.1", "2.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 7); i >= 4; i -= 4, src += 28, dst += 12) {
+        __m128 in[8], out[4];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 7, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 14, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 21, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src + 4, 3);
+        in[5] = SDL_LoadChannels_SSE(src + 11, 3);
+        in[6] = SDL_LoadChannels_SSE(src + 18, 3);
+        in[7] = SDL_LoadChannels_SSE(src + 25, 3);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.268000007f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.188999996f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[4], _mm_set1_ps(0.188999996f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[5], _mm_set1_ps(0.245000005f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[6], _mm_set1_ps(0.108999997f)));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.268000007f));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[2], _mm_set1_ps(0.188999996f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[4], _mm_set1_ps(0.188999996f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[5], _mm_set1_ps(0.108999997f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[6], _mm_set1_ps(0.245000005f)));
+        out[2] /* LFE */ = in[3];
+        out[3] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst, out[0], 3);
+        SDL_StoreChannels_SSE(dst + 3, out[1], 3);
+        SDL_StoreChannels_SSE(dst + 6, out[2], 3);
+        SDL_StoreChannels_SSE(dst + 9, out[3], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 7, dst += 3) {
+        const float srcFC = src[2];
+        const float srcBC = src[4];
+        const float srcSL = src[5];
+        const float srcSR = src[6];
+        dst[0] /* FL */ = (src[0] * 0.268000007f) + (srcFC * 0.188999996f) + (srcBC * 0.188999996f) + (srcSL * 0.245000005f) + (srcSR * 0.108999997f);
+        dst[1] /* FR */ = (src[1] * 0.268000007f) + (srcFC * 0.188999996f) + (srcBC * 0.188999996f) + (srcSL * 0.108999997f) + (srcSR * 0.245000005f);
+        dst[2] /* LFE */ = src[3];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 7) * 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert61ToQuad_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("6.1", "quad (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 7); i >= 4; i -= 4, src += 28, dst += 16) {
+        __m128 in[8], out[4];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 7, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 14, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 21, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src + 4, 3);
+        in[5] = SDL_LoadChannels_SSE(src + 11, 3);
+        in[6] = SDL_LoadChannels_SSE(src + 18, 3);
+        in[7] = SDL_LoadChannels_SSE(src + 25, 3);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.463679999f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.327360004f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[3], _mm_set1_ps(0.040000003f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[5], _mm_set1_ps(0.168960005f)));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.463679999f));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[2], _mm_set1_ps(0.327360004f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[3], _mm_set1_ps(0.040000003f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[6], _mm_set1_ps(0.168960005f)));
+        out[2] /* BL */ = _mm_mul_ps(in[3], _mm_set1_ps(0.040000003f));
+        out[2] = _mm_add_ps(out[2], _mm_mul_ps(in[4], _mm_set1_ps(0.327360004f)));
+        out[2] = _mm_add_ps(out[2], _mm_mul_ps(in[5], _mm_set1_ps(0.431039989f)));
+        out[3] /* BR */ = _mm_mul_ps(in[3], _mm_set1_ps(0.040000003f));
+        out[3] = _mm_add_ps(out[3], _mm_mul_ps(in[4], _mm_set1_ps(0.327360004f)));
+        out[3] = _mm_add_ps(out[3], _mm_mul_ps(in[6], _mm_set1_ps(0.431039989f)));
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst, out[0], 4);
+        SDL_StoreChannels_SSE(dst + 4, out[1], 4);
+        SDL_StoreChannels_SSE(dst + 8, out[2], 4);
+        SDL_StoreChannels_SSE(dst + 12, out[3], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 7, dst += 4) {
+        const float srcFC = src[2];
+        const float srcLFE = src[3];
+        const float srcBC = src[4];
+        const float srcSL = src[5];
+        const float srcSR = src[6];
+        dst[0] /* FL */ = (src[0] * 0.463679999f) + (srcFC * 0.327360004f) + (srcLFE * 0.040000003f) + (srcSL * 0.168960005f);
+        dst[1] /* FR */ = (src[1] * 0.463679999f) + (srcFC * 0.327360004f) + (srcLFE * 0.040000003f) + (srcSR * 0.168960005f);
+        dst[2] /* BL */ = (srcLFE * 0.040000003f) + (srcBC * 0.327360004f) + (srcSL * 0.431039989f);
+        dst[3] /* BR */ = (srcLFE * 0.040000003f) + (srcBC * 0.327360004f) + (srcSR * 0.431039989f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 7) * 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert61To41_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("6.1", "4.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 7); i >= 4; i -= 4, src += 28, dst += 20) {
+        __m128 in[8], out[8];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 7, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 14, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 21, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src + 4, 3);
+        in[5] = SDL_LoadChannels_SSE(src + 11, 3);
+        in[6] = SDL_LoadChannels_SSE(src + 18, 3);
+        in[7] = SDL_LoadChannels_SSE(src + 25, 3);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.483000010f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.340999991f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[5], _mm_set1_ps(0.175999999f)));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.483000010f));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[2], _mm_set1_ps(0.340999991f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[6], _mm_set1_ps(0.175999999f)));
+        out[2] /* LFE */ = in[3];
+        out[3] /* BL */ = _mm_mul_ps(in[4], _mm_set1_ps(0.340999991f));
+        out[3] = _mm_add_ps(out[3], _mm_mul_ps(in[5], _mm_set1_ps(0.449000001f)));
+        out[4] /* BR */ = _mm_mul_ps(in[4], _mm_set1_ps(0.340999991f));
+        out[4] = _mm_add_ps(out[4], _mm_mul_ps(in[6], _mm_set1_ps(0.449000001f)));
+        out[5] = out[6] = out[7] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst, out[0], 4);
+        SDL_StoreChannels_SSE(dst + 5, out[1], 4);
+        SDL_StoreChannels_SSE(dst + 10, out[2], 4);
+        SDL_StoreChannels_SSE(dst + 15, out[3], 4);
+        _MM_TRANSPOSE4_PS(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_SSE(dst + 4, out[4], 1);
+        SDL_StoreChannels_SSE(dst + 9, out[5], 1);
+        SDL_StoreChannels_SSE(dst + 14, out[6], 1);
+        SDL_StoreChannels_SSE(dst + 19, out[7], 1);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 7, dst += 5) {
+        const float srcFC = src[2];
+        const float srcBC = src[4];
+        const float srcSL = src[5];
+        const float srcSR = src[6];
+        dst[0] /* FL */ = (src[0] * 0.483000010f) + (srcFC * 0.340999991f) + (srcSL * 0.175999999f);
+        dst[1] /* FR */ = (src[1] * 0.483000010f) + (srcFC * 0.340999991f) + (srcSR * 0.175999999f);
+        dst[2] /* LFE */ = src[3];
+        dst[3] /* BL */ = (srcBC * 0.340999991f) + (srcSL * 0.449000001f);
+        dst[4] /* BR */ = (srcBC * 0.340999991f) + (srcSR * 0.449000001f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 7) * 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert61To51_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("6.1", "5.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 7); i >= 4; i -= 4, src += 28, dst += 24) {
+        __m128 in[8], out[8];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 7, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 14, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 21, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src + 4, 3);
+        in[5] = SDL_LoadChannels_SSE(src + 11, 3);
+        in[6] = SDL_LoadChannels_SSE(src + 18, 3);
+        in[7] = SDL_LoadChannels_SSE(src + 25, 3);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.611000001f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[5], _mm_set1_ps(0.223000005f)));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.611000001f));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[6], _mm_set1_ps(0.223000005f)));
+        out[2] /* FC */ = _mm_mul_ps(in[2], _mm_set1_ps(0.611000001f));
+        out[3] /* LFE */ = in[3];
+        out[4] /* BL */ = _mm_mul_ps(in[4], _mm_set1_ps(0.432000011f));
+        out[4] = _mm_add_ps(out[4], _mm_mul_ps(in[5], _mm_set1_ps(0.568000019f)));
+        out[5] /* BR */ = _mm_mul_ps(in[4], _mm_set1_ps(0.432000011f));
+        out[5] = _mm_add_ps(out[5], _mm_mul_ps(in[6], _mm_set1_ps(0.568000019f)));
+        out[6] = out[7] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst, out[0], 4);
+        SDL_StoreChannels_SSE(dst + 6, out[1], 4);
+        SDL_StoreChannels_SSE(dst + 12, out[2], 4);
+        SDL_StoreChannels_SSE(dst + 18, out[3], 4);
+        _MM_TRANSPOSE4_PS(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_SSE(dst + 4, out[4], 2);
+        SDL_StoreChannels_SSE(dst + 10, out[5], 2);
+        SDL_StoreChannels_SSE(dst + 16, out[6], 2);
+        SDL_StoreChannels_SSE(dst + 22, out[7], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 7, dst += 6) {
+        const float srcBC = src[4];
+        const float srcSL = src[5];
+        const float srcSR = src[6];
+        dst[0] /* FL */ = (src[0] * 0.611000001f) + (srcSL * 0.223000005f);
+        dst[1] /* FR */ = (src[1] * 0.611000001f) + (srcSR * 0.223000005f);
+        dst[2] /* FC */ = (src[2] * 0.611000001f);
+        dst[3] /* LFE */ = src[3];
+        dst[4] /* BL */ = (srcBC * 0.432000011f) + (srcSL * 0.568000019f);
+        dst[5] /* BR */ = (srcBC * 0.432000011f) + (srcSR * 0.568000019f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 7) * 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert61To71_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 7) * 8))) - 8;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 7;
+    int i;
+
+    LOG_DEBUG_CONVERT("6.1", "7.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 7); i >= 4; i -= 4, src -= 28, dst -= 32) {
+        __m128 in[8], out[8];
+        in[0] = SDL_LoadChannels_SSE(src - 21, 4);
+        in[1] = SDL_LoadChannels_SSE(src - 14, 4);
+        in[2] = SDL_LoadChannels_SSE(src - 7, 4);
+        in[3] = SDL_LoadChannels_SSE(src, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src - 17, 3);
+        in[5] = SDL_LoadChannels_SSE(src - 10, 3);
+        in[6] = SDL_LoadChannels_SSE(src - 3, 3);
+        in[7] = SDL_LoadChannels_SSE(src + 4, 3);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = in[2];
+        out[3] /* LFE */ = in[3];
+        out[4] /* BL */ = _mm_mul_ps(in[4], _mm_set1_ps(0.707000017f));
+        out[5] /* BR */ = _mm_mul_ps(in[4], _mm_set1_ps(0.707000017f));
+        out[6] /* SL */ = in[5];
+        out[7] /* SR */ = in[6];
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst - 24, out[0], 4);
+        SDL_StoreChannels_SSE(dst - 16, out[1], 4);
+        SDL_StoreChannels_SSE(dst - 8, out[2], 4);
+        SDL_StoreChannels_SSE(dst, out[3], 4);
+        _MM_TRANSPOSE4_PS(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_SSE(dst - 20, out[4], 4);
+        SDL_StoreChannels_SSE(dst - 12, out[5], 4);
+        SDL_StoreChannels_SSE(dst - 4, out[6], 4);
+        SDL_StoreChannels_SSE(dst + 4, out[7], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 7, dst -= 8) {
+        const float srcBC = src[4];
+        dst[7] /* SR */ = src[6];
+        dst[6] /* SL */ = src[5];
+        dst[5] /* BR */ = (srcBC * 0.707000017f);
+        dst[4] /* BL */ = (srcBC * 0.707000017f);
+        dst[3] /* LFE */ = src[3];
+        dst[2] /* FC */ = src[2];
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 7) * 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert71ToMono_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("7.1", "mono (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 8); i >= 4; i -= 4, src += 32, dst += 4) {
+        __m128 in[8], out[1];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 8, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 16, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 24, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src + 4, 4);
+        in[5] = SDL_LoadChannels_SSE(src + 12, 4);
+        in[6] = SDL_LoadChannels_SSE(src + 20, 4);
+        in[7] = SDL_LoadChannels_SSE(src + 28, 4);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FC */ = _mm_mul_ps(in[0], _mm_set1_ps(0.125125006f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[1], _mm_set1_ps(0.125125006f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.125125006f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[3], _mm_set1_ps(0.125000000f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[4], _mm_set1_ps(0.125125006f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[5], _mm_set1_ps(0.125125006f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[6], _mm_set1_ps(0.125125006f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[7], _mm_set1_ps(0.125125006f)));
+        _mm_storeu_ps(dst, out[0]);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 8, dst += 1) {
+        dst[0] /* FC */ = (src[0] * 0.125125006f) + (src[1] * 0.125125006f) + (src[2] * 0.125125006f) + (src[3] * 0.125000000f) + (src[4] * 0.125125006f) + (src[5] * 0.125125006f) + (src[6] * 0.125125006f) + (src[7] * 0.125125006f);
+    }
+
+    cvt->len_cvt = cvt->len_cvt / 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert71ToStereo_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("7.1", "stereo (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 8); i >= 4; i -= 4, src += 32, dst += 8) {
+        __m128 in[8], out[4];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 8, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 16, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 24, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src + 4, 4);
+        in[5] = SDL_LoadChannels_SSE(src + 12, 4);
+        in[6] = SDL_LoadChannels_SSE(src + 20, 4);
+        in[7] = SDL_LoadChannels_SSE(src + 28, 4);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.211866662f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.150266662f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[3], _mm_set1_ps(0.066666670f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[4], _mm_set1_ps(0.181066677f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[5], _mm_set1_ps(0.111066669f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[6], _mm_set1_ps(0.194133341f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[7], _mm_set1_ps(0.085866667f)));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.211866662f));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[2], _mm_set1_ps(0.150266662f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[3], _mm_set1_ps(0.066666670f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[4], _mm_set1_ps(0.111066669f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[5], _mm_set1_ps(0.181066677f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[6], _mm_set1_ps(0.085866667f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[7], _mm_set1_ps(0.194133341f)));
+        out[2] = out[3] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst, out[0], 2);
+        SDL_StoreChannels_SSE(dst + 2, out[1], 2);
+        SDL_StoreChannels_SSE(dst + 4, out[2], 2);
+        SDL_StoreChannels_SSE(dst + 6, out[3], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 8, dst += 2) {
+        const float srcFC = src[2];
+        const float srcLFE = src[3];
+        const float srcBL = src[4];
+        const float srcBR = src[5];
+        const float srcSL = src[6];
+        const float srcSR = src[7];
+        dst[0] /* FL */ = (src[0] * 0.211866662f) + (srcFC * 0.150266662f) + (srcLFE * 0.066666670f) + (srcBL * 0.181066677f) + (srcBR * 0.111066669f) + (srcSL * 0.194133341f) + (srcSR * 0.085866667f);
+        dst[1] /* FR */ = (src[1] * 0.211866662f) + (srcFC * 0.150266662f) + (srcLFE * 0.066666670f) + (srcBL * 0.111066669f) + (srcBR * 0.181066677f) + (srcSL * 0.085866667f) + (srcSR * 0.194133341f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 8) * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert71To21_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("7.1", "2.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 8); i >= 4; i -= 4, src += 32, dst += 12) {
+        __m128 in[8], out[4];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 8, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 16, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 24, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src + 4, 4);
+        in[5] = SDL_LoadChannels_SSE(src + 12, 4);
+        in[6] = SDL_LoadChannels_SSE(src + 20, 4);
+        in[7] = SDL_LoadChannels_SSE(src + 28, 4);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.226999998f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.160999998f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[4], _mm_set1_ps(0.194000006f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[5], _mm_set1_ps(0.119000003f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[6], _mm_set1_ps(0.208000004f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[7], _mm_set1_ps(0.092000000f)));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.226999998f));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[2], _mm_set1_ps(0.160999998f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[4], _mm_set1_ps(0.119000003f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[5], _mm_set1_ps(0.194000006f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[6], _mm_set1_ps(0.092000000f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[7], _mm_set1_ps(0.208000004f)));
+        out[2] /* LFE */ = in[3];
+        out[3] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst, out[0], 3);
+        SDL_StoreChannels_SSE(dst + 3, out[1], 3);
+        SDL_StoreChannels_SSE(dst + 6, out[2], 3);
+        SDL_StoreChannels_SSE(dst + 9, out[3], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 8, dst += 3) {
+        const float srcFC = src[2];
+        const float srcBL = src[4];
+        const float srcBR = src[5];
+        const float srcSL = src[6];
+        const float srcSR = src[7];
+        dst[0] /* FL */ = (src[0] * 0.226999998f) + (srcFC * 0.160999998f) + (srcBL * 0.194000006f) + (srcBR * 0.119000003f) + (srcSL * 0.208000004f) + (srcSR * 0.092000000f);
+        dst[1] /* FR */ = (src[1] * 0.226999998f) + (srcFC * 0.160999998f) + (srcBL * 0.119000003f) + (srcBR * 0.194000006f) + (srcSL * 0.092000000f) + (srcSR * 0.208000004f);
+        dst[2] /* LFE */ = src[3];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 8) * 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert71ToQuad_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("7.1", "quad (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 8); i >= 4; i -= 4, src += 32, dst += 16) {
+        __m128 in[8], out[4];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 8, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 16, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 24, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src + 4, 4);
+        in[5] = SDL_LoadChannels_SSE(src + 12, 4);
+        in[6] = SDL_LoadChannels_SSE(src + 20, 4);
+        in[7] = SDL_LoadChannels_SSE(src + 28, 4);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.466344833f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.329241365f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[3], _mm_set1_ps(0.034482758f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[6], _mm_set1_ps(0.169931039f)));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.466344833f));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[2], _mm_set1_ps(0.329241365f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[3], _mm_set1_ps(0.034482758f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[7], _mm_set1_ps(0.169931039f)));
+        out[2] /* BL */ = _mm_mul_ps(in[3], _mm_set1_ps(0.034482758f));
+        out[2] = _mm_add_ps(out[2], _mm_mul_ps(in[4], _mm_set1_ps(0.466344833f)));
+        out[2] = _mm_add_ps(out[2], _mm_mul_ps(in[6], _mm_set1_ps(0.433517247f)));
+        out[3] /* BR */ = _mm_mul_ps(in[3], _mm_set1_ps(0.034482758f));
+        out[3] = _mm_add_ps(out[3], _mm_mul_ps(in[5], _mm_set1_ps(0.466344833f)));
+        out[3] = _mm_add_ps(out[3], _mm_mul_ps(in[7], _mm_set1_ps(0.433517247f)));
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst, out[0], 4);
+        SDL_StoreChannels_SSE(dst + 4, out[1], 4);
+        SDL_StoreChannels_SSE(dst + 8, out[2], 4);
+        SDL_StoreChannels_SSE(dst + 12, out[3], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 8, dst += 4) {
+        const float srcFC = src[2];
+        const float srcLFE = src[3];
+        const float srcSL = src[6];
+        const float srcSR = src[7];
+        dst[0] /* FL */ = (src[0] * 0.466344833f) + (srcFC * 0.329241365f) + (srcLFE * 0.034482758f) + (srcSL * 0.169931039f);
+        dst[1] /* FR */ = (src[1] * 0.466344833f) + (srcFC * 0.329241365f) + (srcLFE * 0.034482758f) + (srcSR * 0.169931039f);
+        dst[2] /* BL */ = (srcLFE * 0.034482758f) + (src[4] * 0.466344833f) + (srcSL * 0.433517247f);
+        dst[3] /* BR */ = (srcLFE * 0.034482758f) + (src[5] * 0.466344833f) + (srcSR * 0.433517247f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 8) * 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert71To41_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("7.1", "4.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 8); i >= 4; i -= 4, src += 32, dst += 20) {
+        __m128 in[8], out[8];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 8, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 16, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 24, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src + 4, 4);
+        in[5] = SDL_LoadChannels_SSE(src + 12, 4);
+        in[6] = SDL_LoadChannels_SSE(src + 20, 4);
+        in[7] = SDL_LoadChannels_SSE(src + 28, 4);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.483000010f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[2], _mm_set1_ps(0.340999991f)));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[6], _mm_set1_ps(0.175999999f)));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.483000010f));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[2], _mm_set1_ps(0.340999991f)));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[7], _mm_set1_ps(0.175999999f)));
+        out[2] /* LFE */ = in[3];
+        out[3] /* BL */ = _mm_mul_ps(in[4], _mm_set1_ps(0.483000010f));
+        out[3] = _mm_add_ps(out[3], _mm_mul_ps(in[6], _mm_set1_ps(0.449000001f)));
+        out[4] /* BR */ = _mm_mul_ps(in[5], _mm_set1_ps(0.483000010f));
+        out[4] = _mm_add_ps(out[4], _mm_mul_ps(in[7], _mm_set1_ps(0.449000001f)));
+        out[5] = out[6] = out[7] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst, out[0], 4);
+        SDL_StoreChannels_SSE(dst + 5, out[1], 4);
+        SDL_StoreChannels_SSE(dst + 10, out[2], 4);
+        SDL_StoreChannels_SSE(dst + 15, out[3], 4);
+        _MM_TRANSPOSE4_PS(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_SSE(dst + 4, out[4], 1);
+        SDL_StoreChannels_SSE(dst + 9, out[5], 1);
+        SDL_StoreChannels_SSE(dst + 14, out[6], 1);
+        SDL_StoreChannels_SSE(dst + 19, out[7], 1);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 8, dst += 5) {
+        const float srcFC = src[2];
+        const float srcSL = src[6];
+        const float srcSR = src[7];
+        dst[0] /* FL */ = (src[0] * 0.483000010f) + (srcFC * 0.340999991f) + (srcSL * 0.175999999f);
+        dst[1] /* FR */ = (src[1] * 0.483000010f) + (srcFC * 0.340999991f) + (srcSR * 0.175999999f);
+        dst[2] /* LFE */ = src[3];
+        dst[3] /* BL */ = (src[4] * 0.483000010f) + (srcSL * 0.449000001f);
+        dst[4] /* BR */ = (src[5] * 0.483000010f) + (srcSR * 0.449000001f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 8) * 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert71To51_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("7.1", "5.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 8); i >= 4; i -= 4, src += 32, dst += 24) {
+        __m128 in[8], out[8];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 8, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 16, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 24, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src + 4, 4);
+        in[5] = SDL_LoadChannels_SSE(src + 12, 4);
+        in[6] = SDL_LoadChannels_SSE(src + 20, 4);
+        in[7] = SDL_LoadChannels_SSE(src + 28, 4);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.518000007f));
+        out[0] = _mm_add_ps(out[0], _mm_mul_ps(in[6], _mm_set1_ps(0.188999996f)));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.518000007f));
+        out[1] = _mm_add_ps(out[1], _mm_mul_ps(in[7], _mm_set1_ps(0.188999996f)));
+        out[2] /* FC */ = _mm_mul_ps(in[2], _mm_set1_ps(0.518000007f));
+        out[3] /* LFE */ = in[3];
+        out[4] /* BL */ = _mm_mul_ps(in[4], _mm_set1_ps(0.518000007f));
+        out[4] = _mm_add_ps(out[4], _mm_mul_ps(in[6], _mm_set1_ps(0.481999993f)));
+        out[5] /* BR */ = _mm_mul_ps(in[5], _mm_set1_ps(0.518000007f));
+        out[5] = _mm_add_ps(out[5], _mm_mul_ps(in[7], _mm_set1_ps(0.481999993f)));
+        out[6] = out[7] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst, out[0], 4);
+        SDL_StoreChannels_SSE(dst + 6, out[1], 4);
+        SDL_StoreChannels_SSE(dst + 12, out[2], 4);
+        SDL_StoreChannels_SSE(dst + 18, out[3], 4);
+        _MM_TRANSPOSE4_PS(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_SSE(dst + 4, out[4], 2);
+        SDL_StoreChannels_SSE(dst + 10, out[5], 2);
+        SDL_StoreChannels_SSE(dst + 16, out[6], 2);
+        SDL_StoreChannels_SSE(dst + 22, out[7], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 8, dst += 6) {
+        const float srcSL = src[6];
+        const float srcSR = src[7];
+        dst[0] /* FL */ = (src[0] * 0.518000007f) + (srcSL * 0.188999996f);
+        dst[1] /* FR */ = (src[1] * 0.518000007f) + (srcSR * 0.188999996f);
+        dst[2] /* FC */ = (src[2] * 0.518000007f);
+        dst[3] /* LFE */ = src[3];
+        dst[4] /* BL */ = (src[4] * 0.518000007f) + (srcSL * 0.481999993f);
+        dst[5] /* BR */ = (src[5] * 0.518000007f) + (srcSR * 0.481999993f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 8) * 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert71To61_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("7.1", "6.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 8); i >= 4; i -= 4, src += 32, dst += 28) {
+        __m128 in[8], out[8];
+        in[0] = SDL_LoadChannels_SSE(src, 4);
+        in[1] = SDL_LoadChannels_SSE(src + 8, 4);
+        in[2] = SDL_LoadChannels_SSE(src + 16, 4);
+        in[3] = SDL_LoadChannels_SSE(src + 24, 4);
+        _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_SSE(src + 4, 4);
+        in[5] = SDL_LoadChannels_SSE(src + 12, 4);
+        in[6] = SDL_LoadChannels_SSE(src + 20, 4);
+        in[7] = SDL_LoadChannels_SSE(src + 28, 4);
+        _MM_TRANSPOSE4_PS(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm_mul_ps(in[0], _mm_set1_ps(0.541000009f));
+        out[1] /* FR */ = _mm_mul_ps(in[1], _mm_set1_ps(0.541000009f));
+        out[2] /* FC */ = _mm_mul_ps(in[2], _mm_set1_ps(0.541000009f));
+        out[3] /* LFE */ = in[3];
+        out[4] /* BC */ = _mm_mul_ps(in[4], _mm_set1_ps(0.287999988f));
+        out[4] = _mm_add_ps(out[4], _mm_mul_ps(in[5], _mm_set1_ps(0.287999988f)));
+        out[5] /* SL */ = _mm_mul_ps(in[4], _mm_set1_ps(0.458999991f));
+        out[5] = _mm_add_ps(out[5], _mm_mul_ps(in[6], _mm_set1_ps(0.541000009f)));
+        out[6] /* SR */ = _mm_mul_ps(in[5], _mm_set1_ps(0.458999991f));
+        out[6] = _mm_add_ps(out[6], _mm_mul_ps(in[7], _mm_set1_ps(0.541000009f)));
+        out[7] = _mm_setzero_ps();  /* padding for the transpose. */
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_SSE(dst, out[0], 4);
+        SDL_StoreChannels_SSE(dst + 7, out[1], 4);
+        SDL_StoreChannels_SSE(dst + 14, out[2], 4);
+        SDL_StoreChannels_SSE(dst + 21, out[3], 4);
+        _MM_TRANSPOSE4_PS(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_SSE(dst + 4, out[4], 3);
+        SDL_StoreChannels_SSE(dst + 11, out[5], 3);
+        SDL_StoreChannels_SSE(dst + 18, out[6], 3);
+        SDL_StoreChannels_SSE(dst + 25, out[7], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 8, dst += 7) {
+        const float srcBL = src[4];
+        const float srcBR = src[5];
+        dst[0] /* FL */ = (src[0] * 0.541000009f);
+        dst[1] /* FR */ = (src[1] * 0.541000009f);
+        dst[2] /* FC */ = (src[2] * 0.541000009f);
+        dst[3] /* LFE */ = src[3];
+        dst[4] /* BC */ = (srcBL * 0.287999988f) + (srcBR * 0.287999988f);
+        dst[5] /* SL */ = (srcBL * 0.458999991f) + (src[6] * 0.541000009f);
+        dst[6] /* SR */ = (srcBR * 0.458999991f) + (src[7] * 0.541000009f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 8) * 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static const SDL_AudioFilter channel_converters_SSE[8][8] = {   /* [from][to] */
+    { NULL, SDL_ConvertMonoToStereo_SSE, SDL_ConvertMonoTo21_SSE, SDL_ConvertMonoToQuad_SSE, SDL_ConvertMonoTo41_SSE, SDL_ConvertMonoTo51_SSE, SDL_ConvertMonoTo61_SSE, SDL_ConvertMonoTo71_SSE },
+    { SDL_ConvertStereoToMono_SSE, NULL, SDL_ConvertStereoTo21_SSE, SDL_ConvertStereoToQuad_SSE, SDL_ConvertStereoTo41_SSE, SDL_ConvertStereoTo51_SSE, SDL_ConvertStereoTo61_SSE, SDL_ConvertStereoTo71_SSE },
+    { SDL_Convert21ToMono_SSE, SDL_Convert21ToStereo_SSE, NULL, SDL_Convert21ToQuad_SSE, SDL_Convert21To41_SSE, SDL_Convert21To51_SSE, SDL_Convert21To61_SSE, SDL_Convert21To71_SSE },
+    { SDL_ConvertQuadToMono_SSE, SDL_ConvertQuadToStereo_SSE, SDL_ConvertQuadTo21_SSE, NULL, SDL_ConvertQuadTo41_SSE, SDL_ConvertQuadTo51_SSE, SDL_ConvertQuadTo61_SSE, SDL_ConvertQuadTo71_SSE },
+    { SDL_Convert41ToMono_SSE, SDL_Convert41ToStereo_SSE, SDL_Convert41To21_SSE, SDL_Convert41ToQuad_SSE, NULL, SDL_Convert41To51_SSE, SDL_Convert41To61_SSE, SDL_Convert41To71_SSE },
+    { SDL_Convert51ToMono_SSE, SDL_Convert51ToStereo_SSE, SDL_Convert51To21_SSE, SDL_Convert51ToQuad_SSE, SDL_Convert51To41_SSE, NULL, SDL_Convert51To61_SSE, SDL_Convert51To71_SSE },
+    { SDL_Convert61ToMono_SSE, SDL_Convert61ToStereo_SSE, SDL_Convert61To21_SSE, SDL_Convert61ToQuad_SSE, SDL_Convert61To41_SSE, SDL_Convert61To51_SSE, NULL, SDL_Convert61To71_SSE },
+    { SDL_Convert71ToMono_SSE, SDL_Convert71ToStereo_SSE, SDL_Convert71To21_SSE, SDL_Convert71ToQuad_SSE, SDL_Convert71To41_SSE, SDL_Convert71To51_SSE, SDL_Convert71To61_SSE, NULL }
+};
+
+#endif
+
+#if HAVE_AVX_INTRINSICS
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_ConvertMonoToStereo_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 1) * 2))) - 2;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("mono", "stereo (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 1); i >= 8; i -= 8, src -= 8, dst -= 16) {
+        __m256 in[1], out[4];
+        in[0] = _mm256_loadu_ps(src - 7);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[0];
+        out[2] = out[3] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 14, dst - 6, out[0], 2);
+        SDL_StoreChannels_AVX(dst - 12, dst - 4, out[1], 2);
+        SDL_StoreChannels_AVX(dst - 10, dst - 2, out[2], 2);
+        SDL_StoreChannels_AVX(dst - 8, dst, out[3], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 1, dst -= 2) {
+        const float srcFC = src[0];
+        dst[1] /* FR */ = srcFC;
+        dst[0] /* FL */ = srcFC;
+    }
+
+    cvt->len_cvt = cvt->len_cvt * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_ConvertMonoTo21_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 1) * 3))) - 3;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("mono", "2.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 1); i >= 8; i -= 8, src -= 8, dst -= 24) {
+        __m256 in[1], out[4];
+        in[0] = _mm256_loadu_ps(src - 7);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[0];
+        out[2] /* LFE */ = _mm256_setzero_ps();
+        out[3] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 21, dst - 9, out[0], 3);
+        SDL_StoreChannels_AVX(dst - 18, dst - 6, out[1], 3);
+        SDL_StoreChannels_AVX(dst - 15, dst - 3, out[2], 3);
+        SDL_StoreChannels_AVX(dst - 12, dst, out[3], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 1, dst -= 3) {
+        const float srcFC = src[0];
+        dst[2] /* LFE */ = 0.0f;
+        dst[1] /* FR */ = srcFC;
+        dst[0] /* FL */ = srcFC;
+    }
+
+    cvt->len_cvt = cvt->len_cvt * 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_ConvertMonoToQuad_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 1) * 4))) - 4;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("mono", "quad (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 1); i >= 8; i -= 8, src -= 8, dst -= 32) {
+        __m256 in[1], out[4];
+        in[0] = _mm256_loadu_ps(src - 7);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[0];
+        out[2] /* BL */ = _mm256_setzero_ps();
+        out[3] /* BR */ = _mm256_setzero_ps();
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 28, dst - 12, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 24, dst - 8, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 20, dst - 4, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 16, dst, out[3], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 1, dst -= 4) {
+        const float srcFC = src[0];
+        dst[3] /* BR */ = 0.0f;
+        dst[2] /* BL */ = 0.0f;
+        dst[1] /* FR */ = srcFC;
+        dst[0] /* FL */ = srcFC;
+    }
+
+    cvt->len_cvt = cvt->len_cvt * 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_ConvertMonoTo41_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 1) * 5))) - 5;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("mono", "4.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 1); i >= 8; i -= 8, src -= 8, dst -= 40) {
+        __m256 in[1], out[8];
+        in[0] = _mm256_loadu_ps(src - 7);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[0];
+        out[2] /* LFE */ = _mm256_setzero_ps();
+        out[3] /* BL */ = _mm256_setzero_ps();
+        out[4] /* BR */ = _mm256_setzero_ps();
+        out[5] = out[6] = out[7] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 35, dst - 15, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 30, dst - 10, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 25, dst - 5, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 20, dst, out[3], 4);
+        SDL_StoreChannels_AVX(dst - 31, dst - 11, out[4], 1);
+        SDL_StoreChannels_AVX(dst - 26, dst - 6, out[5], 1);
+        SDL_StoreChannels_AVX(dst - 21, dst - 1, out[6], 1);
+        SDL_StoreChannels_AVX(dst - 16, dst + 4, out[7], 1);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 1, dst -= 5) {
+        const float srcFC = src[0];
+        dst[4] /* BR */ = 0.0f;
+        dst[3] /* BL */ = 0.0f;
+        dst[2] /* LFE */ = 0.0f;
+        dst[1] /* FR */ = srcFC;
+        dst[0] /* FL */ = srcFC;
+    }
+
+    cvt->len_cvt = cvt->len_cvt * 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_ConvertMonoTo51_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 1) * 6))) - 6;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("mono", "5.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 1); i >= 8; i -= 8, src -= 8, dst -= 48) {
+        __m256 in[1], out[8];
+        in[0] = _mm256_loadu_ps(src - 7);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[0];
+        out[2] /* FC */ = _mm256_setzero_ps();
+        out[3] /* LFE */ = _mm256_setzero_ps();
+        out[4] /* BL */ = _mm256_setzero_ps();
+        out[5] /* BR */ = _mm256_setzero_ps();
+        out[6] = out[7] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 42, dst - 18, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 36, dst - 12, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 30, dst - 6, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 24, dst, out[3], 4);
+        SDL_StoreChannels_AVX(dst - 38, dst - 14, out[4], 2);
+        SDL_StoreChannels_AVX(dst - 32, dst - 8, out[5], 2);
+        SDL_StoreChannels_AVX(dst - 26, dst - 2, out[6], 2);
+        SDL_StoreChannels_AVX(dst - 20, dst + 4, out[7], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 1, dst -= 6) {
+        const float srcFC = src[0];
+        dst[5] /* BR */ = 0.0f;
+        dst[4] /* BL */ = 0.0f;
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = srcFC;
+        dst[0] /* FL */ = srcFC;
+    }
+
+    cvt->len_cvt = cvt->len_cvt * 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_ConvertMonoTo61_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 1) * 7))) - 7;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("mono", "6.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 1); i >= 8; i -= 8, src -= 8, dst -= 56) {
+        __m256 in[1], out[8];
+        in[0] = _mm256_loadu_ps(src - 7);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[0];
+        out[2] /* FC */ = _mm256_setzero_ps();
+        out[3] /* LFE */ = _mm256_setzero_ps();
+        out[4] /* BC */ = _mm256_setzero_ps();
+        out[5] /* SL */ = _mm256_setzero_ps();
+        out[6] /* SR */ = _mm256_setzero_ps();
+        out[7] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 49, dst - 21, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 42, dst - 14, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 35, dst - 7, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 28, dst, out[3], 4);
+        SDL_StoreChannels_AVX(dst - 45, dst - 17, out[4], 3);
+        SDL_StoreChannels_AVX(dst - 38, dst - 10, out[5], 3);
+        SDL_StoreChannels_AVX(dst - 31, dst - 3, out[6], 3);
+        SDL_StoreChannels_AVX(dst - 24, dst + 4, out[7], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 1, dst -= 7) {
+        const float srcFC = src[0];
+        dst[6] /* SR */ = 0.0f;
+        dst[5] /* SL */ = 0.0f;
+        dst[4] /* BC */ = 0.0f;
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = srcFC;
+        dst[0] /* FL */ = srcFC;
+    }
+
+    cvt->len_cvt = cvt->len_cvt * 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_ConvertMonoTo71_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 1) * 8))) - 8;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("mono", "7.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 1); i >= 8; i -= 8, src -= 8, dst -= 64) {
+        __m256 in[1], out[8];
+        in[0] = _mm256_loadu_ps(src - 7);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[0];
+        out[2] /* FC */ = _mm256_setzero_ps();
+        out[3] /* LFE */ = _mm256_setzero_ps();
+        out[4] /* BL */ = _mm256_setzero_ps();
+        out[5] /* BR */ = _mm256_setzero_ps();
+        out[6] /* SL */ = _mm256_setzero_ps();
+        out[7] /* SR */ = _mm256_setzero_ps();
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 56, dst - 24, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 48, dst - 16, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 40, dst - 8, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 32, dst, out[3], 4);
+        SDL_StoreChannels_AVX(dst - 52, dst - 20, out[4], 4);
+        SDL_StoreChannels_AVX(dst - 44, dst - 12, out[5], 4);
+        SDL_StoreChannels_AVX(dst - 36, dst - 4, out[6], 4);
+        SDL_StoreChannels_AVX(dst - 28, dst + 4, out[7], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 1, dst -= 8) {
+        const float srcFC = src[0];
+        dst[7] /* SR */ = 0.0f;
+        dst[6] /* SL */ = 0.0f;
+        dst[5] /* BR */ = 0.0f;
+        dst[4] /* BL */ = 0.0f;
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = srcFC;
+        dst[0] /* FL */ = srcFC;
+    }
+
+    cvt->len_cvt = cvt->len_cvt * 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_ConvertStereoToMono_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("stereo", "mono (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 2); i >= 8; i -= 8, src += 16, dst += 8) {
+        __m256 in[4], out[1];
+        in[0] = SDL_LoadChannels_AVX(src, src + 8, 2);
+        in[1] = SDL_LoadChannels_AVX(src + 2, src + 10, 2);
+        in[2] = SDL_LoadChannels_AVX(src + 4, src + 12, 2);
+        in[3] = SDL_LoadChannels_AVX(src + 6, src + 14, 2);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        out[0] /* FC */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.500000000f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[1], _mm256_set1_ps(0.500000000f)));
+        _mm256_storeu_ps(dst, out[0]);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 2, dst += 1) {
+        dst[0] /* FC */ = (src[0] * 0.500000000f) + (src[1] * 0.500000000f);
+    }
+
+    cvt->len_cvt = cvt->len_cvt / 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_ConvertStereoTo21_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 2) * 3))) - 3;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 2;
+    int i;
+
+    LOG_DEBUG_CONVERT("stereo", "2.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 2); i >= 8; i -= 8, src -= 16, dst -= 24) {
+        __m256 in[4], out[4];
+        in[0] = SDL_LoadChannels_AVX(src - 14, src - 6, 2);
+        in[1] = SDL_LoadChannels_AVX(src - 12, src - 4, 2);
+        in[2] = SDL_LoadChannels_AVX(src - 10, src - 2, 2);
+        in[3] = SDL_LoadChannels_AVX(src - 8, src, 2);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* LFE */ = _mm256_setzero_ps();
+        out[3] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 21, dst - 9, out[0], 3);
+        SDL_StoreChannels_AVX(dst - 18, dst - 6, out[1], 3);
+        SDL_StoreChannels_AVX(dst - 15, dst - 3, out[2], 3);
+        SDL_StoreChannels_AVX(dst - 12, dst, out[3], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 2, dst -= 3) {
+        dst[2] /* LFE */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 2) * 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_ConvertStereoToQuad_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 2) * 4))) - 4;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 2;
+    int i;
+
+    LOG_DEBUG_CONVERT("stereo", "quad (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 2); i >= 8; i -= 8, src -= 16, dst -= 32) {
+        __m256 in[4], out[4];
+        in[0] = SDL_LoadChannels_AVX(src - 14, src - 6, 2);
+        in[1] = SDL_LoadChannels_AVX(src - 12, src - 4, 2);
+        in[2] = SDL_LoadChannels_AVX(src - 10, src - 2, 2);
+        in[3] = SDL_LoadChannels_AVX(src - 8, src, 2);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* BL */ = _mm256_setzero_ps();
+        out[3] /* BR */ = _mm256_setzero_ps();
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 28, dst - 12, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 24, dst - 8, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 20, dst - 4, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 16, dst, out[3], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 2, dst -= 4) {
+        dst[3] /* BR */ = 0.0f;
+        dst[2] /* BL */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 2) * 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_ConvertStereoTo41_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 2) * 5))) - 5;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 2;
+    int i;
+
+    LOG_DEBUG_CONVERT("stereo", "4.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 2); i >= 8; i -= 8, src -= 16, dst -= 40) {
+        __m256 in[4], out[8];
+        in[0] = SDL_LoadChannels_AVX(src - 14, src - 6, 2);
+        in[1] = SDL_LoadChannels_AVX(src - 12, src - 4, 2);
+        in[2] = SDL_LoadChannels_AVX(src - 10, src - 2, 2);
+        in[3] = SDL_LoadChannels_AVX(src - 8, src, 2);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* LFE */ = _mm256_setzero_ps();
+        out[3] /* BL */ = _mm256_setzero_ps();
+        out[4] /* BR */ = _mm256_setzero_ps();
+        out[5] = out[6] = out[7] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 35, dst - 15, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 30, dst - 10, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 25, dst - 5, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 20, dst, out[3], 4);
+        SDL_StoreChannels_AVX(dst - 31, dst - 11, out[4], 1);
+        SDL_StoreChannels_AVX(dst - 26, dst - 6, out[5], 1);
+        SDL_StoreChannels_AVX(dst - 21, dst - 1, out[6], 1);
+        SDL_StoreChannels_AVX(dst - 16, dst + 4, out[7], 1);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 2, dst -= 5) {
+        dst[4] /* BR */ = 0.0f;
+        dst[3] /* BL */ = 0.0f;
+        dst[2] /* LFE */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 2) * 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_ConvertStereoTo51_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 2) * 6))) - 6;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 2;
+    int i;
+
+    LOG_DEBUG_CONVERT("stereo", "5.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 2); i >= 8; i -= 8, src -= 16, dst -= 48) {
+        __m256 in[4], out[8];
+        in[0] = SDL_LoadChannels_AVX(src - 14, src - 6, 2);
+        in[1] = SDL_LoadChannels_AVX(src - 12, src - 4, 2);
+        in[2] = SDL_LoadChannels_AVX(src - 10, src - 2, 2);
+        in[3] = SDL_LoadChannels_AVX(src - 8, src, 2);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = _mm256_setzero_ps();
+        out[3] /* LFE */ = _mm256_setzero_ps();
+        out[4] /* BL */ = _mm256_setzero_ps();
+        out[5] /* BR */ = _mm256_setzero_ps();
+        out[6] = out[7] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 42, dst - 18, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 36, dst - 12, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 30, dst - 6, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 24, dst, out[3], 4);
+        SDL_StoreChannels_AVX(dst - 38, dst - 14, out[4], 2);
+        SDL_StoreChannels_AVX(dst - 32, dst - 8, out[5], 2);
+        SDL_StoreChannels_AVX(dst - 26, dst - 2, out[6], 2);
+        SDL_StoreChannels_AVX(dst - 20, dst + 4, out[7], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 2, dst -= 6) {
+        dst[5] /* BR */ = 0.0f;
+        dst[4] /* BL */ = 0.0f;
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 2) * 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_ConvertStereoTo61_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 2) * 7))) - 7;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 2;
+    int i;
+
+    LOG_DEBUG_CONVERT("stereo", "6.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 2); i >= 8; i -= 8, src -= 16, dst -= 56) {
+        __m256 in[4], out[8];
+        in[0] = SDL_LoadChannels_AVX(src - 14, src - 6, 2);
+        in[1] = SDL_LoadChannels_AVX(src - 12, src - 4, 2);
+        in[2] = SDL_LoadChannels_AVX(src - 10, src - 2, 2);
+        in[3] = SDL_LoadChannels_AVX(src - 8, src, 2);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = _mm256_setzero_ps();
+        out[3] /* LFE */ = _mm256_setzero_ps();
+        out[4] /* BC */ = _mm256_setzero_ps();
+        out[5] /* SL */ = _mm256_setzero_ps();
+        out[6] /* SR */ = _mm256_setzero_ps();
+        out[7] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 49, dst - 21, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 42, dst - 14, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 35, dst - 7, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 28, dst, out[3], 4);
+        SDL_StoreChannels_AVX(dst - 45, dst - 17, out[4], 3);
+        SDL_StoreChannels_AVX(dst - 38, dst - 10, out[5], 3);
+        SDL_StoreChannels_AVX(dst - 31, dst - 3, out[6], 3);
+        SDL_StoreChannels_AVX(dst - 24, dst + 4, out[7], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 2, dst -= 7) {
+        dst[6] /* SR */ = 0.0f;
+        dst[5] /* SL */ = 0.0f;
+        dst[4] /* BC */ = 0.0f;
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 2) * 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_ConvertStereoTo71_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 2) * 8))) - 8;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 2;
+    int i;
+
+    LOG_DEBUG_CONVERT("stereo", "7.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 2); i >= 8; i -= 8, src -= 16, dst -= 64) {
+        __m256 in[4], out[8];
+        in[0] = SDL_LoadChannels_AVX(src - 14, src - 6, 2);
+        in[1] = SDL_LoadChannels_AVX(src - 12, src - 4, 2);
+        in[2] = SDL_LoadChannels_AVX(src - 10, src - 2, 2);
+        in[3] = SDL_LoadChannels_AVX(src - 8, src, 2);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = _mm256_setzero_ps();
+        out[3] /* LFE */ = _mm256_setzero_ps();
+        out[4] /* BL */ = _mm256_setzero_ps();
+        out[5] /* BR */ = _mm256_setzero_ps();
+        out[6] /* SL */ = _mm256_setzero_ps();
+        out[7] /* SR */ = _mm256_setzero_ps();
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 56, dst - 24, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 48, dst - 16, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 40, dst - 8, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 32, dst, out[3], 4);
+        SDL_StoreChannels_AVX(dst - 52, dst - 20, out[4], 4);
+        SDL_StoreChannels_AVX(dst - 44, dst - 12, out[5], 4);
+        SDL_StoreChannels_AVX(dst - 36, dst - 4, out[6], 4);
+        SDL_StoreChannels_AVX(dst - 28, dst + 4, out[7], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 2, dst -= 8) {
+        dst[7] /* SR */ = 0.0f;
+        dst[6] /* SL */ = 0.0f;
+        dst[5] /* BR */ = 0.0f;
+        dst[4] /* BL */ = 0.0f;
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 2) * 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert21ToMono_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("2.1", "mono (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 3); i >= 8; i -= 8, src += 24, dst += 8) {
+        __m256 in[4], out[1];
+        in[0] = SDL_LoadChannels_AVX(src, src + 12, 3);
+        in[1] = SDL_LoadChannels_AVX(src + 3, src + 15, 3);
+        in[2] = SDL_LoadChannels_AVX(src + 6, src + 18, 3);
+        in[3] = SDL_LoadChannels_AVX(src + 9, src + 21, 3);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        out[0] /* FC */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.333333343f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[1], _mm256_set1_ps(0.333333343f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.333333343f)));
+        _mm256_storeu_ps(dst, out[0]);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 3, dst += 1) {
+        dst[0] /* FC */ = (src[0] * 0.333333343f) + (src[1] * 0.333333343f) + (src[2] * 0.333333343f);
+    }
+
+    cvt->len_cvt = cvt->len_cvt / 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert21ToStereo_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("2.1", "stereo (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 3); i >= 8; i -= 8, src += 24, dst += 16) {
+        __m256 in[4], out[4];
+        in[0] = SDL_LoadChannels_AVX(src, src + 12, 3);
+        in[1] = SDL_LoadChannels_AVX(src + 3, src + 15, 3);
+        in[2] = SDL_LoadChannels_AVX(src + 6, src + 18, 3);
+        in[3] = SDL_LoadChannels_AVX(src + 9, src + 21, 3);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.800000012f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.200000003f)));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.800000012f));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[2], _mm256_set1_ps(0.200000003f)));
+        out[2] = out[3] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst, dst + 8, out[0], 2);
+        SDL_StoreChannels_AVX(dst + 2, dst + 10, out[1], 2);
+        SDL_StoreChannels_AVX(dst + 4, dst + 12, out[2], 2);
+        SDL_StoreChannels_AVX(dst + 6, dst + 14, out[3], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 3, dst += 2) {
+        const float srcLFE = src[2];
+        dst[0] /* FL */ = (src[0] * 0.800000012f) + (srcLFE * 0.200000003f);
+        dst[1] /* FR */ = (src[1] * 0.800000012f) + (srcLFE * 0.200000003f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 3) * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert21ToQuad_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 3) * 4))) - 4;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 3;
+    int i;
+
+    LOG_DEBUG_CONVERT("2.1", "quad (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 3); i >= 8; i -= 8, src -= 24, dst -= 32) {
+        __m256 in[4], out[4];
+        in[0] = SDL_LoadChannels_AVX(src - 21, src - 9, 3);
+        in[1] = SDL_LoadChannels_AVX(src - 18, src - 6, 3);
+        in[2] = SDL_LoadChannels_AVX(src - 15, src - 3, 3);
+        in[3] = SDL_LoadChannels_AVX(src - 12, src, 3);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.888888896f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.111111112f)));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.888888896f));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[2], _mm256_set1_ps(0.111111112f)));
+        out[2] /* BL */ = _mm256_mul_ps(in[2], _mm256_set1_ps(0.111111112f));
+        out[3] /* BR */ = _mm256_mul_ps(in[2], _mm256_set1_ps(0.111111112f));
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 28, dst - 12, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 24, dst - 8, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 20, dst - 4, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 16, dst, out[3], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 3, dst -= 4) {
+        const float srcLFE = src[2];
+        dst[3] /* BR */ = (srcLFE * 0.111111112f);
+        dst[2] /* BL */ = (srcLFE * 0.111111112f);
+        dst[1] /* FR */ = (srcLFE * 0.111111112f) + (src[1] * 0.888888896f);
+        dst[0] /* FL */ = (srcLFE * 0.111111112f) + (src[0] * 0.888888896f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 3) * 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert21To41_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 3) * 5))) - 5;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 3;
+    int i;
+
+    LOG_DEBUG_CONVERT("2.1", "4.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 3); i >= 8; i -= 8, src -= 24, dst -= 40) {
+        __m256 in[4], out[8];
+        in[0] = SDL_LoadChannels_AVX(src - 21, src - 9, 3);
+        in[1] = SDL_LoadChannels_AVX(src - 18, src - 6, 3);
+        in[2] = SDL_LoadChannels_AVX(src - 15, src - 3, 3);
+        in[3] = SDL_LoadChannels_AVX(src - 12, src, 3);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* LFE */ = in[2];
+        out[3] /* BL */ = _mm256_setzero_ps();
+        out[4] /* BR */ = _mm256_setzero_ps();
+        out[5] = out[6] = out[7] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 35, dst - 15, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 30, dst - 10, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 25, dst - 5, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 20, dst, out[3], 4);
+        SDL_StoreChannels_AVX(dst - 31, dst - 11, out[4], 1);
+        SDL_StoreChannels_AVX(dst - 26, dst - 6, out[5], 1);
+        SDL_StoreChannels_AVX(dst - 21, dst - 1, out[6], 1);
+        SDL_StoreChannels_AVX(dst - 16, dst + 4, out[7], 1);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 3, dst -= 5) {
+        dst[4] /* BR */ = 0.0f;
+        dst[3] /* BL */ = 0.0f;
+        dst[2] /* LFE */ = src[2];
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 3) * 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert21To51_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 3) * 6))) - 6;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 3;
+    int i;
+
+    LOG_DEBUG_CONVERT("2.1", "5.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 3); i >= 8; i -= 8, src -= 24, dst -= 48) {
+        __m256 in[4], out[8];
+        in[0] = SDL_LoadChannels_AVX(src - 21, src - 9, 3);
+        in[1] = SDL_LoadChannels_AVX(src - 18, src - 6, 3);
+        in[2] = SDL_LoadChannels_AVX(src - 15, src - 3, 3);
+        in[3] = SDL_LoadChannels_AVX(src - 12, src, 3);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = _mm256_setzero_ps();
+        out[3] /* LFE */ = in[2];
+        out[4] /* BL */ = _mm256_setzero_ps();
+        out[5] /* BR */ = _mm256_setzero_ps();
+        out[6] = out[7] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 42, dst - 18, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 36, dst - 12, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 30, dst - 6, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 24, dst, out[3], 4);
+        SDL_StoreChannels_AVX(dst - 38, dst - 14, out[4], 2);
+        SDL_StoreChannels_AVX(dst - 32, dst - 8, out[5], 2);
+        SDL_StoreChannels_AVX(dst - 26, dst - 2, out[6], 2);
+        SDL_StoreChannels_AVX(dst - 20, dst + 4, out[7], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 3, dst -= 6) {
+        dst[5] /* BR */ = 0.0f;
+        dst[4] /* BL */ = 0.0f;
+        dst[3] /* LFE */ = src[2];
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 3) * 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert21To61_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 3) * 7))) - 7;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 3;
+    int i;
+
+    LOG_DEBUG_CONVERT("2.1", "6.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 3); i >= 8; i -= 8, src -= 24, dst -= 56) {
+        __m256 in[4], out[8];
+        in[0] = SDL_LoadChannels_AVX(src - 21, src - 9, 3);
+        in[1] = SDL_LoadChannels_AVX(src - 18, src - 6, 3);
+        in[2] = SDL_LoadChannels_AVX(src - 15, src - 3, 3);
+        in[3] = SDL_LoadChannels_AVX(src - 12, src, 3);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = _mm256_setzero_ps();
+        out[3] /* LFE */ = in[2];
+        out[4] /* BC */ = _mm256_setzero_ps();
+        out[5] /* SL */ = _mm256_setzero_ps();
+        out[6] /* SR */ = _mm256_setzero_ps();
+        out[7] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 49, dst - 21, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 42, dst - 14, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 35, dst - 7, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 28, dst, out[3], 4);
+        SDL_StoreChannels_AVX(dst - 45, dst - 17, out[4], 3);
+        SDL_StoreChannels_AVX(dst - 38, dst - 10, out[5], 3);
+        SDL_StoreChannels_AVX(dst - 31, dst - 3, out[6], 3);
+        SDL_StoreChannels_AVX(dst - 24, dst + 4, out[7], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 3, dst -= 7) {
+        dst[6] /* SR */ = 0.0f;
+        dst[5] /* SL */ = 0.0f;
+        dst[4] /* BC */ = 0.0f;
+        dst[3] /* LFE */ = src[2];
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 3) * 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert21To71_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 3) * 8))) - 8;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 3;
+    int i;
+
+    LOG_DEBUG_CONVERT("2.1", "7.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 3); i >= 8; i -= 8, src -= 24, dst -= 64) {
+        __m256 in[4], out[8];
+        in[0] = SDL_LoadChannels_AVX(src - 21, src - 9, 3);
+        in[1] = SDL_LoadChannels_AVX(src - 18, src - 6, 3);
+        in[2] = SDL_LoadChannels_AVX(src - 15, src - 3, 3);
+        in[3] = SDL_LoadChannels_AVX(src - 12, src, 3);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = _mm256_setzero_ps();
+        out[3] /* LFE */ = in[2];
+        out[4] /* BL */ = _mm256_setzero_ps();
+        out[5] /* BR */ = _mm256_setzero_ps();
+        out[6] /* SL */ = _mm256_setzero_ps();
+        out[7] /* SR */ = _mm256_setzero_ps();
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 56, dst - 24, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 48, dst - 16, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 40, dst - 8, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 32, dst, out[3], 4);
+        SDL_StoreChannels_AVX(dst - 52, dst - 20, out[4], 4);
+        SDL_StoreChannels_AVX(dst - 44, dst - 12, out[5], 4);
+        SDL_StoreChannels_AVX(dst - 36, dst - 4, out[6], 4);
+        SDL_StoreChannels_AVX(dst - 28, dst + 4, out[7], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 3, dst -= 8) {
+        dst[7] /* SR */ = 0.0f;
+        dst[6] /* SL */ = 0.0f;
+        dst[5] /* BR */ = 0.0f;
+        dst[4] /* BL */ = 0.0f;
+        dst[3] /* LFE */ = src[2];
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 3) * 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_ConvertQuadToMono_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("quad", "mono (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 4); i >= 8; i -= 8, src += 32, dst += 8) {
+        __m256 in[4], out[1];
+        in[0] = SDL_LoadChannels_AVX(src, src + 16, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 4, src + 20, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 8, src + 24, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 12, src + 28, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        out[0] /* FC */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.250000000f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[1], _mm256_set1_ps(0.250000000f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.250000000f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[3], _mm256_set1_ps(0.250000000f)));
+        _mm256_storeu_ps(dst, out[0]);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 4, dst += 1) {
+        dst[0] /* FC */ = (src[0] * 0.250000000f) + (src[1] * 0.250000000f) + (src[2] * 0.250000000f) + (src[3] * 0.250000000f);
+    }
+
+    cvt->len_cvt = cvt->len_cvt / 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_ConvertQuadToStereo_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("quad", "stereo (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 4); i >= 8; i -= 8, src += 32, dst += 16) {
+        __m256 in[4], out[4];
+        in[0] = SDL_LoadChannels_AVX(src, src + 16, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 4, src + 20, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 8, src + 24, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 12, src + 28, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.421000004f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.358999997f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[3], _mm256_set1_ps(0.219999999f)));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.421000004f));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[2], _mm256_set1_ps(0.219999999f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[3], _mm256_set1_ps(0.358999997f)));
+        out[2] = out[3] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst, dst + 8, out[0], 2);
+        SDL_StoreChannels_AVX(dst + 2, dst + 10, out[1], 2);
+        SDL_StoreChannels_AVX(dst + 4, dst + 12, out[2], 2);
+        SDL_StoreChannels_AVX(dst + 6, dst + 14, out[3], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 4, dst += 2) {
+        const float srcBL = src[2];
+        const float srcBR = src[3];
+        dst[0] /* FL */ = (src[0] * 0.421000004f) + (srcBL * 0.358999997f) + (srcBR * 0.219999999f);
+        dst[1] /* FR */ = (src[1] * 0.421000004f) + (srcBL * 0.219999999f) + (srcBR * 0.358999997f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 4) * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_ConvertQuadTo21_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("quad", "2.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 4); i >= 8; i -= 8, src += 32, dst += 24) {
+        __m256 in[4], out[4];
+        in[0] = SDL_LoadChannels_AVX(src, src + 16, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 4, src + 20, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 8, src + 24, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 12, src + 28, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.421000004f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.358999997f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[3], _mm256_set1_ps(0.219999999f)));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.421000004f));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[2], _mm256_set1_ps(0.219999999f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[3], _mm256_set1_ps(0.358999997f)));
+        out[2] /* LFE */ = _mm256_setzero_ps();
+        out[3] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst, dst + 12, out[0], 3);
+        SDL_StoreChannels_AVX(dst + 3, dst + 15, out[1], 3);
+        SDL_StoreChannels_AVX(dst + 6, dst + 18, out[2], 3);
+        SDL_StoreChannels_AVX(dst + 9, dst + 21, out[3], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 4, dst += 3) {
+        const float srcBL = src[2];
+        const float srcBR = src[3];
+        dst[0] /* FL */ = (src[0] * 0.421000004f) + (srcBL * 0.358999997f) + (srcBR * 0.219999999f);
+        dst[1] /* FR */ = (src[1] * 0.421000004f) + (srcBL * 0.219999999f) + (srcBR * 0.358999997f);
+        dst[2] /* LFE */ = 0.0f;
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 4) * 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_ConvertQuadTo41_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 4) * 5))) - 5;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 4;
+    int i;
+
+    LOG_DEBUG_CONVERT("quad", "4.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 4); i >= 8; i -= 8, src -= 32, dst -= 40) {
+        __m256 in[4], out[8];
+        in[0] = SDL_LoadChannels_AVX(src - 28, src - 12, 4);
+        in[1] = SDL_LoadChannels_AVX(src - 24, src - 8, 4);
+        in[2] = SDL_LoadChannels_AVX(src - 20, src - 4, 4);
+        in[3] = SDL_LoadChannels_AVX(src - 16, src, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* LFE */ = _mm256_setzero_ps();
+        out[3] /* BL */ = in[2];
+        out[4] /* BR */ = in[3];
+        out[5] = out[6] = out[7] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 35, dst - 15, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 30, dst - 10, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 25, dst - 5, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 20, dst, out[3], 4);
+        SDL_TRANSPOSE4_AVX(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_AVX(dst - 31, dst - 11, out[4], 1);
+        SDL_StoreChannels_AVX(dst - 26, dst - 6, out[5], 1);
+        SDL_StoreChannels_AVX(dst - 21, dst - 1, out[6], 1);
+        SDL_StoreChannels_AVX(dst - 16, dst + 4, out[7], 1);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 4, dst -= 5) {
+        dst[4] /* BR */ = src[3];
+        dst[3] /* BL */ = src[2];
+        dst[2] /* LFE */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 4) * 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_ConvertQuadTo51_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 4) * 6))) - 6;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 4;
+    int i;
+
+    LOG_DEBUG_CONVERT("quad", "5.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 4); i >= 8; i -= 8, src -= 32, dst -= 48) {
+        __m256 in[4], out[8];
+        in[0] = SDL_LoadChannels_AVX(src - 28, src - 12, 4);
+        in[1] = SDL_LoadChannels_AVX(src - 24, src - 8, 4);
+        in[2] = SDL_LoadChannels_AVX(src - 20, src - 4, 4);
+        in[3] = SDL_LoadChannels_AVX(src - 16, src, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = _mm256_setzero_ps();
+        out[3] /* LFE */ = _mm256_setzero_ps();
+        out[4] /* BL */ = in[2];
+        out[5] /* BR */ = in[3];
+        out[6] = out[7] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 42, dst - 18, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 36, dst - 12, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 30, dst - 6, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 24, dst, out[3], 4);
+        SDL_TRANSPOSE4_AVX(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_AVX(dst - 38, dst - 14, out[4], 2);
+        SDL_StoreChannels_AVX(dst - 32, dst - 8, out[5], 2);
+        SDL_StoreChannels_AVX(dst - 26, dst - 2, out[6], 2);
+        SDL_StoreChannels_AVX(dst - 20, dst + 4, out[7], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 4, dst -= 6) {
+        dst[5] /* BR */ = src[3];
+        dst[4] /* BL */ = src[2];
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 4) * 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_ConvertQuadTo61_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 4) * 7))) - 7;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 4;
+    int i;
+
+    LOG_DEBUG_CONVERT("quad", "6.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 4); i >= 8; i -= 8, src -= 32, dst -= 56) {
+        __m256 in[4], out[8];
+        in[0] = SDL_LoadChannels_AVX(src - 28, src - 12, 4);
+        in[1] = SDL_LoadChannels_AVX(src - 24, src - 8, 4);
+        in[2] = SDL_LoadChannels_AVX(src - 20, src - 4, 4);
+        in[3] = SDL_LoadChannels_AVX(src - 16, src, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.939999998f));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.939999998f));
+        out[2] /* FC */ = _mm256_setzero_ps();
+        out[3] /* LFE */ = _mm256_setzero_ps();
+        out[4] /* BC */ = _mm256_mul_ps(in[2], _mm256_set1_ps(0.500000000f));
+        out[4] = _mm256_add_ps(out[4], _mm256_mul_ps(in[3], _mm256_set1_ps(0.500000000f)));
+        out[5] /* SL */ = _mm256_mul_ps(in[2], _mm256_set1_ps(0.796000004f));
+        out[6] /* SR */ = _mm256_mul_ps(in[3], _mm256_set1_ps(0.796000004f));
+        out[7] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 49, dst - 21, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 42, dst - 14, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 35, dst - 7, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 28, dst, out[3], 4);
+        SDL_TRANSPOSE4_AVX(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_AVX(dst - 45, dst - 17, out[4], 3);
+        SDL_StoreChannels_AVX(dst - 38, dst - 10, out[5], 3);
+        SDL_StoreChannels_AVX(dst - 31, dst - 3, out[6], 3);
+        SDL_StoreChannels_AVX(dst - 24, dst + 4, out[7], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 4, dst -= 7) {
+        const float srcBL = src[2];
+        const float srcBR = src[3];
+        dst[6] /* SR */ = (srcBR * 0.796000004f);
+        dst[5] /* SL */ = (srcBL * 0.796000004f);
+        dst[4] /* BC */ = (srcBR * 0.500000000f) + (srcBL * 0.500000000f);
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = (src[1] * 0.939999998f);
+        dst[0] /* FL */ = (src[0] * 0.939999998f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 4) * 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_ConvertQuadTo71_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 4) * 8))) - 8;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 4;
+    int i;
+
+    LOG_DEBUG_CONVERT("quad", "7.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 4); i >= 8; i -= 8, src -= 32, dst -= 64) {
+        __m256 in[4], out[8];
+        in[0] = SDL_LoadChannels_AVX(src - 28, src - 12, 4);
+        in[1] = SDL_LoadChannels_AVX(src - 24, src - 8, 4);
+        in[2] = SDL_LoadChannels_AVX(src - 20, src - 4, 4);
+        in[3] = SDL_LoadChannels_AVX(src - 16, src, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = _mm256_setzero_ps();
+        out[3] /* LFE */ = _mm256_setzero_ps();
+        out[4] /* BL */ = in[2];
+        out[5] /* BR */ = in[3];
+        out[6] /* SL */ = _mm256_setzero_ps();
+        out[7] /* SR */ = _mm256_setzero_ps();
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 56, dst - 24, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 48, dst - 16, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 40, dst - 8, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 32, dst, out[3], 4);
+        SDL_TRANSPOSE4_AVX(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_AVX(dst - 52, dst - 20, out[4], 4);
+        SDL_StoreChannels_AVX(dst - 44, dst - 12, out[5], 4);
+        SDL_StoreChannels_AVX(dst - 36, dst - 4, out[6], 4);
+        SDL_StoreChannels_AVX(dst - 28, dst + 4, out[7], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 4, dst -= 8) {
+        dst[7] /* SR */ = 0.0f;
+        dst[6] /* SL */ = 0.0f;
+        dst[5] /* BR */ = src[3];
+        dst[4] /* BL */ = src[2];
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 4) * 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert41ToMono_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("4.1", "mono (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 5); i >= 8; i -= 8, src += 40, dst += 8) {
+        __m256 in[8], out[1];
+        in[0] = SDL_LoadChannels_AVX(src, src + 20, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 5, src + 25, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 10, src + 30, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 15, src + 35, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src + 4, src + 24, 1);
+        in[5] = SDL_LoadChannels_AVX(src + 9, src + 29, 1);
+        in[6] = SDL_LoadChannels_AVX(src + 14, src + 34, 1);
+        in[7] = SDL_LoadChannels_AVX(src + 19, src + 39, 1);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FC */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.200000003f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[1], _mm256_set1_ps(0.200000003f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.200000003f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[3], _mm256_set1_ps(0.200000003f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[4], _mm256_set1_ps(0.200000003f)));
+        _mm256_storeu_ps(dst, out[0]);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 5, dst += 1) {
+        dst[0] /* FC */ = (src[0] * 0.200000003f) + (src[1] * 0.200000003f) + (src[2] * 0.200000003f) + (src[3] * 0.200000003f) + (src[4] * 0.200000003f);
+    }
+
+    cvt->len_cvt = cvt->len_cvt / 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert41ToStereo_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("4.1", "stereo (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 5); i >= 8; i -= 8, src += 40, dst += 16) {
+        __m256 in[8], out[4];
+        in[0] = SDL_LoadChannels_AVX(src, src + 20, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 5, src + 25, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 10, src + 30, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 15, src + 35, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src + 4, src + 24, 1);
+        in[5] = SDL_LoadChannels_AVX(src + 9, src + 29, 1);
+        in[6] = SDL_LoadChannels_AVX(src + 14, src + 34, 1);
+        in[7] = SDL_LoadChannels_AVX(src + 19, src + 39, 1);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.374222219f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.111111112f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[3], _mm256_set1_ps(0.319111109f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[4], _mm256_set1_ps(0.195555553f)));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.374222219f));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[2], _mm256_set1_ps(0.111111112f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[3], _mm256_set1_ps(0.195555553f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[4], _mm256_set1_ps(0.319111109f)));
+        out[2] = out[3] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst, dst + 8, out[0], 2);
+        SDL_StoreChannels_AVX(dst + 2, dst + 10, out[1], 2);
+        SDL_StoreChannels_AVX(dst + 4, dst + 12, out[2], 2);
+        SDL_StoreChannels_AVX(dst + 6, dst + 14, out[3], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 5, dst += 2) {
+        const float srcLFE = src[2];
+        const float srcBL = src[3];
+        const float srcBR = src[4];
+        dst[0] /* FL */ = (src[0] * 0.374222219f) + (srcLFE * 0.111111112f) + (srcBL * 0.319111109f) + (srcBR * 0.195555553f);
+        dst[1] /* FR */ = (src[1] * 0.374222219f) + (srcLFE * 0.111111112f) + (srcBL * 0.195555553f) + (srcBR * 0.319111109f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 5) * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert41To21_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("4.1", "2.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 5); i >= 8; i -= 8, src += 40, dst += 24) {
+        __m256 in[8], out[4];
+        in[0] = SDL_LoadChannels_AVX(src, src + 20, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 5, src + 25, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 10, src + 30, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 15, src + 35, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src + 4, src + 24, 1);
+        in[5] = SDL_LoadChannels_AVX(src + 9, src + 29, 1);
+        in[6] = SDL_LoadChannels_AVX(src + 14, src + 34, 1);
+        in[7] = SDL_LoadChannels_AVX(src + 19, src + 39, 1);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.421000004f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[3], _mm256_set1_ps(0.358999997f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[4], _mm256_set1_ps(0.219999999f)));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.421000004f));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[3], _mm256_set1_ps(0.219999999f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[4], _mm256_set1_ps(0.358999997f)));
+        out[2] /* LFE */ = in[2];
+        out[3] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst, dst + 12, out[0], 3);
+        SDL_StoreChannels_AVX(dst + 3, dst + 15, out[1], 3);
+        SDL_StoreChannels_AVX(dst + 6, dst + 18, out[2], 3);
+        SDL_StoreChannels_AVX(dst + 9, dst + 21, out[3], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 5, dst += 3) {
+        const float srcBL = src[3];
+        const float srcBR = src[4];
+        dst[0] /* FL */ = (src[0] * 0.421000004f) + (srcBL * 0.358999997f) + (srcBR * 0.219999999f);
+        dst[1] /* FR */ = (src[1] * 0.421000004f) + (srcBL * 0.219999999f) + (srcBR * 0.358999997f);
+        dst[2] /* LFE */ = src[2];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 5) * 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert41ToQuad_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("4.1", "quad (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 5); i >= 8; i -= 8, src += 40, dst += 32) {
+        __m256 in[8], out[4];
+        in[0] = SDL_LoadChannels_AVX(src, src + 20, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 5, src + 25, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 10, src + 30, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 15, src + 35, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src + 4, src + 24, 1);
+        in[5] = SDL_LoadChannels_AVX(src + 9, src + 29, 1);
+        in[6] = SDL_LoadChannels_AVX(src + 14, src + 34, 1);
+        in[7] = SDL_LoadChannels_AVX(src + 19, src + 39, 1);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.941176474f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.058823530f)));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.941176474f));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[2], _mm256_set1_ps(0.058823530f)));
+        out[2] /* BL */ = _mm256_mul_ps(in[2], _mm256_set1_ps(0.058823530f));
+        out[2] = _mm256_add_ps(out[2], _mm256_mul_ps(in[3], _mm256_set1_ps(0.941176474f)));
+        out[3] /* BR */ = _mm256_mul_ps(in[2], _mm256_set1_ps(0.058823530f));
+        out[3] = _mm256_add_ps(out[3], _mm256_mul_ps(in[4], _mm256_set1_ps(0.941176474f)));
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst, dst + 16, out[0], 4);
+        SDL_StoreChannels_AVX(dst + 4, dst + 20, out[1], 4);
+        SDL_StoreChannels_AVX(dst + 8, dst + 24, out[2], 4);
+        SDL_StoreChannels_AVX(dst + 12, dst + 28, out[3], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 5, dst += 4) {
+        const float srcLFE = src[2];
+        dst[0] /* FL */ = (src[0] * 0.941176474f) + (srcLFE * 0.058823530f);
+        dst[1] /* FR */ = (src[1] * 0.941176474f) + (srcLFE * 0.058823530f);
+        dst[2] /* BL */ = (srcLFE * 0.058823530f) + (src[3] * 0.941176474f);
+        dst[3] /* BR */ = (srcLFE * 0.058823530f) + (src[4] * 0.941176474f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 5) * 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert41To51_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 5) * 6))) - 6;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 5;
+    int i;
+
+    LOG_DEBUG_CONVERT("4.1", "5.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 5); i >= 8; i -= 8, src -= 40, dst -= 48) {
+        __m256 in[8], out[8];
+        in[0] = SDL_LoadChannels_AVX(src - 35, src - 15, 4);
+        in[1] = SDL_LoadChannels_AVX(src - 30, src - 10, 4);
+        in[2] = SDL_LoadChannels_AVX(src - 25, src - 5, 4);
+        in[3] = SDL_LoadChannels_AVX(src - 20, src, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src - 31, src - 11, 1);
+        in[5] = SDL_LoadChannels_AVX(src - 26, src - 6, 1);
+        in[6] = SDL_LoadChannels_AVX(src - 21, src - 1, 1);
+        in[7] = SDL_LoadChannels_AVX(src - 16, src + 4, 1);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = _mm256_setzero_ps();
+        out[3] /* LFE */ = in[2];
+        out[4] /* BL */ = in[3];
+        out[5] /* BR */ = in[4];
+        out[6] = out[7] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 42, dst - 18, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 36, dst - 12, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 30, dst - 6, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 24, dst, out[3], 4);
+        SDL_TRANSPOSE4_AVX(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_AVX(dst - 38, dst - 14, out[4], 2);
+        SDL_StoreChannels_AVX(dst - 32, dst - 8, out[5], 2);
+        SDL_StoreChannels_AVX(dst - 26, dst - 2, out[6], 2);
+        SDL_StoreChannels_AVX(dst - 20, dst + 4, out[7], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 5, dst -= 6) {
+        dst[5] /* BR */ = src[4];
+        dst[4] /* BL */ = src[3];
+        dst[3] /* LFE */ = src[2];
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 5) * 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert41To61_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 5) * 7))) - 7;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 5;
+    int i;
+
+    LOG_DEBUG_CONVERT("4.1", "6.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 5); i >= 8; i -= 8, src -= 40, dst -= 56) {
+        __m256 in[8], out[8];
+        in[0] = SDL_LoadChannels_AVX(src - 35, src - 15, 4);
+        in[1] = SDL_LoadChannels_AVX(src - 30, src - 10, 4);
+        in[2] = SDL_LoadChannels_AVX(src - 25, src - 5, 4);
+        in[3] = SDL_LoadChannels_AVX(src - 20, src, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src - 31, src - 11, 1);
+        in[5] = SDL_LoadChannels_AVX(src - 26, src - 6, 1);
+        in[6] = SDL_LoadChannels_AVX(src - 21, src - 1, 1);
+        in[7] = SDL_LoadChannels_AVX(src - 16, src + 4, 1);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.939999998f));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.939999998f));
+        out[2] /* FC */ = _mm256_setzero_ps();
+        out[3] /* LFE */ = in[2];
+        out[4] /* BC */ = _mm256_mul_ps(in[3], _mm256_set1_ps(0.500000000f));
+        out[4] = _mm256_add_ps(out[4], _mm256_mul_ps(in[4], _mm256_set1_ps(0.500000000f)));
+        out[5] /* SL */ = _mm256_mul_ps(in[3], _mm256_set1_ps(0.796000004f));
+        out[6] /* SR */ = _mm256_mul_ps(in[4], _mm256_set1_ps(0.796000004f));
+        out[7] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 49, dst - 21, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 42, dst - 14, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 35, dst - 7, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 28, dst, out[3], 4);
+        SDL_TRANSPOSE4_AVX(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_AVX(dst - 45, dst - 17, out[4], 3);
+        SDL_StoreChannels_AVX(dst - 38, dst - 10, out[5], 3);
+        SDL_StoreChannels_AVX(dst - 31, dst - 3, out[6], 3);
+        SDL_StoreChannels_AVX(dst - 24, dst + 4, out[7], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 5, dst -= 7) {
+        const float srcBL = src[3];
+        const float srcBR = src[4];
+        dst[6] /* SR */ = (srcBR * 0.796000004f);
+        dst[5] /* SL */ = (srcBL * 0.796000004f);
+        dst[4] /* BC */ = (srcBR * 0.500000000f) + (srcBL * 0.500000000f);
+        dst[3] /* LFE */ = src[2];
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = (src[1] * 0.939999998f);
+        dst[0] /* FL */ = (src[0] * 0.939999998f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 5) * 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert41To71_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 5) * 8))) - 8;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 5;
+    int i;
+
+    LOG_DEBUG_CONVERT("4.1", "7.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 5); i >= 8; i -= 8, src -= 40, dst -= 64) {
+        __m256 in[8], out[8];
+        in[0] = SDL_LoadChannels_AVX(src - 35, src - 15, 4);
+        in[1] = SDL_LoadChannels_AVX(src - 30, src - 10, 4);
+        in[2] = SDL_LoadChannels_AVX(src - 25, src - 5, 4);
+        in[3] = SDL_LoadChannels_AVX(src - 20, src, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src - 31, src - 11, 1);
+        in[5] = SDL_LoadChannels_AVX(src - 26, src - 6, 1);
+        in[6] = SDL_LoadChannels_AVX(src - 21, src - 1, 1);
+        in[7] = SDL_LoadChannels_AVX(src - 16, src + 4, 1);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = _mm256_setzero_ps();
+        out[3] /* LFE */ = in[2];
+        out[4] /* BL */ = in[3];
+        out[5] /* BR */ = in[4];
+        out[6] /* SL */ = _mm256_setzero_ps();
+        out[7] /* SR */ = _mm256_setzero_ps();
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 56, dst - 24, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 48, dst - 16, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 40, dst - 8, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 32, dst, out[3], 4);
+        SDL_TRANSPOSE4_AVX(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_AVX(dst - 52, dst - 20, out[4], 4);
+        SDL_StoreChannels_AVX(dst - 44, dst - 12, out[5], 4);
+        SDL_StoreChannels_AVX(dst - 36, dst - 4, out[6], 4);
+        SDL_StoreChannels_AVX(dst - 28, dst + 4, out[7], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 5, dst -= 8) {
+        dst[7] /* SR */ = 0.0f;
+        dst[6] /* SL */ = 0.0f;
+        dst[5] /* BR */ = src[4];
+        dst[4] /* BL */ = src[3];
+        dst[3] /* LFE */ = src[2];
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 5) * 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert51ToMono_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("5.1", "mono (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 6); i >= 8; i -= 8, src += 48, dst += 8) {
+        __m256 in[8], out[1];
+        in[0] = SDL_LoadChannels_AVX(src, src + 24, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 6, src + 30, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 12, src + 36, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 18, src + 42, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src + 4, src + 28, 2);
+        in[5] = SDL_LoadChannels_AVX(src + 10, src + 34, 2);
+        in[6] = SDL_LoadChannels_AVX(src + 16, src + 40, 2);
+        in[7] = SDL_LoadChannels_AVX(src + 22, src + 46, 2);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FC */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.166666672f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[1], _mm256_set1_ps(0.166666672f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.166666672f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[3], _mm256_set1_ps(0.166666672f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[4], _mm256_set1_ps(0.166666672f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[5], _mm256_set1_ps(0.166666672f)));
+        _mm256_storeu_ps(dst, out[0]);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 6, dst += 1) {
+        dst[0] /* FC */ = (src[0] * 0.166666672f) + (src[1] * 0.166666672f) + (src[2] * 0.166666672f) + (src[3] * 0.166666672f) + (src[4] * 0.166666672f) + (src[5] * 0.166666672f);
+    }
+
+    cvt->len_cvt = cvt->len_cvt / 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert51ToStereo_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("5.1", "stereo (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 6); i >= 8; i -= 8, src += 48, dst += 16) {
+        __m256 in[8], out[4];
+        in[0] = SDL_LoadChannels_AVX(src, src + 24, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 6, src + 30, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 12, src + 36, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 18, src + 42, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src + 4, src + 28, 2);
+        in[5] = SDL_LoadChannels_AVX(src + 10, src + 34, 2);
+        in[6] = SDL_LoadChannels_AVX(src + 16, src + 40, 2);
+        in[7] = SDL_LoadChannels_AVX(src + 22, src + 46, 2);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.294545442f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.208181813f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[3], _mm256_set1_ps(0.090909094f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[4], _mm256_set1_ps(0.251818180f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[5], _mm256_set1_ps(0.154545456f)));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.294545442f));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[2], _mm256_set1_ps(0.208181813f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[3], _mm256_set1_ps(0.090909094f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[4], _mm256_set1_ps(0.154545456f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[5], _mm256_set1_ps(0.251818180f)));
+        out[2] = out[3] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst, dst + 8, out[0], 2);
+        SDL_StoreChannels_AVX(dst + 2, dst + 10, out[1], 2);
+        SDL_StoreChannels_AVX(dst + 4, dst + 12, out[2], 2);
+        SDL_StoreChannels_AVX(dst + 6, dst + 14, out[3], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 6, dst += 2) {
+        const float srcFC = src[2];
+        const float srcLFE = src[3];
+        const float srcBL = src[4];
+        const float srcBR = src[5];
+        dst[0] /* FL */ = (src[0] * 0.294545442f) + (srcFC * 0.208181813f) + (srcLFE * 0.090909094f) + (srcBL * 0.251818180f) + (srcBR * 0.154545456f);
+        dst[1] /* FR */ = (src[1] * 0.294545442f) + (srcFC * 0.208181813f) + (srcLFE * 0.090909094f) + (srcBL * 0.154545456f) + (srcBR * 0.251818180f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 6) * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert51To21_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("5.1", "2.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 6); i >= 8; i -= 8, src += 48, dst += 24) {
+        __m256 in[8], out[4];
+        in[0] = SDL_LoadChannels_AVX(src, src + 24, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 6, src + 30, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 12, src + 36, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 18, src + 42, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src + 4, src + 28, 2);
+        in[5] = SDL_LoadChannels_AVX(src + 10, src + 34, 2);
+        in[6] = SDL_LoadChannels_AVX(src + 16, src + 40, 2);
+        in[7] = SDL_LoadChannels_AVX(src + 22, src + 46, 2);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.324000001f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.229000002f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[4], _mm256_set1_ps(0.277000010f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[5], _mm256_set1_ps(0.170000002f)));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.324000001f));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[2], _mm256_set1_ps(0.229000002f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[4], _mm256_set1_ps(0.170000002f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[5], _mm256_set1_ps(0.277000010f)));
+        out[2] /* LFE */ = in[3];
+        out[3] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst, dst + 12, out[0], 3);
+        SDL_StoreChannels_AVX(dst + 3, dst + 15, out[1], 3);
+        SDL_StoreChannels_AVX(dst + 6, dst + 18, out[2], 3);
+        SDL_StoreChannels_AVX(dst + 9, dst + 21, out[3], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 6, dst += 3) {
+        const float srcFC = src[2];
+        const float srcBL = src[4];
+        const float srcBR = src[5];
+        dst[0] /* FL */ = (src[0] * 0.324000001f) + (srcFC * 0.229000002f) + (srcBL * 0.277000010f) + (srcBR * 0.170000002f);
+        dst[1] /* FR */ = (src[1] * 0.324000001f) + (srcFC * 0.229000002f) + (srcBL * 0.170000002f) + (srcBR * 0.277000010f);
+        dst[2] /* LFE */ = src[3];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 6) * 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert51ToQuad_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("5.1", "quad (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 6); i >= 8; i -= 8, src += 48, dst += 32) {
+        __m256 in[8], out[4];
+        in[0] = SDL_LoadChannels_AVX(src, src + 24, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 6, src + 30, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 12, src + 36, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 18, src + 42, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src + 4, src + 28, 2);
+        in[5] = SDL_LoadChannels_AVX(src + 10, src + 34, 2);
+        in[6] = SDL_LoadChannels_AVX(src + 16, src + 40, 2);
+        in[7] = SDL_LoadChannels_AVX(src + 22, src + 46, 2);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.558095276f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.394285709f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[3], _mm256_set1_ps(0.047619049f)));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.558095276f));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[2], _mm256_set1_ps(0.394285709f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[3], _mm256_set1_ps(0.047619049f)));
+        out[2] /* BL */ = _mm256_mul_ps(in[3], _mm256_set1_ps(0.047619049f));
+        out[2] = _mm256_add_ps(out[2], _mm256_mul_ps(in[4], _mm256_set1_ps(0.558095276f)));
+        out[3] /* BR */ = _mm256_mul_ps(in[3], _mm256_set1_ps(0.047619049f));
+        out[3] = _mm256_add_ps(out[3], _mm256_mul_ps(in[5], _mm256_set1_ps(0.558095276f)));
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst, dst + 16, out[0], 4);
+        SDL_StoreChannels_AVX(dst + 4, dst + 20, out[1], 4);
+        SDL_StoreChannels_AVX(dst + 8, dst + 24, out[2], 4);
+        SDL_StoreChannels_AVX(dst + 12, dst + 28, out[3], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 6, dst += 4) {
+        const float srcFC = src[2];
+        const float srcLFE = src[3];
+        dst[0] /* FL */ = (src[0] * 0.558095276f) + (srcFC * 0.394285709f) + (srcLFE * 0.047619049f);
+        dst[1] /* FR */ = (src[1] * 0.558095276f) + (srcFC * 0.394285709f) + (srcLFE * 0.047619049f);
+        dst[2] /* BL */ = (srcLFE * 0.047619049f) + (src[4] * 0.558095276f);
+        dst[3] /* BR */ = (srcLFE * 0.047619049f) + (src[5] * 0.558095276f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 6) * 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert51To41_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("5.1", "4.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 6); i >= 8; i -= 8, src += 48, dst += 40) {
+        __m256 in[8], out[8];
+        in[0] = SDL_LoadChannels_AVX(src, src + 24, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 6, src + 30, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 12, src + 36, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 18, src + 42, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src + 4, src + 28, 2);
+        in[5] = SDL_LoadChannels_AVX(src + 10, src + 34, 2);
+        in[6] = SDL_LoadChannels_AVX(src + 16, src + 40, 2);
+        in[7] = SDL_LoadChannels_AVX(src + 22, src + 46, 2);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.586000025f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.414000005f)));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.586000025f));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[2], _mm256_set1_ps(0.414000005f)));
+        out[2] /* LFE */ = in[3];
+        out[3] /* BL */ = _mm256_mul_ps(in[4], _mm256_set1_ps(0.586000025f));
+        out[4] /* BR */ = _mm256_mul_ps(in[5], _mm256_set1_ps(0.586000025f));
+        out[5] = out[6] = out[7] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst, dst + 20, out[0], 4);
+        SDL_StoreChannels_AVX(dst + 5, dst + 25, out[1], 4);
+        SDL_StoreChannels_AVX(dst + 10, dst + 30, out[2], 4);
+        SDL_StoreChannels_AVX(dst + 15, dst + 35, out[3], 4);
+        SDL_TRANSPOSE4_AVX(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_AVX(dst + 4, dst + 24, out[4], 1);
+        SDL_StoreChannels_AVX(dst + 9, dst + 29, out[5], 1);
+        SDL_StoreChannels_AVX(dst + 14, dst + 34, out[6], 1);
+        SDL_StoreChannels_AVX(dst + 19, dst + 39, out[7], 1);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 6, dst += 5) {
+        const float srcFC = src[2];
+        dst[0] /* FL */ = (src[0] * 0.586000025f) + (srcFC * 0.414000005f);
+        dst[1] /* FR */ = (src[1] * 0.586000025f) + (srcFC * 0.414000005f);
+        dst[2] /* LFE */ = src[3];
+        dst[3] /* BL */ = (src[4] * 0.586000025f);
+        dst[4] /* BR */ = (src[5] * 0.586000025f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 6) * 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert51To61_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 6) * 7))) - 7;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 6;
+    int i;
+
+    LOG_DEBUG_CONVERT("5.1", "6.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 6); i >= 8; i -= 8, src -= 48, dst -= 56) {
+        __m256 in[8], out[8];
+        in[0] = SDL_LoadChannels_AVX(src - 42, src - 18, 4);
+        in[1] = SDL_LoadChannels_AVX(src - 36, src - 12, 4);
+        in[2] = SDL_LoadChannels_AVX(src - 30, src - 6, 4);
+        in[3] = SDL_LoadChannels_AVX(src - 24, src, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src - 38, src - 14, 2);
+        in[5] = SDL_LoadChannels_AVX(src - 32, src - 8, 2);
+        in[6] = SDL_LoadChannels_AVX(src - 26, src - 2, 2);
+        in[7] = SDL_LoadChannels_AVX(src - 20, src + 4, 2);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.939999998f));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.939999998f));
+        out[2] /* FC */ = _mm256_mul_ps(in[2], _mm256_set1_ps(0.939999998f));
+        out[3] /* LFE */ = in[3];
+        out[4] /* BC */ = _mm256_mul_ps(in[4], _mm256_set1_ps(0.500000000f));
+        out[4] = _mm256_add_ps(out[4], _mm256_mul_ps(in[5], _mm256_set1_ps(0.500000000f)));
+        out[5] /* SL */ = _mm256_mul_ps(in[4], _mm256_set1_ps(0.796000004f));
+        out[6] /* SR */ = _mm256_mul_ps(in[5], _mm256_set1_ps(0.796000004f));
+        out[7] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 49, dst - 21, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 42, dst - 14, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 35, dst - 7, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 28, dst, out[3], 4);
+        SDL_TRANSPOSE4_AVX(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_AVX(dst - 45, dst - 17, out[4], 3);
+        SDL_StoreChannels_AVX(dst - 38, dst - 10, out[5], 3);
+        SDL_StoreChannels_AVX(dst - 31, dst - 3, out[6], 3);
+        SDL_StoreChannels_AVX(dst - 24, dst + 4, out[7], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 6, dst -= 7) {
+        const float srcBL = src[4];
+        const float srcBR = src[5];
+        dst[6] /* SR */ = (srcBR * 0.796000004f);
+        dst[5] /* SL */ = (srcBL * 0.796000004f);
+        dst[4] /* BC */ = (srcBR * 0.500000000f) + (srcBL * 0.500000000f);
+        dst[3] /* LFE */ = src[3];
+        dst[2] /* FC */ = (src[2] * 0.939999998f);
+        dst[1] /* FR */ = (src[1] * 0.939999998f);
+        dst[0] /* FL */ = (src[0] * 0.939999998f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 6) * 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert51To71_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 6) * 8))) - 8;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 6;
+    int i;
+
+    LOG_DEBUG_CONVERT("5.1", "7.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 6); i >= 8; i -= 8, src -= 48, dst -= 64) {
+        __m256 in[8], out[8];
+        in[0] = SDL_LoadChannels_AVX(src - 42, src - 18, 4);
+        in[1] = SDL_LoadChannels_AVX(src - 36, src - 12, 4);
+        in[2] = SDL_LoadChannels_AVX(src - 30, src - 6, 4);
+        in[3] = SDL_LoadChannels_AVX(src - 24, src, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src - 38, src - 14, 2);
+        in[5] = SDL_LoadChannels_AVX(src - 32, src - 8, 2);
+        in[6] = SDL_LoadChannels_AVX(src - 26, src - 2, 2);
+        in[7] = SDL_LoadChannels_AVX(src - 20, src + 4, 2);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = in[2];
+        out[3] /* LFE */ = in[3];
+        out[4] /* BL */ = in[4];
+        out[5] /* BR */ = in[5];
+        out[6] /* SL */ = _mm256_setzero_ps();
+        out[7] /* SR */ = _mm256_setzero_ps();
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 56, dst - 24, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 48, dst - 16, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 40, dst - 8, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 32, dst, out[3], 4);
+        SDL_TRANSPOSE4_AVX(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_AVX(dst - 52, dst - 20, out[4], 4);
+        SDL_StoreChannels_AVX(dst - 44, dst - 12, out[5], 4);
+        SDL_StoreChannels_AVX(dst - 36, dst - 4, out[6], 4);
+        SDL_StoreChannels_AVX(dst - 28, dst + 4, out[7], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 6, dst -= 8) {
+        dst[7] /* SR */ = 0.0f;
+        dst[6] /* SL */ = 0.0f;
+        dst[5] /* BR */ = src[5];
+        dst[4] /* BL */ = src[4];
+        dst[3] /* LFE */ = src[3];
+        dst[2] /* FC */ = src[2];
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 6) * 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert61ToMono_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("6.1", "mono (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 7); i >= 8; i -= 8, src += 56, dst += 8) {
+        __m256 in[8], out[1];
+        in[0] = SDL_LoadChannels_AVX(src, src + 28, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 7, src + 35, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 14, src + 42, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 21, src + 49, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src + 4, src + 32, 3);
+        in[5] = SDL_LoadChannels_AVX(src + 11, src + 39, 3);
+        in[6] = SDL_LoadChannels_AVX(src + 18, src + 46, 3);
+        in[7] = SDL_LoadChannels_AVX(src + 25, src + 53, 3);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FC */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.143142849f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[1], _mm256_set1_ps(0.143142849f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.143142849f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[3], _mm256_set1_ps(0.142857149f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[4], _mm256_set1_ps(0.143142849f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[5], _mm256_set1_ps(0.143142849f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[6], _mm256_set1_ps(0.143142849f)));
+        _mm256_storeu_ps(dst, out[0]);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 7, dst += 1) {
+        dst[0] /* FC */ = (src[0] * 0.143142849f) + (src[1] * 0.143142849f) + (src[2] * 0.143142849f) + (src[3] * 0.142857149f) + (src[4] * 0.143142849f) + (src[5] * 0.143142849f) + (src[6] * 0.143142849f);
+    }
+
+    cvt->len_cvt = cvt->len_cvt / 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert61ToStereo_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("6.1", "stereo (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 7); i >= 8; i -= 8, src += 56, dst += 16) {
+        __m256 in[8], out[4];
+        in[0] = SDL_LoadChannels_AVX(src, src + 28, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 7, src + 35, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 14, src + 42, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 21, src + 49, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src + 4, src + 32, 3);
+        in[5] = SDL_LoadChannels_AVX(src + 11, src + 39, 3);
+        in[6] = SDL_LoadChannels_AVX(src + 18, src + 46, 3);
+        in[7] = SDL_LoadChannels_AVX(src + 25, src + 53, 3);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.247384623f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.174461529f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[3], _mm256_set1_ps(0.076923080f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[4], _mm256_set1_ps(0.174461529f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[5], _mm256_set1_ps(0.226153851f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[6], _mm256_set1_ps(0.100615382f)));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.247384623f));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[2], _mm256_set1_ps(0.174461529f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[3], _mm256_set1_ps(0.076923080f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[4], _mm256_set1_ps(0.174461529f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[5], _mm256_set1_ps(0.100615382f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[6], _mm256_set1_ps(0.226153851f)));
+        out[2] = out[3] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst, dst + 8, out[0], 2);
+        SDL_StoreChannels_AVX(dst + 2, dst + 10, out[1], 2);
+        SDL_StoreChannels_AVX(dst + 4, dst + 12, out[2], 2);
+        SDL_StoreChannels_AVX(dst + 6, dst + 14, out[3], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 7, dst += 2) {
+        const float srcFC = src[2];
+        const float srcLFE = src[3];
+        const float srcBC = src[4];
+        const float srcSL = src[5];
+        const float srcSR = src[6];
+        dst[0] /* FL */ = (src[0] * 0.247384623f) + (srcFC * 0.174461529f) + (srcLFE * 0.076923080f) + (srcBC * 0.174461529f) + (srcSL * 0.226153851f) + (srcSR * 0.100615382f);
+        dst[1] /* FR */ = (src[1] * 0.247384623f) + (srcFC * 0.174461529f) + (srcLFE * 0.076923080f) + (srcBC * 0.174461529f) + (srcSL * 0.100615382f) + (srcSR * 0.226153851f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 7) * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert61To21_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("6.1", "2.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 7); i >= 8; i -= 8, src += 56, dst += 24) {
+        __m256 in[8], out[4];
+        in[0] = SDL_LoadChannels_AVX(src, src + 28, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 7, src + 35, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 14, src + 42, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 21, src + 49, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src + 4, src + 32, 3);
+        in[5] = SDL_LoadChannels_AVX(src + 11, src + 39, 3);
+        in[6] = SDL_LoadChannels_AVX(src + 18, src + 46, 3);
+        in[7] = SDL_LoadChannels_AVX(src + 25, src + 53, 3);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.268000007f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.188999996f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[4], _mm256_set1_ps(0.188999996f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[5], _mm256_set1_ps(0.245000005f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[6], _mm256_set1_ps(0.108999997f)));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.268000007f));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[2], _mm256_set1_ps(0.188999996f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[4], _mm256_set1_ps(0.188999996f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[5], _mm256_set1_ps(0.108999997f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[6], _mm256_set1_ps(0.245000005f)));
+        out[2] /* LFE */ = in[3];
+        out[3] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst, dst + 12, out[0], 3);
+        SDL_StoreChannels_AVX(dst + 3, dst + 15, out[1], 3);
+        SDL_StoreChannels_AVX(dst + 6, dst + 18, out[2], 3);
+        SDL_StoreChannels_AVX(dst + 9, dst + 21, out[3], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 7, dst += 3) {
+        const float srcFC = src[2];
+        const float srcBC = src[4];
+        const float srcSL = src[5];
+        const float srcSR = src[6];
+        dst[0] /* FL */ = (src[0] * 0.268000007f) + (srcFC * 0.188999996f) + (srcBC * 0.188999996f) + (srcSL * 0.245000005f) + (srcSR * 0.108999997f);
+        dst[1] /* FR */ = (src[1] * 0.268000007f) + (srcFC * 0.188999996f) + (srcBC * 0.188999996f) + (srcSL * 0.108999997f) + (srcSR * 0.245000005f);
+        dst[2] /* LFE */ = src[3];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 7) * 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert61ToQuad_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("6.1", "quad (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 7); i >= 8; i -= 8, src += 56, dst += 32) {
+        __m256 in[8], out[4];
+        in[0] = SDL_LoadChannels_AVX(src, src + 28, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 7, src + 35, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 14, src + 42, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 21, src + 49, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src + 4, src + 32, 3);
+        in[5] = SDL_LoadChannels_AVX(src + 11, src + 39, 3);
+        in[6] = SDL_LoadChannels_AVX(src + 18, src + 46, 3);
+        in[7] = SDL_LoadChannels_AVX(src + 25, src + 53, 3);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.463679999f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.327360004f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[3], _mm256_set1_ps(0.040000003f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[5], _mm256_set1_ps(0.168960005f)));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.463679999f));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[2], _mm256_set1_ps(0.327360004f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[3], _mm256_set1_ps(0.040000003f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[6], _mm256_set1_ps(0.168960005f)));
+        out[2] /* BL */ = _mm256_mul_ps(in[3], _mm256_set1_ps(0.040000003f));
+        out[2] = _mm256_add_ps(out[2], _mm256_mul_ps(in[4], _mm256_set1_ps(0.327360004f)));
+        out[2] = _mm256_add_ps(out[2], _mm256_mul_ps(in[5], _mm256_set1_ps(0.431039989f)));
+        out[3] /* BR */ = _mm256_mul_ps(in[3], _mm256_set1_ps(0.040000003f));
+        out[3] = _mm256_add_ps(out[3], _mm256_mul_ps(in[4], _mm256_set1_ps(0.327360004f)));
+        out[3] = _mm256_add_ps(out[3], _mm256_mul_ps(in[6], _mm256_set1_ps(0.431039989f)));
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst, dst + 16, out[0], 4);
+        SDL_StoreChannels_AVX(dst + 4, dst + 20, out[1], 4);
+        SDL_StoreChannels_AVX(dst + 8, dst + 24, out[2], 4);
+        SDL_StoreChannels_AVX(dst + 12, dst + 28, out[3], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 7, dst += 4) {
+        const float srcFC = src[2];
+        const float srcLFE = src[3];
+        const float srcBC = src[4];
+        const float srcSL = src[5];
+        const float srcSR = src[6];
+        dst[0] /* FL */ = (src[0] * 0.463679999f) + (srcFC * 0.327360004f) + (srcLFE * 0.040000003f) + (srcSL * 0.168960005f);
+        dst[1] /* FR */ = (src[1] * 0.463679999f) + (srcFC * 0.327360004f) + (srcLFE * 0.040000003f) + (srcSR * 0.168960005f);
+        dst[2] /* BL */ = (srcLFE * 0.040000003f) + (srcBC * 0.327360004f) + (srcSL * 0.431039989f);
+        dst[3] /* BR */ = (srcLFE * 0.040000003f) + (srcBC * 0.327360004f) + (srcSR * 0.431039989f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 7) * 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert61To41_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("6.1", "4.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 7); i >= 8; i -= 8, src += 56, dst += 40) {
+        __m256 in[8], out[8];
+        in[0] = SDL_LoadChannels_AVX(src, src + 28, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 7, src + 35, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 14, src + 42, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 21, src + 49, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src + 4, src + 32, 3);
+        in[5] = SDL_LoadChannels_AVX(src + 11, src + 39, 3);
+        in[6] = SDL_LoadChannels_AVX(src + 18, src + 46, 3);
+        in[7] = SDL_LoadChannels_AVX(src + 25, src + 53, 3);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.483000010f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.340999991f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[5], _mm256_set1_ps(0.175999999f)));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.483000010f));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[2], _mm256_set1_ps(0.340999991f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[6], _mm256_set1_ps(0.175999999f)));
+        out[2] /* LFE */ = in[3];
+        out[3] /* BL */ = _mm256_mul_ps(in[4], _mm256_set1_ps(0.340999991f));
+        out[3] = _mm256_add_ps(out[3], _mm256_mul_ps(in[5], _mm256_set1_ps(0.449000001f)));
+        out[4] /* BR */ = _mm256_mul_ps(in[4], _mm256_set1_ps(0.340999991f));
+        out[4] = _mm256_add_ps(out[4], _mm256_mul_ps(in[6], _mm256_set1_ps(0.449000001f)));
+        out[5] = out[6] = out[7] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst, dst + 20, out[0], 4);
+        SDL_StoreChannels_AVX(dst + 5, dst + 25, out[1], 4);
+        SDL_StoreChannels_AVX(dst + 10, dst + 30, out[2], 4);
+        SDL_StoreChannels_AVX(dst + 15, dst + 35, out[3], 4);
+        SDL_TRANSPOSE4_AVX(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_AVX(dst + 4, dst + 24, out[4], 1);
+        SDL_StoreChannels_AVX(dst + 9, dst + 29, out[5], 1);
+        SDL_StoreChannels_AVX(dst + 14, dst + 34, out[6], 1);
+        SDL_StoreChannels_AVX(dst + 19, dst + 39, out[7], 1);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 7, dst += 5) {
+        const float srcFC = src[2];
+        const float srcBC = src[4];
+        const float srcSL = src[5];
+        const float srcSR = src[6];
+        dst[0] /* FL */ = (src[0] * 0.483000010f) + (srcFC * 0.340999991f) + (srcSL * 0.175999999f);
+        dst[1] /* FR */ = (src[1] * 0.483000010f) + (srcFC * 0.340999991f) + (srcSR * 0.175999999f);
+        dst[2] /* LFE */ = src[3];
+        dst[3] /* BL */ = (srcBC * 0.340999991f) + (srcSL * 0.449000001f);
+        dst[4] /* BR */ = (srcBC * 0.340999991f) + (srcSR * 0.449000001f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 7) * 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert61To51_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("6.1", "5.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 7); i >= 8; i -= 8, src += 56, dst += 48) {
+        __m256 in[8], out[8];
+        in[0] = SDL_LoadChannels_AVX(src, src + 28, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 7, src + 35, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 14, src + 42, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 21, src + 49, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src + 4, src + 32, 3);
+        in[5] = SDL_LoadChannels_AVX(src + 11, src + 39, 3);
+        in[6] = SDL_LoadChannels_AVX(src + 18, src + 46, 3);
+        in[7] = SDL_LoadChannels_AVX(src + 25, src + 53, 3);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.611000001f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[5], _mm256_set1_ps(0.223000005f)));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.611000001f));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[6], _mm256_set1_ps(0.223000005f)));
+        out[2] /* FC */ = _mm256_mul_ps(in[2], _mm256_set1_ps(0.611000001f));
+        out[3] /* LFE */ = in[3];
+        out[4] /* BL */ = _mm256_mul_ps(in[4], _mm256_set1_ps(0.432000011f));
+        out[4] = _mm256_add_ps(out[4], _mm256_mul_ps(in[5], _mm256_set1_ps(0.568000019f)));
+        out[5] /* BR */ = _mm256_mul_ps(in[4], _mm256_set1_ps(0.432000011f));
+        out[5] = _mm256_add_ps(out[5], _mm256_mul_ps(in[6], _mm256_set1_ps(0.568000019f)));
+        out[6] = out[7] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst, dst + 24, out[0], 4);
+        SDL_StoreChannels_AVX(dst + 6, dst + 30, out[1], 4);
+        SDL_StoreChannels_AVX(dst + 12, dst + 36, out[2], 4);
+        SDL_StoreChannels_AVX(dst + 18, dst + 42, out[3], 4);
+        SDL_TRANSPOSE4_AVX(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_AVX(dst + 4, dst + 28, out[4], 2);
+        SDL_StoreChannels_AVX(dst + 10, dst + 34, out[5], 2);
+        SDL_StoreChannels_AVX(dst + 16, dst + 40, out[6], 2);
+        SDL_StoreChannels_AVX(dst + 22, dst + 46, out[7], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 7, dst += 6) {
+        const float srcBC = src[4];
+        const float srcSL = src[5];
+        const float srcSR = src[6];
+        dst[0] /* FL */ = (src[0] * 0.611000001f) + (srcSL * 0.223000005f);
+        dst[1] /* FR */ = (src[1] * 0.611000001f) + (srcSR * 0.223000005f);
+        dst[2] /* FC */ = (src[2] * 0.611000001f);
+        dst[3] /* LFE */ = src[3];
+        dst[4] /* BL */ = (srcBC * 0.432000011f) + (srcSL * 0.568000019f);
+        dst[5] /* BR */ = (srcBC * 0.432000011f) + (srcSR * 0.568000019f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 7) * 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert61To71_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 7) * 8))) - 8;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 7;
+    int i;
+
+    LOG_DEBUG_CONVERT("6.1", "7.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 7); i >= 8; i -= 8, src -= 56, dst -= 64) {
+        __m256 in[8], out[8];
+        in[0] = SDL_LoadChannels_AVX(src - 49, src - 21, 4);
+        in[1] = SDL_LoadChannels_AVX(src - 42, src - 14, 4);
+        in[2] = SDL_LoadChannels_AVX(src - 35, src - 7, 4);
+        in[3] = SDL_LoadChannels_AVX(src - 28, src, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src - 45, src - 17, 3);
+        in[5] = SDL_LoadChannels_AVX(src - 38, src - 10, 3);
+        in[6] = SDL_LoadChannels_AVX(src - 31, src - 3, 3);
+        in[7] = SDL_LoadChannels_AVX(src - 24, src + 4, 3);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = in[2];
+        out[3] /* LFE */ = in[3];
+        out[4] /* BL */ = _mm256_mul_ps(in[4], _mm256_set1_ps(0.707000017f));
+        out[5] /* BR */ = _mm256_mul_ps(in[4], _mm256_set1_ps(0.707000017f));
+        out[6] /* SL */ = in[5];
+        out[7] /* SR */ = in[6];
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst - 56, dst - 24, out[0], 4);
+        SDL_StoreChannels_AVX(dst - 48, dst - 16, out[1], 4);
+        SDL_StoreChannels_AVX(dst - 40, dst - 8, out[2], 4);
+        SDL_StoreChannels_AVX(dst - 32, dst, out[3], 4);
+        SDL_TRANSPOSE4_AVX(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_AVX(dst - 52, dst - 20, out[4], 4);
+        SDL_StoreChannels_AVX(dst - 44, dst - 12, out[5], 4);
+        SDL_StoreChannels_AVX(dst - 36, dst - 4, out[6], 4);
+        SDL_StoreChannels_AVX(dst - 28, dst + 4, out[7], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 7, dst -= 8) {
+        const float srcBC = src[4];
+        dst[7] /* SR */ = src[6];
+        dst[6] /* SL */ = src[5];
+        dst[5] /* BR */ = (srcBC * 0.707000017f);
+        dst[4] /* BL */ = (srcBC * 0.707000017f);
+        dst[3] /* LFE */ = src[3];
+        dst[2] /* FC */ = src[2];
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 7) * 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert71ToMono_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("7.1", "mono (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 8); i >= 8; i -= 8, src += 64, dst += 8) {
+        __m256 in[8], out[1];
+        in[0] = SDL_LoadChannels_AVX(src, src + 32, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 8, src + 40, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 16, src + 48, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 24, src + 56, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src + 4, src + 36, 4);
+        in[5] = SDL_LoadChannels_AVX(src + 12, src + 44, 4);
+        in[6] = SDL_LoadChannels_AVX(src + 20, src + 52, 4);
+        in[7] = SDL_LoadChannels_AVX(src + 28, src + 60, 4);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FC */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.125125006f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[1], _mm256_set1_ps(0.125125006f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.125125006f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[3], _mm256_set1_ps(0.125000000f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[4], _mm256_set1_ps(0.125125006f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[5], _mm256_set1_ps(0.125125006f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[6], _mm256_set1_ps(0.125125006f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[7], _mm256_set1_ps(0.125125006f)));
+        _mm256_storeu_ps(dst, out[0]);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 8, dst += 1) {
+        dst[0] /* FC */ = (src[0] * 0.125125006f) + (src[1] * 0.125125006f) + (src[2] * 0.125125006f) + (src[3] * 0.125000000f) + (src[4] * 0.125125006f) + (src[5] * 0.125125006f) + (src[6] * 0.125125006f) + (src[7] * 0.125125006f);
+    }
+
+    cvt->len_cvt = cvt->len_cvt / 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert71ToStereo_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("7.1", "stereo (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 8); i >= 8; i -= 8, src += 64, dst += 16) {
+        __m256 in[8], out[4];
+        in[0] = SDL_LoadChannels_AVX(src, src + 32, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 8, src + 40, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 16, src + 48, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 24, src + 56, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src + 4, src + 36, 4);
+        in[5] = SDL_LoadChannels_AVX(src + 12, src + 44, 4);
+        in[6] = SDL_LoadChannels_AVX(src + 20, src + 52, 4);
+        in[7] = SDL_LoadChannels_AVX(src + 28, src + 60, 4);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.211866662f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.150266662f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[3], _mm256_set1_ps(0.066666670f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[4], _mm256_set1_ps(0.181066677f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[5], _mm256_set1_ps(0.111066669f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[6], _mm256_set1_ps(0.194133341f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[7], _mm256_set1_ps(0.085866667f)));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.211866662f));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[2], _mm256_set1_ps(0.150266662f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[3], _mm256_set1_ps(0.066666670f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[4], _mm256_set1_ps(0.111066669f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[5], _mm256_set1_ps(0.181066677f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[6], _mm256_set1_ps(0.085866667f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[7], _mm256_set1_ps(0.194133341f)));
+        out[2] = out[3] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst, dst + 8, out[0], 2);
+        SDL_StoreChannels_AVX(dst + 2, dst + 10, out[1], 2);
+        SDL_StoreChannels_AVX(dst + 4, dst + 12, out[2], 2);
+        SDL_StoreChannels_AVX(dst + 6, dst + 14, out[3], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 8, dst += 2) {
+        const float srcFC = src[2];
+        const float srcLFE = src[3];
+        const float srcBL = src[4];
+        const float srcBR = src[5];
+        const float srcSL = src[6];
+        const float srcSR = src[7];
+        dst[0] /* FL */ = (src[0] * 0.211866662f) + (srcFC * 0.150266662f) + (srcLFE * 0.066666670f) + (srcBL * 0.181066677f) + (srcBR * 0.111066669f) + (srcSL * 0.194133341f) + (srcSR * 0.085866667f);
+        dst[1] /* FR */ = (src[1] * 0.211866662f) + (srcFC * 0.150266662f) + (srcLFE * 0.066666670f) + (srcBL * 0.111066669f) + (srcBR * 0.181066677f) + (srcSL * 0.085866667f) + (srcSR * 0.194133341f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 8) * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert71To21_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("7.1", "2.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 8); i >= 8; i -= 8, src += 64, dst += 24) {
+        __m256 in[8], out[4];
+        in[0] = SDL_LoadChannels_AVX(src, src + 32, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 8, src + 40, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 16, src + 48, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 24, src + 56, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src + 4, src + 36, 4);
+        in[5] = SDL_LoadChannels_AVX(src + 12, src + 44, 4);
+        in[6] = SDL_LoadChannels_AVX(src + 20, src + 52, 4);
+        in[7] = SDL_LoadChannels_AVX(src + 28, src + 60, 4);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.226999998f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.160999998f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[4], _mm256_set1_ps(0.194000006f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[5], _mm256_set1_ps(0.119000003f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[6], _mm256_set1_ps(0.208000004f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[7], _mm256_set1_ps(0.092000000f)));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.226999998f));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[2], _mm256_set1_ps(0.160999998f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[4], _mm256_set1_ps(0.119000003f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[5], _mm256_set1_ps(0.194000006f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[6], _mm256_set1_ps(0.092000000f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[7], _mm256_set1_ps(0.208000004f)));
+        out[2] /* LFE */ = in[3];
+        out[3] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst, dst + 12, out[0], 3);
+        SDL_StoreChannels_AVX(dst + 3, dst + 15, out[1], 3);
+        SDL_StoreChannels_AVX(dst + 6, dst + 18, out[2], 3);
+        SDL_StoreChannels_AVX(dst + 9, dst + 21, out[3], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 8, dst += 3) {
+        const float srcFC = src[2];
+        const float srcBL = src[4];
+        const float srcBR = src[5];
+        const float srcSL = src[6];
+        const float srcSR = src[7];
+        dst[0] /* FL */ = (src[0] * 0.226999998f) + (srcFC * 0.160999998f) + (srcBL * 0.194000006f) + (srcBR * 0.119000003f) + (srcSL * 0.208000004f) + (srcSR * 0.092000000f);
+        dst[1] /* FR */ = (src[1] * 0.226999998f) + (srcFC * 0.160999998f) + (srcBL * 0.119000003f) + (srcBR * 0.194000006f) + (srcSL * 0.092000000f) + (srcSR * 0.208000004f);
+        dst[2] /* LFE */ = src[3];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 8) * 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert71ToQuad_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("7.1", "quad (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 8); i >= 8; i -= 8, src += 64, dst += 32) {
+        __m256 in[8], out[4];
+        in[0] = SDL_LoadChannels_AVX(src, src + 32, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 8, src + 40, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 16, src + 48, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 24, src + 56, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src + 4, src + 36, 4);
+        in[5] = SDL_LoadChannels_AVX(src + 12, src + 44, 4);
+        in[6] = SDL_LoadChannels_AVX(src + 20, src + 52, 4);
+        in[7] = SDL_LoadChannels_AVX(src + 28, src + 60, 4);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.466344833f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.329241365f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[3], _mm256_set1_ps(0.034482758f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[6], _mm256_set1_ps(0.169931039f)));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.466344833f));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[2], _mm256_set1_ps(0.329241365f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[3], _mm256_set1_ps(0.034482758f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[7], _mm256_set1_ps(0.169931039f)));
+        out[2] /* BL */ = _mm256_mul_ps(in[3], _mm256_set1_ps(0.034482758f));
+        out[2] = _mm256_add_ps(out[2], _mm256_mul_ps(in[4], _mm256_set1_ps(0.466344833f)));
+        out[2] = _mm256_add_ps(out[2], _mm256_mul_ps(in[6], _mm256_set1_ps(0.433517247f)));
+        out[3] /* BR */ = _mm256_mul_ps(in[3], _mm256_set1_ps(0.034482758f));
+        out[3] = _mm256_add_ps(out[3], _mm256_mul_ps(in[5], _mm256_set1_ps(0.466344833f)));
+        out[3] = _mm256_add_ps(out[3], _mm256_mul_ps(in[7], _mm256_set1_ps(0.433517247f)));
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst, dst + 16, out[0], 4);
+        SDL_StoreChannels_AVX(dst + 4, dst + 20, out[1], 4);
+        SDL_StoreChannels_AVX(dst + 8, dst + 24, out[2], 4);
+        SDL_StoreChannels_AVX(dst + 12, dst + 28, out[3], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 8, dst += 4) {
+        const float srcFC = src[2];
+        const float srcLFE = src[3];
+        const float srcSL = src[6];
+        const float srcSR = src[7];
+        dst[0] /* FL */ = (src[0] * 0.466344833f) + (srcFC * 0.329241365f) + (srcLFE * 0.034482758f) + (srcSL * 0.169931039f);
+        dst[1] /* FR */ = (src[1] * 0.466344833f) + (srcFC * 0.329241365f) + (srcLFE * 0.034482758f) + (srcSR * 0.169931039f);
+        dst[2] /* BL */ = (srcLFE * 0.034482758f) + (src[4] * 0.466344833f) + (srcSL * 0.433517247f);
+        dst[3] /* BR */ = (srcLFE * 0.034482758f) + (src[5] * 0.466344833f) + (srcSR * 0.433517247f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 8) * 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert71To41_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("7.1", "4.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 8); i >= 8; i -= 8, src += 64, dst += 40) {
+        __m256 in[8], out[8];
+        in[0] = SDL_LoadChannels_AVX(src, src + 32, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 8, src + 40, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 16, src + 48, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 24, src + 56, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src + 4, src + 36, 4);
+        in[5] = SDL_LoadChannels_AVX(src + 12, src + 44, 4);
+        in[6] = SDL_LoadChannels_AVX(src + 20, src + 52, 4);
+        in[7] = SDL_LoadChannels_AVX(src + 28, src + 60, 4);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.483000010f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[2], _mm256_set1_ps(0.340999991f)));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[6], _mm256_set1_ps(0.175999999f)));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.483000010f));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[2], _mm256_set1_ps(0.340999991f)));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[7], _mm256_set1_ps(0.175999999f)));
+        out[2] /* LFE */ = in[3];
+        out[3] /* BL */ = _mm256_mul_ps(in[4], _mm256_set1_ps(0.483000010f));
+        out[3] = _mm256_add_ps(out[3], _mm256_mul_ps(in[6], _mm256_set1_ps(0.449000001f)));
+        out[4] /* BR */ = _mm256_mul_ps(in[5], _mm256_set1_ps(0.483000010f));
+        out[4] = _mm256_add_ps(out[4], _mm256_mul_ps(in[7], _mm256_set1_ps(0.449000001f)));
+        out[5] = out[6] = out[7] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst, dst + 20, out[0], 4);
+        SDL_StoreChannels_AVX(dst + 5, dst + 25, out[1], 4);
+        SDL_StoreChannels_AVX(dst + 10, dst + 30, out[2], 4);
+        SDL_StoreChannels_AVX(dst + 15, dst + 35, out[3], 4);
+        SDL_TRANSPOSE4_AVX(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_AVX(dst + 4, dst + 24, out[4], 1);
+        SDL_StoreChannels_AVX(dst + 9, dst + 29, out[5], 1);
+        SDL_StoreChannels_AVX(dst + 14, dst + 34, out[6], 1);
+        SDL_StoreChannels_AVX(dst + 19, dst + 39, out[7], 1);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 8, dst += 5) {
+        const float srcFC = src[2];
+        const float srcSL = src[6];
+        const float srcSR = src[7];
+        dst[0] /* FL */ = (src[0] * 0.483000010f) + (srcFC * 0.340999991f) + (srcSL * 0.175999999f);
+        dst[1] /* FR */ = (src[1] * 0.483000010f) + (srcFC * 0.340999991f) + (srcSR * 0.175999999f);
+        dst[2] /* LFE */ = src[3];
+        dst[3] /* BL */ = (src[4] * 0.483000010f) + (srcSL * 0.449000001f);
+        dst[4] /* BR */ = (src[5] * 0.483000010f) + (srcSR * 0.449000001f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 8) * 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert71To51_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("7.1", "5.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 8); i >= 8; i -= 8, src += 64, dst += 48) {
+        __m256 in[8], out[8];
+        in[0] = SDL_LoadChannels_AVX(src, src + 32, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 8, src + 40, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 16, src + 48, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 24, src + 56, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src + 4, src + 36, 4);
+        in[5] = SDL_LoadChannels_AVX(src + 12, src + 44, 4);
+        in[6] = SDL_LoadChannels_AVX(src + 20, src + 52, 4);
+        in[7] = SDL_LoadChannels_AVX(src + 28, src + 60, 4);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.518000007f));
+        out[0] = _mm256_add_ps(out[0], _mm256_mul_ps(in[6], _mm256_set1_ps(0.188999996f)));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.518000007f));
+        out[1] = _mm256_add_ps(out[1], _mm256_mul_ps(in[7], _mm256_set1_ps(0.188999996f)));
+        out[2] /* FC */ = _mm256_mul_ps(in[2], _mm256_set1_ps(0.518000007f));
+        out[3] /* LFE */ = in[3];
+        out[4] /* BL */ = _mm256_mul_ps(in[4], _mm256_set1_ps(0.518000007f));
+        out[4] = _mm256_add_ps(out[4], _mm256_mul_ps(in[6], _mm256_set1_ps(0.481999993f)));
+        out[5] /* BR */ = _mm256_mul_ps(in[5], _mm256_set1_ps(0.518000007f));
+        out[5] = _mm256_add_ps(out[5], _mm256_mul_ps(in[7], _mm256_set1_ps(0.481999993f)));
+        out[6] = out[7] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst, dst + 24, out[0], 4);
+        SDL_StoreChannels_AVX(dst + 6, dst + 30, out[1], 4);
+        SDL_StoreChannels_AVX(dst + 12, dst + 36, out[2], 4);
+        SDL_StoreChannels_AVX(dst + 18, dst + 42, out[3], 4);
+        SDL_TRANSPOSE4_AVX(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_AVX(dst + 4, dst + 28, out[4], 2);
+        SDL_StoreChannels_AVX(dst + 10, dst + 34, out[5], 2);
+        SDL_StoreChannels_AVX(dst + 16, dst + 40, out[6], 2);
+        SDL_StoreChannels_AVX(dst + 22, dst + 46, out[7], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 8, dst += 6) {
+        const float srcSL = src[6];
+        const float srcSR = src[7];
+        dst[0] /* FL */ = (src[0] * 0.518000007f) + (srcSL * 0.188999996f);
+        dst[1] /* FR */ = (src[1] * 0.518000007f) + (srcSR * 0.188999996f);
+        dst[2] /* FC */ = (src[2] * 0.518000007f);
+        dst[3] /* LFE */ = src[3];
+        dst[4] /* BL */ = (src[4] * 0.518000007f) + (srcSL * 0.481999993f);
+        dst[5] /* BR */ = (src[5] * 0.518000007f) + (srcSR * 0.481999993f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 8) * 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx")
+SDL_Convert71To61_AVX(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("7.1", "6.1 (using AVX)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 8); i >= 8; i -= 8, src += 64, dst += 56) {
+        __m256 in[8], out[8];
+        in[0] = SDL_LoadChannels_AVX(src, src + 32, 4);
+        in[1] = SDL_LoadChannels_AVX(src + 8, src + 40, 4);
+        in[2] = SDL_LoadChannels_AVX(src + 16, src + 48, 4);
+        in[3] = SDL_LoadChannels_AVX(src + 24, src + 56, 4);
+        SDL_TRANSPOSE4_AVX(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_AVX(src + 4, src + 36, 4);
+        in[5] = SDL_LoadChannels_AVX(src + 12, src + 44, 4);
+        in[6] = SDL_LoadChannels_AVX(src + 20, src + 52, 4);
+        in[7] = SDL_LoadChannels_AVX(src + 28, src + 60, 4);
+        SDL_TRANSPOSE4_AVX(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = _mm256_mul_ps(in[0], _mm256_set1_ps(0.541000009f));
+        out[1] /* FR */ = _mm256_mul_ps(in[1], _mm256_set1_ps(0.541000009f));
+        out[2] /* FC */ = _mm256_mul_ps(in[2], _mm256_set1_ps(0.541000009f));
+        out[3] /* LFE */ = in[3];
+        out[4] /* BC */ = _mm256_mul_ps(in[4], _mm256_set1_ps(0.287999988f));
+        out[4] = _mm256_add_ps(out[4], _mm256_mul_ps(in[5], _mm256_set1_ps(0.287999988f)));
+        out[5] /* SL */ = _mm256_mul_ps(in[4], _mm256_set1_ps(0.458999991f));
+        out[5] = _mm256_add_ps(out[5], _mm256_mul_ps(in[6], _mm256_set1_ps(0.541000009f)));
+        out[6] /* SR */ = _mm256_mul_ps(in[5], _mm256_set1_ps(0.458999991f));
+        out[6] = _mm256_add_ps(out[6], _mm256_mul_ps(in[7], _mm256_set1_ps(0.541000009f)));
+        out[7] = _mm256_setzero_ps();  /* padding for the transpose. */
+        SDL_TRANSPOSE4_AVX(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_AVX(dst, dst + 28, out[0], 4);
+        SDL_StoreChannels_AVX(dst + 7, dst + 35, out[1], 4);
+        SDL_StoreChannels_AVX(dst + 14, dst + 42, out[2], 4);
+        SDL_StoreChannels_AVX(dst + 21, dst + 49, out[3], 4);
+        SDL_TRANSPOSE4_AVX(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_AVX(dst + 4, dst + 32, out[4], 3);
+        SDL_StoreChannels_AVX(dst + 11, dst + 39, out[5], 3);
+        SDL_StoreChannels_AVX(dst + 18, dst + 46, out[6], 3);
+        SDL_StoreChannels_AVX(dst + 25, dst + 53, out[7], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 8, dst += 7) {
+        const float srcBL = src[4];
+        const float srcBR = src[5];
+        dst[0] /* FL */ = (src[0] * 0.541000009f);
+        dst[1] /* FR */ = (src[1] * 0.541000009f);
+        dst[2] /* FC */ = (src[2] * 0.541000009f);
+        dst[3] /* LFE */ = src[3];
+        dst[4] /* BC */ = (srcBL * 0.287999988f) + (srcBR * 0.287999988f);
+        dst[5] /* SL */ = (srcBL * 0.458999991f) + (src[6] * 0.541000009f);
+        dst[6] /* SR */ = (srcBR * 0.458999991f) + (src[7] * 0.541000009f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 8) * 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static const SDL_AudioFilter channel_converters_AVX[8][8] = {   /* [from][to] */
+    { NULL, SDL_ConvertMonoToStereo_AVX, SDL_ConvertMonoTo21_AVX, SDL_ConvertMonoToQuad_AVX, SDL_ConvertMonoTo41_AVX, SDL_ConvertMonoTo51_AVX, SDL_ConvertMonoTo61_AVX, SDL_ConvertMonoTo71_AVX },
+    { SDL_ConvertStereoToMono_AVX, NULL, SDL_ConvertStereoTo21_AVX, SDL_ConvertStereoToQuad_AVX, SDL_ConvertStereoTo41_AVX, SDL_ConvertStereoTo51_AVX, SDL_ConvertStereoTo61_AVX, SDL_ConvertStereoTo71_AVX },
+    { SDL_Convert21ToMono_AVX, SDL_Convert21ToStereo_AVX, NULL, SDL_Convert21ToQuad_AVX, SDL_Convert21To41_AVX, SDL_Convert21To51_AVX, SDL_Convert21To61_AVX, SDL_Convert21To71_AVX },
+    { SDL_ConvertQuadToMono_AVX, SDL_ConvertQuadToStereo_AVX, SDL_ConvertQuadTo21_AVX, NULL, SDL_ConvertQuadTo41_AVX, SDL_ConvertQuadTo51_AVX, SDL_ConvertQuadTo61_AVX, SDL_ConvertQuadTo71_AVX },
+    { SDL_Convert41ToMono_AVX, SDL_Convert41ToStereo_AVX, SDL_Convert41To21_AVX, SDL_Convert41ToQuad_AVX, NULL, SDL_Convert41To51_AVX, SDL_Convert41To61_AVX, SDL_Convert41To71_AVX },
+    { SDL_Convert51ToMono_AVX, SDL_Convert51ToStereo_AVX, SDL_Convert51To21_AVX, SDL_Convert51ToQuad_AVX, SDL_Convert51To41_AVX, NULL, SDL_Convert51To61_AVX, SDL_Convert51To71_AVX },
+    { SDL_Convert61ToMono_AVX, SDL_Convert61ToStereo_AVX, SDL_Convert61To21_AVX, SDL_Convert61ToQuad_AVX, SDL_Convert61To41_AVX, SDL_Convert61To51_AVX, NULL, SDL_Convert61To71_AVX },
+    { SDL_Convert71ToMono_AVX, SDL_Convert71ToStereo_AVX, SDL_Convert71To21_AVX, SDL_Convert71ToQuad_AVX, SDL_Convert71To41_AVX, SDL_Convert71To51_AVX, SDL_Convert71To61_AVX, NULL }
+};
+
+#endif
+
+#if HAVE_NEON_INTRINSICS
+
+static void SDLCALL
+SDL_ConvertMonoToStereo_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 1) * 2))) - 2;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("mono", "stereo (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 1); i >= 4; i -= 4, src -= 4, dst -= 8) {
+        float32x4_t in[1], out[4];
+        in[0] = vld1q_f32(src - 3);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[0];
+        out[2] = out[3] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 6, out[0], 2);
+        SDL_StoreChannels_NEON(dst - 4, out[1], 2);
+        SDL_StoreChannels_NEON(dst - 2, out[2], 2);
+        SDL_StoreChannels_NEON(dst, out[3], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 1, dst -= 2) {
+        const float srcFC = src[0];
+        dst[1] /* FR */ = srcFC;
+        dst[0] /* FL */ = srcFC;
+    }
+
+    cvt->len_cvt = cvt->len_cvt * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertMonoTo21_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 1) * 3))) - 3;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("mono", "2.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 1); i >= 4; i -= 4, src -= 4, dst -= 12) {
+        float32x4_t in[1], out[4];
+        in[0] = vld1q_f32(src - 3);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[0];
+        out[2] /* LFE */ = vdupq_n_f32(0.0f);
+        out[3] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 9, out[0], 3);
+        SDL_StoreChannels_NEON(dst - 6, out[1], 3);
+        SDL_StoreChannels_NEON(dst - 3, out[2], 3);
+        SDL_StoreChannels_NEON(dst, out[3], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 1, dst -= 3) {
+        const float srcFC = src[0];
+        dst[2] /* LFE */ = 0.0f;
+        dst[1] /* FR */ = srcFC;
+        dst[0] /* FL */ = srcFC;
+    }
+
+    cvt->len_cvt = cvt->len_cvt * 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertMonoToQuad_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 1) * 4))) - 4;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("mono", "quad (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 1); i >= 4; i -= 4, src -= 4, dst -= 16) {
+        float32x4_t in[1], out[4];
+        in[0] = vld1q_f32(src - 3);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[0];
+        out[2] /* BL */ = vdupq_n_f32(0.0f);
+        out[3] /* BR */ = vdupq_n_f32(0.0f);
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 12, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 8, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 4, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 1, dst -= 4) {
+        const float srcFC = src[0];
+        dst[3] /* BR */ = 0.0f;
+        dst[2] /* BL */ = 0.0f;
+        dst[1] /* FR */ = srcFC;
+        dst[0] /* FL */ = srcFC;
+    }
+
+    cvt->len_cvt = cvt->len_cvt * 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertMonoTo41_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 1) * 5))) - 5;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("mono", "4.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 1); i >= 4; i -= 4, src -= 4, dst -= 20) {
+        float32x4_t in[1], out[8];
+        in[0] = vld1q_f32(src - 3);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[0];
+        out[2] /* LFE */ = vdupq_n_f32(0.0f);
+        out[3] /* BL */ = vdupq_n_f32(0.0f);
+        out[4] /* BR */ = vdupq_n_f32(0.0f);
+        out[5] = out[6] = out[7] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 15, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 10, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 5, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+        SDL_StoreChannels_NEON(dst - 11, out[4], 1);
+        SDL_StoreChannels_NEON(dst - 6, out[5], 1);
+        SDL_StoreChannels_NEON(dst - 1, out[6], 1);
+        SDL_StoreChannels_NEON(dst + 4, out[7], 1);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 1, dst -= 5) {
+        const float srcFC = src[0];
+        dst[4] /* BR */ = 0.0f;
+        dst[3] /* BL */ = 0.0f;
+        dst[2] /* LFE */ = 0.0f;
+        dst[1] /* FR */ = srcFC;
+        dst[0] /* FL */ = srcFC;
+    }
+
+    cvt->len_cvt = cvt->len_cvt * 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertMonoTo51_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 1) * 6))) - 6;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("mono", "5.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 1); i >= 4; i -= 4, src -= 4, dst -= 24) {
+        float32x4_t in[1], out[8];
+        in[0] = vld1q_f32(src - 3);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[0];
+        out[2] /* FC */ = vdupq_n_f32(0.0f);
+        out[3] /* LFE */ = vdupq_n_f32(0.0f);
+        out[4] /* BL */ = vdupq_n_f32(0.0f);
+        out[5] /* BR */ = vdupq_n_f32(0.0f);
+        out[6] = out[7] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 18, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 12, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 6, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+        SDL_StoreChannels_NEON(dst - 14, out[4], 2);
+        SDL_StoreChannels_NEON(dst - 8, out[5], 2);
+        SDL_StoreChannels_NEON(dst - 2, out[6], 2);
+        SDL_StoreChannels_NEON(dst + 4, out[7], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 1, dst -= 6) {
+        const float srcFC = src[0];
+        dst[5] /* BR */ = 0.0f;
+        dst[4] /* BL */ = 0.0f;
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = srcFC;
+        dst[0] /* FL */ = srcFC;
+    }
+
+    cvt->len_cvt = cvt->len_cvt * 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertMonoTo61_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 1) * 7))) - 7;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("mono", "6.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 1); i >= 4; i -= 4, src -= 4, dst -= 28) {
+        float32x4_t in[1], out[8];
+        in[0] = vld1q_f32(src - 3);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[0];
+        out[2] /* FC */ = vdupq_n_f32(0.0f);
+        out[3] /* LFE */ = vdupq_n_f32(0.0f);
+        out[4] /* BC */ = vdupq_n_f32(0.0f);
+        out[5] /* SL */ = vdupq_n_f32(0.0f);
+        out[6] /* SR */ = vdupq_n_f32(0.0f);
+        out[7] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 21, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 14, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 7, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+        SDL_StoreChannels_NEON(dst - 17, out[4], 3);
+        SDL_StoreChannels_NEON(dst - 10, out[5], 3);
+        SDL_StoreChannels_NEON(dst - 3, out[6], 3);
+        SDL_StoreChannels_NEON(dst + 4, out[7], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 1, dst -= 7) {
+        const float srcFC = src[0];
+        dst[6] /* SR */ = 0.0f;
+        dst[5] /* SL */ = 0.0f;
+        dst[4] /* BC */ = 0.0f;
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = srcFC;
+        dst[0] /* FL */ = srcFC;
+    }
+
+    cvt->len_cvt = cvt->len_cvt * 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertMonoTo71_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 1) * 8))) - 8;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("mono", "7.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 1); i >= 4; i -= 4, src -= 4, dst -= 32) {
+        float32x4_t in[1], out[8];
+        in[0] = vld1q_f32(src - 3);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[0];
+        out[2] /* FC */ = vdupq_n_f32(0.0f);
+        out[3] /* LFE */ = vdupq_n_f32(0.0f);
+        out[4] /* BL */ = vdupq_n_f32(0.0f);
+        out[5] /* BR */ = vdupq_n_f32(0.0f);
+        out[6] /* SL */ = vdupq_n_f32(0.0f);
+        out[7] /* SR */ = vdupq_n_f32(0.0f);
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 24, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 16, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 8, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+        SDL_StoreChannels_NEON(dst - 20, out[4], 4);
+        SDL_StoreChannels_NEON(dst - 12, out[5], 4);
+        SDL_StoreChannels_NEON(dst - 4, out[6], 4);
+        SDL_StoreChannels_NEON(dst + 4, out[7], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 1, dst -= 8) {
+        const float srcFC = src[0];
+        dst[7] /* SR */ = 0.0f;
+        dst[6] /* SL */ = 0.0f;
+        dst[5] /* BR */ = 0.0f;
+        dst[4] /* BL */ = 0.0f;
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = srcFC;
+        dst[0] /* FL */ = srcFC;
+    }
+
+    cvt->len_cvt = cvt->len_cvt * 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertStereoToMono_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("stereo", "mono (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 2); i >= 4; i -= 4, src += 8, dst += 4) {
+        float32x4_t in[4], out[1];
+        in[0] = SDL_LoadChannels_NEON(src, 2);
+        in[1] = SDL_LoadChannels_NEON(src + 2, 2);
+        in[2] = SDL_LoadChannels_NEON(src + 4, 2);
+        in[3] = SDL_LoadChannels_NEON(src + 6, 2);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        out[0] /* FC */ = vmulq_n_f32(in[0], 0.500000000f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[1], 0.500000000f));
+        vst1q_f32(dst, out[0]);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 2, dst += 1) {
+        dst[0] /* FC */ = (src[0] * 0.500000000f) + (src[1] * 0.500000000f);
+    }
+
+    cvt->len_cvt = cvt->len_cvt / 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertStereoTo21_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 2) * 3))) - 3;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 2;
+    int i;
+
+    LOG_DEBUG_CONVERT("stereo", "2.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 2); i >= 4; i -= 4, src -= 8, dst -= 12) {
+        float32x4_t in[4], out[4];
+        in[0] = SDL_LoadChannels_NEON(src - 6, 2);
+        in[1] = SDL_LoadChannels_NEON(src - 4, 2);
+        in[2] = SDL_LoadChannels_NEON(src - 2, 2);
+        in[3] = SDL_LoadChannels_NEON(src, 2);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* LFE */ = vdupq_n_f32(0.0f);
+        out[3] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 9, out[0], 3);
+        SDL_StoreChannels_NEON(dst - 6, out[1], 3);
+        SDL_StoreChannels_NEON(dst - 3, out[2], 3);
+        SDL_StoreChannels_NEON(dst, out[3], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 2, dst -= 3) {
+        dst[2] /* LFE */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 2) * 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertStereoToQuad_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 2) * 4))) - 4;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 2;
+    int i;
+
+    LOG_DEBUG_CONVERT("stereo", "quad (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 2); i >= 4; i -= 4, src -= 8, dst -= 16) {
+        float32x4_t in[4], out[4];
+        in[0] = SDL_LoadChannels_NEON(src - 6, 2);
+        in[1] = SDL_LoadChannels_NEON(src - 4, 2);
+        in[2] = SDL_LoadChannels_NEON(src - 2, 2);
+        in[3] = SDL_LoadChannels_NEON(src, 2);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* BL */ = vdupq_n_f32(0.0f);
+        out[3] /* BR */ = vdupq_n_f32(0.0f);
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 12, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 8, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 4, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 2, dst -= 4) {
+        dst[3] /* BR */ = 0.0f;
+        dst[2] /* BL */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 2) * 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertStereoTo41_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 2) * 5))) - 5;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 2;
+    int i;
+
+    LOG_DEBUG_CONVERT("stereo", "4.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 2); i >= 4; i -= 4, src -= 8, dst -= 20) {
+        float32x4_t in[4], out[8];
+        in[0] = SDL_LoadChannels_NEON(src - 6, 2);
+        in[1] = SDL_LoadChannels_NEON(src - 4, 2);
+        in[2] = SDL_LoadChannels_NEON(src - 2, 2);
+        in[3] = SDL_LoadChannels_NEON(src, 2);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* LFE */ = vdupq_n_f32(0.0f);
+        out[3] /* BL */ = vdupq_n_f32(0.0f);
+        out[4] /* BR */ = vdupq_n_f32(0.0f);
+        out[5] = out[6] = out[7] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 15, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 10, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 5, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+        SDL_StoreChannels_NEON(dst - 11, out[4], 1);
+        SDL_StoreChannels_NEON(dst - 6, out[5], 1);
+        SDL_StoreChannels_NEON(dst - 1, out[6], 1);
+        SDL_StoreChannels_NEON(dst + 4, out[7], 1);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 2, dst -= 5) {
+        dst[4] /* BR */ = 0.0f;
+        dst[3] /* BL */ = 0.0f;
+        dst[2] /* LFE */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 2) * 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertStereoTo51_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 2) * 6))) - 6;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 2;
+    int i;
+
+    LOG_DEBUG_CONVERT("stereo", "5.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 2); i >= 4; i -= 4, src -= 8, dst -= 24) {
+        float32x4_t in[4], out[8];
+        in[0] = SDL_LoadChannels_NEON(src - 6, 2);
+        in[1] = SDL_LoadChannels_NEON(src - 4, 2);
+        in[2] = SDL_LoadChannels_NEON(src - 2, 2);
+        in[3] = SDL_LoadChannels_NEON(src, 2);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = vdupq_n_f32(0.0f);
+        out[3] /* LFE */ = vdupq_n_f32(0.0f);
+        out[4] /* BL */ = vdupq_n_f32(0.0f);
+        out[5] /* BR */ = vdupq_n_f32(0.0f);
+        out[6] = out[7] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 18, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 12, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 6, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+        SDL_StoreChannels_NEON(dst - 14, out[4], 2);
+        SDL_StoreChannels_NEON(dst - 8, out[5], 2);
+        SDL_StoreChannels_NEON(dst - 2, out[6], 2);
+        SDL_StoreChannels_NEON(dst + 4, out[7], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 2, dst -= 6) {
+        dst[5] /* BR */ = 0.0f;
+        dst[4] /* BL */ = 0.0f;
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 2) * 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertStereoTo61_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 2) * 7))) - 7;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 2;
+    int i;
+
+    LOG_DEBUG_CONVERT("stereo", "6.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 2); i >= 4; i -= 4, src -= 8, dst -= 28) {
+        float32x4_t in[4], out[8];
+        in[0] = SDL_LoadChannels_NEON(src - 6, 2);
+        in[1] = SDL_LoadChannels_NEON(src - 4, 2);
+        in[2] = SDL_LoadChannels_NEON(src - 2, 2);
+        in[3] = SDL_LoadChannels_NEON(src, 2);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = vdupq_n_f32(0.0f);
+        out[3] /* LFE */ = vdupq_n_f32(0.0f);
+        out[4] /* BC */ = vdupq_n_f32(0.0f);
+        out[5] /* SL */ = vdupq_n_f32(0.0f);
+        out[6] /* SR */ = vdupq_n_f32(0.0f);
+        out[7] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 21, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 14, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 7, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+        SDL_StoreChannels_NEON(dst - 17, out[4], 3);
+        SDL_StoreChannels_NEON(dst - 10, out[5], 3);
+        SDL_StoreChannels_NEON(dst - 3, out[6], 3);
+        SDL_StoreChannels_NEON(dst + 4, out[7], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 2, dst -= 7) {
+        dst[6] /* SR */ = 0.0f;
+        dst[5] /* SL */ = 0.0f;
+        dst[4] /* BC */ = 0.0f;
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 2) * 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertStereoTo71_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 2) * 8))) - 8;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 2;
+    int i;
+
+    LOG_DEBUG_CONVERT("stereo", "7.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 2); i >= 4; i -= 4, src -= 8, dst -= 32) {
+        float32x4_t in[4], out[8];
+        in[0] = SDL_LoadChannels_NEON(src - 6, 2);
+        in[1] = SDL_LoadChannels_NEON(src - 4, 2);
+        in[2] = SDL_LoadChannels_NEON(src - 2, 2);
+        in[3] = SDL_LoadChannels_NEON(src, 2);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = vdupq_n_f32(0.0f);
+        out[3] /* LFE */ = vdupq_n_f32(0.0f);
+        out[4] /* BL */ = vdupq_n_f32(0.0f);
+        out[5] /* BR */ = vdupq_n_f32(0.0f);
+        out[6] /* SL */ = vdupq_n_f32(0.0f);
+        out[7] /* SR */ = vdupq_n_f32(0.0f);
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 24, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 16, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 8, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+        SDL_StoreChannels_NEON(dst - 20, out[4], 4);
+        SDL_StoreChannels_NEON(dst - 12, out[5], 4);
+        SDL_StoreChannels_NEON(dst - 4, out[6], 4);
+        SDL_StoreChannels_NEON(dst + 4, out[7], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 2, dst -= 8) {
+        dst[7] /* SR */ = 0.0f;
+        dst[6] /* SL */ = 0.0f;
+        dst[5] /* BR */ = 0.0f;
+        dst[4] /* BL */ = 0.0f;
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 2) * 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert21ToMono_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("2.1", "mono (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 3); i >= 4; i -= 4, src += 12, dst += 4) {
+        float32x4_t in[4], out[1];
+        in[0] = SDL_LoadChannels_NEON(src, 3);
+        in[1] = SDL_LoadChannels_NEON(src + 3, 3);
+        in[2] = SDL_LoadChannels_NEON(src + 6, 3);
+        in[3] = SDL_LoadChannels_NEON(src + 9, 3);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        out[0] /* FC */ = vmulq_n_f32(in[0], 0.333333343f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[1], 0.333333343f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.333333343f));
+        vst1q_f32(dst, out[0]);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 3, dst += 1) {
+        dst[0] /* FC */ = (src[0] * 0.333333343f) + (src[1] * 0.333333343f) + (src[2] * 0.333333343f);
+    }
+
+    cvt->len_cvt = cvt->len_cvt / 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert21ToStereo_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("2.1", "stereo (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 3); i >= 4; i -= 4, src += 12, dst += 8) {
+        float32x4_t in[4], out[4];
+        in[0] = SDL_LoadChannels_NEON(src, 3);
+        in[1] = SDL_LoadChannels_NEON(src + 3, 3);
+        in[2] = SDL_LoadChannels_NEON(src + 6, 3);
+        in[3] = SDL_LoadChannels_NEON(src + 9, 3);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.800000012f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.200000003f));
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.800000012f);
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[2], 0.200000003f));
+        out[2] = out[3] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst, out[0], 2);
+        SDL_StoreChannels_NEON(dst + 2, out[1], 2);
+        SDL_StoreChannels_NEON(dst + 4, out[2], 2);
+        SDL_StoreChannels_NEON(dst + 6, out[3], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 3, dst += 2) {
+        const float srcLFE = src[2];
+        dst[0] /* FL */ = (src[0] * 0.800000012f) + (srcLFE * 0.200000003f);
+        dst[1] /* FR */ = (src[1] * 0.800000012f) + (srcLFE * 0.200000003f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 3) * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert21ToQuad_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 3) * 4))) - 4;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 3;
+    int i;
+
+    LOG_DEBUG_CONVERT("2.1", "quad (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 3); i >= 4; i -= 4, src -= 12, dst -= 16) {
+        float32x4_t in[4], out[4];
+        in[0] = SDL_LoadChannels_NEON(src - 9, 3);
+        in[1] = SDL_LoadChannels_NEON(src - 6, 3);
+        in[2] = SDL_LoadChannels_NEON(src - 3, 3);
+        in[3] = SDL_LoadChannels_NEON(src, 3);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.888888896f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.111111112f));
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.888888896f);
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[2], 0.111111112f));
+        out[2] /* BL */ = vmulq_n_f32(in[2], 0.111111112f);
+        out[3] /* BR */ = vmulq_n_f32(in[2], 0.111111112f);
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 12, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 8, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 4, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 3, dst -= 4) {
+        const float srcLFE = src[2];
+        dst[3] /* BR */ = (srcLFE * 0.111111112f);
+        dst[2] /* BL */ = (srcLFE * 0.111111112f);
+        dst[1] /* FR */ = (srcLFE * 0.111111112f) + (src[1] * 0.888888896f);
+        dst[0] /* FL */ = (srcLFE * 0.111111112f) + (src[0] * 0.888888896f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 3) * 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert21To41_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 3) * 5))) - 5;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 3;
+    int i;
+
+    LOG_DEBUG_CONVERT("2.1", "4.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 3); i >= 4; i -= 4, src -= 12, dst -= 20) {
+        float32x4_t in[4], out[8];
+        in[0] = SDL_LoadChannels_NEON(src - 9, 3);
+        in[1] = SDL_LoadChannels_NEON(src - 6, 3);
+        in[2] = SDL_LoadChannels_NEON(src - 3, 3);
+        in[3] = SDL_LoadChannels_NEON(src, 3);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* LFE */ = in[2];
+        out[3] /* BL */ = vdupq_n_f32(0.0f);
+        out[4] /* BR */ = vdupq_n_f32(0.0f);
+        out[5] = out[6] = out[7] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 15, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 10, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 5, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+        SDL_StoreChannels_NEON(dst - 11, out[4], 1);
+        SDL_StoreChannels_NEON(dst - 6, out[5], 1);
+        SDL_StoreChannels_NEON(dst - 1, out[6], 1);
+        SDL_StoreChannels_NEON(dst + 4, out[7], 1);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 3, dst -= 5) {
+        dst[4] /* BR */ = 0.0f;
+        dst[3] /* BL */ = 0.0f;
+        dst[2] /* LFE */ = src[2];
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 3) * 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert21To51_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 3) * 6))) - 6;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 3;
+    int i;
+
+    LOG_DEBUG_CONVERT("2.1", "5.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 3); i >= 4; i -= 4, src -= 12, dst -= 24) {
+        float32x4_t in[4], out[8];
+        in[0] = SDL_LoadChannels_NEON(src - 9, 3);
+        in[1] = SDL_LoadChannels_NEON(src - 6, 3);
+        in[2] = SDL_LoadChannels_NEON(src - 3, 3);
+        in[3] = SDL_LoadChannels_NEON(src, 3);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = vdupq_n_f32(0.0f);
+        out[3] /* LFE */ = in[2];
+        out[4] /* BL */ = vdupq_n_f32(0.0f);
+        out[5] /* BR */ = vdupq_n_f32(0.0f);
+        out[6] = out[7] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 18, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 12, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 6, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+        SDL_StoreChannels_NEON(dst - 14, out[4], 2);
+        SDL_StoreChannels_NEON(dst - 8, out[5], 2);
+        SDL_StoreChannels_NEON(dst - 2, out[6], 2);
+        SDL_StoreChannels_NEON(dst + 4, out[7], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 3, dst -= 6) {
+        dst[5] /* BR */ = 0.0f;
+        dst[4] /* BL */ = 0.0f;
+        dst[3] /* LFE */ = src[2];
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 3) * 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert21To61_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 3) * 7))) - 7;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 3;
+    int i;
+
+    LOG_DEBUG_CONVERT("2.1", "6.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 3); i >= 4; i -= 4, src -= 12, dst -= 28) {
+        float32x4_t in[4], out[8];
+        in[0] = SDL_LoadChannels_NEON(src - 9, 3);
+        in[1] = SDL_LoadChannels_NEON(src - 6, 3);
+        in[2] = SDL_LoadChannels_NEON(src - 3, 3);
+        in[3] = SDL_LoadChannels_NEON(src, 3);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = vdupq_n_f32(0.0f);
+        out[3] /* LFE */ = in[2];
+        out[4] /* BC */ = vdupq_n_f32(0.0f);
+        out[5] /* SL */ = vdupq_n_f32(0.0f);
+        out[6] /* SR */ = vdupq_n_f32(0.0f);
+        out[7] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 21, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 14, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 7, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+        SDL_StoreChannels_NEON(dst - 17, out[4], 3);
+        SDL_StoreChannels_NEON(dst - 10, out[5], 3);
+        SDL_StoreChannels_NEON(dst - 3, out[6], 3);
+        SDL_StoreChannels_NEON(dst + 4, out[7], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 3, dst -= 7) {
+        dst[6] /* SR */ = 0.0f;
+        dst[5] /* SL */ = 0.0f;
+        dst[4] /* BC */ = 0.0f;
+        dst[3] /* LFE */ = src[2];
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 3) * 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert21To71_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 3) * 8))) - 8;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 3;
+    int i;
+
+    LOG_DEBUG_CONVERT("2.1", "7.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 3); i >= 4; i -= 4, src -= 12, dst -= 32) {
+        float32x4_t in[4], out[8];
+        in[0] = SDL_LoadChannels_NEON(src - 9, 3);
+        in[1] = SDL_LoadChannels_NEON(src - 6, 3);
+        in[2] = SDL_LoadChannels_NEON(src - 3, 3);
+        in[3] = SDL_LoadChannels_NEON(src, 3);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = vdupq_n_f32(0.0f);
+        out[3] /* LFE */ = in[2];
+        out[4] /* BL */ = vdupq_n_f32(0.0f);
+        out[5] /* BR */ = vdupq_n_f32(0.0f);
+        out[6] /* SL */ = vdupq_n_f32(0.0f);
+        out[7] /* SR */ = vdupq_n_f32(0.0f);
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 24, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 16, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 8, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+        SDL_StoreChannels_NEON(dst - 20, out[4], 4);
+        SDL_StoreChannels_NEON(dst - 12, out[5], 4);
+        SDL_StoreChannels_NEON(dst - 4, out[6], 4);
+        SDL_StoreChannels_NEON(dst + 4, out[7], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 3, dst -= 8) {
+        dst[7] /* SR */ = 0.0f;
+        dst[6] /* SL */ = 0.0f;
+        dst[5] /* BR */ = 0.0f;
+        dst[4] /* BL */ = 0.0f;
+        dst[3] /* LFE */ = src[2];
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 3) * 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertQuadToMono_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("quad", "mono (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 4); i >= 4; i -= 4, src += 16, dst += 4) {
+        float32x4_t in[4], out[1];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 4, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 8, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 12, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        out[0] /* FC */ = vmulq_n_f32(in[0], 0.250000000f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[1], 0.250000000f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.250000000f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[3], 0.250000000f));
+        vst1q_f32(dst, out[0]);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 4, dst += 1) {
+        dst[0] /* FC */ = (src[0] * 0.250000000f) + (src[1] * 0.250000000f) + (src[2] * 0.250000000f) + (src[3] * 0.250000000f);
+    }
+
+    cvt->len_cvt = cvt->len_cvt / 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertQuadToStereo_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("quad", "stereo (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 4); i >= 4; i -= 4, src += 16, dst += 8) {
+        float32x4_t in[4], out[4];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 4, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 8, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 12, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.421000004f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.358999997f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[3], 0.219999999f));
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.421000004f);
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[2], 0.219999999f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[3], 0.358999997f));
+        out[2] = out[3] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst, out[0], 2);
+        SDL_StoreChannels_NEON(dst + 2, out[1], 2);
+        SDL_StoreChannels_NEON(dst + 4, out[2], 2);
+        SDL_StoreChannels_NEON(dst + 6, out[3], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 4, dst += 2) {
+        const float srcBL = src[2];
+        const float srcBR = src[3];
+        dst[0] /* FL */ = (src[0] * 0.421000004f) + (srcBL * 0.358999997f) + (srcBR * 0.219999999f);
+        dst[1] /* FR */ = (src[1] * 0.421000004f) + (srcBL * 0.219999999f) + (srcBR * 0.358999997f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 4) * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertQuadTo21_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("quad", "2.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 4); i >= 4; i -= 4, src += 16, dst += 12) {
+        float32x4_t in[4], out[4];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 4, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 8, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 12, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.421000004f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.358999997f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[3], 0.219999999f));
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.421000004f);
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[2], 0.219999999f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[3], 0.358999997f));
+        out[2] /* LFE */ = vdupq_n_f32(0.0f);
+        out[3] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst, out[0], 3);
+        SDL_StoreChannels_NEON(dst + 3, out[1], 3);
+        SDL_StoreChannels_NEON(dst + 6, out[2], 3);
+        SDL_StoreChannels_NEON(dst + 9, out[3], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 4, dst += 3) {
+        const float srcBL = src[2];
+        const float srcBR = src[3];
+        dst[0] /* FL */ = (src[0] * 0.421000004f) + (srcBL * 0.358999997f) + (srcBR * 0.219999999f);
+        dst[1] /* FR */ = (src[1] * 0.421000004f) + (srcBL * 0.219999999f) + (srcBR * 0.358999997f);
+        dst[2] /* LFE */ = 0.0f;
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 4) * 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertQuadTo41_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 4) * 5))) - 5;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 4;
+    int i;
+
+    LOG_DEBUG_CONVERT("quad", "4.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 4); i >= 4; i -= 4, src -= 16, dst -= 20) {
+        float32x4_t in[4], out[8];
+        in[0] = SDL_LoadChannels_NEON(src - 12, 4);
+        in[1] = SDL_LoadChannels_NEON(src - 8, 4);
+        in[2] = SDL_LoadChannels_NEON(src - 4, 4);
+        in[3] = SDL_LoadChannels_NEON(src, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* LFE */ = vdupq_n_f32(0.0f);
+        out[3] /* BL */ = in[2];
+        out[4] /* BR */ = in[3];
+        out[5] = out[6] = out[7] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 15, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 10, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 5, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+        SDL_TRANSPOSE4_NEON(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_NEON(dst - 11, out[4], 1);
+        SDL_StoreChannels_NEON(dst - 6, out[5], 1);
+        SDL_StoreChannels_NEON(dst - 1, out[6], 1);
+        SDL_StoreChannels_NEON(dst + 4, out[7], 1);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 4, dst -= 5) {
+        dst[4] /* BR */ = src[3];
+        dst[3] /* BL */ = src[2];
+        dst[2] /* LFE */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 4) * 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertQuadTo51_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 4) * 6))) - 6;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 4;
+    int i;
+
+    LOG_DEBUG_CONVERT("quad", "5.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 4); i >= 4; i -= 4, src -= 16, dst -= 24) {
+        float32x4_t in[4], out[8];
+        in[0] = SDL_LoadChannels_NEON(src - 12, 4);
+        in[1] = SDL_LoadChannels_NEON(src - 8, 4);
+        in[2] = SDL_LoadChannels_NEON(src - 4, 4);
+        in[3] = SDL_LoadChannels_NEON(src, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = vdupq_n_f32(0.0f);
+        out[3] /* LFE */ = vdupq_n_f32(0.0f);
+        out[4] /* BL */ = in[2];
+        out[5] /* BR */ = in[3];
+        out[6] = out[7] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 18, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 12, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 6, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+        SDL_TRANSPOSE4_NEON(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_NEON(dst - 14, out[4], 2);
+        SDL_StoreChannels_NEON(dst - 8, out[5], 2);
+        SDL_StoreChannels_NEON(dst - 2, out[6], 2);
+        SDL_StoreChannels_NEON(dst + 4, out[7], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 4, dst -= 6) {
+        dst[5] /* BR */ = src[3];
+        dst[4] /* BL */ = src[2];
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 4) * 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertQuadTo61_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 4) * 7))) - 7;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 4;
+    int i;
+
+    LOG_DEBUG_CONVERT("quad", "6.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 4); i >= 4; i -= 4, src -= 16, dst -= 28) {
+        float32x4_t in[4], out[8];
+        in[0] = SDL_LoadChannels_NEON(src - 12, 4);
+        in[1] = SDL_LoadChannels_NEON(src - 8, 4);
+        in[2] = SDL_LoadChannels_NEON(src - 4, 4);
+        in[3] = SDL_LoadChannels_NEON(src, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.939999998f);
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.939999998f);
+        out[2] /* FC */ = vdupq_n_f32(0.0f);
+        out[3] /* LFE */ = vdupq_n_f32(0.0f);
+        out[4] /* BC */ = vmulq_n_f32(in[2], 0.500000000f);
+        out[4] = vaddq_f32(out[4], vmulq_n_f32(in[3], 0.500000000f));
+        out[5] /* SL */ = vmulq_n_f32(in[2], 0.796000004f);
+        out[6] /* SR */ = vmulq_n_f32(in[3], 0.796000004f);
+        out[7] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 21, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 14, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 7, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+        SDL_TRANSPOSE4_NEON(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_NEON(dst - 17, out[4], 3);
+        SDL_StoreChannels_NEON(dst - 10, out[5], 3);
+        SDL_StoreChannels_NEON(dst - 3, out[6], 3);
+        SDL_StoreChannels_NEON(dst + 4, out[7], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 4, dst -= 7) {
+        const float srcBL = src[2];
+        const float srcBR = src[3];
+        dst[6] /* SR */ = (srcBR * 0.796000004f);
+        dst[5] /* SL */ = (srcBL * 0.796000004f);
+        dst[4] /* BC */ = (srcBR * 0.500000000f) + (srcBL * 0.500000000f);
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = (src[1] * 0.939999998f);
+        dst[0] /* FL */ = (src[0] * 0.939999998f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 4) * 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertQuadTo71_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 4) * 8))) - 8;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 4;
+    int i;
+
+    LOG_DEBUG_CONVERT("quad", "7.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 4); i >= 4; i -= 4, src -= 16, dst -= 32) {
+        float32x4_t in[4], out[8];
+        in[0] = SDL_LoadChannels_NEON(src - 12, 4);
+        in[1] = SDL_LoadChannels_NEON(src - 8, 4);
+        in[2] = SDL_LoadChannels_NEON(src - 4, 4);
+        in[3] = SDL_LoadChannels_NEON(src, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = vdupq_n_f32(0.0f);
+        out[3] /* LFE */ = vdupq_n_f32(0.0f);
+        out[4] /* BL */ = in[2];
+        out[5] /* BR */ = in[3];
+        out[6] /* SL */ = vdupq_n_f32(0.0f);
+        out[7] /* SR */ = vdupq_n_f32(0.0f);
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 24, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 16, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 8, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+        SDL_TRANSPOSE4_NEON(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_NEON(dst - 20, out[4], 4);
+        SDL_StoreChannels_NEON(dst - 12, out[5], 4);
+        SDL_StoreChannels_NEON(dst - 4, out[6], 4);
+        SDL_StoreChannels_NEON(dst + 4, out[7], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 4, dst -= 8) {
+        dst[7] /* SR */ = 0.0f;
+        dst[6] /* SL */ = 0.0f;
+        dst[5] /* BR */ = src[3];
+        dst[4] /* BL */ = src[2];
+        dst[3] /* LFE */ = 0.0f;
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 4) * 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert41ToMono_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("4.1", "mono (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 5); i >= 4; i -= 4, src += 20, dst += 4) {
+        float32x4_t in[8], out[1];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 5, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 10, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 15, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src + 4, 1);
+        in[5] = SDL_LoadChannels_NEON(src + 9, 1);
+        in[6] = SDL_LoadChannels_NEON(src + 14, 1);
+        in[7] = SDL_LoadChannels_NEON(src + 19, 1);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FC */ = vmulq_n_f32(in[0], 0.200000003f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[1], 0.200000003f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.200000003f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[3], 0.200000003f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[4], 0.200000003f));
+        vst1q_f32(dst, out[0]);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 5, dst += 1) {
+        dst[0] /* FC */ = (src[0] * 0.200000003f) + (src[1] * 0.200000003f) + (src[2] * 0.200000003f) + (src[3] * 0.200000003f) + (src[4] * 0.200000003f);
+    }
+
+    cvt->len_cvt = cvt->len_cvt / 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert41ToStereo_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("4.1", "stereo (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 5); i >= 4; i -= 4, src += 20, dst += 8) {
+        float32x4_t in[8], out[4];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 5, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 10, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 15, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src + 4, 1);
+        in[5] = SDL_LoadChannels_NEON(src + 9, 1);
+        in[6] = SDL_LoadChannels_NEON(src + 14, 1);
+        in[7] = SDL_LoadChannels_NEON(src + 19, 1);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.374222219f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.111111112f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[3], 0.319111109f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[4], 0.195555553f));
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.374222219f);
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[2], 0.111111112f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[3], 0.195555553f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[4], 0.319111109f));
+        out[2] = out[3] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst, out[0], 2);
+        SDL_StoreChannels_NEON(dst + 2, out[1], 2);
+        SDL_StoreChannels_NEON(dst + 4, out[2], 2);
+        SDL_StoreChannels_NEON(dst + 6, out[3], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 5, dst += 2) {
+        const float srcLFE = src[2];
+        const float srcBL = src[3];
+        const float srcBR = src[4];
+        dst[0] /* FL */ = (src[0] * 0.374222219f) + (srcLFE * 0.111111112f) + (srcBL * 0.319111109f) + (srcBR * 0.195555553f);
+        dst[1] /* FR */ = (src[1] * 0.374222219f) + (srcLFE * 0.111111112f) + (srcBL * 0.195555553f) + (srcBR * 0.319111109f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 5) * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert41To21_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("4.1", "2.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 5); i >= 4; i -= 4, src += 20, dst += 12) {
+        float32x4_t in[8], out[4];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 5, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 10, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 15, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src + 4, 1);
+        in[5] = SDL_LoadChannels_NEON(src + 9, 1);
+        in[6] = SDL_LoadChannels_NEON(src + 14, 1);
+        in[7] = SDL_LoadChannels_NEON(src + 19, 1);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.421000004f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[3], 0.358999997f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[4], 0.219999999f));
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.421000004f);
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[3], 0.219999999f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[4], 0.358999997f));
+        out[2] /* LFE */ = in[2];
+        out[3] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst, out[0], 3);
+        SDL_StoreChannels_NEON(dst + 3, out[1], 3);
+        SDL_StoreChannels_NEON(dst + 6, out[2], 3);
+        SDL_StoreChannels_NEON(dst + 9, out[3], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 5, dst += 3) {
+        const float srcBL = src[3];
+        const float srcBR = src[4];
+        dst[0] /* FL */ = (src[0] * 0.421000004f) + (srcBL * 0.358999997f) + (srcBR * 0.219999999f);
+        dst[1] /* FR */ = (src[1] * 0.421000004f) + (srcBL * 0.219999999f) + (srcBR * 0.358999997f);
+        dst[2] /* LFE */ = src[2];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 5) * 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert41ToQuad_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("4.1", "quad (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 5); i >= 4; i -= 4, src += 20, dst += 16) {
+        float32x4_t in[8], out[4];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 5, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 10, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 15, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src + 4, 1);
+        in[5] = SDL_LoadChannels_NEON(src + 9, 1);
+        in[6] = SDL_LoadChannels_NEON(src + 14, 1);
+        in[7] = SDL_LoadChannels_NEON(src + 19, 1);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.941176474f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.058823530f));
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.941176474f);
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[2], 0.058823530f));
+        out[2] /* BL */ = vmulq_n_f32(in[2], 0.058823530f);
+        out[2] = vaddq_f32(out[2], vmulq_n_f32(in[3], 0.941176474f));
+        out[3] /* BR */ = vmulq_n_f32(in[2], 0.058823530f);
+        out[3] = vaddq_f32(out[3], vmulq_n_f32(in[4], 0.941176474f));
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst, out[0], 4);
+        SDL_StoreChannels_NEON(dst + 4, out[1], 4);
+        SDL_StoreChannels_NEON(dst + 8, out[2], 4);
+        SDL_StoreChannels_NEON(dst + 12, out[3], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 5, dst += 4) {
+        const float srcLFE = src[2];
+        dst[0] /* FL */ = (src[0] * 0.941176474f) + (srcLFE * 0.058823530f);
+        dst[1] /* FR */ = (src[1] * 0.941176474f) + (srcLFE * 0.058823530f);
+        dst[2] /* BL */ = (srcLFE * 0.058823530f) + (src[3] * 0.941176474f);
+        dst[3] /* BR */ = (srcLFE * 0.058823530f) + (src[4] * 0.941176474f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 5) * 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert41To51_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 5) * 6))) - 6;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 5;
+    int i;
+
+    LOG_DEBUG_CONVERT("4.1", "5.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 5); i >= 4; i -= 4, src -= 20, dst -= 24) {
+        float32x4_t in[8], out[8];
+        in[0] = SDL_LoadChannels_NEON(src - 15, 4);
+        in[1] = SDL_LoadChannels_NEON(src - 10, 4);
+        in[2] = SDL_LoadChannels_NEON(src - 5, 4);
+        in[3] = SDL_LoadChannels_NEON(src, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src - 11, 1);
+        in[5] = SDL_LoadChannels_NEON(src - 6, 1);
+        in[6] = SDL_LoadChannels_NEON(src - 1, 1);
+        in[7] = SDL_LoadChannels_NEON(src + 4, 1);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = vdupq_n_f32(0.0f);
+        out[3] /* LFE */ = in[2];
+        out[4] /* BL */ = in[3];
+        out[5] /* BR */ = in[4];
+        out[6] = out[7] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 18, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 12, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 6, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+        SDL_TRANSPOSE4_NEON(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_NEON(dst - 14, out[4], 2);
+        SDL_StoreChannels_NEON(dst - 8, out[5], 2);
+        SDL_StoreChannels_NEON(dst - 2, out[6], 2);
+        SDL_StoreChannels_NEON(dst + 4, out[7], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 5, dst -= 6) {
+        dst[5] /* BR */ = src[4];
+        dst[4] /* BL */ = src[3];
+        dst[3] /* LFE */ = src[2];
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 5) * 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert41To61_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 5) * 7))) - 7;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 5;
+    int i;
+
+    LOG_DEBUG_CONVERT("4.1", "6.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 5); i >= 4; i -= 4, src -= 20, dst -= 28) {
+        float32x4_t in[8], out[8];
+        in[0] = SDL_LoadChannels_NEON(src - 15, 4);
+        in[1] = SDL_LoadChannels_NEON(src - 10, 4);
+        in[2] = SDL_LoadChannels_NEON(src - 5, 4);
+        in[3] = SDL_LoadChannels_NEON(src, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src - 11, 1);
+        in[5] = SDL_LoadChannels_NEON(src - 6, 1);
+        in[6] = SDL_LoadChannels_NEON(src - 1, 1);
+        in[7] = SDL_LoadChannels_NEON(src + 4, 1);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.939999998f);
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.939999998f);
+        out[2] /* FC */ = vdupq_n_f32(0.0f);
+        out[3] /* LFE */ = in[2];
+        out[4] /* BC */ = vmulq_n_f32(in[3], 0.500000000f);
+        out[4] = vaddq_f32(out[4], vmulq_n_f32(in[4], 0.500000000f));
+        out[5] /* SL */ = vmulq_n_f32(in[3], 0.796000004f);
+        out[6] /* SR */ = vmulq_n_f32(in[4], 0.796000004f);
+        out[7] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 21, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 14, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 7, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+        SDL_TRANSPOSE4_NEON(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_NEON(dst - 17, out[4], 3);
+        SDL_StoreChannels_NEON(dst - 10, out[5], 3);
+        SDL_StoreChannels_NEON(dst - 3, out[6], 3);
+        SDL_StoreChannels_NEON(dst + 4, out[7], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 5, dst -= 7) {
+        const float srcBL = src[3];
+        const float srcBR = src[4];
+        dst[6] /* SR */ = (srcBR * 0.796000004f);
+        dst[5] /* SL */ = (srcBL * 0.796000004f);
+        dst[4] /* BC */ = (srcBR * 0.500000000f) + (srcBL * 0.500000000f);
+        dst[3] /* LFE */ = src[2];
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = (src[1] * 0.939999998f);
+        dst[0] /* FL */ = (src[0] * 0.939999998f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 5) * 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert41To71_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 5) * 8))) - 8;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 5;
+    int i;
+
+    LOG_DEBUG_CONVERT("4.1", "7.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 5); i >= 4; i -= 4, src -= 20, dst -= 32) {
+        float32x4_t in[8], out[8];
+        in[0] = SDL_LoadChannels_NEON(src - 15, 4);
+        in[1] = SDL_LoadChannels_NEON(src - 10, 4);
+        in[2] = SDL_LoadChannels_NEON(src - 5, 4);
+        in[3] = SDL_LoadChannels_NEON(src, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src - 11, 1);
+        in[5] = SDL_LoadChannels_NEON(src - 6, 1);
+        in[6] = SDL_LoadChannels_NEON(src - 1, 1);
+        in[7] = SDL_LoadChannels_NEON(src + 4, 1);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = vdupq_n_f32(0.0f);
+        out[3] /* LFE */ = in[2];
+        out[4] /* BL */ = in[3];
+        out[5] /* BR */ = in[4];
+        out[6] /* SL */ = vdupq_n_f32(0.0f);
+        out[7] /* SR */ = vdupq_n_f32(0.0f);
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 24, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 16, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 8, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+        SDL_TRANSPOSE4_NEON(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_NEON(dst - 20, out[4], 4);
+        SDL_StoreChannels_NEON(dst - 12, out[5], 4);
+        SDL_StoreChannels_NEON(dst - 4, out[6], 4);
+        SDL_StoreChannels_NEON(dst + 4, out[7], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 5, dst -= 8) {
+        dst[7] /* SR */ = 0.0f;
+        dst[6] /* SL */ = 0.0f;
+        dst[5] /* BR */ = src[4];
+        dst[4] /* BL */ = src[3];
+        dst[3] /* LFE */ = src[2];
+        dst[2] /* FC */ = 0.0f;
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 5) * 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert51ToMono_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("5.1", "mono (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 6); i >= 4; i -= 4, src += 24, dst += 4) {
+        float32x4_t in[8], out[1];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 6, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 12, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 18, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src + 4, 2);
+        in[5] = SDL_LoadChannels_NEON(src + 10, 2);
+        in[6] = SDL_LoadChannels_NEON(src + 16, 2);
+        in[7] = SDL_LoadChannels_NEON(src + 22, 2);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FC */ = vmulq_n_f32(in[0], 0.166666672f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[1], 0.166666672f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.166666672f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[3], 0.166666672f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[4], 0.166666672f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[5], 0.166666672f));
+        vst1q_f32(dst, out[0]);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 6, dst += 1) {
+        dst[0] /* FC */ = (src[0] * 0.166666672f) + (src[1] * 0.166666672f) + (src[2] * 0.166666672f) + (src[3] * 0.166666672f) + (src[4] * 0.166666672f) + (src[5] * 0.166666672f);
+    }
+
+    cvt->len_cvt = cvt->len_cvt / 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert51ToStereo_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("5.1", "stereo (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 6); i >= 4; i -= 4, src += 24, dst += 8) {
+        float32x4_t in[8], out[4];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 6, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 12, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 18, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src + 4, 2);
+        in[5] = SDL_LoadChannels_NEON(src + 10, 2);
+        in[6] = SDL_LoadChannels_NEON(src + 16, 2);
+        in[7] = SDL_LoadChannels_NEON(src + 22, 2);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.294545442f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.208181813f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[3], 0.090909094f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[4], 0.251818180f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[5], 0.154545456f));
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.294545442f);
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[2], 0.208181813f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[3], 0.090909094f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[4], 0.154545456f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[5], 0.251818180f));
+        out[2] = out[3] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst, out[0], 2);
+        SDL_StoreChannels_NEON(dst + 2, out[1], 2);
+        SDL_StoreChannels_NEON(dst + 4, out[2], 2);
+        SDL_StoreChannels_NEON(dst + 6, out[3], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 6, dst += 2) {
+        const float srcFC = src[2];
+        const float srcLFE = src[3];
+        const float srcBL = src[4];
+        const float srcBR = src[5];
+        dst[0] /* FL */ = (src[0] * 0.294545442f) + (srcFC * 0.208181813f) + (srcLFE * 0.090909094f) + (srcBL * 0.251818180f) + (srcBR * 0.154545456f);
+        dst[1] /* FR */ = (src[1] * 0.294545442f) + (srcFC * 0.208181813f) + (srcLFE * 0.090909094f) + (srcBL * 0.154545456f) + (srcBR * 0.251818180f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 6) * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert51To21_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("5.1", "2.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 6); i >= 4; i -= 4, src += 24, dst += 12) {
+        float32x4_t in[8], out[4];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 6, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 12, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 18, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src + 4, 2);
+        in[5] = SDL_LoadChannels_NEON(src + 10, 2);
+        in[6] = SDL_LoadChannels_NEON(src + 16, 2);
+        in[7] = SDL_LoadChannels_NEON(src + 22, 2);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.324000001f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.229000002f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[4], 0.277000010f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[5], 0.170000002f));
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.324000001f);
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[2], 0.229000002f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[4], 0.170000002f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[5], 0.277000010f));
+        out[2] /* LFE */ = in[3];
+        out[3] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst, out[0], 3);
+        SDL_StoreChannels_NEON(dst + 3, out[1], 3);
+        SDL_StoreChannels_NEON(dst + 6, out[2], 3);
+        SDL_StoreChannels_NEON(dst + 9, out[3], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 6, dst += 3) {
+        const float srcFC = src[2];
+        const float srcBL = src[4];
+        const float srcBR = src[5];
+        dst[0] /* FL */ = (src[0] * 0.324000001f) + (srcFC * 0.229000002f) + (srcBL * 0.277000010f) + (srcBR * 0.170000002f);
+        dst[1] /* FR */ = (src[1] * 0.324000001f) + (srcFC * 0.229000002f) + (srcBL * 0.170000002f) + (srcBR * 0.277000010f);
+        dst[2] /* LFE */ = src[3];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 6) * 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert51ToQuad_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("5.1", "quad (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 6); i >= 4; i -= 4, src += 24, dst += 16) {
+        float32x4_t in[8], out[4];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 6, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 12, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 18, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src + 4, 2);
+        in[5] = SDL_LoadChannels_NEON(src + 10, 2);
+        in[6] = SDL_LoadChannels_NEON(src + 16, 2);
+        in[7] = SDL_LoadChannels_NEON(src + 22, 2);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.558095276f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.394285709f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[3], 0.047619049f));
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.558095276f);
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[2], 0.394285709f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[3], 0.047619049f));
+        out[2] /* BL */ = vmulq_n_f32(in[3], 0.047619049f);
+        out[2] = vaddq_f32(out[2], vmulq_n_f32(in[4], 0.558095276f));
+        out[3] /* BR */ = vmulq_n_f32(in[3], 0.047619049f);
+        out[3] = vaddq_f32(out[3], vmulq_n_f32(in[5], 0.558095276f));
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst, out[0], 4);
+        SDL_StoreChannels_NEON(dst + 4, out[1], 4);
+        SDL_StoreChannels_NEON(dst + 8, out[2], 4);
+        SDL_StoreChannels_NEON(dst + 12, out[3], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 6, dst += 4) {
+        const float srcFC = src[2];
+        const float srcLFE = src[3];
+        dst[0] /* FL */ = (src[0] * 0.558095276f) + (srcFC * 0.394285709f) + (srcLFE * 0.047619049f);
+        dst[1] /* FR */ = (src[1] * 0.558095276f) + (srcFC * 0.394285709f) + (srcLFE * 0.047619049f);
+        dst[2] /* BL */ = (srcLFE * 0.047619049f) + (src[4] * 0.558095276f);
+        dst[3] /* BR */ = (srcLFE * 0.047619049f) + (src[5] * 0.558095276f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 6) * 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert51To41_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("5.1", "4.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 6); i >= 4; i -= 4, src += 24, dst += 20) {
+        float32x4_t in[8], out[8];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 6, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 12, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 18, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src + 4, 2);
+        in[5] = SDL_LoadChannels_NEON(src + 10, 2);
+        in[6] = SDL_LoadChannels_NEON(src + 16, 2);
+        in[7] = SDL_LoadChannels_NEON(src + 22, 2);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.586000025f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.414000005f));
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.586000025f);
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[2], 0.414000005f));
+        out[2] /* LFE */ = in[3];
+        out[3] /* BL */ = vmulq_n_f32(in[4], 0.586000025f);
+        out[4] /* BR */ = vmulq_n_f32(in[5], 0.586000025f);
+        out[5] = out[6] = out[7] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst, out[0], 4);
+        SDL_StoreChannels_NEON(dst + 5, out[1], 4);
+        SDL_StoreChannels_NEON(dst + 10, out[2], 4);
+        SDL_StoreChannels_NEON(dst + 15, out[3], 4);
+        SDL_TRANSPOSE4_NEON(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_NEON(dst + 4, out[4], 1);
+        SDL_StoreChannels_NEON(dst + 9, out[5], 1);
+        SDL_StoreChannels_NEON(dst + 14, out[6], 1);
+        SDL_StoreChannels_NEON(dst + 19, out[7], 1);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 6, dst += 5) {
+        const float srcFC = src[2];
+        dst[0] /* FL */ = (src[0] * 0.586000025f) + (srcFC * 0.414000005f);
+        dst[1] /* FR */ = (src[1] * 0.586000025f) + (srcFC * 0.414000005f);
+        dst[2] /* LFE */ = src[3];
+        dst[3] /* BL */ = (src[4] * 0.586000025f);
+        dst[4] /* BR */ = (src[5] * 0.586000025f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 6) * 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert51To61_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 6) * 7))) - 7;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 6;
+    int i;
+
+    LOG_DEBUG_CONVERT("5.1", "6.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 6); i >= 4; i -= 4, src -= 24, dst -= 28) {
+        float32x4_t in[8], out[8];
+        in[0] = SDL_LoadChannels_NEON(src - 18, 4);
+        in[1] = SDL_LoadChannels_NEON(src - 12, 4);
+        in[2] = SDL_LoadChannels_NEON(src - 6, 4);
+        in[3] = SDL_LoadChannels_NEON(src, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src - 14, 2);
+        in[5] = SDL_LoadChannels_NEON(src - 8, 2);
+        in[6] = SDL_LoadChannels_NEON(src - 2, 2);
+        in[7] = SDL_LoadChannels_NEON(src + 4, 2);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.939999998f);
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.939999998f);
+        out[2] /* FC */ = vmulq_n_f32(in[2], 0.939999998f);
+        out[3] /* LFE */ = in[3];
+        out[4] /* BC */ = vmulq_n_f32(in[4], 0.500000000f);
+        out[4] = vaddq_f32(out[4], vmulq_n_f32(in[5], 0.500000000f));
+        out[5] /* SL */ = vmulq_n_f32(in[4], 0.796000004f);
+        out[6] /* SR */ = vmulq_n_f32(in[5], 0.796000004f);
+        out[7] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 21, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 14, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 7, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+        SDL_TRANSPOSE4_NEON(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_NEON(dst - 17, out[4], 3);
+        SDL_StoreChannels_NEON(dst - 10, out[5], 3);
+        SDL_StoreChannels_NEON(dst - 3, out[6], 3);
+        SDL_StoreChannels_NEON(dst + 4, out[7], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 6, dst -= 7) {
+        const float srcBL = src[4];
+        const float srcBR = src[5];
+        dst[6] /* SR */ = (srcBR * 0.796000004f);
+        dst[5] /* SL */ = (srcBL * 0.796000004f);
+        dst[4] /* BC */ = (srcBR * 0.500000000f) + (srcBL * 0.500000000f);
+        dst[3] /* LFE */ = src[3];
+        dst[2] /* FC */ = (src[2] * 0.939999998f);
+        dst[1] /* FR */ = (src[1] * 0.939999998f);
+        dst[0] /* FL */ = (src[0] * 0.939999998f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 6) * 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert51To71_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 6) * 8))) - 8;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 6;
+    int i;
+
+    LOG_DEBUG_CONVERT("5.1", "7.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 6); i >= 4; i -= 4, src -= 24, dst -= 32) {
+        float32x4_t in[8], out[8];
+        in[0] = SDL_LoadChannels_NEON(src - 18, 4);
+        in[1] = SDL_LoadChannels_NEON(src - 12, 4);
+        in[2] = SDL_LoadChannels_NEON(src - 6, 4);
+        in[3] = SDL_LoadChannels_NEON(src, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src - 14, 2);
+        in[5] = SDL_LoadChannels_NEON(src - 8, 2);
+        in[6] = SDL_LoadChannels_NEON(src - 2, 2);
+        in[7] = SDL_LoadChannels_NEON(src + 4, 2);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = in[2];
+        out[3] /* LFE */ = in[3];
+        out[4] /* BL */ = in[4];
+        out[5] /* BR */ = in[5];
+        out[6] /* SL */ = vdupq_n_f32(0.0f);
+        out[7] /* SR */ = vdupq_n_f32(0.0f);
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 24, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 16, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 8, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+        SDL_TRANSPOSE4_NEON(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_NEON(dst - 20, out[4], 4);
+        SDL_StoreChannels_NEON(dst - 12, out[5], 4);
+        SDL_StoreChannels_NEON(dst - 4, out[6], 4);
+        SDL_StoreChannels_NEON(dst + 4, out[7], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 6, dst -= 8) {
+        dst[7] /* SR */ = 0.0f;
+        dst[6] /* SL */ = 0.0f;
+        dst[5] /* BR */ = src[5];
+        dst[4] /* BL */ = src[4];
+        dst[3] /* LFE */ = src[3];
+        dst[2] /* FC */ = src[2];
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 6) * 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert61ToMono_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("6.1", "mono (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 7); i >= 4; i -= 4, src += 28, dst += 4) {
+        float32x4_t in[8], out[1];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 7, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 14, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 21, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src + 4, 3);
+        in[5] = SDL_LoadChannels_NEON(src + 11, 3);
+        in[6] = SDL_LoadChannels_NEON(src + 18, 3);
+        in[7] = SDL_LoadChannels_NEON(src + 25, 3);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FC */ = vmulq_n_f32(in[0], 0.143142849f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[1], 0.143142849f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.143142849f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[3], 0.142857149f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[4], 0.143142849f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[5], 0.143142849f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[6], 0.143142849f));
+        vst1q_f32(dst, out[0]);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 7, dst += 1) {
+        dst[0] /* FC */ = (src[0] * 0.143142849f) + (src[1] * 0.143142849f) + (src[2] * 0.143142849f) + (src[3] * 0.142857149f) + (src[4] * 0.143142849f) + (src[5] * 0.143142849f) + (src[6] * 0.143142849f);
+    }
+
+    cvt->len_cvt = cvt->len_cvt / 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert61ToStereo_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("6.1", "stereo (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 7); i >= 4; i -= 4, src += 28, dst += 8) {
+        float32x4_t in[8], out[4];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 7, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 14, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 21, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src + 4, 3);
+        in[5] = SDL_LoadChannels_NEON(src + 11, 3);
+        in[6] = SDL_LoadChannels_NEON(src + 18, 3);
+        in[7] = SDL_LoadChannels_NEON(src + 25, 3);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.247384623f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.174461529f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[3], 0.076923080f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[4], 0.174461529f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[5], 0.226153851f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[6], 0.100615382f));
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.247384623f);
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[2], 0.174461529f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[3], 0.076923080f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[4], 0.174461529f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[5], 0.100615382f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[6], 0.226153851f));
+        out[2] = out[3] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst, out[0], 2);
+        SDL_StoreChannels_NEON(dst + 2, out[1], 2);
+        SDL_StoreChannels_NEON(dst + 4, out[2], 2);
+        SDL_StoreChannels_NEON(dst + 6, out[3], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 7, dst += 2) {
+        const float srcFC = src[2];
+        const float srcLFE = src[3];
+        const float srcBC = src[4];
+        const float srcSL = src[5];
+        const float srcSR = src[6];
+        dst[0] /* FL */ = (src[0] * 0.247384623f) + (srcFC * 0.174461529f) + (srcLFE * 0.076923080f) + (srcBC * 0.174461529f) + (srcSL * 0.226153851f) + (srcSR * 0.100615382f);
+        dst[1] /* FR */ = (src[1] * 0.247384623f) + (srcFC * 0.174461529f) + (srcLFE * 0.076923080f) + (srcBC * 0.174461529f) + (srcSL * 0.100615382f) + (srcSR * 0.226153851f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 7) * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert61To21_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("6.1", "2.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 7); i >= 4; i -= 4, src += 28, dst += 12) {
+        float32x4_t in[8], out[4];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 7, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 14, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 21, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src + 4, 3);
+        in[5] = SDL_LoadChannels_NEON(src + 11, 3);
+        in[6] = SDL_LoadChannels_NEON(src + 18, 3);
+        in[7] = SDL_LoadChannels_NEON(src + 25, 3);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.268000007f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.188999996f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[4], 0.188999996f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[5], 0.245000005f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[6], 0.108999997f));
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.268000007f);
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[2], 0.188999996f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[4], 0.188999996f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[5], 0.108999997f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[6], 0.245000005f));
+        out[2] /* LFE */ = in[3];
+        out[3] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst, out[0], 3);
+        SDL_StoreChannels_NEON(dst + 3, out[1], 3);
+        SDL_StoreChannels_NEON(dst + 6, out[2], 3);
+        SDL_StoreChannels_NEON(dst + 9, out[3], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 7, dst += 3) {
+        const float srcFC = src[2];
+        const float srcBC = src[4];
+        const float srcSL = src[5];
+        const float srcSR = src[6];
+        dst[0] /* FL */ = (src[0] * 0.268000007f) + (srcFC * 0.188999996f) + (srcBC * 0.188999996f) + (srcSL * 0.245000005f) + (srcSR * 0.108999997f);
+        dst[1] /* FR */ = (src[1] * 0.268000007f) + (srcFC * 0.188999996f) + (srcBC * 0.188999996f) + (srcSL * 0.108999997f) + (srcSR * 0.245000005f);
+        dst[2] /* LFE */ = src[3];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 7) * 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert61ToQuad_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("6.1", "quad (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 7); i >= 4; i -= 4, src += 28, dst += 16) {
+        float32x4_t in[8], out[4];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 7, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 14, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 21, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src + 4, 3);
+        in[5] = SDL_LoadChannels_NEON(src + 11, 3);
+        in[6] = SDL_LoadChannels_NEON(src + 18, 3);
+        in[7] = SDL_LoadChannels_NEON(src + 25, 3);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.463679999f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.327360004f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[3], 0.040000003f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[5], 0.168960005f));
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.463679999f);
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[2], 0.327360004f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[3], 0.040000003f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[6], 0.168960005f));
+        out[2] /* BL */ = vmulq_n_f32(in[3], 0.040000003f);
+        out[2] = vaddq_f32(out[2], vmulq_n_f32(in[4], 0.327360004f));
+        out[2] = vaddq_f32(out[2], vmulq_n_f32(in[5], 0.431039989f));
+        out[3] /* BR */ = vmulq_n_f32(in[3], 0.040000003f);
+        out[3] = vaddq_f32(out[3], vmulq_n_f32(in[4], 0.327360004f));
+        out[3] = vaddq_f32(out[3], vmulq_n_f32(in[6], 0.431039989f));
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst, out[0], 4);
+        SDL_StoreChannels_NEON(dst + 4, out[1], 4);
+        SDL_StoreChannels_NEON(dst + 8, out[2], 4);
+        SDL_StoreChannels_NEON(dst + 12, out[3], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 7, dst += 4) {
+        const float srcFC = src[2];
+        const float srcLFE = src[3];
+        const float srcBC = src[4];
+        const float srcSL = src[5];
+        const float srcSR = src[6];
+        dst[0] /* FL */ = (src[0] * 0.463679999f) + (srcFC * 0.327360004f) + (srcLFE * 0.040000003f) + (srcSL * 0.168960005f);
+        dst[1] /* FR */ = (src[1] * 0.463679999f) + (srcFC * 0.327360004f) + (srcLFE * 0.040000003f) + (srcSR * 0.168960005f);
+        dst[2] /* BL */ = (srcLFE * 0.040000003f) + (srcBC * 0.327360004f) + (srcSL * 0.431039989f);
+        dst[3] /* BR */ = (srcLFE * 0.040000003f) + (srcBC * 0.327360004f) + (srcSR * 0.431039989f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 7) * 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert61To41_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("6.1", "4.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 7); i >= 4; i -= 4, src += 28, dst += 20) {
+        float32x4_t in[8], out[8];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 7, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 14, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 21, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src + 4, 3);
+        in[5] = SDL_LoadChannels_NEON(src + 11, 3);
+        in[6] = SDL_LoadChannels_NEON(src + 18, 3);
+        in[7] = SDL_LoadChannels_NEON(src + 25, 3);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.483000010f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.340999991f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[5], 0.175999999f));
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.483000010f);
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[2], 0.340999991f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[6], 0.175999999f));
+        out[2] /* LFE */ = in[3];
+        out[3] /* BL */ = vmulq_n_f32(in[4], 0.340999991f);
+        out[3] = vaddq_f32(out[3], vmulq_n_f32(in[5], 0.449000001f));
+        out[4] /* BR */ = vmulq_n_f32(in[4], 0.340999991f);
+        out[4] = vaddq_f32(out[4], vmulq_n_f32(in[6], 0.449000001f));
+        out[5] = out[6] = out[7] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst, out[0], 4);
+        SDL_StoreChannels_NEON(dst + 5, out[1], 4);
+        SDL_StoreChannels_NEON(dst + 10, out[2], 4);
+        SDL_StoreChannels_NEON(dst + 15, out[3], 4);
+        SDL_TRANSPOSE4_NEON(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_NEON(dst + 4, out[4], 1);
+        SDL_StoreChannels_NEON(dst + 9, out[5], 1);
+        SDL_StoreChannels_NEON(dst + 14, out[6], 1);
+        SDL_StoreChannels_NEON(dst + 19, out[7], 1);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 7, dst += 5) {
+        const float srcFC = src[2];
+        const float srcBC = src[4];
+        const float srcSL = src[5];
+        const float srcSR = src[6];
+        dst[0] /* FL */ = (src[0] * 0.483000010f) + (srcFC * 0.340999991f) + (srcSL * 0.175999999f);
+        dst[1] /* FR */ = (src[1] * 0.483000010f) + (srcFC * 0.340999991f) + (srcSR * 0.175999999f);
+        dst[2] /* LFE */ = src[3];
+        dst[3] /* BL */ = (srcBC * 0.340999991f) + (srcSL * 0.449000001f);
+        dst[4] /* BR */ = (srcBC * 0.340999991f) + (srcSR * 0.449000001f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 7) * 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert61To51_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("6.1", "5.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 7); i >= 4; i -= 4, src += 28, dst += 24) {
+        float32x4_t in[8], out[8];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 7, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 14, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 21, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src + 4, 3);
+        in[5] = SDL_LoadChannels_NEON(src + 11, 3);
+        in[6] = SDL_LoadChannels_NEON(src + 18, 3);
+        in[7] = SDL_LoadChannels_NEON(src + 25, 3);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.611000001f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[5], 0.223000005f));
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.611000001f);
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[6], 0.223000005f));
+        out[2] /* FC */ = vmulq_n_f32(in[2], 0.611000001f);
+        out[3] /* LFE */ = in[3];
+        out[4] /* BL */ = vmulq_n_f32(in[4], 0.432000011f);
+        out[4] = vaddq_f32(out[4], vmulq_n_f32(in[5], 0.568000019f));
+        out[5] /* BR */ = vmulq_n_f32(in[4], 0.432000011f);
+        out[5] = vaddq_f32(out[5], vmulq_n_f32(in[6], 0.568000019f));
+        out[6] = out[7] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst, out[0], 4);
+        SDL_StoreChannels_NEON(dst + 6, out[1], 4);
+        SDL_StoreChannels_NEON(dst + 12, out[2], 4);
+        SDL_StoreChannels_NEON(dst + 18, out[3], 4);
+        SDL_TRANSPOSE4_NEON(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_NEON(dst + 4, out[4], 2);
+        SDL_StoreChannels_NEON(dst + 10, out[5], 2);
+        SDL_StoreChannels_NEON(dst + 16, out[6], 2);
+        SDL_StoreChannels_NEON(dst + 22, out[7], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 7, dst += 6) {
+        const float srcBC = src[4];
+        const float srcSL = src[5];
+        const float srcSR = src[6];
+        dst[0] /* FL */ = (src[0] * 0.611000001f) + (srcSL * 0.223000005f);
+        dst[1] /* FR */ = (src[1] * 0.611000001f) + (srcSR * 0.223000005f);
+        dst[2] /* FC */ = (src[2] * 0.611000001f);
+        dst[3] /* LFE */ = src[3];
+        dst[4] /* BL */ = (srcBC * 0.432000011f) + (srcSL * 0.568000019f);
+        dst[5] /* BR */ = (srcBC * 0.432000011f) + (srcSR * 0.568000019f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 7) * 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert61To71_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = ((float *) (cvt->buf + ((cvt->len_cvt / 7) * 8))) - 8;
+    const float *src = ((const float *) (cvt->buf + cvt->len_cvt)) - 7;
+    int i;
+
+    LOG_DEBUG_CONVERT("6.1", "7.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / (sizeof (float) * 7); i >= 4; i -= 4, src -= 28, dst -= 32) {
+        float32x4_t in[8], out[8];
+        in[0] = SDL_LoadChannels_NEON(src - 21, 4);
+        in[1] = SDL_LoadChannels_NEON(src - 14, 4);
+        in[2] = SDL_LoadChannels_NEON(src - 7, 4);
+        in[3] = SDL_LoadChannels_NEON(src, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src - 17, 3);
+        in[5] = SDL_LoadChannels_NEON(src - 10, 3);
+        in[6] = SDL_LoadChannels_NEON(src - 3, 3);
+        in[7] = SDL_LoadChannels_NEON(src + 4, 3);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = in[0];
+        out[1] /* FR */ = in[1];
+        out[2] /* FC */ = in[2];
+        out[3] /* LFE */ = in[3];
+        out[4] /* BL */ = vmulq_n_f32(in[4], 0.707000017f);
+        out[5] /* BR */ = vmulq_n_f32(in[4], 0.707000017f);
+        out[6] /* SL */ = in[5];
+        out[7] /* SR */ = in[6];
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst - 24, out[0], 4);
+        SDL_StoreChannels_NEON(dst - 16, out[1], 4);
+        SDL_StoreChannels_NEON(dst - 8, out[2], 4);
+        SDL_StoreChannels_NEON(dst, out[3], 4);
+        SDL_TRANSPOSE4_NEON(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_NEON(dst - 20, out[4], 4);
+        SDL_StoreChannels_NEON(dst - 12, out[5], 4);
+        SDL_StoreChannels_NEON(dst - 4, out[6], 4);
+        SDL_StoreChannels_NEON(dst + 4, out[7], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src -= 7, dst -= 8) {
+        const float srcBC = src[4];
+        dst[7] /* SR */ = src[6];
+        dst[6] /* SL */ = src[5];
+        dst[5] /* BR */ = (srcBC * 0.707000017f);
+        dst[4] /* BL */ = (srcBC * 0.707000017f);
+        dst[3] /* LFE */ = src[3];
+        dst[2] /* FC */ = src[2];
+        dst[1] /* FR */ = src[1];
+        dst[0] /* FL */ = src[0];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 7) * 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert71ToMono_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("7.1", "mono (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 8); i >= 4; i -= 4, src += 32, dst += 4) {
+        float32x4_t in[8], out[1];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 8, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 16, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 24, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src + 4, 4);
+        in[5] = SDL_LoadChannels_NEON(src + 12, 4);
+        in[6] = SDL_LoadChannels_NEON(src + 20, 4);
+        in[7] = SDL_LoadChannels_NEON(src + 28, 4);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FC */ = vmulq_n_f32(in[0], 0.125125006f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[1], 0.125125006f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.125125006f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[3], 0.125000000f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[4], 0.125125006f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[5], 0.125125006f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[6], 0.125125006f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[7], 0.125125006f));
+        vst1q_f32(dst, out[0]);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 8, dst += 1) {
+        dst[0] /* FC */ = (src[0] * 0.125125006f) + (src[1] * 0.125125006f) + (src[2] * 0.125125006f) + (src[3] * 0.125000000f) + (src[4] * 0.125125006f) + (src[5] * 0.125125006f) + (src[6] * 0.125125006f) + (src[7] * 0.125125006f);
+    }
+
+    cvt->len_cvt = cvt->len_cvt / 8;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert71ToStereo_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("7.1", "stereo (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 8); i >= 4; i -= 4, src += 32, dst += 8) {
+        float32x4_t in[8], out[4];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 8, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 16, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 24, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src + 4, 4);
+        in[5] = SDL_LoadChannels_NEON(src + 12, 4);
+        in[6] = SDL_LoadChannels_NEON(src + 20, 4);
+        in[7] = SDL_LoadChannels_NEON(src + 28, 4);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.211866662f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.150266662f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[3], 0.066666670f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[4], 0.181066677f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[5], 0.111066669f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[6], 0.194133341f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[7], 0.085866667f));
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.211866662f);
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[2], 0.150266662f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[3], 0.066666670f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[4], 0.111066669f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[5], 0.181066677f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[6], 0.085866667f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[7], 0.194133341f));
+        out[2] = out[3] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst, out[0], 2);
+        SDL_StoreChannels_NEON(dst + 2, out[1], 2);
+        SDL_StoreChannels_NEON(dst + 4, out[2], 2);
+        SDL_StoreChannels_NEON(dst + 6, out[3], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 8, dst += 2) {
+        const float srcFC = src[2];
+        const float srcLFE = src[3];
+        const float srcBL = src[4];
+        const float srcBR = src[5];
+        const float srcSL = src[6];
+        const float srcSR = src[7];
+        dst[0] /* FL */ = (src[0] * 0.211866662f) + (srcFC * 0.150266662f) + (srcLFE * 0.066666670f) + (srcBL * 0.181066677f) + (srcBR * 0.111066669f) + (srcSL * 0.194133341f) + (srcSR * 0.085866667f);
+        dst[1] /* FR */ = (src[1] * 0.211866662f) + (srcFC * 0.150266662f) + (srcLFE * 0.066666670f) + (srcBL * 0.111066669f) + (srcBR * 0.181066677f) + (srcSL * 0.085866667f) + (srcSR * 0.194133341f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 8) * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert71To21_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("7.1", "2.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 8); i >= 4; i -= 4, src += 32, dst += 12) {
+        float32x4_t in[8], out[4];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 8, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 16, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 24, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src + 4, 4);
+        in[5] = SDL_LoadChannels_NEON(src + 12, 4);
+        in[6] = SDL_LoadChannels_NEON(src + 20, 4);
+        in[7] = SDL_LoadChannels_NEON(src + 28, 4);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.226999998f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.160999998f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[4], 0.194000006f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[5], 0.119000003f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[6], 0.208000004f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[7], 0.092000000f));
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.226999998f);
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[2], 0.160999998f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[4], 0.119000003f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[5], 0.194000006f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[6], 0.092000000f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[7], 0.208000004f));
+        out[2] /* LFE */ = in[3];
+        out[3] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst, out[0], 3);
+        SDL_StoreChannels_NEON(dst + 3, out[1], 3);
+        SDL_StoreChannels_NEON(dst + 6, out[2], 3);
+        SDL_StoreChannels_NEON(dst + 9, out[3], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 8, dst += 3) {
+        const float srcFC = src[2];
+        const float srcBL = src[4];
+        const float srcBR = src[5];
+        const float srcSL = src[6];
+        const float srcSR = src[7];
+        dst[0] /* FL */ = (src[0] * 0.226999998f) + (srcFC * 0.160999998f) + (srcBL * 0.194000006f) + (srcBR * 0.119000003f) + (srcSL * 0.208000004f) + (srcSR * 0.092000000f);
+        dst[1] /* FR */ = (src[1] * 0.226999998f) + (srcFC * 0.160999998f) + (srcBL * 0.119000003f) + (srcBR * 0.194000006f) + (srcSL * 0.092000000f) + (srcSR * 0.208000004f);
+        dst[2] /* LFE */ = src[3];
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 8) * 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert71ToQuad_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("7.1", "quad (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 8); i >= 4; i -= 4, src += 32, dst += 16) {
+        float32x4_t in[8], out[4];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 8, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 16, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 24, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src + 4, 4);
+        in[5] = SDL_LoadChannels_NEON(src + 12, 4);
+        in[6] = SDL_LoadChannels_NEON(src + 20, 4);
+        in[7] = SDL_LoadChannels_NEON(src + 28, 4);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.466344833f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.329241365f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[3], 0.034482758f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[6], 0.169931039f));
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.466344833f);
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[2], 0.329241365f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[3], 0.034482758f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[7], 0.169931039f));
+        out[2] /* BL */ = vmulq_n_f32(in[3], 0.034482758f);
+        out[2] = vaddq_f32(out[2], vmulq_n_f32(in[4], 0.466344833f));
+        out[2] = vaddq_f32(out[2], vmulq_n_f32(in[6], 0.433517247f));
+        out[3] /* BR */ = vmulq_n_f32(in[3], 0.034482758f);
+        out[3] = vaddq_f32(out[3], vmulq_n_f32(in[5], 0.466344833f));
+        out[3] = vaddq_f32(out[3], vmulq_n_f32(in[7], 0.433517247f));
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst, out[0], 4);
+        SDL_StoreChannels_NEON(dst + 4, out[1], 4);
+        SDL_StoreChannels_NEON(dst + 8, out[2], 4);
+        SDL_StoreChannels_NEON(dst + 12, out[3], 4);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 8, dst += 4) {
+        const float srcFC = src[2];
+        const float srcLFE = src[3];
+        const float srcSL = src[6];
+        const float srcSR = src[7];
+        dst[0] /* FL */ = (src[0] * 0.466344833f) + (srcFC * 0.329241365f) + (srcLFE * 0.034482758f) + (srcSL * 0.169931039f);
+        dst[1] /* FR */ = (src[1] * 0.466344833f) + (srcFC * 0.329241365f) + (srcLFE * 0.034482758f) + (srcSR * 0.169931039f);
+        dst[2] /* BL */ = (srcLFE * 0.034482758f) + (src[4] * 0.466344833f) + (srcSL * 0.433517247f);
+        dst[3] /* BR */ = (srcLFE * 0.034482758f) + (src[5] * 0.466344833f) + (srcSR * 0.433517247f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 8) * 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert71To41_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("7.1", "4.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 8); i >= 4; i -= 4, src += 32, dst += 20) {
+        float32x4_t in[8], out[8];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 8, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 16, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 24, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src + 4, 4);
+        in[5] = SDL_LoadChannels_NEON(src + 12, 4);
+        in[6] = SDL_LoadChannels_NEON(src + 20, 4);
+        in[7] = SDL_LoadChannels_NEON(src + 28, 4);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.483000010f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[2], 0.340999991f));
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[6], 0.175999999f));
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.483000010f);
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[2], 0.340999991f));
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[7], 0.175999999f));
+        out[2] /* LFE */ = in[3];
+        out[3] /* BL */ = vmulq_n_f32(in[4], 0.483000010f);
+        out[3] = vaddq_f32(out[3], vmulq_n_f32(in[6], 0.449000001f));
+        out[4] /* BR */ = vmulq_n_f32(in[5], 0.483000010f);
+        out[4] = vaddq_f32(out[4], vmulq_n_f32(in[7], 0.449000001f));
+        out[5] = out[6] = out[7] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst, out[0], 4);
+        SDL_StoreChannels_NEON(dst + 5, out[1], 4);
+        SDL_StoreChannels_NEON(dst + 10, out[2], 4);
+        SDL_StoreChannels_NEON(dst + 15, out[3], 4);
+        SDL_TRANSPOSE4_NEON(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_NEON(dst + 4, out[4], 1);
+        SDL_StoreChannels_NEON(dst + 9, out[5], 1);
+        SDL_StoreChannels_NEON(dst + 14, out[6], 1);
+        SDL_StoreChannels_NEON(dst + 19, out[7], 1);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 8, dst += 5) {
+        const float srcFC = src[2];
+        const float srcSL = src[6];
+        const float srcSR = src[7];
+        dst[0] /* FL */ = (src[0] * 0.483000010f) + (srcFC * 0.340999991f) + (srcSL * 0.175999999f);
+        dst[1] /* FR */ = (src[1] * 0.483000010f) + (srcFC * 0.340999991f) + (srcSR * 0.175999999f);
+        dst[2] /* LFE */ = src[3];
+        dst[3] /* BL */ = (src[4] * 0.483000010f) + (srcSL * 0.449000001f);
+        dst[4] /* BR */ = (src[5] * 0.483000010f) + (srcSR * 0.449000001f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 8) * 5;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert71To51_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("7.1", "5.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 8); i >= 4; i -= 4, src += 32, dst += 24) {
+        float32x4_t in[8], out[8];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 8, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 16, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 24, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src + 4, 4);
+        in[5] = SDL_LoadChannels_NEON(src + 12, 4);
+        in[6] = SDL_LoadChannels_NEON(src + 20, 4);
+        in[7] = SDL_LoadChannels_NEON(src + 28, 4);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.518000007f);
+        out[0] = vaddq_f32(out[0], vmulq_n_f32(in[6], 0.188999996f));
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.518000007f);
+        out[1] = vaddq_f32(out[1], vmulq_n_f32(in[7], 0.188999996f));
+        out[2] /* FC */ = vmulq_n_f32(in[2], 0.518000007f);
+        out[3] /* LFE */ = in[3];
+        out[4] /* BL */ = vmulq_n_f32(in[4], 0.518000007f);
+        out[4] = vaddq_f32(out[4], vmulq_n_f32(in[6], 0.481999993f));
+        out[5] /* BR */ = vmulq_n_f32(in[5], 0.518000007f);
+        out[5] = vaddq_f32(out[5], vmulq_n_f32(in[7], 0.481999993f));
+        out[6] = out[7] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst, out[0], 4);
+        SDL_StoreChannels_NEON(dst + 6, out[1], 4);
+        SDL_StoreChannels_NEON(dst + 12, out[2], 4);
+        SDL_StoreChannels_NEON(dst + 18, out[3], 4);
+        SDL_TRANSPOSE4_NEON(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_NEON(dst + 4, out[4], 2);
+        SDL_StoreChannels_NEON(dst + 10, out[5], 2);
+        SDL_StoreChannels_NEON(dst + 16, out[6], 2);
+        SDL_StoreChannels_NEON(dst + 22, out[7], 2);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 8, dst += 6) {
+        const float srcSL = src[6];
+        const float srcSR = src[7];
+        dst[0] /* FL */ = (src[0] * 0.518000007f) + (srcSL * 0.188999996f);
+        dst[1] /* FR */ = (src[1] * 0.518000007f) + (srcSR * 0.188999996f);
+        dst[2] /* FC */ = (src[2] * 0.518000007f);
+        dst[3] /* LFE */ = src[3];
+        dst[4] /* BL */ = (src[4] * 0.518000007f) + (srcSL * 0.481999993f);
+        dst[5] /* BR */ = (src[5] * 0.518000007f) + (srcSR * 0.481999993f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 8) * 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert71To61_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    int i;
+
+    LOG_DEBUG_CONVERT("7.1", "6.1 (using NEON)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 8); i >= 4; i -= 4, src += 32, dst += 28) {
+        float32x4_t in[8], out[8];
+        in[0] = SDL_LoadChannels_NEON(src, 4);
+        in[1] = SDL_LoadChannels_NEON(src + 8, 4);
+        in[2] = SDL_LoadChannels_NEON(src + 16, 4);
+        in[3] = SDL_LoadChannels_NEON(src + 24, 4);
+        SDL_TRANSPOSE4_NEON(in[0], in[1], in[2], in[3]);
+        in[4] = SDL_LoadChannels_NEON(src + 4, 4);
+        in[5] = SDL_LoadChannels_NEON(src + 12, 4);
+        in[6] = SDL_LoadChannels_NEON(src + 20, 4);
+        in[7] = SDL_LoadChannels_NEON(src + 28, 4);
+        SDL_TRANSPOSE4_NEON(in[4], in[5], in[6], in[7]);
+        out[0] /* FL */ = vmulq_n_f32(in[0], 0.541000009f);
+        out[1] /* FR */ = vmulq_n_f32(in[1], 0.541000009f);
+        out[2] /* FC */ = vmulq_n_f32(in[2], 0.541000009f);
+        out[3] /* LFE */ = in[3];
+        out[4] /* BC */ = vmulq_n_f32(in[4], 0.287999988f);
+        out[4] = vaddq_f32(out[4], vmulq_n_f32(in[5], 0.287999988f));
+        out[5] /* SL */ = vmulq_n_f32(in[4], 0.458999991f);
+        out[5] = vaddq_f32(out[5], vmulq_n_f32(in[6], 0.541000009f));
+        out[6] /* SR */ = vmulq_n_f32(in[5], 0.458999991f);
+        out[6] = vaddq_f32(out[6], vmulq_n_f32(in[7], 0.541000009f));
+        out[7] = vdupq_n_f32(0.0f);  /* padding for the transpose. */
+        SDL_TRANSPOSE4_NEON(out[0], out[1], out[2], out[3]);
+        SDL_StoreChannels_NEON(dst, out[0], 4);
+        SDL_StoreChannels_NEON(dst + 7, out[1], 4);
+        SDL_StoreChannels_NEON(dst + 14, out[2], 4);
+        SDL_StoreChannels_NEON(dst + 21, out[3], 4);
+        SDL_TRANSPOSE4_NEON(out[4], out[5], out[6], out[7]);
+        SDL_StoreChannels_NEON(dst + 4, out[4], 3);
+        SDL_StoreChannels_NEON(dst + 11, out[5], 3);
+        SDL_StoreChannels_NEON(dst + 18, out[6], 3);
+        SDL_StoreChannels_NEON(dst + 25, out[7], 3);
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    for (; i; i--, src += 8, dst += 7) {
+        const float srcBL = src[4];
+        const float srcBR = src[5];
+        dst[0] /* FL */ = (src[0] * 0.541000009f);
+        dst[1] /* FR */ = (src[1] * 0.541000009f);
+        dst[2] /* FC */ = (src[2] * 0.541000009f);
+        dst[3] /* LFE */ = src[3];
+        dst[4] /* BC */ = (srcBL * 0.287999988f) + (srcBR * 0.287999988f);
+        dst[5] /* SL */ = (srcBL * 0.458999991f) + (src[6] * 0.541000009f);
+        dst[6] /* SR */ = (srcBR * 0.458999991f) + (src[7] * 0.541000009f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 8) * 7;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static const SDL_AudioFilter channel_converters_NEON[8][8] = {   /* [from][to] */
+    { NULL, SDL_ConvertMonoToStereo_NEON, SDL_ConvertMonoTo21_NEON, SDL_ConvertMonoToQuad_NEON, SDL_ConvertMonoTo41_NEON, SDL_ConvertMonoTo51_NEON, SDL_ConvertMonoTo61_NEON, SDL_ConvertMonoTo71_NEON },
+    { SDL_ConvertStereoToMono_NEON, NULL, SDL_ConvertStereoTo21_NEON, SDL_ConvertStereoToQuad_NEON, SDL_ConvertStereoTo41_NEON, SDL_ConvertStereoTo51_NEON, SDL_ConvertStereoTo61_NEON, SDL_ConvertStereoTo71_NEON },
+    { SDL_Convert21ToMono_NEON, SDL_Convert21ToStereo_NEON, NULL, SDL_Convert21ToQuad_NEON, SDL_Convert21To41_NEON, SDL_Convert21To51_NEON, SDL_Convert21To61_NEON, SDL_Convert21To71_NEON },
+    { SDL_ConvertQuadToMono_NEON, SDL_ConvertQuadToStereo_NEON, SDL_ConvertQuadTo21_NEON, NULL, SDL_ConvertQuadTo41_NEON, SDL_ConvertQuadTo51_NEON, SDL_ConvertQuadTo61_NEON, SDL_ConvertQuadTo71_NEON },
+    { SDL_Convert41ToMono_NEON, SDL_Convert41ToStereo_NEON, SDL_Convert41To21_NEON, SDL_Convert41ToQuad_NEON, NULL, SDL_Convert41To51_NEON, SDL_Convert41To61_NEON, SDL_Convert41To71_NEON },
+    { SDL_Convert51ToMono_NEON, SDL_Convert51ToStereo_NEON, SDL_Convert51To21_NEON, SDL_Convert51ToQuad_NEON, SDL_Convert51To41_NEON, NULL, SDL_Convert51To61_NEON, SDL_Convert51To71_NEON },
+    { SDL_Convert61ToMono_NEON, SDL_Convert61ToStereo_NEON, SDL_Convert61To21_NEON, SDL_Convert61ToQuad_NEON, SDL_Convert61To41_NEON, SDL_Convert61To51_NEON, NULL, SDL_Convert61To71_NEON },
+    { SDL_Convert71ToMono_NEON, SDL_Convert71ToStereo_NEON, SDL_Convert71To21_NEON, SDL_Convert71ToQuad_NEON, SDL_Convert71To41_NEON, SDL_Convert71To51_NEON, SDL_Convert71To61_NEON, NULL }
+};
+
+#endif
+
 /* vi: set ts=4 sw=4 expandtab: */
 
@@ -44,22 +44,6 @@
 #define HAVE_SSE3_INTRINSICS 1
 #endif
 
-#if defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H)
-#define HAVE_AVX_INTRINSICS 1
-#endif
-#if defined __clang__
-# if (!__has_attribute(target))
-#   undef HAVE_AVX_INTRINSICS
-# endif
-# if (defined(_MSC_VER) || defined(__SCE__)) && !defined(__AVX__)
-#   undef HAVE_AVX_INTRINSICS
-# endif
-#elif defined __GNUC__
-# if (__GNUC__ < 4) || (__GNUC__ == 4 && __GNUC_MINOR__ < 9)
-#   undef HAVE_AVX_INTRINSICS
-# endif
-#endif
-
 /*
  * CHANNEL LAYOUTS AS SDL EXPECTS THEM:
  *
@@ -166,6 +150,120 @@ SDL_ConvertMonoToStereo_SSE(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 }
 #endif
 
+/* Helpers for the generated SIMD channel converters. These run a block of
+   frames at a time: each group of up to four channels is loaded as one row
+   per frame, transposed so each register holds one channel across the
+   block, multiplied through the mixing matrix, then transposed back. Rows
+   are loaded and stored with exactly `count` floats, so we never touch a
+   neighbouring frame (the conversions run in-place). */
+#if HAVE_SSE_INTRINSICS
+SDL_FORCE_INLINE __m128
+SDL_LoadChannels_SSE(const float *src, const int count)
+{
+    switch (count) {
+        case 1: return _mm_load_ss(src);
+        case 2: return _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *) src);
+        case 3: return _mm_movelh_ps(_mm_loadl_pi(_mm_setzero_ps(), (const __m64 *) src), _mm_load_ss(src + 2));
+        default: return _mm_loadu_ps(src);
+    }
+}
+
+SDL_FORCE_INLINE void
+SDL_StoreChannels_SSE(float *dst, const __m128 channels, const int count)
+{
+    switch (count) {
+        case 1: _mm_store_ss(dst, channels); break;
+        case 2: _mm_storel_pi((__m64 *) dst, channels); break;
+        case 3: _mm_storel_pi((__m64 *) dst, channels); _mm_store_ss(dst + 2, _mm_movehl_ps(channels, channels)); break;
+        default: _mm_storeu_ps(dst, channels); break;
+    }
+}
+#endif
+
+#if HAVE_AVX_INTRINSICS
+/* AVX blocks are eight frames: the low half of each row is frame N, the
+   high half is frame N+4, so the in-lane transpose below does two 4x4
+   transposes at once. */
+SDL_FORCE_INLINE __m128 SDL_TARGETING("avx")
+SDL_LoadChannels_AVX128(const float *src, const int count)
+{
+    switch (count) {
+        case 1: return _mm_load_ss(src);
+        case 2: return _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *) src);
+        case 3: return _mm_movelh_ps(_mm_loadl_pi(_mm_setzero_ps(), (const __m64 *) src), _mm_load_ss(src + 2));
+        default: return _mm_loadu_ps(src);
+    }
+}
+
+SDL_FORCE_INLINE void SDL_TARGETING("avx")
+SDL_StoreChannels_AVX128(float *dst, const __m128 channels, const int count)
+{
+    switch (count) {
+        case 1: _mm_store_ss(dst, channels); break;
+        case 2: _mm_storel_pi((__m64 *) dst, channels); break;
+        case 3: _mm_storel_pi((__m64 *) dst, channels); _mm_store_ss(dst + 2, _mm_movehl_ps(channels, channels)); break;
+        default: _mm_storeu_ps(dst, channels); break;
+    }
+}
+
+SDL_FORCE_INLINE __m256 SDL_TARGETING("avx")
+SDL_LoadChannels_AVX(const float *lo, const float *hi, const int count)
+{
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(SDL_LoadChannels_AVX128(lo, count)), SDL_LoadChannels_AVX128(hi, count), 1);
+}
+
+SDL_FORCE_INLINE void SDL_TARGETING("avx")
+SDL_StoreChannels_AVX(float *lo, float *hi, const __m256 channels, const int count)
+{
+    SDL_StoreChannels_AVX128(lo, _mm256_castps256_ps128(channels), count);
+    SDL_StoreChannels_AVX128(hi, _mm256_extractf128_ps(channels, 1), count);
+}
+
+#define SDL_TRANSPOSE4_AVX(row0, row1, row2, row3) do { \
+    const __m256 tmp0 = _mm256_unpacklo_ps((row0), (row1)); \
+    const __m256 tmp1 = _mm256_unpackhi_ps((row0), (row1)); \
+    const __m256 tmp2 = _mm256_unpacklo_ps((row2), (row3)); \
+    const __m256 tmp3 = _mm256_unpackhi_ps((row2), (row3)); \
+    (row0) = _mm256_shuffle_ps(tmp0, tmp2, _MM_SHUFFLE(1, 0, 1, 0)); \
+    (row1) = _mm256_shuffle_ps(tmp0, tmp2, _MM_SHUFFLE(3, 2, 3, 2)); \
+    (row2) = _mm256_shuffle_ps(tmp1, tmp3, _MM_SHUFFLE(1, 0, 1, 0)); \
+    (row3) = _mm256_shuffle_ps(tmp1, tmp3, _MM_SHUFFLE(3, 2, 3, 2)); \
+} while (0)
+#endif
+
+#if HAVE_NEON_INTRINSICS
+SDL_FORCE_INLINE float32x4_t
+SDL_LoadChannels_NEON(const float *src, const int count)
+{
+    switch (count) {
+        case 1: return vld1q_lane_f32(src, vdupq_n_f32(0.0f), 0);
+        case 2: return vcombine_f32(vld1_f32(src), vdup_n_f32(0.0f));
+        case 3: return vcombine_f32(vld1_f32(src), vld1_lane_f32(src + 2, vdup_n_f32(0.0f), 0));
+        default: return vld1q_f32(src);
+    }
+}
+
+SDL_FORCE_INLINE void
+SDL_StoreChannels_NEON(float *dst, const float32x4_t channels, const int count)
+{
+    switch (count) {
+        case 1: vst1q_lane_f32(dst, channels, 0); break;
+        case 2: vst1_f32(dst, vget_low_f32(channels)); break;
+        case 3: vst1_f32(dst, vget_low_f32(channels)); vst1q_lane_f32(dst + 2, channels, 2); break;
+        default: vst1q_f32(dst, channels); break;
+    }
+}
+
+#define SDL_TRANSPOSE4_NEON(row0, row1, row2, row3) do { \
+    const float32x4x2_t tmp01 = vtrnq_f32((row0), (row1)); \
+    const float32x4x2_t tmp23 = vtrnq_f32((row2), (row3)); \
+    (row0) = vcombine_f32(vget_low_f32(tmp01.val[0]), vget_low_f32(tmp23.val[0])); \
+    (row1) = vcombine_f32(vget_low_f32(tmp01.val[1]), vget_low_f32(tmp23.val[1])); \
+    (row2) = vcombine_f32(vget_high_f32(tmp01.val[0]), vget_high_f32(tmp23.val[0])); \
+    (row3) = vcombine_f32(vget_high_f32(tmp01.val[1]), vget_high_f32(tmp23.val[1])); \
+} while (0)
+#endif
+
 
 /* Include the autogenerated channel converters... */
 #include "SDL_audio_channel_converters.h"
@@ -189,70 +287,905 @@ ResamplerPadding(const int inrate, const int outrate)
     return RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
 }
 
+/* The built-in filter from SDL_audio_resampler_filter.h uses this many input
+   frames at and before srcindex, and this many after it. */
+#define RESAMPLER_DEFAULT_LEFT_TAPS (RESAMPLER_ZERO_CROSSINGS + 1)
+#define RESAMPLER_DEFAULT_RIGHT_TAPS (RESAMPLER_ZERO_CROSSINGS + 1)
+
+/* SDL_AUDIO_RESAMPLE_BEST is a Kaiser-windowed sinc, calculated at runtime. */
+#define RESAMPLER_BEST_ZERO_CROSSINGS 16
+#define RESAMPLER_BEST_KAISER_BETA 9.0
+#define RESAMPLER_MAX_TAPS 256
+
+/* Which filter a resampler uses, and how many input frames it reads at and
+   before srcindex (the last input frame at or before the output frame), and
+   in total. */
+typedef struct
+{
+    SDL_AudioResampleQuality quality;
+    int taps;
+    int left_taps;
+    double cutoff;  /* SDL_AUDIO_RESAMPLE_BEST only, relative to the input's Nyquist frequency. */
+} SDL_ResamplerFilter;
+
+static void
+ResamplerSetupFilter(SDL_ResamplerFilter *filter, const SDL_AudioResampleQuality quality,
+                     const int inrate, const int outrate)
+{
+    filter->quality = quality;
+    filter->cutoff = 1.0;
+
+    switch (quality) {
+        case SDL_AUDIO_RESAMPLE_NEAREST:  /* second tap is only there to round up. */
+        case SDL_AUDIO_RESAMPLE_LINEAR:
+            filter->taps = 2;
+            filter->left_taps = 1;
+            break;
+
+        case SDL_AUDIO_RESAMPLE_CUBIC:
+            filter->taps = 4;
+            filter->left_taps = 2;
+            break;
+
+        case SDL_AUDIO_RESAMPLE_BEST: {
+            int halfwidth;
+            /* When downsampling, move the cutoff down to the output's Nyquist
+               frequency, so we filter out what it can't hold instead of
+               letting it alias. That stretches the filter over more input. */
+            filter->cutoff = 0.95 * SDL_min(1.0, ((double) outrate) / ((double) inrate));
+            halfwidth = (int) SDL_ceil(RESAMPLER_BEST_ZERO_CROSSINGS / filter->cutoff);
+            halfwidth = SDL_min((halfwidth + 1) & ~1, RESAMPLER_MAX_TAPS / 2);  /* keeps taps a multiple of 4. */
+            filter->taps = halfwidth * 2;
+            filter->left_taps = halfwidth;
+            break;
+        }
+
+        default:
+            SDL_assert(quality == SDL_AUDIO_RESAMPLE_DEFAULT);
+            filter->quality = SDL_AUDIO_RESAMPLE_DEFAULT;
+            filter->taps = RESAMPLER_DEFAULT_LEFT_TAPS + RESAMPLER_DEFAULT_RIGHT_TAPS;
+            filter->left_taps = RESAMPLER_DEFAULT_LEFT_TAPS;
+            break;
+    }
+}
+
+static double
+ResamplerBesselI0(const double x)
+{
+    const double halfx = x * 0.5;
+    double sum = 1.0;
+    double term = 1.0;
+    int k;
+
+    for (k = 1; k < 64; k++) {
+        term *= halfx / k;
+        sum += term * term;
+        if ((term * term) < (sum * 1e-12)) {
+            break;
+        }
+    }
+    return sum;
+}
+
+/* Fill in (filter->taps) coefficients for an output frame that is
+   (interpolation) of the way from srcindex to the next input frame. Taps run
+   from the oldest input frame to the newest. */
+static void
+ResamplerCalculateCoeffs(const SDL_ResamplerFilter *filter, const float interpolation, float *coeffs)
+{
+    int j;
+
+    SDL_memset(coeffs, '\0', filter->taps * sizeof (float));
+
+    switch (filter->quality) {
+        case SDL_AUDIO_RESAMPLE_NEAREST:
+            coeffs[(interpolation >= 0.5f) ? 1 : 0] = 1.0f;
+            break;
+
+        case SDL_AUDIO_RESAMPLE_LINEAR:
+            coeffs[0] = 1.0f - interpolation;
+            coeffs[1] = interpolation;
+            break;
+
+        case SDL_AUDIO_RESAMPLE_CUBIC: {  /* Catmull-Rom spline. */
+            const float t = interpolation;
+            const float t2 = t * t;
+            const float t3 = t2 * t;
+            coeffs[0] = 0.5f * ((-t3) + (2.0f * t2) - t);
+            coeffs[1] = 0.5f * ((3.0f * t3) - (5.0f * t2) + 2.0f);
+            coeffs[2] = 0.5f * ((-3.0f * t3) + (4.0f * t2) + t);
+            coeffs[3] = 0.5f * (t3 - t2);
+            break;
+        }
+
+        case SDL_AUDIO_RESAMPLE_BEST: {
+            const double halfwidth = (double) filter->left_taps;
+            const double norm = ResamplerBesselI0(RESAMPLER_BEST_KAISER_BETA);
+            double sum = 0.0;
+            for (j = 0; j < filter->taps; j++) {
+                /* distance from the output frame, in input frames. */
+                const double x = ((double) (j - (filter->left_taps - 1))) - interpolation;
+                const double w = x * filter->cutoff;
+                const double sinc = (w == 0.0) ? 1.0 : (SDL_sin(M_PI * w) / (M_PI * w));
+                const double edge = x / halfwidth;
+                const double window = (edge <= -1.0 || edge >= 1.0) ? 0.0 : (ResamplerBesselI0(RESAMPLER_BEST_KAISER_BETA * SDL_sqrt(1.0 - (edge * edge))) / norm);
+                const double coeff = sinc * window;
+                coeffs[j] = (float) coeff;
+                sum += coeff;
+            }
+            /* normalize so the filter doesn't change the volume. */
+            for (j = 0; j < filter->taps; j++) {
+                coeffs[j] = (float) (coeffs[j] / sum);
+            }
+            break;
+        }
+
+        default: {
+            const float interpolation1 = interpolation;
+            const int filterindex1 = (int) (interpolation1 * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
+            const float interpolation2 = 1.0f - interpolation1;
+            const int filterindex2 = (int) (interpolation2 * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
+
+            /* do this twice to calculate the sample, once for the "left wing" and then same for the right. */
+            for (j = 0; (filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
+                const int jsamples = j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
+                coeffs[(filter->left_taps - 1) - j] = ResamplerFilter[filterindex1 + jsamples] + (interpolation1 * ResamplerFilterDifference[filterindex1 + jsamples]);
+            }
+
+            /* Do the right wing! */
+            for (j = 0; (filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
+                const int jsamples = j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
+                coeffs[filter->left_taps + j] = ResamplerFilter[filterindex2 + jsamples] + (interpolation2 * ResamplerFilterDifference[filterindex2 + jsamples]);
+            }
+            break;
+        }
+    }
+}
+
 /* lpadding and rpadding are expected to be buffers of (ResamplePadding(inrate, outrate) * chans * sizeof (float)) bytes. */
 static int
-SDL_ResampleAudio(const int chans, const int inrate, const int outrate,
+SDL_ResampleAudio(const SDL_ResamplerFilter *filter,
+                        const int chans, const int inrate, const int outrate,
                         const float *lpadding, const float *rpadding,
                         const float *inbuf, const int inbuflen,
                         float *outbuf, const int outbuflen)
 {
-    /* Note that this used to be double, but it looks like we can get by with float in most cases at
-       almost twice the speed on Intel processors, and orders of magnitude more
-       on CPUs that need a software fallback for double calculations. */
-    typedef float ResampleFloatType;
-
-    const ResampleFloatType finrate = (ResampleFloatType) inrate;
-    const ResampleFloatType outtimeincr = ((ResampleFloatType) 1.0f) / ((ResampleFloatType) outrate);
-    const ResampleFloatType ratio = ((float) outrate) / ((float) inrate);
     const int paddinglen = ResamplerPadding(inrate, outrate);
     const int framelen = chans * (int)sizeof (float);
     const int inframes = inbuflen / framelen;
-    const int wantedoutframes = (int) ((inbuflen / framelen) * ratio);  /* outbuflen isn't total to write, it's total available. */
+    const int wantedoutframes = (int) ((((Sint64) inframes) * outrate) / inrate);  /* outbuflen isn't total to write, it's total available. */
     const int maxoutframes = outbuflen / framelen;
     const int outframes = SDL_min(wantedoutframes, maxoutframes);
-    ResampleFloatType outtime = 0.0f;
+    Sint64 outtime = 0;  /* in units of 1/(inrate*outrate) seconds, so it stays exact over long buffers. */
+    float coeffs[RESAMPLER_MAX_TAPS];
     float *dst = outbuf;
     int i, j, chan;
 
     for (i = 0; i < outframes; i++) {
-        const int srcindex = (int) (outtime * inrate);
-        const ResampleFloatType intime = ((ResampleFloatType) srcindex) / finrate;
-        const ResampleFloatType innexttime = ((ResampleFloatType) (srcindex + 1)) / finrate;
-        const ResampleFloatType indeltatime = innexttime - intime;
-        const ResampleFloatType interpolation1 = (indeltatime == 0.0f) ? 1.0f : (1.0f - ((innexttime - outtime) / indeltatime));
-        const int filterindex1 = (int) (interpolation1 * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
-        const ResampleFloatType interpolation2 = 1.0f - interpolation1;
-        const int filterindex2 = (int) (interpolation2 * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
+        const int srcindex = (int) (outtime / outrate);
+        const float interpolation = ((float) (outtime % outrate)) / ((float) outrate);
+        const int firstframe = srcindex - (filter->left_taps - 1);
+
+        ResamplerCalculateCoeffs(filter, interpolation, coeffs);
 
         for (chan = 0; chan < chans; chan++) {
             float outsample = 0.0f;
+            for (j = 0; j < filter->taps; j++) {
+                const int srcframe = firstframe + j;
+                float insample;
+                if (srcframe < 0) {
+                    insample = lpadding[((paddinglen + srcframe) * chans) + chan];
+                } else if (srcframe >= inframes) {
+                    insample = rpadding[((srcframe - inframes) * chans) + chan];
+                } else {
+                    insample = inbuf[(srcframe * chans) + chan];
+                }
+                outsample += insample * coeffs[j];
+            }
+            *(dst++) = outsample;
+        }
 
-            /* do this twice to calculate the sample, once for the "left wing" and then same for the right. */
-            for (j = 0; (filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
-                const int srcframe = srcindex - j;
-                /* !!! FIXME: we can bubble this conditional out of here by doing a pre loop. */
-                const float insample = (srcframe < 0) ? lpadding[((paddinglen + srcframe) * chans) + chan] : inbuf[(srcframe * chans) + chan];
-                outsample += (float)(insample * (ResamplerFilter[filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)] + (interpolation1 * ResamplerFilterDifference[filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)])));
+        outtime += inrate;
+    }
+
+    return outframes * chans * sizeof (float);
+}
+
+/* The polyphase resampler evaluates the same filters as SDL_ResampleAudio(),
+   but reduces the rate ratio to lowest terms first. Output frames then cycle
+   through a fixed set of fractional input positions ("phases"), so the filter
+   coefficients for each phase can be calculated once, up front, and every
+   output frame is a straight inner product over the input frames around it. */
+
+/* Ratios that don't reduce to this many phases or less (44100->48000 needs
+   160) would need huge tables, so they use SDL_ResampleAudio() instead. */
+#define POLYPHASE_MAX_PHASES 1024
+
+typedef struct SDL_AudioResampler SDL_AudioResampler;
+
+typedef struct
+{
+    const float *src;  /* first tap of output frame at srcindex == origin. */
+    int origin;
+    int srcindex;
+    int phase;
+    float *dst;
+    int frames;  /* output frames left to write. */
+} SDL_PolyphaseCursor;
+
+/* Resample until we run out of output frames or srcindex hits stopindex. */
+typedef void (SDLCALL *SDL_PolyphaseFunc)(const SDL_AudioResampler *resampler, SDL_PolyphaseCursor *cursor, const int stopindex);
+
+struct SDL_AudioResampler
+{
+    int chans;
+    int phases;  /* reduced output rate. */
+    int step;  /* reduced input rate. */
+    int step_frames;  /* whole input frames to advance per output frame... */
+    int step_phases;  /* ...plus this many phases. */
+    int taps;  /* a multiple of 4 for everything but NEAREST and LINEAR, for SIMD. */
+    int left_taps;
+    float *coeffs;  /* (taps) per phase. */
+    float *folded_coeffs;  /* (taps * chans) per phase, each tap repeated for every channel. */
+    float *edge;  /* scratch space to assemble input that crosses into the padding. */
+    SDL_PolyphaseFunc func;
+};
+
+#define POLYPHASE_ADVANCE(resampler, srcindex, phase) { \
+    int wrap; \
+    srcindex += resampler->step_frames; \
+    phase += resampler->step_phases; \
+    wrap = (phase >= resampler->phases); \
+    srcindex += wrap; \
+    phase -= wrap * resampler->phases; \
+}
+
+/* Works with any channel count, using the unfolded coefficient table. */
+static void SDLCALL
+SDL_ResamplePolyphase_Scalar(const SDL_AudioResampler *resampler, SDL_PolyphaseCursor *cursor, const int stopindex)
+{
+    const int chans = resampler->chans;
+    const int taps = resampler->taps;
+    float *dst = cursor->dst;
+    int srcindex = cursor->srcindex;
+    int phase = cursor->phase;
+    int frames = cursor->frames;
+    int chan, j;
+
+    while (frames && (srcindex < stopindex)) {
+        const float *src = cursor->src + ((srcindex - cursor->origin) * chans);
+        const float *coeffs = resampler->coeffs + (phase * taps);
+        for (chan = 0; chan < chans; chan++) {
+            float outsample = 0.0f;
+            for (j = 0; j < taps; j++) {
+                outsample += src[(j * chans) + chan] * coeffs[j];
             }
+            *(dst++) = outsample;
+        }
+        POLYPHASE_ADVANCE(resampler, srcindex, phase);
+        frames--;
+    }
 
-            /* Do the right wing! */
-            for (j = 0; (filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
-                const int jsamples = j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
-                const int srcframe = srcindex + 1 + j;
-                /* !!! FIXME: we can bubble this conditional out of here by doing a post loop. */
-                const float insample = (srcframe >= inframes) ? rpadding[((srcframe - inframes) * chans) + chan] : inbuf[(srcframe * chans) + chan];
-                outsample += (float)(insample * (ResamplerFilter[filterindex2 + jsamples] + (interpolation2 * ResamplerFilterDifference[filterindex2 + jsamples])));
+    cursor->dst = dst;
+    cursor->srcindex = srcindex;
+    cursor->phase = phase;
+    cursor->frames = frames;
+}
+
+/* NEAREST and LINEAR have two taps, and get their own kernels. */
+static void SDLCALL
+SDL_ResamplePolyphase_Nearest(const SDL_AudioResampler *resampler, SDL_PolyphaseCursor *cursor, const int stopindex)
+{
+    const int chans = resampler->chans;
+    const size_t framelen = chans * sizeof (float);
+    float *dst = cursor->dst;
+    int srcindex = cursor->srcindex;
+    int phase = cursor->phase;
+    int frames = cursor->frames;
+
+    while (frames && (srcindex < stopindex)) {
+        const float *src = cursor->src + ((srcindex - cursor->origin) * chans);
+        /* the second tap is only set if this phase rounds up to the next frame. */
+        const int next = (resampler->coeffs[(phase * 2) + 1] != 0.0f);
+        SDL_memcpy(dst, src + (next * chans), framelen);
+        dst += chans;
+        POLYPHASE_ADVANCE(resampler, srcindex, phase);
+        frames--;
+    }
+
+    cursor->dst = dst;
+    cursor->srcindex = srcindex;
+    cursor->phase = phase;
+    cursor->frames = frames;
+}
+
+static void SDLCALL
+SDL_ResamplePolyphase_Linear(const SDL_AudioResampler *resampler, SDL_PolyphaseCursor *cursor, const int stopindex)
+{
+    const int chans = resampler->chans;
+    float *dst = cursor->dst;
+    int srcindex = cursor->srcindex;
+    int phase = cursor->phase;
+    int frames = cursor->frames;
+    int chan;
+
+    while (frames && (srcindex < stopindex)) {
+        const float *src = cursor->src + ((srcindex - cursor->origin) * chans);
+        const float t = resampler->coeffs[(phase * 2) + 1];
+        for (chan = 0; chan < chans; chan++) {
+            dst[chan] = src[chan] + ((src[chans + chan] - src[chan]) * t);
+        }
+        dst += chans;
+        POLYPHASE_ADVANCE(resampler, srcindex, phase);
+        frames--;
+    }
+
+    cursor->dst = dst;
+    cursor->srcindex = srcindex;
+    cursor->phase = phase;
+    cursor->frames = frames;
+}
+
+/* The folded kernels multiply (taps * chans) contiguous input samples against
+   the folded coefficient table, so each 4-wide accumulator lane always holds
+   the same channel. That only works if chans divides 4. */
+#if HAVE_SSE_INTRINSICS
+static void SDLCALL
+SDL_ResamplePolyphase_SSE(const SDL_AudioResampler *resampler, SDL_PolyphaseCursor *cursor, const int stopindex)
+{
+    const int chans = resampler->chans;
+    const int total = resampler->taps * chans;
+    float *dst = cursor->dst;
+    int srcindex = cursor->srcindex;
+    int phase = cursor->phase;
+    int frames = cursor->frames;
+    int j;
+
+    SDL_assert((chans == 1) || (chans == 2) || (chans == 4));
+
+    while (frames && (srcindex < stopindex)) {
+        const float *src = cursor->src + ((srcindex - cursor->origin) * chans);
+        const float *coeffs = resampler->folded_coeffs + (phase * total);
+        __m128 sum = _mm_mul_ps(_mm_loadu_ps(src), _mm_loadu_ps(coeffs));
+        for (j = 4; j < total; j += 4) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + j), _mm_loadu_ps(coeffs + j)));
+        }
+
+        if (chans == 1) {
+            sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+            _mm_store_ss(dst, _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1))));
+        } else if (chans == 2) {
+            _mm_storel_pi((__m64 *) dst, _mm_add_ps(sum, _mm_movehl_ps(sum, sum)));
+        } else {
+            _mm_storeu_ps(dst, sum);
+        }
+
+        dst += chans;
+        POLYPHASE_ADVANCE(resampler, srcindex, phase);
+        frames--;
+    }
+
+    cursor->dst = dst;
+    cursor->srcindex = srcindex;
+    cursor->phase = phase;
+    cursor->frames = frames;
+}
+#endif
+
+#if HAVE_AVX_INTRINSICS
+static void SDLCALL SDL_TARGETING("avx")
+SDL_ResamplePolyphase_AVX(const SDL_AudioResampler *resampler, SDL_PolyphaseCursor *cursor, const int stopindex)
+{
+    const int chans = resampler->chans;
+    const int total = resampler->taps * chans;
+    float *dst = cursor->dst;
+    int srcindex = cursor->srcindex;
+    int phase = cursor->phase;
+    int frames = cursor->frames;
+    int j;
+
+    SDL_assert((chans == 1) || (chans == 2) || (chans == 4));
+
+    while (frames && (srcindex < stopindex)) {
+        const float *src = cursor->src + ((srcindex - cursor->origin) * chans);
+        const float *coeffs = resampler->folded_coeffs + (phase * total);
+        __m256 wide = _mm256_setzero_ps();
+        __m128 sum;
+
+        for (j = 0; (j + 8) <= total; j += 8) {
+            wide = _mm256_add_ps(wide, _mm256_mul_ps(_mm256_loadu_ps(src + j), _mm256_loadu_ps(coeffs + j)));
+        }
+
+        /* lanes repeat every (chans) floats, so the halves can just be added. */
+        sum = _mm_add_ps(_mm256_castps256_ps128(wide), _mm256_extractf128_ps(wide, 1));
+        if (j < total) {  /* taps are a multiple of 4, so there's at most one more. */
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + j), _mm_loadu_ps(coeffs + j)));
+        }
+
+        if (chans == 1) {
+            sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+            _mm_store_ss(dst, _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1))));
+        } else if (chans == 2) {
+            _mm_storel_pi((__m64 *) dst, _mm_add_ps(sum, _mm_movehl_ps(sum, sum)));
+        } else {
+            _mm_storeu_ps(dst, sum);
+        }
+
+        dst += chans;
+        POLYPHASE_ADVANCE(resampler, srcindex, phase);
+        frames--;
+    }
+
+    cursor->dst = dst;
+    cursor->srcindex = srcindex;
+    cursor->phase = phase;
+    cursor->frames = frames;
+}
+#endif
+
+#if HAVE_NEON_INTRINSICS
+static void SDLCALL
+SDL_ResamplePolyphase_NEON(const SDL_AudioResampler *resampler, SDL_PolyphaseCursor *cursor, const int stopindex)
+{
+    const int chans = resampler->chans;
+    const int total = resampler->taps * chans;
+    float *dst = cursor->dst;
+    int srcindex = cursor->srcindex;
+    int phase = cursor->phase;
+    int frames = cursor->frames;
+    int j;
+
+    SDL_assert((chans == 1) || (chans == 2) || (chans == 4));
+
+    while (frames && (srcindex < stopindex)) {
+        const float *src = cursor->src + ((srcindex - cursor->origin) * chans);
+        const float *coeffs = resampler->folded_coeffs + (phase * total);
+        float32x4_t sum = vmulq_f32(vld1q_f32(src), vld1q_f32(coeffs));
+        for (j = 4; j < total; j += 4) {
+            sum = vmlaq_f32(sum, vld1q_f32(src + j), vld1q_f32(coeffs + j));
+        }
+
+        if (chans == 1) {
+            const float32x2_t halves = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+            *dst = vget_lane_f32(vpadd_f32(halves, halves), 0);
+        } else if (chans == 2) {
+            vst1_f32(dst, vadd_f32(vget_low_f32(sum), vget_high_f32(sum)));
+        } else {
+            vst1q_f32(dst, sum);
+        }
+
+        dst += chans;
+        POLYPHASE_ADVANCE(resampler, srcindex, phase);
+        frames--;
+    }
+
+    cursor->dst = dst;
+    cursor->srcindex = srcindex;
+    cursor->phase = phase;
+    cursor->frames = frames;
+}
+#endif
+
+/* The wide kernels are for 5.1 and 7.1: instead of folding taps into
+   vectors, each vector holds one input frame, and every tap is a single
+   coefficient applied across all of the channels at once. That makes 7.1
+   cost about the same as stereo. */
+#if HAVE_SSE_INTRINSICS
+static void SDLCALL
+SDL_ResamplePolyphaseWide_SSE(const SDL_AudioResampler *resampler, SDL_PolyphaseCursor *cursor, const int stopindex)
+{
+    const int chans = resampler->chans;
+    const int taps = resampler->taps;
+    float *dst = cursor->dst;
+    int srcindex = cursor->srcindex;
+    int phase = cursor->phase;
+    int frames = cursor->frames;
+    int j;
+
+    SDL_assert((chans == 6) || (chans == 8));
+
+    while (frames && (srcindex < stopindex)) {
+        const float *src = cursor->src + ((srcindex - cursor->origin) * chans);
+        const float *coeffs = resampler->coeffs + (phase * taps);
+        __m128 lo = _mm_setzero_ps();
+        __m128 hi = _mm_setzero_ps();
+
+        if (chans == 8) {
+            for (j = 0; j < taps; j++, src += 8) {
+                const __m128 coeff = _mm_set1_ps(coeffs[j]);
+                lo = _mm_add_ps(lo, _mm_mul_ps(_mm_loadu_ps(src), coeff));
+                hi = _mm_add_ps(hi, _mm_mul_ps(_mm_loadu_ps(src + 4), coeff));
+            }
+            _mm_storeu_ps(dst, lo);
+            _mm_storeu_ps(dst + 4, hi);
+        } else {
+            for (j = 0; j < taps; j++, src += 6) {
+                const __m128 coeff = _mm_set1_ps(coeffs[j]);
+                lo = _mm_add_ps(lo, _mm_mul_ps(_mm_loadu_ps(src), coeff));
+                hi = _mm_add_ps(hi, _mm_mul_ps(_mm_loadl_pi(_mm_setzero_ps(), (const __m64 *) (src + 4)), coeff));
             }
+            _mm_storeu_ps(dst, lo);
+            _mm_storel_pi((__m64 *) (dst + 4), hi);
+        }
 
-            *(dst++) = outsample;
+        dst += chans;
+        POLYPHASE_ADVANCE(resampler, srcindex, phase);
+        frames--;
+    }
+
+    cursor->dst = dst;
+    cursor->srcindex = srcindex;
+    cursor->phase = phase;
+    cursor->frames = frames;
+}
+#endif
+
+#if HAVE_AVX_INTRINSICS
+static void SDLCALL SDL_TARGETING("avx")
+SDL_ResamplePolyphaseWide_AVX(const SDL_AudioResampler *resampler, SDL_PolyphaseCursor *cursor, const int stopindex)
+{
+    const int chans = resampler->chans;
+    const int taps = resampler->taps;
+    /* only touch the first (chans) floats of each frame. */
+    const __m256i mask = (chans == 8) ? _mm256_set1_epi32(-1) : _mm256_setr_epi32(-1, -1, -1, -1, -1, -1, 0, 0);
+    float *dst = cursor->dst;
+    int srcindex = cursor->srcindex;
+    int phase = cursor->phase;
+    int frames = cursor->frames;
+    int j;
+
+    SDL_assert((chans == 6) || (chans == 8));
+
+    while (frames && (srcindex < stopindex)) {
+        const float *src = cursor->src + ((srcindex - cursor->origin) * chans);
+        const float *coeffs = resampler->coeffs + (phase * taps);
+        __m256 sum = _mm256_setzero_ps();
+
+        for (j = 0; j < taps; j++, src += chans) {
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_maskload_ps(src, mask), _mm256_broadcast_ss(coeffs + j)));
         }
+        _mm256_maskstore_ps(dst, mask, sum);
 
-        outtime += outtimeincr;
+        dst += chans;
+        POLYPHASE_ADVANCE(resampler, srcindex, phase);
+        frames--;
     }
 
-    return outframes * chans * sizeof (float);
+    cursor->dst = dst;
+    cursor->srcindex = srcindex;
+    cursor->phase = phase;
+    cursor->frames = frames;
+}
+#endif
+
+#if HAVE_NEON_INTRINSICS
+static void SDLCALL
+SDL_ResamplePolyphaseWide_NEON(const SDL_AudioResampler *resampler, SDL_PolyphaseCursor *cursor, const int stopindex)
+{
+    const int chans = resampler->chans;
+    const int taps = resampler->taps;
+    float *dst = cursor->dst;
+    int srcindex = cursor->srcindex;
+    int phase = cursor->phase;
+    int frames = cursor->frames;
+    int j;
+
+    SDL_assert((chans == 6) || (chans == 8));
+
+    while (frames && (srcindex < stopindex)) {
+        const float *src = cursor->src + ((srcindex - cursor->origin) * chans);
+        const float *coeffs = resampler->coeffs + (phase * taps);
+        float32x4_t lo = vdupq_n_f32(0.0f);
+
+        if (chans == 8) {
+            float32x4_t hi = vdupq_n_f32(0.0f);
+            for (j = 0; j < taps; j++, src += 8) {
+                lo = vmlaq_n_f32(lo, vld1q_f32(src), coeffs[j]);
+                hi = vmlaq_n_f32(hi, vld1q_f32(src + 4), coeffs[j]);
+            }
+            vst1q_f32(dst, lo);
+            vst1q_f32(dst + 4, hi);
+        } else {
+            float32x2_t hi = vdup_n_f32(0.0f);
+            for (j = 0; j < taps; j++, src += 6) {
+                lo = vmlaq_n_f32(lo, vld1q_f32(src), coeffs[j]);
+                hi = vmla_n_f32(hi, vld1_f32(src + 4), coeffs[j]);
+            }
+            vst1q_f32(dst, lo);
+            vst1_f32(dst + 4, hi);
+        }
+
+        dst += chans;
+        POLYPHASE_ADVANCE(resampler, srcindex, phase);
+        frames--;
+    }
+
+    cursor->dst = dst;
+    cursor->srcindex = srcindex;
+    cursor->phase = phase;
+    cursor->frames = frames;
+}
+#endif
+
+#undef POLYPHASE_ADVANCE
+
+/* Set to a CPU-specific implementation by SDL_ChooseAudioResamplers(). */
+static SDL_PolyphaseFunc SDL_ResamplePolyphase_Folded = NULL;
+static SDL_PolyphaseFunc SDL_ResamplePolyphase_Wide = NULL;
+
+static void
+SDL_ChooseAudioResamplers(void)
+{
+    static SDL_bool resamplers_chosen = SDL_FALSE;
+
+    if (resamplers_chosen) {
+        return;
+    }
+
+#if HAVE_AVX_INTRINSICS
+    if (!SDL_ResamplePolyphase_Folded && SDL_HasAVX()) {
+        SDL_ResamplePolyphase_Folded = SDL_ResamplePolyphase_AVX;
+        SDL_ResamplePolyphase_Wide = SDL_ResamplePolyphaseWide_AVX;
+    }
+#endif
+
+#if HAVE_SSE_INTRINSICS
+    if (!SDL_ResamplePolyphase_Folded && SDL_HasSSE()) {
+        SDL_ResamplePolyphase_Folded = SDL_ResamplePolyphase_SSE;
+        SDL_ResamplePolyphase_Wide = SDL_ResamplePolyphaseWide_SSE;
+    }
+#endif
+
+#if HAVE_NEON_INTRINSICS
+    if (!SDL_ResamplePolyphase_Folded && SDL_HasNEON()) {
+        SDL_ResamplePolyphase_Folded = SDL_ResamplePolyphase_NEON;
+        SDL_ResamplePolyphase_Wide = SDL_ResamplePolyphaseWide_NEON;
+    }
+#endif
+
+    if (!SDL_ResamplePolyphase_Folded) {
+        SDL_ResamplePolyphase_Folded = SDL_ResamplePolyphase_Scalar;
+        SDL_ResamplePolyphase_Wide = SDL_ResamplePolyphase_Scalar;
+    }
+
+    resamplers_chosen = SDL_TRUE;
+}
+
+static int
+ResamplerGCD(int a, int b)
+{
+    while (b != 0) {
+        const int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+static void
+SDL_DestroyAudioResampler(SDL_AudioResampler *resampler)
+{
+    if (resampler) {
+        SDL_free(resampler->coeffs);
+        SDL_free(resampler->folded_coeffs);
+        SDL_free(resampler->edge);
+        SDL_free(resampler);
+    }
+}
+
+/* Returns NULL if this ratio isn't worth a table (or we're out of memory);
+   callers should fall back to SDL_ResampleAudio() in that case. */
+static SDL_AudioResampler *
+SDL_CreateAudioResampler(const SDL_ResamplerFilter *filter, const int chans, const int inrate, const int outrate)
+{
+    const int divisor = ResamplerGCD(inrate, outrate);
+    const int phases = outrate / divisor;
+    SDL_AudioResampler *resampler;
+    int phase, j;
+
+    if (phases > POLYPHASE_MAX_PHASES) {
+        return NULL;
+    }
+
+    SDL_ChooseAudioResamplers();
+
+    resampler = (SDL_AudioResampler *) SDL_calloc(1, sizeof (SDL_AudioResampler));
+    if (!resampler) {
+        return NULL;
+    }
+
+    resampler->chans = chans;
+    resampler->phases = phases;
+    resampler->step = inrate / divisor;
+    resampler->step_frames = resampler->step / phases;
+    resampler->step_phases = resampler->step % phases;
+    resampler->taps = filter->taps;
+    resampler->left_taps = filter->left_taps;
+    resampler->coeffs = (float *) SDL_malloc(phases * resampler->taps * sizeof (float));
+    resampler->edge = (float *) SDL_malloc(resampler->taps * 2 * chans * sizeof (float));
+    if (!resampler->coeffs || !resampler->edge) {
+        SDL_DestroyAudioResampler(resampler);
+        return NULL;
+    }
+
+    for (phase = 0; phase < phases; phase++) {
+        ResamplerCalculateCoeffs(filter, ((float) phase) / ((float) phases), resampler->coeffs + (phase * resampler->taps));
+    }
+
+    if (filter->quality == SDL_AUDIO_RESAMPLE_NEAREST) {
+        resampler->func = SDL_ResamplePolyphase_Nearest;
+    } else if (filter->quality == SDL_AUDIO_RESAMPLE_LINEAR) {
+        resampler->func = SDL_ResamplePolyphase_Linear;
+    } else if ((chans == 1) || (chans == 2) || (chans == 4)) {
+        SDL_assert((resampler->taps % 4) == 0);
+        resampler->folded_coeffs = (float *) SDL_malloc(phases * resampler->taps * chans * sizeof (float));
+        if (!resampler->folded_coeffs) {
+            SDL_DestroyAudioResampler(resampler);
+            return NULL;
+        }
+        for (j = 0; j < phases * resampler->taps; j++) {
+            int chan;
+            for (chan = 0; chan < chans; chan++) {
+                resampler->folded_coeffs[(j * chans) + chan] = resampler->coeffs[j];
+            }
+        }
+        resampler->func = SDL_ResamplePolyphase_Folded;
+    } else if ((chans == 6) || (chans == 8)) {
+        resampler->func = SDL_ResamplePolyphase_Wide;
+    } else {
+        resampler->func = SDL_ResamplePolyphase_Scalar;
+    }
+
+    return resampler;
+}
+
+/* Copy input frames [first, first+count) into dst, reading from the padding
+   buffers for frames outside of inbuf. */
+static void
+ResamplerCopyFrames(float *dst, const int first, const int count, const int chans,
+                    const float *lpadding, const float *rpadding, const int paddinglen,
+                    const float *inbuf, const int inframes)
+{
+    const int framelen = chans * (int)sizeof (float);
+    int i;
+
+    for (i = first; i < (first + count); i++) {
+        const float *src;
+        if (i < 0) {
+            src = lpadding + ((paddinglen + i) * chans);
+        } else if (i < inframes) {
+            src = inbuf + (i * chans);
+        } else {
+            src = rpadding + ((i - inframes) * chans);
+        }
+        SDL_memcpy(dst, src, framelen);
+        dst += chans;
+    }
+}
+
+/* Walks the three passes of a polyphase resample, so the output can be
+   pulled a few frames at a time. Holds pointers to the caller's buffers. */
+typedef struct
+{
+    SDL_AudioResampler *resampler;
+    const float *lpadding;
+    const float *rpadding;
+    int paddinglen;
+    const float *inbuf;
+    int inframes;
+    int outframes;  /* output frames left to write, over all passes. */
+    int pass;
+    SDL_PolyphaseCursor cursor;
+} SDL_PolyphaseRun;
+
+/* The passes stop when srcindex hits these, so the kernels never have to
+   check if they're reading past the ends of inbuf: the start and end of the
+   input are copied next to their padding, and the middle is read in place. */
+static void
+PolyphaseRunStartPass(SDL_PolyphaseRun *run)
+{
+    SDL_AudioResampler *resampler = run->resampler;
+    const int chans = resampler->chans;
+    const int before = resampler->left_taps - 1;  /* frames needed before srcindex. */
+    const int after = resampler->taps - resampler->left_taps;  /* frames needed after srcindex. */
+
+    switch (run->pass) {
+        case 0:
+            ResamplerCopyFrames(resampler->edge, -before, before + before + after, chans, run->lpadding, run->rpadding, run->paddinglen, run->inbuf, run->inframes);
+            run->cursor.src = resampler->edge;
+            run->cursor.origin = 0;
+            break;
+        case 1:
+            run->cursor.src = run->inbuf;
+            run->cursor.origin = before;
+            break;
+        default:
+            ResamplerCopyFrames(resampler->edge, run->inframes - after - before, before + after + after, chans, run->lpadding, run->rpadding, run->paddinglen, run->inbuf, run->inframes);
+            run->cursor.src = resampler->edge;
+            run->cursor.origin = run->inframes - after;
+            break;
+    }
 }
 
+static int
+PolyphaseRunStopIndex(const SDL_PolyphaseRun *run)
+{
+    const SDL_AudioResampler *resampler = run->resampler;
+    switch (run->pass) {
+        case 0: return resampler->left_taps - 1;
+        case 1: return run->inframes - (resampler->taps - resampler->left_taps);
+        default: break;
+    }
+    return SDL_MAX_SINT32;
+}
+
+/* Returns the number of output frames this resample will produce. */
+static int
+SDL_PolyphaseRunInit(SDL_PolyphaseRun *run, SDL_AudioResampler *resampler, const int paddinglen,
+                     const float *lpadding, const float *rpadding,
+                     const float *inbuf, const int inbuflen, const int outbuflen)
+{
+    const int framelen = resampler->chans * (int)sizeof (float);
+    const int inframes = inbuflen / framelen;
+    const int wantedoutframes = (int) ((((Sint64) inframes) * resampler->phases) / resampler->step);
+    const int maxoutframes = outbuflen / framelen;
+
+    SDL_assert(paddinglen >= resampler->taps);
+
+    run->resampler = resampler;
+    run->lpadding = lpadding;
+    run->rpadding = rpadding;
+    run->paddinglen = paddinglen;
+    run->inbuf = inbuf;
+    run->inframes = inframes;
+    run->outframes = SDL_min(wantedoutframes, maxoutframes);
+    run->pass = 0;
+    run->cursor.srcindex = 0;
+    run->cursor.phase = 0;
+    PolyphaseRunStartPass(run);
+    return run->outframes;
+}
+
+/* Writes up to (frames) output frames to dst, returns how many it wrote. */
+static int
+SDL_PolyphaseRunFrames(SDL_PolyphaseRun *run, float *dst, const int frames)
+{
+    const int wanted = SDL_min(frames, run->outframes);
+
+    run->cursor.dst = dst;
+    run->cursor.frames = wanted;
+    while (run->cursor.frames > 0) {
+        const int stopindex = PolyphaseRunStopIndex(run);
+        run->resampler->func(run->resampler, &run->cursor, stopindex);
+        if (run->cursor.srcindex >= stopindex) {
+            if (run->pass == 2) {
+                break;  /* shouldn't happen, the last pass never stops early. */
+            }
+            run->pass++;
+            PolyphaseRunStartPass(run);
+        }
+    }
+
+    SDL_assert(run->cursor.frames == 0);
+    run->outframes -= wanted;
+    return wanted;
+}
+
+/* Same contract as SDL_ResampleAudio(). */
+static int
+SDL_ResamplePolyphase(SDL_AudioResampler *resampler, const int paddinglen,
+                      const float *lpadding, const float *rpadding,
+                      const float *inbuf, const int inbuflen,
+                      float *outbuf, const int outbuflen)
+{
+    SDL_PolyphaseRun run;
+    const int outframes = SDL_PolyphaseRunInit(&run, resampler, paddinglen, lpadding, rpadding, inbuf, inbuflen, outbuflen);
+    SDL_PolyphaseRunFrames(&run, outbuf, outframes);
+    return outframes * resampler->chans * (int)sizeof (float);
+}
+
+static SDL_bool SDL_ConvertAudioChunked(SDL_AudioCVT *cvt);
+
 int
 SDL_ConvertAudio(SDL_AudioCVT * cvt)
 {
@@ -270,12 +1203,43 @@ SDL_ConvertAudio(SDL_AudioCVT * cvt)
         return 0;
     }
 
+    /* Large buffers go through the filters a chunk at a time, while it's in cache. */
+    if (SDL_ConvertAudioChunked(cvt)) {
+        return 0;
+    }
+
     /* Set up the conversion and go! */
     cvt->filter_index = 0;
     cvt->filters[0] (cvt, cvt->src_format);
     return 0;
 }
 
+int
+SDL_DecodeG711(SDL_G711Law law, const void *src, Sint16 *dst, int samples)
+{
+    if (src == NULL) {
+        return SDL_InvalidParamError("src");
+    } else if (dst == NULL) {
+        return SDL_InvalidParamError("dst");
+    } else if (samples < 0) {
+        return SDL_InvalidParamError("samples");
+    }
+
+    SDL_ChooseAudioConverters();
+
+    switch (law) {
+    case SDL_G711_ULAW:
+        SDL_Convert_ULaw_to_S16((const Uint8 *) src, dst, (size_t) samples);
+        break;
+    case SDL_G711_ALAW:
+        SDL_Convert_ALaw_to_S16((const Uint8 *) src, dst, (size_t) samples);
+        break;
+    default:
+        return SDL_InvalidParamError("law");
+    }
+    return 0;
+}
+
 static void SDLCALL
 SDL_Convert_Byteswap(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
@@ -418,6 +1382,74 @@ SDL_BuildAudioTypeCVTFromFloat(SDL_AudioCVT *cvt, const SDL_AudioFormat dst_fmt)
     return retval;
 }
 
+/* For format-only conversions between integer formats: go through
+   AUDIO_S16SYS instead of float. This is exact, since only AUDIO_S32 has
+   more than 16 bits, and S32 to S32 doesn't need converting at all. */
+static int
+SDL_BuildAudioTypeCVTInteger(SDL_AudioCVT *cvt, const SDL_AudioFormat src_fmt, const SDL_AudioFormat dst_fmt)
+{
+    SDL_AudioFilter to_s16 = NULL;
+    SDL_AudioFilter from_s16 = NULL;
+
+    SDL_assert(!SDL_AUDIO_ISFLOAT(src_fmt) && !SDL_AUDIO_ISFLOAT(dst_fmt));
+
+    switch (src_fmt & ~SDL_AUDIO_MASK_ENDIAN) {
+        case AUDIO_S8: to_s16 = SDL_Convert_S8_to_S16; break;
+        case AUDIO_U8: to_s16 = SDL_Convert_U8_to_S16; break;
+        case AUDIO_S16: break;
+        case AUDIO_U16: to_s16 = SDL_Convert_U16_to_S16; break;
+        case AUDIO_S32: to_s16 = SDL_Convert_S32_to_S16; break;
+        default: return SDL_SetError("No conversion from source format to AUDIO_S16 available");
+    }
+
+    switch (dst_fmt & ~SDL_AUDIO_MASK_ENDIAN) {
+        case AUDIO_S8: from_s16 = SDL_Convert_S16_to_S8; break;
+        case AUDIO_U8: from_s16 = SDL_Convert_S16_to_U8; break;
+        case AUDIO_S16: break;
+        case AUDIO_U16: from_s16 = SDL_Convert_S16_to_U16; break;
+        case AUDIO_S32: from_s16 = SDL_Convert_S16_to_S32; break;
+        default: return SDL_SetError("No conversion from AUDIO_S16 to format 0x%.4x available", dst_fmt);
+    }
+
+    if ((SDL_AUDIO_ISBIGENDIAN(src_fmt) != 0) == (SDL_BYTEORDER == SDL_LIL_ENDIAN) && SDL_AUDIO_BITSIZE(src_fmt) > 8) {
+        if (SDL_AddAudioCVTFilter(cvt, SDL_Convert_Byteswap) < 0) {
+            return -1;
+        }
+    }
+
+    if (to_s16) {
+        if (SDL_AddAudioCVTFilter(cvt, to_s16) < 0) {
+            return -1;
+        }
+        if (SDL_AUDIO_BITSIZE(src_fmt) == 8) {
+            cvt->len_mult *= 2;
+            cvt->len_ratio *= 2;
+        } else if (SDL_AUDIO_BITSIZE(src_fmt) == 32) {
+            cvt->len_ratio /= 2;
+        }
+    }
+
+    if (from_s16) {
+        if (SDL_AddAudioCVTFilter(cvt, from_s16) < 0) {
+            return -1;
+        }
+        if (SDL_AUDIO_BITSIZE(dst_fmt) == 32) {
+            cvt->len_mult *= 2;
+            cvt->len_ratio *= 2;
+        } else if (SDL_AUDIO_BITSIZE(dst_fmt) == 8) {
+            cvt->len_ratio /= 2;
+        }
+    }
+
+    if ((SDL_AUDIO_ISBIGENDIAN(dst_fmt) != 0) == (SDL_BYTEORDER == SDL_LIL_ENDIAN) && SDL_AUDIO_BITSIZE(dst_fmt) > 8) {
+        if (SDL_AddAudioCVTFilter(cvt, SDL_Convert_Byteswap) < 0) {
+            return -1;
+        }
+    }
+
+    return 1;  /* added a converter. */
+}
+
 static void
 SDL_ResampleCVT(SDL_AudioCVT *cvt, const int chans, const SDL_AudioFormat format)
 {
@@ -436,6 +1468,8 @@ SDL_ResampleCVT(SDL_AudioCVT *cvt, const int chans, const SDL_AudioFormat format
     const int requestedpadding = ResamplerPadding(inrate, outrate);
     int paddingsamples;
     float *padding;
+    SDL_ResamplerFilter filter;
+    SDL_AudioResampler *resampler;
 
     if (requestedpadding < SDL_MAX_SINT32 / chans) {
         paddingsamples = requestedpadding * chans;
@@ -451,7 +1485,14 @@ SDL_ResampleCVT(SDL_AudioCVT *cvt, const int chans, const SDL_AudioFormat format
         return;
     }
 
-    cvt->len_cvt = SDL_ResampleAudio(chans, inrate, outrate, padding, padding, src, srclen, dst, dstlen);
+    ResamplerSetupFilter(&filter, SDL_AUDIO_RESAMPLE_DEFAULT, inrate, outrate);
+    resampler = paddingsamples ? SDL_CreateAudioResampler(&filter, chans, inrate, outrate) : NULL;
+    if (resampler) {
+        cvt->len_cvt = SDL_ResamplePolyphase(resampler, requestedpadding, padding, padding, src, srclen, dst, dstlen);
+        SDL_DestroyAudioResampler(resampler);
+    } else {
+        cvt->len_cvt = SDL_ResampleAudio(&filter, chans, inrate, outrate, padding, padding, src, srclen, dst, dstlen);
+    }
 
     SDL_free(padding);
 
@@ -478,19 +1519,257 @@ RESAMPLER_FUNCS(6)
 RESAMPLER_FUNCS(8)
 #undef RESAMPLER_FUNCS
 
-static SDL_AudioFilter
-ChooseCVTResampler(const int dst_channels)
-{
-    switch (dst_channels) {
-        case 1: return SDL_ResampleCVT_c1;
-        case 2: return SDL_ResampleCVT_c2;
-        case 4: return SDL_ResampleCVT_c4;
-        case 6: return SDL_ResampleCVT_c6;
-        case 8: return SDL_ResampleCVT_c8;
-        default: break;
+static SDL_AudioFilter
+ChooseCVTResampler(const int dst_channels)
+{
+    switch (dst_channels) {
+        case 1: return SDL_ResampleCVT_c1;
+        case 2: return SDL_ResampleCVT_c2;
+        case 4: return SDL_ResampleCVT_c4;
+        case 6: return SDL_ResampleCVT_c6;
+        case 8: return SDL_ResampleCVT_c8;
+        default: break;
+    }
+
+    return NULL;
+}
+
+/* SDL_ConvertAudio() can run the whole filter chain over small chunks of the
+   buffer, instead of making a full pass over it for every filter, as long as
+   it knows what every filter does. Byteswaps, type conversions and channel
+   conversions only touch one sample frame at a time, so they can be run on
+   a chunk copied into a scratch buffer that stays in cache; the resampler
+   needs the whole input, but its output can be pulled a chunk at a time and
+   sent through the rest of the chain before it's stored. */
+
+/* Input chunks are a multiple of every possible sample frame size (1-8
+   channels of 1, 2 or 4 byte samples), so they never split a frame. */
+#define CVT_CHUNK_BYTES (840 * 4)
+
+/* Buffers smaller than this get converted in one pass per filter. */
+#define CVT_CHUNKED_MIN_BYTES (CVT_CHUNK_BYTES * 4)
+
+/* Scratch space for a chunk on its way through the filters. */
+#define CVT_SCRATCH_BYTES (16 * 1024)
+
+static SDL_bool
+IsFrameLocalCVTFilter(const SDL_AudioFilter filter)
+{
+    int i, j;
+
+    if ((filter == SDL_Convert_Byteswap) ||
+        (filter == SDL_Convert_S8_to_F32) || (filter == SDL_Convert_U8_to_F32) ||
+        (filter == SDL_Convert_S16_to_F32) || (filter == SDL_Convert_U16_to_F32) ||
+        (filter == SDL_Convert_S32_to_F32) ||
+        (filter == SDL_Convert_F32_to_S8) || (filter == SDL_Convert_F32_to_U8) ||
+        (filter == SDL_Convert_F32_to_S16) || (filter == SDL_Convert_F32_to_U16) ||
+        (filter == SDL_Convert_F32_to_S32) ||
+        (filter == SDL_Convert_S8_to_S16) || (filter == SDL_Convert_U8_to_S16) ||
+        (filter == SDL_Convert_U16_to_S16) || (filter == SDL_Convert_S32_to_S16) ||
+        (filter == SDL_Convert_S16_to_S8) || (filter == SDL_Convert_S16_to_U8) ||
+        (filter == SDL_Convert_S16_to_U16) || (filter == SDL_Convert_S16_to_S32)) {
+        return SDL_TRUE;
+    }
+
+    #if HAVE_SSE3_INTRINSICS
+    if (filter == SDL_ConvertStereoToMono_SSE3) {
+        return SDL_TRUE;
+    }
+    #endif
+    #if HAVE_SSE_INTRINSICS
+    if (filter == SDL_ConvertMonoToStereo_SSE) {
+        return SDL_TRUE;
+    }
+    #endif
+
+    for (i = 0; i < (int) SDL_arraysize(channel_converters); i++) {
+        for (j = 0; j < (int) SDL_arraysize(channel_converters[i]); j++) {
+            if (filter == channel_converters[i][j]) {
+                return SDL_TRUE;
+            }
+            #if HAVE_SSE_INTRINSICS
+            if (filter == channel_converters_SSE[i][j]) {
+                return SDL_TRUE;
+            }
+            #endif
+            #if HAVE_AVX_INTRINSICS
+            if (filter == channel_converters_AVX[i][j]) {
+                return SDL_TRUE;
+            }
+            #endif
+            #if HAVE_NEON_INTRINSICS
+            if (filter == channel_converters_NEON[i][j]) {
+                return SDL_TRUE;
+            }
+            #endif
+        }
+    }
+
+    return SDL_FALSE;
+}
+
+static int
+CVTResamplerChannels(const SDL_AudioFilter filter)
+{
+    if (filter == SDL_ResampleCVT_c1) {
+        return 1;
+    } else if (filter == SDL_ResampleCVT_c2) {
+        return 2;
+    } else if (filter == SDL_ResampleCVT_c4) {
+        return 4;
+    } else if (filter == SDL_ResampleCVT_c6) {
+        return 6;
+    } else if (filter == SDL_ResampleCVT_c8) {
+        return 8;
+    }
+    return 0;
+}
+
+/* Run (count) filters of (cvt), starting at (first), over buf. Returns the converted length. */
+static int
+RunCVTFilters(const SDL_AudioCVT *cvt, const int first, const int count,
+              const SDL_AudioFormat format, Uint8 *buf, const int len)
+{
+    SDL_AudioCVT sub;
+
+    SDL_zero(sub);
+    SDL_memcpy(sub.filters, &cvt->filters[first], count * sizeof (SDL_AudioFilter));
+    sub.src_format = format;
+    sub.dst_format = cvt->dst_format;
+    sub.buf = buf;
+    sub.len = len;
+    sub.len_cvt = len;
+    sub.len_mult = cvt->len_mult;
+    sub.filters[0](&sub, format);
+    return sub.len_cvt;
+}
+
+/* Run frame-local filters over all of buf, in place, a chunk at a time.
+   (ratio) is how much those filters grow or shrink the data. */
+static int
+ConvertAudioChunked(const SDL_AudioCVT *cvt, const int first, const int count,
+                    const SDL_AudioFormat format, Uint8 *buf, const int len,
+                    const double ratio, Uint8 *scratch)
+{
+    const int chunks = (len + CVT_CHUNK_BYTES - 1) / CVT_CHUNK_BYTES;
+    /* a chunk is whole frames, so every full one comes out exactly this long. */
+    const int chunklen = (int) ((CVT_CHUNK_BYTES * ratio) + 0.5);
+    int outlen = 0;
+    int i;
+
+    /* Chunks are stored at their final position as soon as they're
+       converted, so if the data grows we have to go backwards, like the
+       filters themselves do, to avoid overwriting input we haven't read yet. */
+    for (i = 0; i < chunks; i++) {
+        const int chunk = (chunklen > CVT_CHUNK_BYTES) ? (chunks - 1 - i) : i;
+        const int offset = chunk * CVT_CHUNK_BYTES;
+        const int inlen = SDL_min(CVT_CHUNK_BYTES, len - offset);
+        int convertedlen;
+        SDL_memcpy(scratch, buf + offset, inlen);
+        convertedlen = RunCVTFilters(cvt, first, count, format, scratch, inlen);
+        SDL_assert((inlen < CVT_CHUNK_BYTES) || (convertedlen == chunklen));
+        SDL_memcpy(buf + (chunk * chunklen), scratch, convertedlen);
+        outlen += convertedlen;
+    }
+
+    return outlen;
+}
+
+/* Returns SDL_FALSE if (cvt) has to be run one filter at a time. */
+static SDL_bool
+SDL_ConvertAudioChunked(SDL_AudioCVT *cvt)
+{
+    const int inrate = (int) (size_t) cvt->filters[SDL_AUDIOCVT_MAX_FILTERS-1];
+    const int outrate = (int) (size_t) cvt->filters[SDL_AUDIOCVT_MAX_FILTERS];
+    int numfilters = 0;
+    int resampler_index = -1;
+    int chans = 0;
+    int scratchlen;
+    Uint8 *scratch;
+    int i;
+
+    if (cvt->len < CVT_CHUNKED_MIN_BYTES) {
+        return SDL_FALSE;
+    }
+
+    for (i = 0; (i < SDL_AUDIOCVT_MAX_FILTERS) && cvt->filters[i]; i++) {
+        const int resampler_chans = CVTResamplerChannels(cvt->filters[i]);
+        if (resampler_chans && (resampler_index == -1)) {
+            resampler_index = i;
+            chans = resampler_chans;
+        } else if (!IsFrameLocalCVTFilter(cvt->filters[i])) {
+            return SDL_FALSE;  /* an app-supplied filter (or something new); leave it alone. */
+        }
+        numfilters++;
+    }
+
+    if (numfilters < 2) {
+        return SDL_FALSE;  /* it's one pass either way. */
+    }
+
+    scratchlen = SDL_max(CVT_SCRATCH_BYTES, CVT_CHUNK_BYTES * cvt->len_mult);
+    scratch = (Uint8 *) SDL_SIMDAlloc(scratchlen);
+    if (!scratch) {
+        return SDL_FALSE;  /* the slow way still works. */
+    }
+
+    if (resampler_index == -1) {
+        cvt->len_cvt = ConvertAudioChunked(cvt, 0, numfilters, cvt->src_format, cvt->buf, cvt->len, cvt->len_ratio, scratch);
+    } else {
+        /* the resampler and the conversion from float after it make up the rest of len_ratio. */
+        const double preratio = cvt->len_ratio / ((((double) outrate) / ((double) inrate)) * (SDL_AUDIO_BITSIZE(cvt->dst_format) / 32.0));
+        const int framelen = chans * (int) sizeof (float);
+        const int srclen = (resampler_index > 0) ? ConvertAudioChunked(cvt, 0, resampler_index, cvt->src_format, cvt->buf, cvt->len, preratio, scratch) : cvt->len;
+        const int postfilters = numfilters - resampler_index - 1;
+        const int requestedpadding = ResamplerPadding(inrate, outrate);
+        SDL_AudioResampler *resampler = NULL;
+        SDL_ResamplerFilter filter;
+        float *padding = NULL;
+
+        if (requestedpadding < SDL_MAX_SINT32 / chans) {
+            ResamplerSetupFilter(&filter, SDL_AUDIO_RESAMPLE_DEFAULT, inrate, outrate);
+            padding = (float *) SDL_calloc(requestedpadding * chans, sizeof (float));
+            resampler = padding ? SDL_CreateAudioResampler(&filter, chans, inrate, outrate) : NULL;
+        }
+
+        if (resampler) {
+            /* The input is still needed while the output is being written,
+               so, like SDL_ResampleCVT(), write it after the input and move it
+               into place at the end. */
+            Uint8 *dst = cvt->buf + srclen;
+            const int dstlen = (cvt->len * cvt->len_mult) - srclen;
+            const int chunkframes = scratchlen / framelen;
+            SDL_PolyphaseRun run;
+            int outlen = 0;
+
+            SDL_PolyphaseRunInit(&run, resampler, requestedpadding, padding, padding, (const float *) cvt->buf, srclen, dstlen);
+            while (run.outframes > 0) {
+                if (postfilters == 0) {
+                    outlen += SDL_PolyphaseRunFrames(&run, (float *) (dst + outlen), chunkframes) * framelen;
+                } else {
+                    const int frames = SDL_PolyphaseRunFrames(&run, (float *) scratch, chunkframes);
+                    const int convertedlen = RunCVTFilters(cvt, resampler_index + 1, postfilters, AUDIO_F32SYS, scratch, frames * framelen);
+                    SDL_memcpy(dst + outlen, scratch, convertedlen);
+                    outlen += convertedlen;
+                }
+            }
+
+            SDL_DestroyAudioResampler(resampler);
+            SDL_memmove(cvt->buf, dst, outlen);
+            cvt->len_cvt = outlen;
+        } else {
+            /* no polyphase table for this ratio; finish up one filter at a time. */
+            cvt->len_cvt = srclen;
+            cvt->filter_index = resampler_index;
+            cvt->filters[resampler_index](cvt, AUDIO_F32SYS);
+        }
+
+        SDL_free(padding);
     }
 
-    return NULL;
+    cvt->filter_index = numfilters;
+    SDL_SIMDFree(scratch);
+    return SDL_TRUE;
 }
 
 static int
@@ -639,9 +1918,10 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
         - byteswap back to foreign format if necessary.
 
        The expectation is we can process data faster in float32
-       (possibly with SIMD), and making several passes over the same
-       buffer is likely to be CPU cache-friendly, avoiding the
-       biggest performance hit in modern times. Previously we had
+       (possibly with SIMD), and SDL_ConvertAudio() runs large buffers
+       through all the passes a chunk at a time, so it stays CPU
+       cache-friendly, avoiding the biggest performance hit in modern
+       times. Previously we had
        (script-generated) custom converters for every data type and
        it was a bloat on SDL compile times and final library size. */
 
@@ -662,6 +1942,15 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
             cvt->needed = 1;
             return 1;
         }
+
+        /* integer to integer doesn't need to go through float. */
+        if (!SDL_AUDIO_ISFLOAT(src_fmt) && !SDL_AUDIO_ISFLOAT(dst_fmt)) {
+            if (SDL_BuildAudioTypeCVTInteger(cvt, src_fmt, dst_fmt) < 0) {
+                return -1;
+            }
+            cvt->needed = 1;
+            return 1;
+        }
     }
 
     /* Convert data types, if necessary. Updates (cvt). */
@@ -681,20 +1970,27 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
         /* All combinations of supported channel counts should have been handled by now, but let's be defensive */
         return SDL_SetError("Invalid channel combination");
     } else if (channel_converter != NULL) {
-        /* swap in some SIMD versions for a few of these. */
+        /* swap in SIMD versions: the hand-written ones first, then the generated matrix kernels. */
+        SDL_AudioFilter filter = NULL;
         if (channel_converter == SDL_ConvertStereoToMono) {
-            SDL_AudioFilter filter = NULL;
             #if HAVE_SSE3_INTRINSICS
             if (!filter && SDL_HasSSE3()) { filter = SDL_ConvertStereoToMono_SSE3; }
             #endif
-            if (filter) { channel_converter = filter; }
         } else if (channel_converter == SDL_ConvertMonoToStereo) {
-            SDL_AudioFilter filter = NULL;
             #if HAVE_SSE_INTRINSICS
             if (!filter && SDL_HasSSE()) { filter = SDL_ConvertMonoToStereo_SSE; }
             #endif
-            if (filter) { channel_converter = filter; }
         }
+        #if HAVE_AVX_INTRINSICS
+        if (!filter && SDL_HasAVX()) { filter = channel_converters_AVX[src_channels-1][dst_channels-1]; }
+        #endif
+        #if HAVE_SSE_INTRINSICS
+        if (!filter && SDL_HasSSE()) { filter = channel_converters_SSE[src_channels-1][dst_channels-1]; }
+        #endif
+        #if HAVE_NEON_INTRINSICS
+        if (!filter && SDL_HasNEON()) { filter = channel_converters_NEON[src_channels-1][dst_channels-1]; }
+        #endif
+        if (filter) { channel_converter = filter; }
 
         if (SDL_AddAudioCVTFilter(cvt, channel_converter) < 0) {
             return -1;
@@ -722,6 +2018,133 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
     return (cvt->needed);
 }
 
+/* Channel mixing matrices for SDL_AudioStreamSetChannelMatrix(). These mix
+   one sample frame at a time: every input channel is broadcast, multiplied
+   by its column of gains (padded out to eight outputs) and summed, so all of
+   the outputs come out of one or two registers. Like the channel converters,
+   they work in-place, so they walk backwards when the data grows, and read
+   each whole frame before writing any of it. */
+#define CHANNEL_MATRIX_STRIDE 8
+
+typedef void (*SDL_ChannelMatrixFunc)(const float *columns, const int src_channels, const int dst_channels, float *buf, const int frames);
+
+static void
+SDL_MixChannelMatrix_Scalar(const float *columns, const int src_channels, const int dst_channels, float *buf, const int frames)
+{
+    const int backwards = (dst_channels > src_channels);
+    const int srcstep = backwards ? -src_channels : src_channels;
+    const int dststep = backwards ? -dst_channels : dst_channels;
+    const float *src = buf + (backwards ? ((frames - 1) * src_channels) : 0);
+    float *dst = buf + (backwards ? ((frames - 1) * dst_channels) : 0);
+    int i, j, k;
+
+    for (i = frames; i; i--, src += srcstep, dst += dststep) {
+        float mixed[CHANNEL_MATRIX_STRIDE];
+        SDL_zeroa(mixed);
+        for (j = 0; j < src_channels; j++) {
+            const float *column = columns + (j * CHANNEL_MATRIX_STRIDE);
+            const float sample = src[j];
+            for (k = 0; k < dst_channels; k++) {
+                mixed[k] += sample * column[k];
+            }
+        }
+        SDL_memcpy(dst, mixed, dst_channels * sizeof (float));
+    }
+}
+
+#if HAVE_SSE_INTRINSICS
+static void
+SDL_MixChannelMatrix_SSE(const float *columns, const int src_channels, const int dst_channels, float *buf, const int frames)
+{
+    const int backwards = (dst_channels > src_channels);
+    const int srcstep = backwards ? -src_channels : src_channels;
+    const int dststep = backwards ? -dst_channels : dst_channels;
+    const float *src = buf + (backwards ? ((frames - 1) * src_channels) : 0);
+    float *dst = buf + (backwards ? ((frames - 1) * dst_channels) : 0);
+    int i, j;
+
+    if (dst_channels > 4) {
+        for (i = frames; i; i--, src += srcstep, dst += dststep) {
+            __m128 lo = _mm_setzero_ps();
+            __m128 hi = _mm_setzero_ps();
+            for (j = 0; j < src_channels; j++) {
+                const __m128 sample = _mm_set1_ps(src[j]);
+                lo = _mm_add_ps(lo, _mm_mul_ps(sample, _mm_loadu_ps(columns + (j * CHANNEL_MATRIX_STRIDE))));
+                hi = _mm_add_ps(hi, _mm_mul_ps(sample, _mm_loadu_ps(columns + (j * CHANNEL_MATRIX_STRIDE) + 4)));
+            }
+            _mm_storeu_ps(dst, lo);
+            SDL_StoreChannels_SSE(dst + 4, hi, dst_channels - 4);
+        }
+    } else {
+        for (i = frames; i; i--, src += srcstep, dst += dststep) {
+            __m128 mixed = _mm_setzero_ps();
+            for (j = 0; j < src_channels; j++) {
+                mixed = _mm_add_ps(mixed, _mm_mul_ps(_mm_set1_ps(src[j]), _mm_loadu_ps(columns + (j * CHANNEL_MATRIX_STRIDE))));
+            }
+            SDL_StoreChannels_SSE(dst, mixed, dst_channels);
+        }
+    }
+}
+#endif
+
+#if HAVE_AVX_INTRINSICS
+static void SDL_TARGETING("avx")
+SDL_MixChannelMatrix_AVX(const float *columns, const int src_channels, const int dst_channels, float *buf, const int frames)
+{
+    static const int store_masks[CHANNEL_MATRIX_STRIDE * 2] = { -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0 };
+    const __m256i mask = _mm256_loadu_si256((const __m256i *) (store_masks + (CHANNEL_MATRIX_STRIDE - dst_channels)));
+    const int backwards = (dst_channels > src_channels);
+    const int srcstep = backwards ? -src_channels : src_channels;
+    const int dststep = backwards ? -dst_channels : dst_channels;
+    const float *src = buf + (backwards ? ((frames - 1) * src_channels) : 0);
+    float *dst = buf + (backwards ? ((frames - 1) * dst_channels) : 0);
+    int i, j;
+
+    for (i = frames; i; i--, src += srcstep, dst += dststep) {
+        __m256 mixed = _mm256_setzero_ps();
+        for (j = 0; j < src_channels; j++) {
+            mixed = _mm256_add_ps(mixed, _mm256_mul_ps(_mm256_broadcast_ss(src + j), _mm256_loadu_ps(columns + (j * CHANNEL_MATRIX_STRIDE))));
+        }
+        _mm256_maskstore_ps(dst, mask, mixed);  /* masked, so we don't write past this frame. */
+    }
+}
+#endif
+
+#if HAVE_NEON_INTRINSICS
+static void
+SDL_MixChannelMatrix_NEON(const float *columns, const int src_channels, const int dst_channels, float *buf, const int frames)
+{
+    const int backwards = (dst_channels > src_channels);
+    const int srcstep = backwards ? -src_channels : src_channels;
+    const int dststep = backwards ? -dst_channels : dst_channels;
+    const float *src = buf + (backwards ? ((frames - 1) * src_channels) : 0);
+    float *dst = buf + (backwards ? ((frames - 1) * dst_channels) : 0);
+    int i, j;
+
+    if (dst_channels > 4) {
+        for (i = frames; i; i--, src += srcstep, dst += dststep) {
+            float32x4_t lo = vdupq_n_f32(0.0f);
+            float32x4_t hi = vdupq_n_f32(0.0f);
+            for (j = 0; j < src_channels; j++) {
+                const float sample = src[j];
+                lo = vaddq_f32(lo, vmulq_n_f32(vld1q_f32(columns + (j * CHANNEL_MATRIX_STRIDE)), sample));
+                hi = vaddq_f32(hi, vmulq_n_f32(vld1q_f32(columns + (j * CHANNEL_MATRIX_STRIDE) + 4), sample));
+            }
+            vst1q_f32(dst, lo);
+            SDL_StoreChannels_NEON(dst + 4, hi, dst_channels - 4);
+        }
+    } else {
+        for (i = frames; i; i--, src += srcstep, dst += dststep) {
+            float32x4_t mixed = vdupq_n_f32(0.0f);
+            for (j = 0; j < src_channels; j++) {
+                mixed = vaddq_f32(mixed, vmulq_n_f32(vld1q_f32(columns + (j * CHANNEL_MATRIX_STRIDE)), src[j]));
+            }
+            SDL_StoreChannels_NEON(dst, mixed, dst_channels);
+        }
+    }
+}
+#endif
+
 typedef int (*SDL_ResampleAudioStreamFunc)(SDL_AudioStream *stream, const void *inbuf, const int inbuflen, void *outbuf, const int outbuflen);
 typedef void (*SDL_ResetAudioStreamResamplerFunc)(SDL_AudioStream *stream);
 typedef void (*SDL_CleanupAudioStreamResamplerFunc)(SDL_AudioStream *stream);
@@ -751,9 +2174,16 @@ struct _SDL_AudioStream
     int resampler_padding_samples;
     float *resampler_padding;
     void *resampler_state;
+    SDL_ResamplerFilter resampler_filter;
+    SDL_AudioResampler *polyphase;
     SDL_ResampleAudioStreamFunc resampler_func;
     SDL_ResetAudioStreamResamplerFunc reset_resampler_func;
     SDL_CleanupAudioStreamResamplerFunc cleanup_resampler_func;
+    Uint8 *put_span;  /* caller-visible input buffer for SDL_AudioStreamBeginPut() on converting streams. */
+    int put_span_size;
+    int put_span_len;  /* bytes handed out by SDL_AudioStreamBeginPut(), zero if no put in progress. */
+    float *channel_matrix;  /* src_channels columns of CHANNEL_MATRIX_STRIDE gains, NULL for the built-in conversion. */
+    SDL_ChannelMatrixFunc channel_matrix_func;
 };
 
 static Uint8 *
@@ -880,7 +2310,11 @@ SDL_ResampleAudioStream(SDL_AudioStream *stream, const void *_inbuf, const int i
 
     SDL_assert(inbuf != ((const float *) outbuf));  /* SDL_AudioStreamPut() shouldn't allow in-place resamples. */
 
-    retval = SDL_ResampleAudio(chans, inrate, outrate, lpadding, rpadding, inbuf, inbuflen, outbuf, outbuflen);
+    if (stream->polyphase) {
+        retval = SDL_ResamplePolyphase(stream->polyphase, paddingsamples / chans, lpadding, rpadding, inbuf, inbuflen, outbuf, outbuflen);
+    } else {
+        retval = SDL_ResampleAudio(&stream->resampler_filter, chans, inrate, outrate, lpadding, rpadding, inbuf, inbuflen, outbuf, outbuflen);
+    }
 
     /* update our left padding with end of current input, for next run. */
     SDL_memcpy((lpadding + paddingsamples) - (cpy / sizeof (float)), inbufend - cpy, cpy);
@@ -899,6 +2333,75 @@ static void
 SDL_CleanupAudioStreamResampler(SDL_AudioStream *stream)
 {
     SDL_free(stream->resampler_state);
+    SDL_DestroyAudioResampler(stream->polyphase);
+    stream->resampler_state = NULL;
+    stream->polyphase = NULL;
+}
+
+static SDL_bool
+SetupInternalResampling(SDL_AudioStream *stream, const SDL_AudioResampleQuality quality)
+{
+    stream->resampler_state = SDL_calloc(stream->resampler_padding_samples, sizeof (float));
+    if (!stream->resampler_state) {
+        SDL_OutOfMemory();
+        return SDL_FALSE;
+    }
+
+    stream->resampler_func = SDL_ResampleAudioStream;
+    stream->reset_resampler_func = SDL_ResetAudioStreamResampler;
+    stream->cleanup_resampler_func = SDL_CleanupAudioStreamResampler;
+
+    /* NULL is fine here, SDL_ResampleAudioStream() will do it the slow way. */
+    ResamplerSetupFilter(&stream->resampler_filter, quality, stream->src_rate, stream->dst_rate);
+    stream->polyphase = SDL_CreateAudioResampler(&stream->resampler_filter, stream->pre_resample_channels, stream->src_rate, stream->dst_rate);
+    return SDL_TRUE;
+}
+
+/* The conversions on either side of the resampler. With a channel matrix,
+   these only convert to and from Float32, and the matrix does the channels
+   in between: before resampling if it makes fewer channels, after if it
+   makes more, same as SDL_BuildAudioCVT's channel converters would. */
+static int
+BuildAudioStreamCVTs(const SDL_AudioStream *stream, const SDL_bool with_matrix, SDL_AudioCVT *before, SDL_AudioCVT *after)
+{
+    if (with_matrix) {
+        if (SDL_BuildAudioCVT(before, stream->src_format, stream->src_channels, stream->src_rate, AUDIO_F32SYS, stream->src_channels, stream->src_rate) < 0) {
+            return -1;
+        }
+        return SDL_BuildAudioCVT(after, AUDIO_F32SYS, stream->dst_channels, stream->dst_rate, stream->dst_format, stream->dst_channels, stream->dst_rate);
+    }
+
+    /* Not resampling? It's an easy conversion (and maybe not even that!) */
+    if (stream->src_rate == stream->dst_rate) {
+        before->needed = SDL_FALSE;
+        return SDL_BuildAudioCVT(after, stream->src_format, stream->src_channels, stream->dst_rate, stream->dst_format, stream->dst_channels, stream->dst_rate);
+    }
+
+    /* Don't resample at first. Just get us to Float32 format. */
+    /* !!! FIXME: convert to int32 on devices without hardware float. */
+    if (SDL_BuildAudioCVT(before, stream->src_format, stream->src_channels, stream->src_rate, AUDIO_F32SYS, stream->pre_resample_channels, stream->src_rate) < 0) {
+        return -1;
+    }
+
+    /* Convert us to the final format after resampling. */
+    return SDL_BuildAudioCVT(after, AUDIO_F32SYS, stream->pre_resample_channels, stream->dst_rate, stream->dst_format, stream->dst_channels, stream->dst_rate);
+}
+
+static SDL_bool
+MixChannelsAfterResampling(const SDL_AudioStream *stream)
+{
+    return ((stream->src_rate != stream->dst_rate) && (stream->dst_channels > stream->src_channels)) ? SDL_TRUE : SDL_FALSE;
+}
+
+/* runs the channel matrix over len bytes of Float32 data in-place, returns the new length. */
+static int
+MixAudioStreamChannels(SDL_AudioStream *stream, Uint8 *buf, const int len)
+{
+    const int frames = len / (stream->src_channels * (int) sizeof (float));
+    if (frames > 0) {
+        stream->channel_matrix_func(stream->channel_matrix, stream->src_channels, stream->dst_channels, (float *) buf, frames);
+    }
+    return frames * stream->dst_channels * (int) sizeof (float);
 }
 
 SDL_AudioStream *
@@ -909,7 +2412,9 @@ SDL_NewAudioStream(const SDL_AudioFormat src_format,
                    const Uint8 dst_channels,
                    const int dst_rate)
 {
-    const int packetlen = 4096;  /* !!! FIXME: good enough for now. */
+    const int dst_sample_frame_size = (SDL_AUDIO_BITSIZE(dst_format) / 8) * dst_channels;
+    /* !!! FIXME: good enough for now. Whole frames, so a packet never splits one and SDL_AudioStreamBeginGet() always gets at least one. */
+    const int packetlen = dst_sample_frame_size ? (4096 - (4096 % dst_sample_frame_size)) : 4096;
     Uint8 pre_resample_channels;
     SDL_AudioStream *retval;
 
@@ -930,7 +2435,7 @@ SDL_NewAudioStream(const SDL_AudioFormat src_format,
     retval->src_format = src_format;
     retval->src_channels = src_channels;
     retval->src_rate = src_rate;
-    retval->dst_sample_frame_size = (SDL_AUDIO_BITSIZE(dst_format) / 8) * dst_channels;
+    retval->dst_sample_frame_size = dst_sample_frame_size;
     retval->dst_format = dst_format;
     retval->dst_channels = dst_channels;
     retval->dst_rate = dst_rate;
@@ -956,42 +2461,21 @@ SDL_NewAudioStream(const SDL_AudioFormat src_format,
         }
     }
 
-    /* Not resampling? It's an easy conversion (and maybe not even that!) */
-    if (src_rate == dst_rate) {
-        retval->cvt_before_resampling.needed = SDL_FALSE;
-        if (SDL_BuildAudioCVT(&retval->cvt_after_resampling, src_format, src_channels, dst_rate, dst_format, dst_channels, dst_rate) < 0) {
-            SDL_FreeAudioStream(retval);
-            return NULL;  /* SDL_BuildAudioCVT should have called SDL_SetError. */
-        }
-    } else {
-        /* Don't resample at first. Just get us to Float32 format. */
-        /* !!! FIXME: convert to int32 on devices without hardware float. */
-        if (SDL_BuildAudioCVT(&retval->cvt_before_resampling, src_format, src_channels, src_rate, AUDIO_F32SYS, pre_resample_channels, src_rate) < 0) {
-            SDL_FreeAudioStream(retval);
-            return NULL;  /* SDL_BuildAudioCVT should have called SDL_SetError. */
-        }
+    if (BuildAudioStreamCVTs(retval, SDL_FALSE, &retval->cvt_before_resampling, &retval->cvt_after_resampling) < 0) {
+        SDL_FreeAudioStream(retval);
+        return NULL;  /* SDL_BuildAudioCVT should have called SDL_SetError. */
+    }
 
+    if (src_rate != dst_rate) {
 #ifdef HAVE_LIBSAMPLERATE_H
         SetupLibSampleRateResampling(retval);
 #endif
 
         if (!retval->resampler_func) {
-            retval->resampler_state = SDL_calloc(retval->resampler_padding_samples, sizeof (float));
-            if (!retval->resampler_state) {
+            if (!SetupInternalResampling(retval, SDL_AUDIO_RESAMPLE_DEFAULT)) {
                 SDL_FreeAudioStream(retval);
-                SDL_OutOfMemory();
                 return NULL;
             }
-
-            retval->resampler_func = SDL_ResampleAudioStream;
-            retval->reset_resampler_func = SDL_ResetAudioStreamResampler;
-            retval->cleanup_resampler_func = SDL_CleanupAudioStreamResampler;
-        }
-
-        /* Convert us to the final format after resampling. */
-        if (SDL_BuildAudioCVT(&retval->cvt_after_resampling, AUDIO_F32SYS, pre_resample_channels, dst_rate, dst_format, dst_channels, dst_rate) < 0) {
-            SDL_FreeAudioStream(retval);
-            return NULL;  /* SDL_BuildAudioCVT should have called SDL_SetError. */
         }
     }
 
@@ -1004,6 +2488,95 @@ SDL_NewAudioStream(const SDL_AudioFormat src_format,
     return retval;
 }
 
+int
+SDL_AudioStreamSetResampleQuality(SDL_AudioStream *stream, SDL_AudioResampleQuality quality)
+{
+    SDL_ResamplerFilter filter;
+    SDL_AudioResampler *polyphase;
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+    if (((int) quality < (int) SDL_AUDIO_RESAMPLE_NEAREST) || ((int) quality > (int) SDL_AUDIO_RESAMPLE_BEST)) {
+        return SDL_InvalidParamError("quality");
+    }
+
+    if (stream->src_rate == stream->dst_rate) {
+        return 0;  /* not resampling, nothing to do. */
+    }
+
+    /* libsamplerate has its own idea of quality; switch over to ours.
+       Both keep the same padding, so buffered data carries over. */
+    if (stream->resampler_func != SDL_ResampleAudioStream) {
+        if (stream->cleanup_resampler_func) {
+            stream->cleanup_resampler_func(stream);
+        }
+        if (!SetupInternalResampling(stream, quality)) {
+            return -1;
+        }
+        return 0;
+    }
+
+    ResamplerSetupFilter(&filter, quality, stream->src_rate, stream->dst_rate);
+    polyphase = SDL_CreateAudioResampler(&filter, stream->pre_resample_channels, stream->src_rate, stream->dst_rate);
+    SDL_DestroyAudioResampler(stream->polyphase);
+    stream->polyphase = polyphase;
+    stream->resampler_filter = filter;
+    return 0;
+}
+
+int
+SDL_AudioStreamSetChannelMatrix(SDL_AudioStream *stream, const float *matrix)
+{
+    SDL_AudioCVT before, after;
+    SDL_ChannelMatrixFunc func = NULL;
+    float *columns = NULL;
+    int i, j;
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+    if (stream->put_span_len) {
+        return SDL_SetError("Can't change the channel matrix while SDL_AudioStreamBeginPut() is in progress");
+    }
+
+    SDL_zero(before);
+    SDL_zero(after);
+    if (BuildAudioStreamCVTs(stream, matrix ? SDL_TRUE : SDL_FALSE, &before, &after) < 0) {
+        return -1;
+    }
+
+    if (matrix) {
+        columns = (float *) SDL_calloc(stream->src_channels * CHANNEL_MATRIX_STRIDE, sizeof (float));
+        if (!columns) {
+            return SDL_OutOfMemory();
+        }
+        for (i = 0; i < stream->dst_channels; i++) {
+            for (j = 0; j < stream->src_channels; j++) {
+                columns[(j * CHANNEL_MATRIX_STRIDE) + i] = matrix[(i * stream->src_channels) + j];
+            }
+        }
+
+        #if HAVE_AVX_INTRINSICS
+        if (!func && SDL_HasAVX()) { func = SDL_MixChannelMatrix_AVX; }
+        #endif
+        #if HAVE_SSE_INTRINSICS
+        if (!func && SDL_HasSSE()) { func = SDL_MixChannelMatrix_SSE; }
+        #endif
+        #if HAVE_NEON_INTRINSICS
+        if (!func && SDL_HasNEON()) { func = SDL_MixChannelMatrix_NEON; }
+        #endif
+        if (!func) { func = SDL_MixChannelMatrix_Scalar; }
+    }
+
+    SDL_free(stream->channel_matrix);
+    stream->channel_matrix = columns;
+    stream->channel_matrix_func = func;
+    stream->cvt_before_resampling = before;
+    stream->cvt_after_resampling = after;
+    return 0;
+}
+
 static int
 SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf, int len, int *maxputbytes)
 {
@@ -1034,11 +2607,18 @@ SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf, int len, in
         workbuflen *= stream->cvt_before_resampling.len_mult;
     }
 
+    if (stream->channel_matrix && !MixChannelsAfterResampling(stream) && (stream->dst_channels > stream->src_channels)) {
+        workbuflen = ((workbuflen + (stream->src_channels - 1)) / stream->src_channels) * stream->dst_channels;
+    }
+
     if (stream->dst_rate != stream->src_rate) {
         /* resamples can't happen in place, so make space for second buf. */
         const int framesize = stream->pre_resample_channels * sizeof (float);
         const int frames = workbuflen / framesize;
         resamplebuflen = ((int) SDL_ceil(frames * stream->rate_incr)) * framesize;
+        if (stream->channel_matrix && MixChannelsAfterResampling(stream)) {
+            resamplebuflen = (resamplebuflen / stream->src_channels) * stream->dst_channels;
+        }
         #if DEBUG_AUDIOSTREAM
         SDL_Log("AUDIOSTREAM: will resample %d bytes to %d (ratio=%.6f)\n", workbuflen, resamplebuflen, stream->rate_incr);
         #endif
@@ -1078,6 +2658,10 @@ SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf, int len, in
         #endif
     }
 
+    if (stream->channel_matrix && !MixChannelsAfterResampling(stream)) {
+        buflen = MixAudioStreamChannels(stream, workbuf + paddingbytes, buflen);
+    }
+
     if (stream->dst_rate != stream->src_rate) {
         /* save off some samples at the end; they are used for padding now so
            the resampler is coherent and then used at the start of the next
@@ -1103,6 +2687,10 @@ SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf, int len, in
         #if DEBUG_AUDIOSTREAM
         SDL_Log("AUDIOSTREAM: After resampling we have %d bytes\n", buflen);
         #endif
+
+        if (stream->channel_matrix && MixChannelsAfterResampling(stream)) {
+            buflen = MixAudioStreamChannels(stream, resamplebuf, buflen);
+        }
     }
 
     if (stream->cvt_after_resampling.needed && (buflen > 0)) {
@@ -1133,6 +2721,55 @@ SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf, int len, in
     return buflen ? SDL_WriteToDataQueue(stream->queue, resamplebuf, buflen) : 0;
 }
 
+static SDL_bool
+SDL_AudioStreamIsPassthrough(const SDL_AudioStream *stream)
+{
+    return (!stream->cvt_before_resampling.needed &&
+            !stream->channel_matrix &&
+            (stream->dst_rate == stream->src_rate) &&
+            !stream->cvt_after_resampling.needed) ? SDL_TRUE : SDL_FALSE;
+}
+
+/* Not resampling means no padding to carry between puts, so convert each
+   piece of input right in the queue's memory, instead of going through the
+   work buffer and copying the result into the queue afterwards. */
+static int
+SDL_AudioStreamConvertIntoQueue(SDL_AudioStream *stream, const Uint8 *buf, int len)
+{
+    SDL_AudioCVT *cvt = &stream->cvt_after_resampling;
+    const int framelen = stream->src_sample_frame_size;
+    const int minlen = framelen * cvt->len_mult;  /* room to convert one frame in place. */
+
+    SDL_assert(!stream->cvt_before_resampling.needed);
+    SDL_assert(stream->dst_rate == stream->src_rate);
+
+    while (len > 0) {
+        size_t spanlen;
+        Uint8 *span = (Uint8 *) SDL_GetDataQueueWriteSpan(stream->queue, minlen, &spanlen);
+        int cpy;
+
+        if (!span) {
+            return -1;  /* probably out of memory. */
+        }
+
+        cpy = SDL_min(len, (((int) spanlen) / minlen) * framelen);
+        SDL_memcpy(span, buf, cpy);
+        cvt->buf = span;
+        cvt->len = cpy;
+        if (SDL_ConvertAudio(cvt) == -1) {
+            return -1;   /* uhoh! */
+        }
+        if (SDL_CommitDataQueueWrite(stream->queue, minlen, cvt->len_cvt) < 0) {
+            return -1;
+        }
+
+        buf += cpy;
+        len -= cpy;
+    }
+
+    return 0;
+}
+
 int
 SDL_AudioStreamPut(SDL_AudioStream *stream, const void *buf, int len)
 {
@@ -1160,16 +2797,24 @@ SDL_AudioStreamPut(SDL_AudioStream *stream, const void *buf, int len)
     if ((len % stream->src_sample_frame_size) != 0) {
         return SDL_SetError("Can't add partial sample frames");
     }
+    if (stream->put_span_len) {
+        return SDL_SetError("Can't add data while SDL_AudioStreamBeginPut() is in progress");
+    }
 
-    if (!stream->cvt_before_resampling.needed &&
-        (stream->dst_rate == stream->src_rate) &&
-        !stream->cvt_after_resampling.needed) {
+    if (SDL_AudioStreamIsPassthrough(stream)) {
         #if DEBUG_AUDIOSTREAM
         SDL_Log("AUDIOSTREAM: no conversion needed at all, queueing %d bytes.\n", len);
         #endif
         return SDL_WriteToDataQueue(stream->queue, buf, len);
     }
 
+    if ((stream->dst_rate == stream->src_rate) && !stream->channel_matrix) {
+        #if DEBUG_AUDIOSTREAM
+        SDL_Log("AUDIOSTREAM: not resampling, converting %d bytes in the queue.\n", len);
+        #endif
+        return SDL_AudioStreamConvertIntoQueue(stream, (const Uint8 *) buf, len);
+    }
+
     while (len > 0) {
         int amount;
 
@@ -1277,6 +2922,109 @@ SDL_AudioStreamGet(SDL_AudioStream *stream, void *buf, int len)
     return (int) SDL_ReadFromDataQueue(stream->queue, buf, len);
 }
 
+int
+SDL_AudioStreamBeginPut(SDL_AudioStream *stream, int len, void **buf)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+    if (!buf) {
+        return SDL_InvalidParamError("buf");
+    }
+    if (stream->put_span_len) {
+        return SDL_SetError("SDL_AudioStreamBeginPut() is already in progress");
+    }
+
+    len -= len % stream->src_sample_frame_size;
+    if (len <= 0) {
+        return SDL_SetError("Can't add partial sample frames");
+    }
+
+    if (SDL_AudioStreamIsPassthrough(stream)) {
+        /* nothing to convert, so let them write straight into the queue. */
+        size_t spanlen;
+        void *span = SDL_GetDataQueueWriteSpan(stream->queue, stream->src_sample_frame_size, &spanlen);
+        if (!span) {
+            return -1;  /* probably out of memory. */
+        }
+        len = SDL_min(len, (int) spanlen);
+        *buf = span;
+    } else {
+        if (len > stream->put_span_size) {
+            Uint8 *ptr = (Uint8 *) SDL_realloc(stream->put_span, len);
+            if (!ptr) {
+                return SDL_OutOfMemory();
+            }
+            stream->put_span = ptr;
+            stream->put_span_size = len;
+        }
+        *buf = stream->put_span;
+    }
+
+    stream->put_span_len = len;
+    return len;
+}
+
+int
+SDL_AudioStreamEndPut(SDL_AudioStream *stream, int len)
+{
+    int reserved;
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+
+    reserved = stream->put_span_len;
+    if (!reserved) {
+        return SDL_SetError("SDL_AudioStreamBeginPut() wasn't called");
+    }
+    if ((len < 0) || (len > reserved)) {
+        return SDL_InvalidParamError("len");
+    }
+    if ((len % stream->src_sample_frame_size) != 0) {
+        return SDL_SetError("Can't add partial sample frames");
+    }
+
+    stream->put_span_len = 0;
+
+    if (SDL_AudioStreamIsPassthrough(stream)) {
+        return SDL_CommitDataQueueWrite(stream->queue, stream->src_sample_frame_size, len);
+    }
+    return SDL_AudioStreamPut(stream, stream->put_span, len);
+}
+
+int
+SDL_AudioStreamBeginGet(SDL_AudioStream *stream, const void **buf)
+{
+    size_t len;
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+    if (!buf) {
+        return SDL_InvalidParamError("buf");
+    }
+
+    *buf = SDL_GetDataQueueReadSpan(stream->queue, &len);
+    return (int) len;
+}
+
+int
+SDL_AudioStreamEndGet(SDL_AudioStream *stream, int len)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+    if (len < 0) {
+        return SDL_InvalidParamError("len");
+    }
+    if ((len % stream->dst_sample_frame_size) != 0) {
+        return SDL_SetError("Can't consume partial sample frames");
+    }
+
+    return (int) SDL_DiscardFromDataQueue(stream->queue, len);
+}
+
 /* number of converted/resampled bytes available */
 int
 SDL_AudioStreamAvailable(SDL_AudioStream *stream)
@@ -1296,14 +3044,24 @@ SDL_AudioStreamClear(SDL_AudioStream *stream)
         }
         stream->first_run = SDL_TRUE;
         stream->staging_buffer_filled = 0;
+        stream->put_span_len = 0;
     }
 }
 
+void
+SDL_GetAudioStreamOutputSpec(SDL_AudioStream *stream, SDL_AudioFormat *format, Uint8 *channels, int *rate)
+{
+    *format = stream->dst_format;
+    *channels = stream->dst_channels;
+    *rate = stream->dst_rate;
+}
+
 /* dispose of a stream */
 void
 SDL_FreeAudioStream(SDL_AudioStream *stream)
 {
     if (stream) {
+        SDL_UnbindAudioStream(stream);
         if (stream->cleanup_resampler_func) {
             stream->cleanup_resampler_func(stream);
         }
@@ -1311,6 +3069,8 @@ SDL_FreeAudioStream(SDL_AudioStream *stream)
         SDL_free(stream->staging_buffer);
         SDL_free(stream->work_buffer_base);
         SDL_free(stream->resampler_padding);
+        SDL_free(stream->put_span);
+        SDL_free(stream->channel_matrix);
         SDL_free(stream);
     }
 }
@@ -58,6 +58,16 @@ SDL_AudioFilter SDL_Convert_F32_to_U8 = NULL;
 SDL_AudioFilter SDL_Convert_F32_to_S16 = NULL;
 SDL_AudioFilter SDL_Convert_F32_to_U16 = NULL;
 SDL_AudioFilter SDL_Convert_F32_to_S32 = NULL;
+SDL_AudioFilter SDL_Convert_S8_to_S16 = NULL;
+SDL_AudioFilter SDL_Convert_U8_to_S16 = NULL;
+SDL_AudioFilter SDL_Convert_U16_to_S16 = NULL;
+SDL_AudioFilter SDL_Convert_S32_to_S16 = NULL;
+SDL_AudioFilter SDL_Convert_S16_to_S8 = NULL;
+SDL_AudioFilter SDL_Convert_S16_to_U8 = NULL;
+SDL_AudioFilter SDL_Convert_S16_to_U16 = NULL;
+SDL_AudioFilter SDL_Convert_S16_to_S32 = NULL;
+SDL_G711Converter SDL_Convert_ULaw_to_S16 = NULL;
+SDL_G711Converter SDL_Convert_ALaw_to_S16 = NULL;
 
 
 #define DIVBY128 0.0078125f
@@ -850,42 +860,34 @@ SDL_Convert_F32_to_S32_SSE2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 #endif
 
 
-#if HAVE_NEON_INTRINSICS
-static void SDLCALL
-SDL_Convert_S8_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+#if HAVE_AVX2_INTRINSICS
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_S8_to_F32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
     const Sint8 *src = ((const Sint8 *) (cvt->buf + cvt->len_cvt)) - 1;
     float *dst = ((float *) (cvt->buf + cvt->len_cvt * 4)) - 1;
     int i;
 
-    LOG_DEBUG_CONVERT("AUDIO_S8", "AUDIO_F32 (using NEON)");
+    LOG_DEBUG_CONVERT("AUDIO_S8", "AUDIO_F32 (using AVX2)");
 
-    /* Get dst aligned to 16 bytes (since buffer is growing, we don't have to worry about overreading from src) */
-    for (i = cvt->len_cvt; i && (((size_t) (dst-15)) & 15); --i, --src, --dst) {
+    /* Get dst aligned to 32 bytes (since buffer is growing, we don't have to worry about overreading from src) */
+    for (i = cvt->len_cvt; i && (((size_t) (dst-15)) & 31); --i, --src, --dst) {
         *dst = ((float) *src) * DIVBY128;
     }
 
-    src -= 15; dst -= 15;  /* adjust to read NEON blocks from the start. */
-    SDL_assert(!i || ((((size_t) dst) & 15) == 0));
+    src -= 15; dst -= 15;  /* adjust to read AVX blocks from the start. */
+    SDL_assert(!i || ((((size_t) dst) & 31) == 0));
 
-    /* Make sure src is aligned too. */
-    if ((((size_t) src) & 15) == 0) {
-        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
-        const int8_t *mmsrc = (const int8_t *) src;
-        const float32x4_t divby128 = vdupq_n_f32(DIVBY128);
+    {
+        /* src alignment doesn't matter for AVX loads, so no need to check it. */
+        const __m256 divby128 = _mm256_set1_ps(DIVBY128);
         while (i >= 16) {   /* 16 * 8-bit */
-            const int8x16_t bytes = vld1q_s8(mmsrc);  /* get 16 sint8 into a NEON register. */
-            const int16x8_t int16hi = vmovl_s8(vget_high_s8(bytes));  /* convert top 8 bytes to 8 int16 */
-            const int16x8_t int16lo = vmovl_s8(vget_low_s8(bytes));   /* convert bottom 8 bytes to 8 int16 */
-            /* split int16 to two int32, then convert to float, then multiply to normalize, store. */
-            vst1q_f32(dst, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(int16lo))), divby128));
-            vst1q_f32(dst+4, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(int16lo))), divby128));
-            vst1q_f32(dst+8, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(int16hi))), divby128));
-            vst1q_f32(dst+12, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(int16hi))), divby128));
-            i -= 16; mmsrc -= 16; dst -= 16;
+            const __m128i bytes = _mm_loadu_si128((const __m128i *) src);  /* get 16 sint8 into an XMM register. */
+            /* sign-extend each half to sint32, convert to float, multiply, store. */
+            _mm256_store_ps(dst, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(bytes)), divby128));
+            _mm256_store_ps(dst+8, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_srli_si128(bytes, 8))), divby128));
+            i -= 16; src -= 16; dst -= 16;
         }
-
-        src = (const Sint8 *) mmsrc;
     }
 
     src += 15; dst += 15;  /* adjust for any scalar finishing. */
@@ -902,42 +904,35 @@ SDL_Convert_S8_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
     }
 }
 
-static void SDLCALL
-SDL_Convert_U8_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_U8_to_F32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
     const Uint8 *src = ((const Uint8 *) (cvt->buf + cvt->len_cvt)) - 1;
     float *dst = ((float *) (cvt->buf + cvt->len_cvt * 4)) - 1;
     int i;
 
-    LOG_DEBUG_CONVERT("AUDIO_U8", "AUDIO_F32 (using NEON)");
+    LOG_DEBUG_CONVERT("AUDIO_U8", "AUDIO_F32 (using AVX2)");
 
-    /* Get dst aligned to 16 bytes (since buffer is growing, we don't have to worry about overreading from src) */
-    for (i = cvt->len_cvt; i && (((size_t) (dst-15)) & 15); --i, --src, --dst) {
+    /* Get dst aligned to 32 bytes (since buffer is growing, we don't have to worry about overreading from src) */
+    for (i = cvt->len_cvt; i && (((size_t) (dst-15)) & 31); --i, --src, --dst) {
         *dst = (((float) *src) * DIVBY128) - 1.0f;
     }
 
-    src -= 15; dst -= 15;  /* adjust to read NEON blocks from the start. */
-    SDL_assert(!i || ((((size_t) dst) & 15) == 0));
+    src -= 15; dst -= 15;  /* adjust to read AVX blocks from the start. */
+    SDL_assert(!i || ((((size_t) dst) & 31) == 0));
 
-    /* Make sure src is aligned too. */
-    if ((((size_t) src) & 15) == 0) {
-        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
-        const uint8_t *mmsrc = (const uint8_t *) src;
-        const float32x4_t divby128 = vdupq_n_f32(DIVBY128);
-        const float32x4_t negone = vdupq_n_f32(-1.0f);
+    {
+        /* src alignment doesn't matter for AVX loads, so no need to check it. */
+        const __m256 divby128 = _mm256_set1_ps(DIVBY128);
+        const __m256 minus1 = _mm256_set1_ps(-1.0f);
         while (i >= 16) {   /* 16 * 8-bit */
-            const uint8x16_t bytes = vld1q_u8(mmsrc);  /* get 16 uint8 into a NEON register. */
-            const uint16x8_t uint16hi = vmovl_u8(vget_high_u8(bytes));  /* convert top 8 bytes to 8 uint16 */
-            const uint16x8_t uint16lo = vmovl_u8(vget_low_u8(bytes));   /* convert bottom 8 bytes to 8 uint16 */
-            /* split uint16 to two uint32, then convert to float, then multiply to normalize, subtract to adjust for sign, store. */
-            vst1q_f32(dst, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_low_u16(uint16lo))), divby128));
-            vst1q_f32(dst+4, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_high_u16(uint16lo))), divby128));
-            vst1q_f32(dst+8, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_low_u16(uint16hi))), divby128));
-            vst1q_f32(dst+12, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_high_u16(uint16hi))), divby128));
-            i -= 16; mmsrc -= 16; dst -= 16;
+            const __m128i bytes = _mm_loadu_si128((const __m128i *) src);  /* get 16 uint8 into an XMM register. */
+            /* zero-extend each half to sint32, convert to float, multiply, add, store. Separate
+               multiply and add (not FMA), so results match the SSE2 path. */
+            _mm256_store_ps(dst, _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(bytes)), divby128), minus1));
+            _mm256_store_ps(dst+8, _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(bytes, 8))), divby128), minus1));
+            i -= 16; src -= 16; dst -= 16;
         }
-
-        src = (const Uint8 *) mmsrc;
     }
 
     src += 15; dst += 15;  /* adjust for any scalar finishing. */
@@ -954,37 +949,37 @@ SDL_Convert_U8_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
     }
 }
 
-static void SDLCALL
-SDL_Convert_S16_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_S16_to_F32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
     const Sint16 *src = ((const Sint16 *) (cvt->buf + cvt->len_cvt)) - 1;
     float *dst = ((float *) (cvt->buf + cvt->len_cvt * 2)) - 1;
     int i;
 
-    LOG_DEBUG_CONVERT("AUDIO_S16", "AUDIO_F32 (using NEON)");
+    LOG_DEBUG_CONVERT("AUDIO_S16", "AUDIO_F32 (using AVX2)");
 
-    /* Get dst aligned to 16 bytes (since buffer is growing, we don't have to worry about overreading from src) */
-    for (i = cvt->len_cvt / sizeof (Sint16); i && (((size_t) (dst-7)) & 15); --i, --src, --dst) {
+    /* Get dst aligned to 32 bytes (since buffer is growing, we don't have to worry about overreading from src) */
+    for (i = cvt->len_cvt / sizeof (Sint16); i && (((size_t) (dst-15)) & 31); --i, --src, --dst) {
         *dst = ((float) *src) * DIVBY32768;
     }
 
-    src -= 7; dst -= 7;  /* adjust to read NEON blocks from the start. */
-    SDL_assert(!i || ((((size_t) dst) & 15) == 0));
+    src -= 15; dst -= 15;  /* adjust to read AVX blocks from the start. */
+    SDL_assert(!i || ((((size_t) dst) & 31) == 0));
 
-    /* Make sure src is aligned too. */
-    if ((((size_t) src) & 15) == 0) {
-        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
-        const float32x4_t divby32768 = vdupq_n_f32(DIVBY32768);
-        while (i >= 8) {   /* 8 * 16-bit */
-            const int16x8_t ints = vld1q_s16((int16_t const *) src);  /* get 8 sint16 into a NEON register. */
-            /* split int16 to two int32, then convert to float, then multiply to normalize, store. */
-            vst1q_f32(dst, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(ints))), divby32768));
-            vst1q_f32(dst+4, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(ints))), divby32768));
-            i -= 8; src -= 8; dst -= 8;
+    {
+        /* src alignment doesn't matter for AVX loads, so no need to check it. */
+        const __m256 divby32768 = _mm256_set1_ps(DIVBY32768);
+        while (i >= 16) {   /* 16 * 16-bit */
+            /* load both halves before storing anything, since dst overlaps src. */
+            const __m256i ints1 = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *) src));
+            const __m256i ints2 = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *) (src+8)));
+            _mm256_store_ps(dst, _mm256_mul_ps(_mm256_cvtepi32_ps(ints1), divby32768));
+            _mm256_store_ps(dst+8, _mm256_mul_ps(_mm256_cvtepi32_ps(ints2), divby32768));
+            i -= 16; src -= 16; dst -= 16;
         }
     }
 
-    src += 7; dst += 7;  /* adjust for any scalar finishing. */
+    src += 15; dst += 15;  /* adjust for any scalar finishing. */
 
     /* Finish off any leftovers with scalar operations. */
     while (i) {
@@ -998,38 +993,38 @@ SDL_Convert_S16_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
     }
 }
 
-static void SDLCALL
-SDL_Convert_U16_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_U16_to_F32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
     const Uint16 *src = ((const Uint16 *) (cvt->buf + cvt->len_cvt)) - 1;
     float *dst = ((float *) (cvt->buf + cvt->len_cvt * 2)) - 1;
     int i;
 
-    LOG_DEBUG_CONVERT("AUDIO_U16", "AUDIO_F32 (using NEON)");
+    LOG_DEBUG_CONVERT("AUDIO_U16", "AUDIO_F32 (using AVX2)");
 
-    /* Get dst aligned to 16 bytes (since buffer is growing, we don't have to worry about overreading from src) */
-    for (i = cvt->len_cvt / sizeof (Sint16); i && (((size_t) (dst-7)) & 15); --i, --src, --dst) {
+    /* Get dst aligned to 32 bytes (since buffer is growing, we don't have to worry about overreading from src) */
+    for (i = cvt->len_cvt / sizeof (Sint16); i && (((size_t) (dst-15)) & 31); --i, --src, --dst) {
         *dst = (((float) *src) * DIVBY32768) - 1.0f;
     }
 
-    src -= 7; dst -= 7;  /* adjust to read NEON blocks from the start. */
-    SDL_assert(!i || ((((size_t) dst) & 15) == 0));
+    src -= 15; dst -= 15;  /* adjust to read AVX blocks from the start. */
+    SDL_assert(!i || ((((size_t) dst) & 31) == 0));
 
-    /* Make sure src is aligned too. */
-    if ((((size_t) src) & 15) == 0) {
-        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
-        const float32x4_t divby32768 = vdupq_n_f32(DIVBY32768);
-        const float32x4_t negone = vdupq_n_f32(-1.0f);
-        while (i >= 8) {   /* 8 * 16-bit */
-            const uint16x8_t uints = vld1q_u16((uint16_t const *) src);  /* get 8 uint16 into a NEON register. */
-            /* split uint16 to two int32, then convert to float, then multiply to normalize, subtract for sign, store. */
-            vst1q_f32(dst, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_low_u16(uints))), divby32768));
-            vst1q_f32(dst+4, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_high_u16(uints))), divby32768));
-            i -= 8; src -= 8; dst -= 8;
+    {
+        /* src alignment doesn't matter for AVX loads, so no need to check it. */
+        const __m256 divby32768 = _mm256_set1_ps(DIVBY32768);
+        const __m256 minus1 = _mm256_set1_ps(-1.0f);
+        while (i >= 16) {   /* 16 * 16-bit */
+            /* load both halves before storing anything, since dst overlaps src. */
+            const __m256i ints1 = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *) src));
+            const __m256i ints2 = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *) (src+8)));
+            _mm256_store_ps(dst, _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(ints1), divby32768), minus1));
+            _mm256_store_ps(dst+8, _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(ints2), divby32768), minus1));
+            i -= 16; src -= 16; dst -= 16;
         }
     }
 
-    src += 7; dst += 7;  /* adjust for any scalar finishing. */
+    src += 15; dst += 15;  /* adjust for any scalar finishing. */
 
     /* Finish off any leftovers with scalar operations. */
     while (i) {
@@ -1043,33 +1038,30 @@ SDL_Convert_U16_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
     }
 }
 
-static void SDLCALL
-SDL_Convert_S32_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_S32_to_F32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
     const Sint32 *src = (const Sint32 *) cvt->buf;
     float *dst = (float *) cvt->buf;
     int i;
 
-    LOG_DEBUG_CONVERT("AUDIO_S32", "AUDIO_F32 (using NEON)");
+    LOG_DEBUG_CONVERT("AUDIO_S32", "AUDIO_F32 (using AVX2)");
 
-    /* Get dst aligned to 16 bytes */
-    for (i = cvt->len_cvt / sizeof (Sint32); i && (((size_t) dst) & 15); --i, ++src, ++dst) {
+    /* Get dst aligned to 32 bytes */
+    for (i = cvt->len_cvt / sizeof (Sint32); i && (((size_t) dst) & 31); --i, ++src, ++dst) {
         *dst = ((float) (*src>>8)) * DIVBY8388607;
     }
 
-    SDL_assert(!i || ((((size_t) dst) & 15) == 0));
+    SDL_assert(!i || ((((size_t) dst) & 31) == 0));
 
-    /* Make sure src is aligned too. */
-    if ((((size_t) src) & 15) == 0) {
-        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
-        const float32x4_t divby8388607 = vdupq_n_f32(DIVBY8388607);
-        const int32_t *mmsrc = (const int32_t *) src;
-        while (i >= 4) {   /* 4 * sint32 */
+    {
+        /* src and dst are the same buffer, so src is aligned too. */
+        const __m256 divby8388607 = _mm256_set1_ps(DIVBY8388607);
+        while (i >= 8) {   /* 8 * sint32 */
             /* shift out lowest bits so int fits in a float32. Small precision loss, but much faster. */
-            vst1q_f32(dst, vmulq_f32(vcvtq_f32_s32(vshrq_n_s32(vld1q_s32(mmsrc), 8)), divby8388607));
-            i -= 4; mmsrc += 4; dst += 4;
+            _mm256_store_ps(dst, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_load_si256((const __m256i *) src), 8)), divby8388607));
+            i -= 8; src += 8; dst += 8;
         }
-        src = (const Sint32 *) mmsrc;
     }
 
     /* Finish off any leftovers with scalar operations. */
@@ -1083,17 +1075,17 @@ SDL_Convert_S32_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
     }
 }
 
-static void SDLCALL
-SDL_Convert_F32_to_S8_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_F32_to_S8_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
     const float *src = (const float *) cvt->buf;
     Sint8 *dst = (Sint8 *) cvt->buf;
     int i;
 
-    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S8 (using NEON)");
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S8 (using AVX2)");
 
-    /* Get dst aligned to 16 bytes */
-    for (i = cvt->len_cvt / sizeof (float); i && (((size_t) dst) & 15); --i, ++src, ++dst) {
+    /* Get dst aligned to 32 bytes */
+    for (i = cvt->len_cvt / sizeof (float); i && (((size_t) dst) & 31); --i, ++src, ++dst) {
         const float sample = *src;
         if (sample >= 1.0f) {
             *dst = 127;
@@ -1104,24 +1096,23 @@ SDL_Convert_F32_to_S8_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
         }
     }
 
-    SDL_assert(!i || ((((size_t) dst) & 15) == 0));
+    SDL_assert(!i || ((((size_t) dst) & 31) == 0));
 
-    /* Make sure src is aligned too. */
-    if ((((size_t) src) & 15) == 0) {
-        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
-        const float32x4_t one = vdupq_n_f32(1.0f);
-        const float32x4_t negone = vdupq_n_f32(-1.0f);
-        const float32x4_t mulby127 = vdupq_n_f32(127.0f);
-        int8_t *mmdst = (int8_t *) dst;
-        while (i >= 16) {   /* 16 * float32 */
-            const int32x4_t ints1 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src)), one), mulby127));  /* load 4 floats, clamp, convert to sint32 */
-            const int32x4_t ints2 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src+4)), one), mulby127));  /* load 4 floats, clamp, convert to sint32 */
-            const int32x4_t ints3 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src+8)), one), mulby127));  /* load 4 floats, clamp, convert to sint32 */
-            const int32x4_t ints4 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src+12)), one), mulby127));  /* load 4 floats, clamp, convert to sint32 */
-            const int8x8_t i8lo = vmovn_s16(vcombine_s16(vmovn_s32(ints1), vmovn_s32(ints2))); /* narrow to sint16, combine, narrow to sint8 */
-            const int8x8_t i8hi = vmovn_s16(vcombine_s16(vmovn_s32(ints3), vmovn_s32(ints4))); /* narrow to sint16, combine, narrow to sint8 */
-            vst1q_s8(mmdst, vcombine_s8(i8lo, i8hi));  /* combine to int8x16_t, store out */
-            i -= 16; src += 16; mmdst += 16;
+    {
+        /* src alignment doesn't matter for AVX loads, so no need to check it. */
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 negone = _mm256_set1_ps(-1.0f);
+        const __m256 mulby127 = _mm256_set1_ps(127.0f);
+        /* the packs work within 128-bit lanes, so this puts the 4-byte groups back in order. */
+        const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+        __m256i *mmdst = (__m256i *) dst;
+        while (i >= 32) {   /* 32 * float32 */
+            const __m256i ints1 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src)), one), mulby127));  /* load 8 floats, clamp, convert to sint32 */
+            const __m256i ints2 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src+8)), one), mulby127));  /* load 8 floats, clamp, convert to sint32 */
+            const __m256i ints3 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src+16)), one), mulby127));  /* load 8 floats, clamp, convert to sint32 */
+            const __m256i ints4 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src+24)), one), mulby127));  /* load 8 floats, clamp, convert to sint32 */
+            _mm256_store_si256(mmdst, _mm256_permutevar8x32_epi32(_mm256_packs_epi16(_mm256_packs_epi32(ints1, ints2), _mm256_packs_epi32(ints3, ints4)), order));  /* pack down, reorder, store out. */
+            i -= 32; src += 32; mmdst++;
         }
         dst = (Sint8 *) mmdst;
     }
@@ -1145,17 +1136,17 @@ SDL_Convert_F32_to_S8_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
     }
 }
 
-static void SDLCALL
-SDL_Convert_F32_to_U8_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_F32_to_U8_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
     const float *src = (const float *) cvt->buf;
-    Uint8 *dst = (Uint8 *) cvt->buf;
+    Uint8 *dst = cvt->buf;
     int i;
 
-    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_U8 (using NEON)");
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_U8 (using AVX2)");
 
-    /* Get dst aligned to 16 bytes */
-    for (i = cvt->len_cvt / sizeof (float); i && (((size_t) dst) & 15); --i, ++src, ++dst) {
+    /* Get dst aligned to 32 bytes */
+    for (i = cvt->len_cvt / sizeof (float); i && (((size_t) dst) & 31); --i, ++src, ++dst) {
         const float sample = *src;
         if (sample >= 1.0f) {
             *dst = 255;
@@ -1166,26 +1157,24 @@ SDL_Convert_F32_to_U8_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
         }
     }
 
-    SDL_assert(!i || ((((size_t) dst) & 15) == 0));
+    SDL_assert(!i || ((((size_t) dst) & 31) == 0));
 
-    /* Make sure src is aligned too. */
-    if ((((size_t) src) & 15) == 0) {
-        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
-        const float32x4_t one = vdupq_n_f32(1.0f);
-        const float32x4_t negone = vdupq_n_f32(-1.0f);
-        const float32x4_t mulby127 = vdupq_n_f32(127.0f);
-        uint8_t *mmdst = (uint8_t *) dst;
-        while (i >= 16) {   /* 16 * float32 */
-            const uint32x4_t uints1 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src)), one), one), mulby127));  /* load 4 floats, clamp, convert to uint32 */
-            const uint32x4_t uints2 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src+4)), one), one), mulby127));  /* load 4 floats, clamp, convert to uint32 */
-            const uint32x4_t uints3 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src+8)), one), one), mulby127));  /* load 4 floats, clamp, convert to uint32 */
-            const uint32x4_t uints4 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src+12)), one), one), mulby127));  /* load 4 floats, clamp, convert to uint32 */
-            const uint8x8_t ui8lo = vmovn_u16(vcombine_u16(vmovn_u32(uints1), vmovn_u32(uints2))); /* narrow to uint16, combine, narrow to uint8 */
-            const uint8x8_t ui8hi = vmovn_u16(vcombine_u16(vmovn_u32(uints3), vmovn_u32(uints4))); /* narrow to uint16, combine, narrow to uint8 */
-            vst1q_u8(mmdst, vcombine_u8(ui8lo, ui8hi));  /* combine to uint8x16_t, store out */
-            i -= 16; src += 16; mmdst += 16;
+    {
+        /* src alignment doesn't matter for AVX loads, so no need to check it. */
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 negone = _mm256_set1_ps(-1.0f);
+        const __m256 mulby127 = _mm256_set1_ps(127.0f);
+        /* the packs work within 128-bit lanes, so this puts the 4-byte groups back in order. */
+        const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+        __m256i *mmdst = (__m256i *) dst;
+        while (i >= 32) {   /* 32 * float32 */
+            const __m256i ints1 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_add_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src)), one), one), mulby127));  /* load 8 floats, clamp, convert to sint32 */
+            const __m256i ints2 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_add_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src+8)), one), one), mulby127));  /* load 8 floats, clamp, convert to sint32 */
+            const __m256i ints3 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_add_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src+16)), one), one), mulby127));  /* load 8 floats, clamp, convert to sint32 */
+            const __m256i ints4 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_add_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src+24)), one), one), mulby127));  /* load 8 floats, clamp, convert to sint32 */
+            _mm256_store_si256(mmdst, _mm256_permutevar8x32_epi32(_mm256_packus_epi16(_mm256_packs_epi32(ints1, ints2), _mm256_packs_epi32(ints3, ints4)), order));  /* pack down, reorder, store out. */
+            i -= 32; src += 32; mmdst++;
         }
-
         dst = (Uint8 *) mmdst;
     }
 
@@ -1208,17 +1197,17 @@ SDL_Convert_F32_to_U8_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
     }
 }
 
-static void SDLCALL
-SDL_Convert_F32_to_S16_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_F32_to_S16_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
     const float *src = (const float *) cvt->buf;
     Sint16 *dst = (Sint16 *) cvt->buf;
     int i;
 
-    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S16 (using NEON)");
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S16 (using AVX2)");
 
-    /* Get dst aligned to 16 bytes */
-    for (i = cvt->len_cvt / sizeof (float); i && (((size_t) dst) & 15); --i, ++src, ++dst) {
+    /* Get dst aligned to 32 bytes */
+    for (i = cvt->len_cvt / sizeof (float); i && (((size_t) dst) & 31); --i, ++src, ++dst) {
         const float sample = *src;
         if (sample >= 1.0f) {
             *dst = 32767;
@@ -1229,20 +1218,19 @@ SDL_Convert_F32_to_S16_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
         }
     }
 
-    SDL_assert(!i || ((((size_t) dst) & 15) == 0));
+    SDL_assert(!i || ((((size_t) dst) & 31) == 0));
 
-    /* Make sure src is aligned too. */
-    if ((((size_t) src) & 15) == 0) {
-        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
-        const float32x4_t one = vdupq_n_f32(1.0f);
-        const float32x4_t negone = vdupq_n_f32(-1.0f);
-        const float32x4_t mulby32767 = vdupq_n_f32(32767.0f);
-        int16_t *mmdst = (int16_t *) dst;
-        while (i >= 8) {   /* 8 * float32 */
-            const int32x4_t ints1 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src)), one), mulby32767));  /* load 4 floats, clamp, convert to sint32 */
-            const int32x4_t ints2 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src+4)), one), mulby32767));  /* load 4 floats, clamp, convert to sint32 */
-            vst1q_s16(mmdst, vcombine_s16(vmovn_s32(ints1), vmovn_s32(ints2)));  /* narrow to sint16, combine, store out. */
-            i -= 8; src += 8; mmdst += 8;
+    {
+        /* src alignment doesn't matter for AVX loads, so no need to check it. */
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 negone = _mm256_set1_ps(-1.0f);
+        const __m256 mulby32767 = _mm256_set1_ps(32767.0f);
+        __m256i *mmdst = (__m256i *) dst;
+        while (i >= 16) {   /* 16 * float32 */
+            const __m256i ints1 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src)), one), mulby32767));  /* load 8 floats, clamp, convert to sint32 */
+            const __m256i ints2 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src+8)), one), mulby32767));  /* load 8 floats, clamp, convert to sint32 */
+            _mm256_store_si256(mmdst, _mm256_permute4x64_epi64(_mm256_packs_epi32(ints1, ints2), 0xD8));  /* pack to sint16, put the 128-bit lanes back in order, store out. */
+            i -= 16; src += 16; mmdst++;
         }
         dst = (Sint16 *) mmdst;
     }
@@ -1266,17 +1254,17 @@ SDL_Convert_F32_to_S16_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
     }
 }
 
-static void SDLCALL
-SDL_Convert_F32_to_U16_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_F32_to_U16_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
     const float *src = (const float *) cvt->buf;
     Uint16 *dst = (Uint16 *) cvt->buf;
     int i;
 
-    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_U16 (using NEON)");
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_U16 (using AVX2)");
 
-    /* Get dst aligned to 16 bytes */
-    for (i = cvt->len_cvt / sizeof (float); i && (((size_t) dst) & 15); --i, ++src, ++dst) {
+    /* Get dst aligned to 32 bytes */
+    for (i = cvt->len_cvt / sizeof (float); i && (((size_t) dst) & 31); --i, ++src, ++dst) {
         const float sample = *src;
         if (sample >= 1.0f) {
             *dst = 65535;
@@ -1287,20 +1275,21 @@ SDL_Convert_F32_to_U16_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
         }
     }
 
-    SDL_assert(!i || ((((size_t) dst) & 15) == 0));
+    SDL_assert(!i || ((((size_t) dst) & 31) == 0));
 
-    /* Make sure src is aligned too. */
-    if ((((size_t) src) & 15) == 0) {
-        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
-        const float32x4_t one = vdupq_n_f32(1.0f);
-        const float32x4_t negone = vdupq_n_f32(-1.0f);
-        const float32x4_t mulby32767 = vdupq_n_f32(32767.0f);
-        uint16_t *mmdst = (uint16_t *) dst;
-        while (i >= 8) {   /* 8 * float32 */
-            const uint32x4_t uints1 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src)), one), one), mulby32767));  /* load 4 floats, clamp, convert to uint32 */
-            const uint32x4_t uints2 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src+4)), one), one), mulby32767));  /* load 4 floats, clamp, convert to uint32 */
-            vst1q_u16(mmdst, vcombine_u16(vmovn_u32(uints1), vmovn_u32(uints2)));  /* narrow to uint16, combine, store out. */
-            i -= 8; src += 8; mmdst += 8;
+    {
+        /* src alignment doesn't matter for AVX loads, so no need to check it. */
+        /* Same signed-pack-and-flip-the-top-bit trick as the SSE2 version, so both give the same results. */
+        const __m256 mulby32767 = _mm256_set1_ps(32767.0f);
+        const __m256i topbit = _mm256_set1_epi16(-32768);
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 negone = _mm256_set1_ps(-1.0f);
+        __m256i *mmdst = (__m256i *) dst;
+        while (i >= 16) {   /* 16 * float32 */
+            const __m256i ints1 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src)), one), mulby32767));  /* load 8 floats, clamp, convert to sint32 */
+            const __m256i ints2 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src+8)), one), mulby32767));  /* load 8 floats, clamp, convert to sint32 */
+            _mm256_store_si256(mmdst, _mm256_xor_si256(_mm256_permute4x64_epi64(_mm256_packs_epi32(ints1, ints2), 0xD8), topbit));  /* pack to sint16, reorder, xor top bit, store out. */
+            i -= 16; src += 16; mmdst++;
         }
         dst = (Uint16 *) mmdst;
     }
@@ -1324,39 +1313,39 @@ SDL_Convert_F32_to_U16_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
     }
 }
 
-static void SDLCALL
-SDL_Convert_F32_to_S32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_F32_to_S32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
     const float *src = (const float *) cvt->buf;
     Sint32 *dst = (Sint32 *) cvt->buf;
     int i;
 
-    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S32 (using NEON)");
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S32 (using AVX2)");
 
-    /* Get dst aligned to 16 bytes */
-    for (i = cvt->len_cvt / sizeof (float); i && (((size_t) dst) & 15); --i, ++src, ++dst) {
+    /* Get dst aligned to 32 bytes */
+    for (i = cvt->len_cvt / sizeof (float); i && (((size_t) dst) & 31); --i, ++src, ++dst) {
         const float sample = *src;
         if (sample >= 1.0f) {
             *dst = 2147483647;
         } else if (sample <= -1.0f) {
-            *dst = (-2147483647) - 1;
+            *dst = (Sint32) -2147483648LL;
         } else {
             *dst = ((Sint32)(sample * 8388607.0f)) << 8;
         }
     }
 
-    SDL_assert(!i || ((((size_t) dst) & 15) == 0));
-    SDL_assert(!i || ((((size_t) src) & 15) == 0));
+    SDL_assert(!i || ((((size_t) dst) & 31) == 0));
+    SDL_assert(!i || ((((size_t) src) & 31) == 0));
 
     {
-        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
-        const float32x4_t one = vdupq_n_f32(1.0f);
-        const float32x4_t negone = vdupq_n_f32(-1.0f);
-        const float32x4_t mulby8388607 = vdupq_n_f32(8388607.0f);
-        int32_t *mmdst = (int32_t *) dst;
-        while (i >= 4) {   /* 4 * float32 */
-            vst1q_s32(mmdst, vshlq_n_s32(vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src)), one), mulby8388607)), 8));
-            i -= 4; src += 4; mmdst += 4;
+        /* Aligned! Do AVX blocks as long as we have 32 bytes available. */
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 negone = _mm256_set1_ps(-1.0f);
+        const __m256 mulby8388607 = _mm256_set1_ps(8388607.0f);
+        __m256i *mmdst = (__m256i *) dst;
+        while (i >= 8) {   /* 8 * float32 */
+            _mm256_store_si256(mmdst, _mm256_slli_epi32(_mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_load_ps(src)), one), mulby8388607)), 8));  /* load 8 floats, clamp, convert to sint32 */
+            i -= 8; src += 8; mmdst++;
         }
         dst = (Sint32 *) mmdst;
     }
@@ -1367,7 +1356,7 @@ SDL_Convert_F32_to_S32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
         if (sample >= 1.0f) {
             *dst = 2147483647;
         } else if (sample <= -1.0f) {
-            *dst = (-2147483647) - 1;
+            *dst = (Sint32) -2147483648LL;
         } else {
             *dst = ((Sint32)(sample * 8388607.0f)) << 8;
         }
@@ -1380,17 +1369,1832 @@ SDL_Convert_F32_to_S32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 }
 #endif
 
+#if HAVE_AVX512F_INTRINSICS
+static void SDLCALL SDL_TARGETING("avx512f")
+SDL_Convert_S8_to_F32_AVX512(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint8 *src = ((const Sint8 *) (cvt->buf + cvt->len_cvt)) - 1;
+    float *dst = ((float *) (cvt->buf + cvt->len_cvt * 4)) - 1;
+    int i;
 
+    LOG_DEBUG_CONVERT("AUDIO_S8", "AUDIO_F32 (using AVX-512)");
 
-void SDL_ChooseAudioConverters(void)
+    /* Get dst aligned to 64 bytes (since buffer is growing, we don't have to worry about overreading from src) */
+    for (i = cvt->len_cvt; i && (((size_t) (dst-15)) & 63); --i, --src, --dst) {
+        *dst = ((float) *src) * DIVBY128;
+    }
+
+    src -= 15; dst -= 15;  /* adjust to read AVX-512 blocks from the start. */
+    SDL_assert(!i || ((((size_t) dst) & 63) == 0));
+
+    {
+        /* src alignment doesn't matter for AVX-512 loads, so no need to check it. */
+        const __m512 divby128 = _mm512_set1_ps(DIVBY128);
+        while (i >= 16) {   /* 16 * 8-bit */
+            _mm512_store_ps(dst, _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i *) src))), divby128));
+            i -= 16; src -= 16; dst -= 16;
+        }
+    }
+
+    src += 15; dst += 15;  /* adjust for any scalar finishing. */
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        *dst = ((float) *src) * DIVBY128;
+        i--; src--; dst--;
+    }
+
+    cvt->len_cvt *= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx512f")
+SDL_Convert_U8_to_F32_AVX512(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
-    static SDL_bool converters_chosen = SDL_FALSE;
+    const Uint8 *src = ((const Uint8 *) (cvt->buf + cvt->len_cvt)) - 1;
+    float *dst = ((float *) (cvt->buf + cvt->len_cvt * 4)) - 1;
+    int i;
 
-    if (converters_chosen) {
-        return;
+    LOG_DEBUG_CONVERT("AUDIO_U8", "AUDIO_F32 (using AVX-512)");
+
+    /* Get dst aligned to 64 bytes (since buffer is growing, we don't have to worry about overreading from src) */
+    for (i = cvt->len_cvt; i && (((size_t) (dst-15)) & 63); --i, --src, --dst) {
+        *dst = (((float) *src) * DIVBY128) - 1.0f;
     }
 
-#define SET_CONVERTER_FUNCS(fntype) \
+    src -= 15; dst -= 15;  /* adjust to read AVX-512 blocks from the start. */
+    SDL_assert(!i || ((((size_t) dst) & 63) == 0));
+
+    {
+        /* src alignment doesn't matter for AVX-512 loads, so no need to check it. */
+        const __m512 divby128 = _mm512_set1_ps(DIVBY128);
+        const __m512 minus1 = _mm512_set1_ps(-1.0f);
+        while (i >= 16) {   /* 16 * 8-bit */
+            _mm512_store_ps(dst, _mm512_add_ps(_mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i *) src))), divby128), minus1));
+            i -= 16; src -= 16; dst -= 16;
+        }
+    }
+
+    src += 15; dst += 15;  /* adjust for any scalar finishing. */
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        *dst = (((float) *src) * DIVBY128) - 1.0f;
+        i--; src--; dst--;
+    }
+
+    cvt->len_cvt *= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx512f")
+SDL_Convert_S16_to_F32_AVX512(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = ((const Sint16 *) (cvt->buf + cvt->len_cvt)) - 1;
+    float *dst = ((float *) (cvt->buf + cvt->len_cvt * 2)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S16", "AUDIO_F32 (using AVX-512)");
+
+    /* Get dst aligned to 64 bytes (since buffer is growing, we don't have to worry about overreading from src) */
+    for (i = cvt->len_cvt / sizeof (Sint16); i && (((size_t) (dst-15)) & 63); --i, --src, --dst) {
+        *dst = ((float) *src) * DIVBY32768;
+    }
+
+    src -= 15; dst -= 15;  /* adjust to read AVX-512 blocks from the start. */
+    SDL_assert(!i || ((((size_t) dst) & 63) == 0));
+
+    {
+        /* src alignment doesn't matter for AVX-512 loads, so no need to check it. */
+        const __m512 divby32768 = _mm512_set1_ps(DIVBY32768);
+        while (i >= 16) {   /* 16 * 16-bit */
+            _mm512_store_ps(dst, _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i *) src))), divby32768));
+            i -= 16; src -= 16; dst -= 16;
+        }
+    }
+
+    src += 15; dst += 15;  /* adjust for any scalar finishing. */
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        *dst = ((float) *src) * DIVBY32768;
+        i--; src--; dst--;
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx512f")
+SDL_Convert_U16_to_F32_AVX512(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Uint16 *src = ((const Uint16 *) (cvt->buf + cvt->len_cvt)) - 1;
+    float *dst = ((float *) (cvt->buf + cvt->len_cvt * 2)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_U16", "AUDIO_F32 (using AVX-512)");
+
+    /* Get dst aligned to 64 bytes (since buffer is growing, we don't have to worry about overreading from src) */
+    for (i = cvt->len_cvt / sizeof (Sint16); i && (((size_t) (dst-15)) & 63); --i, --src, --dst) {
+        *dst = (((float) *src) * DIVBY32768) - 1.0f;
+    }
+
+    src -= 15; dst -= 15;  /* adjust to read AVX-512 blocks from the start. */
+    SDL_assert(!i || ((((size_t) dst) & 63) == 0));
+
+    {
+        /* src alignment doesn't matter for AVX-512 loads, so no need to check it. */
+        const __m512 divby32768 = _mm512_set1_ps(DIVBY32768);
+        const __m512 minus1 = _mm512_set1_ps(-1.0f);
+        while (i >= 16) {   /* 16 * 16-bit */
+            _mm512_store_ps(dst, _mm512_add_ps(_mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *) src))), divby32768), minus1));
+            i -= 16; src -= 16; dst -= 16;
+        }
+    }
+
+    src += 15; dst += 15;  /* adjust for any scalar finishing. */
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        *dst = (((float) *src) * DIVBY32768) - 1.0f;
+        i--; src--; dst--;
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx512f")
+SDL_Convert_S32_to_F32_AVX512(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint32 *src = (const Sint32 *) cvt->buf;
+    float *dst = (float *) cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S32", "AUDIO_F32 (using AVX-512)");
+
+    /* Get dst aligned to 64 bytes */
+    for (i = cvt->len_cvt / sizeof (Sint32); i && (((size_t) dst) & 63); --i, ++src, ++dst) {
+        *dst = ((float) (*src>>8)) * DIVBY8388607;
+    }
+
+    SDL_assert(!i || ((((size_t) dst) & 63) == 0));
+
+    {
+        /* src and dst are the same buffer, so src is aligned too. */
+        const __m512 divby8388607 = _mm512_set1_ps(DIVBY8388607);
+        while (i >= 16) {   /* 16 * sint32 */
+            /* shift out lowest bits so int fits in a float32. Small precision loss, but much faster. */
+            _mm512_store_ps(dst, _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_srai_epi32(_mm512_load_si512((const void *) src), 8)), divby8388607));
+            i -= 16; src += 16; dst += 16;
+        }
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        *dst = ((float) (*src>>8)) * DIVBY8388607;
+        i--; src++; dst++;
+    }
+
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx512f")
+SDL_Convert_F32_to_S8_AVX512(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) cvt->buf;
+    Sint8 *dst = (Sint8 *) cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S8 (using AVX-512)");
+
+    /* Get dst aligned to 16 bytes */
+    for (i = cvt->len_cvt / sizeof (float); i && (((size_t) dst) & 15); --i, ++src, ++dst) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 127;
+        } else if (sample <= -1.0f) {
+            *dst = -128;
+        } else {
+            *dst = (Sint8)(sample * 127.0f);
+        }
+    }
+
+    SDL_assert(!i || ((((size_t) dst) & 15) == 0));
+
+    {
+        /* src alignment doesn't matter for AVX-512 loads, so no need to check it. */
+        const __m512 one = _mm512_set1_ps(1.0f);
+        const __m512 negone = _mm512_set1_ps(-1.0f);
+        const __m512 mulby127 = _mm512_set1_ps(127.0f);
+        while (i >= 16) {   /* 16 * float32 */
+            /* load 16 floats, clamp, convert to sint32, narrow to sint8 with saturation, store out. */
+            _mm_store_si128((__m128i *) dst, _mm512_cvtsepi32_epi8(_mm512_cvtps_epi32(_mm512_mul_ps(_mm512_min_ps(_mm512_max_ps(negone, _mm512_loadu_ps(src)), one), mulby127))));
+            i -= 16; src += 16; dst += 16;
+        }
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 127;
+        } else if (sample <= -1.0f) {
+            *dst = -128;
+        } else {
+            *dst = (Sint8)(sample * 127.0f);
+        }
+        i--; src++; dst++;
+    }
+
+    cvt->len_cvt /= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S8);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx512f")
+SDL_Convert_F32_to_U8_AVX512(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) cvt->buf;
+    Uint8 *dst = (Uint8 *) cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_U8 (using AVX-512)");
+
+    /* Get dst aligned to 16 bytes */
+    for (i = cvt->len_cvt / sizeof (float); i && (((size_t) dst) & 15); --i, ++src, ++dst) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 255;
+        } else if (sample <= -1.0f) {
+            *dst = 0;
+        } else {
+            *dst = (Uint8)((sample + 1.0f) * 127.0f);
+        }
+    }
+
+    SDL_assert(!i || ((((size_t) dst) & 15) == 0));
+
+    {
+        /* src alignment doesn't matter for AVX-512 loads, so no need to check it. */
+        const __m512 one = _mm512_set1_ps(1.0f);
+        const __m512 negone = _mm512_set1_ps(-1.0f);
+        const __m512 mulby127 = _mm512_set1_ps(127.0f);
+        while (i >= 16) {   /* 16 * float32 */
+            /* load 16 floats, clamp, convert to sint32 (all positive now), narrow to uint8, store out. */
+            _mm_store_si128((__m128i *) dst, _mm512_cvtusepi32_epi8(_mm512_cvtps_epi32(_mm512_mul_ps(_mm512_add_ps(_mm512_min_ps(_mm512_max_ps(negone, _mm512_loadu_ps(src)), one), one), mulby127))));
+            i -= 16; src += 16; dst += 16;
+        }
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 255;
+        } else if (sample <= -1.0f) {
+            *dst = 0;
+        } else {
+            *dst = (Uint8)((sample + 1.0f) * 127.0f);
+        }
+        i--; src++; dst++;
+    }
+
+    cvt->len_cvt /= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_U8);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx512f")
+SDL_Convert_F32_to_S16_AVX512(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) cvt->buf;
+    Sint16 *dst = (Sint16 *) cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S16 (using AVX-512)");
+
+    /* Get dst aligned to 32 bytes */
+    for (i = cvt->len_cvt / sizeof (float); i && (((size_t) dst) & 31); --i, ++src, ++dst) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 32767;
+        } else if (sample <= -1.0f) {
+            *dst = -32768;
+        } else {
+            *dst = (Sint16)(sample * 32767.0f);
+        }
+    }
+
+    SDL_assert(!i || ((((size_t) dst) & 31) == 0));
+
+    {
+        /* src alignment doesn't matter for AVX-512 loads, so no need to check it. */
+        const __m512 one = _mm512_set1_ps(1.0f);
+        const __m512 negone = _mm512_set1_ps(-1.0f);
+        const __m512 mulby32767 = _mm512_set1_ps(32767.0f);
+        while (i >= 16) {   /* 16 * float32 */
+            /* load 16 floats, clamp, convert to sint32, narrow to sint16 with saturation, store out. */
+            _mm256_store_si256((__m256i *) dst, _mm512_cvtsepi32_epi16(_mm512_cvtps_epi32(_mm512_mul_ps(_mm512_min_ps(_mm512_max_ps(negone, _mm512_loadu_ps(src)), one), mulby32767))));
+            i -= 16; src += 16; dst += 16;
+        }
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 32767;
+        } else if (sample <= -1.0f) {
+            *dst = -32768;
+        } else {
+            *dst = (Sint16)(sample * 32767.0f);
+        }
+        i--; src++; dst++;
+    }
+
+    cvt->len_cvt /= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx512f")
+SDL_Convert_F32_to_U16_AVX512(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) cvt->buf;
+    Uint16 *dst = (Uint16 *) cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_U16 (using AVX-512)");
+
+    /* Get dst aligned to 32 bytes */
+    for (i = cvt->len_cvt / sizeof (float); i && (((size_t) dst) & 31); --i, ++src, ++dst) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 65535;
+        } else if (sample <= -1.0f) {
+            *dst = 0;
+        } else {
+            *dst = (Uint16)((sample + 1.0f) * 32767.0f);
+        }
+    }
+
+    SDL_assert(!i || ((((size_t) dst) & 31) == 0));
+
+    {
+        /* src alignment doesn't matter for AVX-512 loads, so no need to check it. */
+        /* Same signed-pack-and-flip-the-top-bit trick as the SSE2 version, so both give the same results. */
+        const __m512 one = _mm512_set1_ps(1.0f);
+        const __m512 negone = _mm512_set1_ps(-1.0f);
+        const __m512 mulby32767 = _mm512_set1_ps(32767.0f);
+        const __m256i topbit = _mm256_set1_epi16(-32768);
+        while (i >= 16) {   /* 16 * float32 */
+            /* load 16 floats, clamp, convert to sint32, narrow to sint16, xor top bit, store out. */
+            _mm256_store_si256((__m256i *) dst, _mm256_xor_si256(_mm512_cvtsepi32_epi16(_mm512_cvtps_epi32(_mm512_mul_ps(_mm512_min_ps(_mm512_max_ps(negone, _mm512_loadu_ps(src)), one), mulby32767))), topbit));
+            i -= 16; src += 16; dst += 16;
+        }
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 65535;
+        } else if (sample <= -1.0f) {
+            *dst = 0;
+        } else {
+            *dst = (Uint16)((sample + 1.0f) * 32767.0f);
+        }
+        i--; src++; dst++;
+    }
+
+    cvt->len_cvt /= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_U16SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx512f")
+SDL_Convert_F32_to_S32_AVX512(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) cvt->buf;
+    Sint32 *dst = (Sint32 *) cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S32 (using AVX-512)");
+
+    /* Get dst aligned to 64 bytes */
+    for (i = cvt->len_cvt / sizeof (float); i && (((size_t) dst) & 63); --i, ++src, ++dst) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 2147483647;
+        } else if (sample <= -1.0f) {
+            *dst = (Sint32) -2147483648LL;
+        } else {
+            *dst = ((Sint32)(sample * 8388607.0f)) << 8;
+        }
+    }
+
+    SDL_assert(!i || ((((size_t) dst) & 63) == 0));
+
+    {
+        /* src alignment doesn't matter for AVX-512 loads, so no need to check it. */
+        const __m512 one = _mm512_set1_ps(1.0f);
+        const __m512 negone = _mm512_set1_ps(-1.0f);
+        const __m512 mulby8388607 = _mm512_set1_ps(8388607.0f);
+        while (i >= 16) {   /* 16 * float32 */
+            /* load 16 floats, clamp, convert to sint32, store out. */
+            _mm512_store_si512((void *) dst, _mm512_slli_epi32(_mm512_cvtps_epi32(_mm512_mul_ps(_mm512_min_ps(_mm512_max_ps(negone, _mm512_loadu_ps(src)), one), mulby8388607)), 8));
+            i -= 16; src += 16; dst += 16;
+        }
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 2147483647;
+        } else if (sample <= -1.0f) {
+            *dst = (Sint32) -2147483648LL;
+        } else {
+            *dst = ((Sint32)(sample * 8388607.0f)) << 8;
+        }
+        i--; src++; dst++;
+    }
+
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S32SYS);
+    }
+}
+#endif
+
+
+#if HAVE_NEON_INTRINSICS
+static void SDLCALL
+SDL_Convert_S8_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint8 *src = ((const Sint8 *) (cvt->buf + cvt->len_cvt)) - 1;
+    float *dst = ((float *) (cvt->buf + cvt->len_cvt * 4)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S8", "AUDIO_F32 (using NEON)");
+
+    /* Get dst aligned to 16 bytes (since buffer is growing, we don't have to worry about overreading from src) */
+    for (i = cvt->len_cvt; i && (((size_t) (dst-15)) & 15); --i, --src, --dst) {
+        *dst = ((float) *src) * DIVBY128;
+    }
+
+    src -= 15; dst -= 15;  /* adjust to read NEON blocks from the start. */
+    SDL_assert(!i || ((((size_t) dst) & 15) == 0));
+
+    /* Make sure src is aligned too. */
+    if ((((size_t) src) & 15) == 0) {
+        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
+        const int8_t *mmsrc = (const int8_t *) src;
+        const float32x4_t divby128 = vdupq_n_f32(DIVBY128);
+        while (i >= 16) {   /* 16 * 8-bit */
+            const int8x16_t bytes = vld1q_s8(mmsrc);  /* get 16 sint8 into a NEON register. */
+            const int16x8_t int16hi = vmovl_s8(vget_high_s8(bytes));  /* convert top 8 bytes to 8 int16 */
+            const int16x8_t int16lo = vmovl_s8(vget_low_s8(bytes));   /* convert bottom 8 bytes to 8 int16 */
+            /* split int16 to two int32, then convert to float, then multiply to normalize, store. */
+            vst1q_f32(dst, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(int16lo))), divby128));
+            vst1q_f32(dst+4, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(int16lo))), divby128));
+            vst1q_f32(dst+8, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(int16hi))), divby128));
+            vst1q_f32(dst+12, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(int16hi))), divby128));
+            i -= 16; mmsrc -= 16; dst -= 16;
+        }
+
+        src = (const Sint8 *) mmsrc;
+    }
+
+    src += 15; dst += 15;  /* adjust for any scalar finishing. */
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        *dst = ((float) *src) * DIVBY128;
+        i--; src--; dst--;
+    }
+
+    cvt->len_cvt *= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_U8_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Uint8 *src = ((const Uint8 *) (cvt->buf + cvt->len_cvt)) - 1;
+    float *dst = ((float *) (cvt->buf + cvt->len_cvt * 4)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_U8", "AUDIO_F32 (using NEON)");
+
+    /* Get dst aligned to 16 bytes (since buffer is growing, we don't have to worry about overreading from src) */
+    for (i = cvt->len_cvt; i && (((size_t) (dst-15)) & 15); --i, --src, --dst) {
+        *dst = (((float) *src) * DIVBY128) - 1.0f;
+    }
+
+    src -= 15; dst -= 15;  /* adjust to read NEON blocks from the start. */
+    SDL_assert(!i || ((((size_t) dst) & 15) == 0));
+
+    /* Make sure src is aligned too. */
+    if ((((size_t) src) & 15) == 0) {
+        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
+        const uint8_t *mmsrc = (const uint8_t *) src;
+        const float32x4_t divby128 = vdupq_n_f32(DIVBY128);
+        const float32x4_t negone = vdupq_n_f32(-1.0f);
+        while (i >= 16) {   /* 16 * 8-bit */
+            const uint8x16_t bytes = vld1q_u8(mmsrc);  /* get 16 uint8 into a NEON register. */
+            const uint16x8_t uint16hi = vmovl_u8(vget_high_u8(bytes));  /* convert top 8 bytes to 8 uint16 */
+            const uint16x8_t uint16lo = vmovl_u8(vget_low_u8(bytes));   /* convert bottom 8 bytes to 8 uint16 */
+            /* split uint16 to two uint32, then convert to float, then multiply to normalize, subtract to adjust for sign, store. */
+            vst1q_f32(dst, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_low_u16(uint16lo))), divby128));
+            vst1q_f32(dst+4, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_high_u16(uint16lo))), divby128));
+            vst1q_f32(dst+8, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_low_u16(uint16hi))), divby128));
+            vst1q_f32(dst+12, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_high_u16(uint16hi))), divby128));
+            i -= 16; mmsrc -= 16; dst -= 16;
+        }
+
+        src = (const Uint8 *) mmsrc;
+    }
+
+    src += 15; dst += 15;  /* adjust for any scalar finishing. */
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        *dst = (((float) *src) * DIVBY128) - 1.0f;
+        i--; src--; dst--;
+    }
+
+    cvt->len_cvt *= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_S16_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = ((const Sint16 *) (cvt->buf + cvt->len_cvt)) - 1;
+    float *dst = ((float *) (cvt->buf + cvt->len_cvt * 2)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S16", "AUDIO_F32 (using NEON)");
+
+    /* Get dst aligned to 16 bytes (since buffer is growing, we don't have to worry about overreading from src) */
+    for (i = cvt->len_cvt / sizeof (Sint16); i && (((size_t) (dst-7)) & 15); --i, --src, --dst) {
+        *dst = ((float) *src) * DIVBY32768;
+    }
+
+    src -= 7; dst -= 7;  /* adjust to read NEON blocks from the start. */
+    SDL_assert(!i || ((((size_t) dst) & 15) == 0));
+
+    /* Make sure src is aligned too. */
+    if ((((size_t) src) & 15) == 0) {
+        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
+        const float32x4_t divby32768 = vdupq_n_f32(DIVBY32768);
+        while (i >= 8) {   /* 8 * 16-bit */
+            const int16x8_t ints = vld1q_s16((int16_t const *) src);  /* get 8 sint16 into a NEON register. */
+            /* split int16 to two int32, then convert to float, then multiply to normalize, store. */
+            vst1q_f32(dst, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(ints))), divby32768));
+            vst1q_f32(dst+4, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(ints))), divby32768));
+            i -= 8; src -= 8; dst -= 8;
+        }
+    }
+
+    src += 7; dst += 7;  /* adjust for any scalar finishing. */
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        *dst = ((float) *src) * DIVBY32768;
+        i--; src--; dst--;
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_U16_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Uint16 *src = ((const Uint16 *) (cvt->buf + cvt->len_cvt)) - 1;
+    float *dst = ((float *) (cvt->buf + cvt->len_cvt * 2)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_U16", "AUDIO_F32 (using NEON)");
+
+    /* Get dst aligned to 16 bytes (since buffer is growing, we don't have to worry about overreading from src) */
+    for (i = cvt->len_cvt / sizeof (Sint16); i && (((size_t) (dst-7)) & 15); --i, --src, --dst) {
+        *dst = (((float) *src) * DIVBY32768) - 1.0f;
+    }
+
+    src -= 7; dst -= 7;  /* adjust to read NEON blocks from the start. */
+    SDL_assert(!i || ((((size_t) dst) & 15) == 0));
+
+    /* Make sure src is aligned too. */
+    if ((((size_t) src) & 15) == 0) {
+        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
+        const float32x4_t divby32768 = vdupq_n_f32(DIVBY32768);
+        const float32x4_t negone = vdupq_n_f32(-1.0f);
+        while (i >= 8) {   /* 8 * 16-bit */
+            const uint16x8_t uints = vld1q_u16((uint16_t const *) src);  /* get 8 uint16 into a NEON register. */
+            /* split uint16 to two int32, then convert to float, then multiply to normalize, subtract for sign, store. */
+            vst1q_f32(dst, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_low_u16(uints))), divby32768));
+            vst1q_f32(dst+4, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_high_u16(uints))), divby32768));
+            i -= 8; src -= 8; dst -= 8;
+        }
+    }
+
+    src += 7; dst += 7;  /* adjust for any scalar finishing. */
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        *dst = (((float) *src) * DIVBY32768) - 1.0f;
+        i--; src--; dst--;
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_S32_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint32 *src = (const Sint32 *) cvt->buf;
+    float *dst = (float *) cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S32", "AUDIO_F32 (using NEON)");
+
+    /* Get dst aligned to 16 bytes */
+    for (i = cvt->len_cvt / sizeof (Sint32); i && (((size_t) dst) & 15); --i, ++src, ++dst) {
+        *dst = ((float) (*src>>8)) * DIVBY8388607;
+    }
+
+    SDL_assert(!i || ((((size_t) dst) & 15) == 0));
+
+    /* Make sure src is aligned too. */
+    if ((((size_t) src) & 15) == 0) {
+        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
+        const float32x4_t divby8388607 = vdupq_n_f32(DIVBY8388607);
+        const int32_t *mmsrc = (const int32_t *) src;
+        while (i >= 4) {   /* 4 * sint32 */
+            /* shift out lowest bits so int fits in a float32. Small precision loss, but much faster. */
+            vst1q_f32(dst, vmulq_f32(vcvtq_f32_s32(vshrq_n_s32(vld1q_s32(mmsrc), 8)), divby8388607));
+            i -= 4; mmsrc += 4; dst += 4;
+        }
+        src = (const Sint32 *) mmsrc;
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        *dst = ((float) (*src>>8)) * DIVBY8388607;
+        i--; src++; dst++;
+    }
+
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_F32_to_S8_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) cvt->buf;
+    Sint8 *dst = (Sint8 *) cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S8 (using NEON)");
+
+    /* Get dst aligned to 16 bytes */
+    for (i = cvt->len_cvt / sizeof (float); i && (((size_t) dst) & 15); --i, ++src, ++dst) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 127;
+        } else if (sample <= -1.0f) {
+            *dst = -128;
+        } else {
+            *dst = (Sint8)(sample * 127.0f);
+        }
+    }
+
+    SDL_assert(!i || ((((size_t) dst) & 15) == 0));
+
+    /* Make sure src is aligned too. */
+    if ((((size_t) src) & 15) == 0) {
+        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
+        const float32x4_t one = vdupq_n_f32(1.0f);
+        const float32x4_t negone = vdupq_n_f32(-1.0f);
+        const float32x4_t mulby127 = vdupq_n_f32(127.0f);
+        int8_t *mmdst = (int8_t *) dst;
+        while (i >= 16) {   /* 16 * float32 */
+            const int32x4_t ints1 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src)), one), mulby127));  /* load 4 floats, clamp, convert to sint32 */
+            const int32x4_t ints2 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src+4)), one), mulby127));  /* load 4 floats, clamp, convert to sint32 */
+            const int32x4_t ints3 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src+8)), one), mulby127));  /* load 4 floats, clamp, convert to sint32 */
+            const int32x4_t ints4 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src+12)), one), mulby127));  /* load 4 floats, clamp, convert to sint32 */
+            const int8x8_t i8lo = vmovn_s16(vcombine_s16(vmovn_s32(ints1), vmovn_s32(ints2))); /* narrow to sint16, combine, narrow to sint8 */
+            const int8x8_t i8hi = vmovn_s16(vcombine_s16(vmovn_s32(ints3), vmovn_s32(ints4))); /* narrow to sint16, combine, narrow to sint8 */
+            vst1q_s8(mmdst, vcombine_s8(i8lo, i8hi));  /* combine to int8x16_t, store out */
+            i -= 16; src += 16; mmdst += 16;
+        }
+        dst = (Sint8 *) mmdst;
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 127;
+        } else if (sample <= -1.0f) {
+            *dst = -128;
+        } else {
+            *dst = (Sint8)(sample * 127.0f);
+        }
+        i--; src++; dst++;
+    }
+
+    cvt->len_cvt /= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S8);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_F32_to_U8_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) cvt->buf;
+    Uint8 *dst = (Uint8 *) cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_U8 (using NEON)");
+
+    /* Get dst aligned to 16 bytes */
+    for (i = cvt->len_cvt / sizeof (float); i && (((size_t) dst) & 15); --i, ++src, ++dst) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 255;
+        } else if (sample <= -1.0f) {
+            *dst = 0;
+        } else {
+            *dst = (Uint8)((sample + 1.0f) * 127.0f);
+        }
+    }
+
+    SDL_assert(!i || ((((size_t) dst) & 15) == 0));
+
+    /* Make sure src is aligned too. */
+    if ((((size_t) src) & 15) == 0) {
+        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
+        const float32x4_t one = vdupq_n_f32(1.0f);
+        const float32x4_t negone = vdupq_n_f32(-1.0f);
+        const float32x4_t mulby127 = vdupq_n_f32(127.0f);
+        uint8_t *mmdst = (uint8_t *) dst;
+        while (i >= 16) {   /* 16 * float32 */
+            const uint32x4_t uints1 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src)), one), one), mulby127));  /* load 4 floats, clamp, convert to uint32 */
+            const uint32x4_t uints2 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src+4)), one), one), mulby127));  /* load 4 floats, clamp, convert to uint32 */
+            const uint32x4_t uints3 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src+8)), one), one), mulby127));  /* load 4 floats, clamp, convert to uint32 */
+            const uint32x4_t uints4 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src+12)), one), one), mulby127));  /* load 4 floats, clamp, convert to uint32 */
+            const uint8x8_t ui8lo = vmovn_u16(vcombine_u16(vmovn_u32(uints1), vmovn_u32(uints2))); /* narrow to uint16, combine, narrow to uint8 */
+            const uint8x8_t ui8hi = vmovn_u16(vcombine_u16(vmovn_u32(uints3), vmovn_u32(uints4))); /* narrow to uint16, combine, narrow to uint8 */
+            vst1q_u8(mmdst, vcombine_u8(ui8lo, ui8hi));  /* combine to uint8x16_t, store out */
+            i -= 16; src += 16; mmdst += 16;
+        }
+
+        dst = (Uint8 *) mmdst;
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 255;
+        } else if (sample <= -1.0f) {
+            *dst = 0;
+        } else {
+            *dst = (Uint8)((sample + 1.0f) * 127.0f);
+        }
+        i--; src++; dst++;
+    }
+
+    cvt->len_cvt /= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_U8);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_F32_to_S16_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) cvt->buf;
+    Sint16 *dst = (Sint16 *) cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S16 (using NEON)");
+
+    /* Get dst aligned to 16 bytes */
+    for (i = cvt->len_cvt / sizeof (float); i && (((size_t) dst) & 15); --i, ++src, ++dst) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 32767;
+        } else if (sample <= -1.0f) {
+            *dst = -32768;
+        } else {
+            *dst = (Sint16)(sample * 32767.0f);
+        }
+    }
+
+    SDL_assert(!i || ((((size_t) dst) & 15) == 0));
+
+    /* Make sure src is aligned too. */
+    if ((((size_t) src) & 15) == 0) {
+        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
+        const float32x4_t one = vdupq_n_f32(1.0f);
+        const float32x4_t negone = vdupq_n_f32(-1.0f);
+        const float32x4_t mulby32767 = vdupq_n_f32(32767.0f);
+        int16_t *mmdst = (int16_t *) dst;
+        while (i >= 8) {   /* 8 * float32 */
+            const int32x4_t ints1 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src)), one), mulby32767));  /* load 4 floats, clamp, convert to sint32 */
+            const int32x4_t ints2 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src+4)), one), mulby32767));  /* load 4 floats, clamp, convert to sint32 */
+            vst1q_s16(mmdst, vcombine_s16(vmovn_s32(ints1), vmovn_s32(ints2)));  /* narrow to sint16, combine, store out. */
+            i -= 8; src += 8; mmdst += 8;
+        }
+        dst = (Sint16 *) mmdst;
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 32767;
+        } else if (sample <= -1.0f) {
+            *dst = -32768;
+        } else {
+            *dst = (Sint16)(sample * 32767.0f);
+        }
+        i--; src++; dst++;
+    }
+
+    cvt->len_cvt /= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_F32_to_U16_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) cvt->buf;
+    Uint16 *dst = (Uint16 *) cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_U16 (using NEON)");
+
+    /* Get dst aligned to 16 bytes */
+    for (i = cvt->len_cvt / sizeof (float); i && (((size_t) dst) & 15); --i, ++src, ++dst) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 65535;
+        } else if (sample <= -1.0f) {
+            *dst = 0;
+        } else {
+            *dst = (Uint16)((sample + 1.0f) * 32767.0f);
+        }
+    }
+
+    SDL_assert(!i || ((((size_t) dst) & 15) == 0));
+
+    /* Make sure src is aligned too. */
+    if ((((size_t) src) & 15) == 0) {
+        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
+        const float32x4_t one = vdupq_n_f32(1.0f);
+        const float32x4_t negone = vdupq_n_f32(-1.0f);
+        const float32x4_t mulby32767 = vdupq_n_f32(32767.0f);
+        uint16_t *mmdst = (uint16_t *) dst;
+        while (i >= 8) {   /* 8 * float32 */
+            const uint32x4_t uints1 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src)), one), one), mulby32767));  /* load 4 floats, clamp, convert to uint32 */
+            const uint32x4_t uints2 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src+4)), one), one), mulby32767));  /* load 4 floats, clamp, convert to uint32 */
+            vst1q_u16(mmdst, vcombine_u16(vmovn_u32(uints1), vmovn_u32(uints2)));  /* narrow to uint16, combine, store out. */
+            i -= 8; src += 8; mmdst += 8;
+        }
+        dst = (Uint16 *) mmdst;
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 65535;
+        } else if (sample <= -1.0f) {
+            *dst = 0;
+        } else {
+            *dst = (Uint16)((sample + 1.0f) * 32767.0f);
+        }
+        i--; src++; dst++;
+    }
+
+    cvt->len_cvt /= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_U16SYS);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_F32_to_S32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) cvt->buf;
+    Sint32 *dst = (Sint32 *) cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S32 (using NEON)");
+
+    /* Get dst aligned to 16 bytes */
+    for (i = cvt->len_cvt / sizeof (float); i && (((size_t) dst) & 15); --i, ++src, ++dst) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 2147483647;
+        } else if (sample <= -1.0f) {
+            *dst = (-2147483647) - 1;
+        } else {
+            *dst = ((Sint32)(sample * 8388607.0f)) << 8;
+        }
+    }
+
+    SDL_assert(!i || ((((size_t) dst) & 15) == 0));
+    SDL_assert(!i || ((((size_t) src) & 15) == 0));
+
+    {
+        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
+        const float32x4_t one = vdupq_n_f32(1.0f);
+        const float32x4_t negone = vdupq_n_f32(-1.0f);
+        const float32x4_t mulby8388607 = vdupq_n_f32(8388607.0f);
+        int32_t *mmdst = (int32_t *) dst;
+        while (i >= 4) {   /* 4 * float32 */
+            vst1q_s32(mmdst, vshlq_n_s32(vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src)), one), mulby8388607)), 8));
+            i -= 4; src += 4; mmdst += 4;
+        }
+        dst = (Sint32 *) mmdst;
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 2147483647;
+        } else if (sample <= -1.0f) {
+            *dst = (-2147483647) - 1;
+        } else {
+            *dst = ((Sint32)(sample * 8388607.0f)) << 8;
+        }
+        i--; src++; dst++;
+    }
+
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S32SYS);
+    }
+}
+#endif
+
+
+/* Integer to integer conversions, for when the rate and channels don't
+   change and there's no reason to go through float. Everything converts
+   to or from AUDIO_S16SYS, by shifting and flipping sign bits, so a
+   round trip through a wider format is lossless. */
+
+static void SDLCALL
+SDL_Convert_S8_to_S16_Scalar(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint8 *src = ((const Sint8 *) (cvt->buf + cvt->len_cvt)) - 1;
+    Sint16 *dst = ((Sint16 *) (cvt->buf + cvt->len_cvt * 2)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S8", "AUDIO_S16");
+
+    for (i = cvt->len_cvt; i; --i, --src, --dst) {
+        *dst = (Sint16) (((Uint16) (Uint8) *src) << 8);
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_U8_to_S16_Scalar(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Uint8 *src = ((const Uint8 *) (cvt->buf + cvt->len_cvt)) - 1;
+    Sint16 *dst = ((Sint16 *) (cvt->buf + cvt->len_cvt * 2)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_U8", "AUDIO_S16");
+
+    for (i = cvt->len_cvt; i; --i, --src, --dst) {
+        *dst = (Sint16) (((Uint16) (*src ^ 0x80)) << 8);
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_U16_to_S16_Scalar(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    Uint16 *ptr = (Uint16 *) cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_U16", "AUDIO_S16");
+
+    for (i = cvt->len_cvt / sizeof (Uint16); i; --i, ++ptr) {
+        *ptr ^= 0x8000;
+    }
+
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_S32_to_S16_Scalar(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint32 *src = (const Sint32 *) cvt->buf;
+    Sint16 *dst = (Sint16 *) cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S32", "AUDIO_S16");
+
+    for (i = cvt->len_cvt / sizeof (Sint32); i; --i, ++src, ++dst) {
+        *dst = (Sint16) (*src >> 16);
+    }
+
+    cvt->len_cvt /= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_S16_to_S8_Scalar(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *) cvt->buf;
+    Sint8 *dst = (Sint8 *) cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S16", "AUDIO_S8");
+
+    for (i = cvt->len_cvt / sizeof (Sint16); i; --i, ++src, ++dst) {
+        *dst = (Sint8) (*src >> 8);
+    }
+
+    cvt->len_cvt /= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S8);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_S16_to_U8_Scalar(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *) cvt->buf;
+    Uint8 *dst = (Uint8 *) cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S16", "AUDIO_U8");
+
+    for (i = cvt->len_cvt / sizeof (Sint16); i; --i, ++src, ++dst) {
+        *dst = (Uint8) ((*src >> 8) ^ 0x80);
+    }
+
+    cvt->len_cvt /= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_U8);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_S16_to_U16_Scalar(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    Uint16 *ptr = (Uint16 *) cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S16", "AUDIO_U16");
+
+    for (i = cvt->len_cvt / sizeof (Uint16); i; --i, ++ptr) {
+        *ptr ^= 0x8000;
+    }
+
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_U16SYS);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_S16_to_S32_Scalar(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = ((const Sint16 *) (cvt->buf + cvt->len_cvt)) - 1;
+    Sint32 *dst = ((Sint32 *) (cvt->buf + cvt->len_cvt * 2)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S16", "AUDIO_S32");
+
+    for (i = cvt->len_cvt / sizeof (Sint16); i; --i, --src, --dst) {
+        *dst = (Sint32) (((Uint32) (Uint16) *src) << 16);
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S32SYS);
+    }
+}
+
+#if HAVE_SSE2_INTRINSICS
+/* These just use unaligned loads and stores; if the memory at runtime is
+   aligned, it'll be just as fast on modern processors. */
+static void SDLCALL
+SDL_Convert_S8_to_S16_SSE2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint8 *src = (const Sint8 *) cvt->buf;
+    Sint16 *dst = (Sint16 *) cvt->buf;
+    const __m128i zero = _mm_setzero_si128();
+    int i = cvt->len_cvt;
+
+    LOG_DEBUG_CONVERT("AUDIO_S8", "AUDIO_S16 (using SSE2)");
+
+    /* convert backwards, since output is growing in-place; leftovers at the end go first. */
+    while (i & 15) {
+        --i;
+        dst[i] = (Sint16) (((Uint16) (Uint8) src[i]) << 8);
+    }
+
+    while (i) {
+        const __m128i bytes = _mm_loadu_si128((const __m128i *) (src + i - 16));
+        /* put each byte in the top half of a 16-bit lane. */
+        _mm_storeu_si128((__m128i *) (dst + i - 16), _mm_unpacklo_epi8(zero, bytes));
+        _mm_storeu_si128((__m128i *) (dst + i - 8), _mm_unpackhi_epi8(zero, bytes));
+        i -= 16;
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_U8_to_S16_SSE2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Uint8 *src = (const Uint8 *) cvt->buf;
+    Sint16 *dst = (Sint16 *) cvt->buf;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i flipsign = _mm_set1_epi8((char) 0x80);
+    int i = cvt->len_cvt;
+
+    LOG_DEBUG_CONVERT("AUDIO_U8", "AUDIO_S16 (using SSE2)");
+
+    /* convert backwards, since output is growing in-place; leftovers at the end go first. */
+    while (i & 15) {
+        --i;
+        dst[i] = (Sint16) (((Uint16) (src[i] ^ 0x80)) << 8);
+    }
+
+    while (i) {
+        const __m128i bytes = _mm_xor_si128(_mm_loadu_si128((const __m128i *) (src + i - 16)), flipsign);
+        _mm_storeu_si128((__m128i *) (dst + i - 16), _mm_unpacklo_epi8(zero, bytes));
+        _mm_storeu_si128((__m128i *) (dst + i - 8), _mm_unpackhi_epi8(zero, bytes));
+        i -= 16;
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+
+static void
+FlipSign16_SSE2(Uint16 *ptr, const int samples)
+{
+    const __m128i flipsign = _mm_set1_epi16((short) 0x8000);
+    int i;
+
+    for (i = 0; i + 8 <= samples; i += 8) {
+        __m128i *block = (__m128i *) (ptr + i);
+        _mm_storeu_si128(block, _mm_xor_si128(_mm_loadu_si128(block), flipsign));
+    }
+
+    for (; i < samples; i++) {
+        ptr[i] ^= 0x8000;
+    }
+}
+
+static void SDLCALL
+SDL_Convert_U16_to_S16_SSE2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    LOG_DEBUG_CONVERT("AUDIO_U16", "AUDIO_S16 (using SSE2)");
+
+    FlipSign16_SSE2((Uint16 *) cvt->buf, cvt->len_cvt / sizeof (Uint16));
+
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_S32_to_S16_SSE2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint32 *src = (const Sint32 *) cvt->buf;
+    Sint16 *dst = (Sint16 *) cvt->buf;
+    const int samples = cvt->len_cvt / sizeof (Sint32);
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S32", "AUDIO_S16 (using SSE2)");
+
+    /* shrinking in-place, so go forwards. After the shift, everything fits in 16 bits, so the pack doesn't saturate. */
+    for (i = 0; i + 8 <= samples; i += 8) {
+        const __m128i a = _mm_srai_epi32(_mm_loadu_si128((const __m128i *) (src + i)), 16);
+        const __m128i b = _mm_srai_epi32(_mm_loadu_si128((const __m128i *) (src + i + 4)), 16);
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_packs_epi32(a, b));
+    }
+
+    for (; i < samples; i++) {
+        dst[i] = (Sint16) (src[i] >> 16);
+    }
+
+    cvt->len_cvt /= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_S16_to_S8_SSE2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *) cvt->buf;
+    Sint8 *dst = (Sint8 *) cvt->buf;
+    const int samples = cvt->len_cvt / sizeof (Sint16);
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S16", "AUDIO_S8 (using SSE2)");
+
+    /* shrinking in-place, so go forwards. */
+    for (i = 0; i + 16 <= samples; i += 16) {
+        const __m128i a = _mm_srai_epi16(_mm_loadu_si128((const __m128i *) (src + i)), 8);
+        const __m128i b = _mm_srai_epi16(_mm_loadu_si128((const __m128i *) (src + i + 8)), 8);
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_packs_epi16(a, b));
+    }
+
+    for (; i < samples; i++) {
+        dst[i] = (Sint8) (src[i] >> 8);
+    }
+
+    cvt->len_cvt /= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S8);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_S16_to_U8_SSE2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *) cvt->buf;
+    Uint8 *dst = (Uint8 *) cvt->buf;
+    const __m128i flipsign = _mm_set1_epi8((char) 0x80);
+    const int samples = cvt->len_cvt / sizeof (Sint16);
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S16", "AUDIO_U8 (using SSE2)");
+
+    /* shrinking in-place, so go forwards. */
+    for (i = 0; i + 16 <= samples; i += 16) {
+        const __m128i a = _mm_srai_epi16(_mm_loadu_si128((const __m128i *) (src + i)), 8);
+        const __m128i b = _mm_srai_epi16(_mm_loadu_si128((const __m128i *) (src + i + 8)), 8);
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_xor_si128(_mm_packs_epi16(a, b), flipsign));
+    }
+
+    for (; i < samples; i++) {
+        dst[i] = (Uint8) ((src[i] >> 8) ^ 0x80);
+    }
+
+    cvt->len_cvt /= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_U8);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_S16_to_U16_SSE2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    LOG_DEBUG_CONVERT("AUDIO_S16", "AUDIO_U16 (using SSE2)");
+
+    FlipSign16_SSE2((Uint16 *) cvt->buf, cvt->len_cvt / sizeof (Uint16));
+
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_U16SYS);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_S16_to_S32_SSE2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *) cvt->buf;
+    Sint32 *dst = (Sint32 *) cvt->buf;
+    const __m128i zero = _mm_setzero_si128();
+    int i = cvt->len_cvt / sizeof (Sint16);
+
+    LOG_DEBUG_CONVERT("AUDIO_S16", "AUDIO_S32 (using SSE2)");
+
+    /* convert backwards, since output is growing in-place; leftovers at the end go first. */
+    while (i & 7) {
+        --i;
+        dst[i] = (Sint32) (((Uint32) (Uint16) src[i]) << 16);
+    }
+
+    while (i) {
+        const __m128i ints = _mm_loadu_si128((const __m128i *) (src + i - 8));
+        /* put each sint16 in the top half of a 32-bit lane. */
+        _mm_storeu_si128((__m128i *) (dst + i - 8), _mm_unpacklo_epi16(zero, ints));
+        _mm_storeu_si128((__m128i *) (dst + i - 4), _mm_unpackhi_epi16(zero, ints));
+        i -= 8;
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S32SYS);
+    }
+}
+#endif
+
+#if HAVE_AVX2_INTRINSICS
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_S8_to_S16_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint8 *src = (const Sint8 *) cvt->buf;
+    Sint16 *dst = (Sint16 *) cvt->buf;
+    int i = cvt->len_cvt;
+
+    LOG_DEBUG_CONVERT("AUDIO_S8", "AUDIO_S16 (using AVX2)");
+
+    /* convert backwards, since output is growing in-place; leftovers at the end go first. */
+    while (i & 31) {
+        --i;
+        dst[i] = (Sint16) (((Uint16) (Uint8) src[i]) << 8);
+    }
+
+    while (i) {
+        const __m128i a = _mm_loadu_si128((const __m128i *) (src + i - 32));
+        const __m128i b = _mm_loadu_si128((const __m128i *) (src + i - 16));
+        _mm256_storeu_si256((__m256i *) (dst + i - 32), _mm256_slli_epi16(_mm256_cvtepi8_epi16(a), 8));
+        _mm256_storeu_si256((__m256i *) (dst + i - 16), _mm256_slli_epi16(_mm256_cvtepi8_epi16(b), 8));
+        i -= 32;
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_U8_to_S16_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Uint8 *src = (const Uint8 *) cvt->buf;
+    Sint16 *dst = (Sint16 *) cvt->buf;
+    const __m256i flipsign = _mm256_set1_epi16((short) 0x8000);
+    int i = cvt->len_cvt;
+
+    LOG_DEBUG_CONVERT("AUDIO_U8", "AUDIO_S16 (using AVX2)");
+
+    /* convert backwards, since output is growing in-place; leftovers at the end go first. */
+    while (i & 31) {
+        --i;
+        dst[i] = (Sint16) (((Uint16) (src[i] ^ 0x80)) << 8);
+    }
+
+    while (i) {
+        const __m128i a = _mm_loadu_si128((const __m128i *) (src + i - 32));
+        const __m128i b = _mm_loadu_si128((const __m128i *) (src + i - 16));
+        _mm256_storeu_si256((__m256i *) (dst + i - 32), _mm256_xor_si256(_mm256_slli_epi16(_mm256_cvtepu8_epi16(a), 8), flipsign));
+        _mm256_storeu_si256((__m256i *) (dst + i - 16), _mm256_xor_si256(_mm256_slli_epi16(_mm256_cvtepu8_epi16(b), 8), flipsign));
+        i -= 32;
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+
+static void SDL_TARGETING("avx2")
+FlipSign16_AVX2(Uint16 *ptr, const int samples)
+{
+    const __m256i flipsign = _mm256_set1_epi16((short) 0x8000);
+    int i;
+
+    for (i = 0; i + 16 <= samples; i += 16) {
+        __m256i *block = (__m256i *) (ptr + i);
+        _mm256_storeu_si256(block, _mm256_xor_si256(_mm256_loadu_si256(block), flipsign));
+    }
+
+    for (; i < samples; i++) {
+        ptr[i] ^= 0x8000;
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_U16_to_S16_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    LOG_DEBUG_CONVERT("AUDIO_U16", "AUDIO_S16 (using AVX2)");
+
+    FlipSign16_AVX2((Uint16 *) cvt->buf, cvt->len_cvt / sizeof (Uint16));
+
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_S32_to_S16_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint32 *src = (const Sint32 *) cvt->buf;
+    Sint16 *dst = (Sint16 *) cvt->buf;
+    const int samples = cvt->len_cvt / sizeof (Sint32);
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S32", "AUDIO_S16 (using AVX2)");
+
+    /* shrinking in-place, so go forwards. The pack works within 128-bit lanes, so put the halves back in order after. */
+    for (i = 0; i + 16 <= samples; i += 16) {
+        const __m256i a = _mm256_srai_epi32(_mm256_loadu_si256((const __m256i *) (src + i)), 16);
+        const __m256i b = _mm256_srai_epi32(_mm256_loadu_si256((const __m256i *) (src + i + 8)), 16);
+        _mm256_storeu_si256((__m256i *) (dst + i), _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xD8));
+    }
+
+    for (; i < samples; i++) {
+        dst[i] = (Sint16) (src[i] >> 16);
+    }
+
+    cvt->len_cvt /= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_S16_to_S8_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *) cvt->buf;
+    Sint8 *dst = (Sint8 *) cvt->buf;
+    const int samples = cvt->len_cvt / sizeof (Sint16);
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S16", "AUDIO_S8 (using AVX2)");
+
+    /* shrinking in-place, so go forwards. */
+    for (i = 0; i + 32 <= samples; i += 32) {
+        const __m256i a = _mm256_srai_epi16(_mm256_loadu_si256((const __m256i *) (src + i)), 8);
+        const __m256i b = _mm256_srai_epi16(_mm256_loadu_si256((const __m256i *) (src + i + 16)), 8);
+        _mm256_storeu_si256((__m256i *) (dst + i), _mm256_permute4x64_epi64(_mm256_packs_epi16(a, b), 0xD8));
+    }
+
+    for (; i < samples; i++) {
+        dst[i] = (Sint8) (src[i] >> 8);
+    }
+
+    cvt->len_cvt /= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S8);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_S16_to_U8_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *) cvt->buf;
+    Uint8 *dst = (Uint8 *) cvt->buf;
+    const __m256i flipsign = _mm256_set1_epi8((char) 0x80);
+    const int samples = cvt->len_cvt / sizeof (Sint16);
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S16", "AUDIO_U8 (using AVX2)");
+
+    /* shrinking in-place, so go forwards. */
+    for (i = 0; i + 32 <= samples; i += 32) {
+        const __m256i a = _mm256_srai_epi16(_mm256_loadu_si256((const __m256i *) (src + i)), 8);
+        const __m256i b = _mm256_srai_epi16(_mm256_loadu_si256((const __m256i *) (src + i + 16)), 8);
+        const __m256i bytes = _mm256_permute4x64_epi64(_mm256_packs_epi16(a, b), 0xD8);
+        _mm256_storeu_si256((__m256i *) (dst + i), _mm256_xor_si256(bytes, flipsign));
+    }
+
+    for (; i < samples; i++) {
+        dst[i] = (Uint8) ((src[i] >> 8) ^ 0x80);
+    }
+
+    cvt->len_cvt /= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_U8);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_S16_to_U16_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    LOG_DEBUG_CONVERT("AUDIO_S16", "AUDIO_U16 (using AVX2)");
+
+    FlipSign16_AVX2((Uint16 *) cvt->buf, cvt->len_cvt / sizeof (Uint16));
+
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_U16SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_S16_to_S32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *) cvt->buf;
+    Sint32 *dst = (Sint32 *) cvt->buf;
+    int i = cvt->len_cvt / sizeof (Sint16);
+
+    LOG_DEBUG_CONVERT("AUDIO_S16", "AUDIO_S32 (using AVX2)");
+
+    /* convert backwards, since output is growing in-place; leftovers at the end go first. */
+    while (i & 15) {
+        --i;
+        dst[i] = (Sint32) (((Uint32) (Uint16) src[i]) << 16);
+    }
+
+    while (i) {
+        const __m128i a = _mm_loadu_si128((const __m128i *) (src + i - 16));
+        const __m128i b = _mm_loadu_si128((const __m128i *) (src + i - 8));
+        _mm256_storeu_si256((__m256i *) (dst + i - 16), _mm256_slli_epi32(_mm256_cvtepi16_epi32(a), 16));
+        _mm256_storeu_si256((__m256i *) (dst + i - 8), _mm256_slli_epi32(_mm256_cvtepi16_epi32(b), 16));
+        i -= 16;
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S32SYS);
+    }
+}
+#endif
+
+/* G.711 mu-law and A-law expand each byte to one 16-bit sample. The scalar
+   path is a plain table lookup; the SIMD paths do the expansion arithmetic
+   on 16-bit lanes, using byte shuffles as 8-entry tables for the powers of
+   two. Everything works backwards, so the output may overwrite the input. */
+static const Sint16 alaw_to_s16[256] = {
+    -5504, -5248, -6016, -5760, -4480, -4224, -4992, -4736, -7552, -7296, -8064, -7808, -6528, -6272, -7040, -6784, -2752,
+    -2624, -3008, -2880, -2240, -2112, -2496, -2368, -3776, -3648, -4032, -3904, -3264, -3136, -3520, -3392, -22016,
+    -20992, -24064, -23040, -17920, -16896, -19968, -18944, -30208, -29184, -32256, -31232, -26112, -25088, -28160, -27136, -11008,
+    -10496, -12032, -11520, -8960, -8448, -9984, -9472, -15104, -14592, -16128, -15616, -13056, -12544, -14080, -13568, -344,
+    -328, -376, -360, -280, -264, -312, -296, -472, -456, -504, -488, -408, -392, -440, -424, -88,
+    -72, -120, -104, -24, -8, -56, -40, -216, -200, -248, -232, -152, -136, -184, -168, -1376,
+    -1312, -1504, -1440, -1120, -1056, -1248, -1184, -1888, -1824, -2016, -1952, -1632, -1568, -1760, -1696, -688,
+    -656, -752, -720, -560, -528, -624, -592, -944, -912, -1008, -976, -816, -784, -880, -848, 5504,
+    5248, 6016, 5760, 4480, 4224, 4992, 4736, 7552, 7296, 8064, 7808, 6528, 6272, 7040, 6784, 2752,
+    2624, 3008, 2880, 2240, 2112, 2496, 2368, 3776, 3648, 4032, 3904, 3264, 3136, 3520, 3392, 22016,
+    20992, 24064, 23040, 17920, 16896, 19968, 18944, 30208, 29184, 32256, 31232, 26112, 25088, 28160, 27136, 11008,
+    10496, 12032, 11520, 8960, 8448, 9984, 9472, 15104, 14592, 16128, 15616, 13056, 12544, 14080, 13568, 344,
+    328, 376, 360, 280, 264, 312, 296, 472, 456, 504, 488, 408, 392, 440, 424, 88,
+    72, 120, 104, 24, 8, 56, 40, 216, 200, 248, 232, 152, 136, 184, 168, 1376,
+    1312, 1504, 1440, 1120, 1056, 1248, 1184, 1888, 1824, 2016, 1952, 1632, 1568, 1760, 1696, 688,
+    656, 752, 720, 560, 528, 624, 592, 944, 912, 1008, 976, 816, 784, 880, 848
+};
+
+static const Sint16 ulaw_to_s16[256] = {
+    -32124, -31100, -30076, -29052, -28028, -27004, -25980, -24956, -23932, -22908, -21884, -20860, -19836, -18812, -17788, -16764, -15996,
+    -15484, -14972, -14460, -13948, -13436, -12924, -12412, -11900, -11388, -10876, -10364, -9852, -9340, -8828, -8316, -7932,
+    -7676, -7420, -7164, -6908, -6652, -6396, -6140, -5884, -5628, -5372, -5116, -4860, -4604, -4348, -4092, -3900,
+    -3772, -3644, -3516, -3388, -3260, -3132, -3004, -2876, -2748, -2620, -2492, -2364, -2236, -2108, -1980, -1884,
+    -1820, -1756, -1692, -1628, -1564, -1500, -1436, -1372, -1308, -1244, -1180, -1116, -1052, -988, -924, -876,
+    -844, -812, -780, -748, -716, -684, -652, -620, -588, -556, -524, -492, -460, -428, -396, -372,
+    -356, -340, -324, -308, -292, -276, -260, -244, -228, -212, -196, -180, -164, -148, -132, -120,
+    -112, -104, -96, -88, -80, -72, -64, -56, -48, -40, -32, -24, -16, -8, 0, 32124,
+    31100, 30076, 29052, 28028, 27004, 25980, 24956, 23932, 22908, 21884, 20860, 19836, 18812, 17788, 16764, 15996,
+    15484, 14972, 14460, 13948, 13436, 12924, 12412, 11900, 11388, 10876, 10364, 9852, 9340, 8828, 8316, 7932,
+    7676, 7420, 7164, 6908, 6652, 6396, 6140, 5884, 5628, 5372, 5116, 4860, 4604, 4348, 4092, 3900,
+    3772, 3644, 3516, 3388, 3260, 3132, 3004, 2876, 2748, 2620, 2492, 2364, 2236, 2108, 1980, 1884,
+    1820, 1756, 1692, 1628, 1564, 1500, 1436, 1372, 1308, 1244, 1180, 1116, 1052, 988, 924, 876,
+    844, 812, 780, 748, 716, 684, 652, 620, 588, 556, 524, 492, 460, 428, 396, 372,
+    356, 340, 324, 308, 292, 276, 260, 244, 228, 212, 196, 180, 164, 148, 132, 120,
+    112, 104, 96, 88, 80, 72, 64, 56, 48, 40, 32, 24, 16, 8, 0
+};
+
+static void
+SDL_Convert_ULaw_to_S16_Scalar(const Uint8 *src, Sint16 *dst, size_t num_samples)
+{
+    size_t i = num_samples;
+    while (i--) {
+        dst[i] = ulaw_to_s16[src[i]];
+    }
+}
+
+static void
+SDL_Convert_ALaw_to_S16_Scalar(const Uint8 *src, Sint16 *dst, size_t num_samples)
+{
+    size_t i = num_samples;
+    while (i--) {
+        dst[i] = alaw_to_s16[src[i]];
+    }
+}
+
+#if HAVE_SSE41_INTRINSICS
+/* mu-law: with x = ~byte, the magnitude is ((mantissa << 3) + 0x84 << exponent) - 0x84,
+   negative if the top bit of x is set. */
+static void SDL_TARGETING("sse4.1")
+SDL_Convert_ULaw_to_S16_SSE41(const Uint8 *src, Sint16 *dst, size_t num_samples)
+{
+    const __m128i pow2 = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, (char) 128, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i lowbyte = _mm_set1_epi16(0x8000 - 0x10000);  /* shuffle index 0x80 zeroes the high byte */
+    const __m128i mask0f = _mm_set1_epi16(0x0F);
+    const __m128i mask07 = _mm_set1_epi16(0x07);
+    const __m128i mask80 = _mm_set1_epi16(0x80);
+    const __m128i bias = _mm_set1_epi16(0x84);
+    const __m128i invert = _mm_set1_epi16(0xFF);
+    size_t i = num_samples;
+
+    while (i >= 8) {
+        const __m128i x = _mm_xor_si128(_mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *) (src + i - 8))), invert);
+        const __m128i exponent = _mm_and_si128(_mm_srli_epi16(x, 4), mask07);
+        const __m128i scale = _mm_shuffle_epi8(pow2, _mm_or_si128(exponent, lowbyte));
+        const __m128i base = _mm_add_epi16(_mm_slli_epi16(_mm_and_si128(x, mask0f), 3), bias);
+        const __m128i magnitude = _mm_sub_epi16(_mm_mullo_epi16(base, scale), bias);
+        const __m128i negative = _mm_cmpeq_epi16(_mm_and_si128(x, mask80), mask80);
+        i -= 8;
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_sub_epi16(_mm_xor_si128(magnitude, negative), negative));
+    }
+
+    while (i--) {
+        dst[i] = ulaw_to_s16[src[i]];
+    }
+}
+
+/* A-law: with x = (byte & 0x7F) ^ 0x55, the magnitude is ((mantissa << 4) + 8 + (exponent ? 0x100 : 0))
+   shifted left by exponent - 1 (if positive), negative if the top bit of the byte is clear. */
+static void SDL_TARGETING("sse4.1")
+SDL_Convert_ALaw_to_S16_SSE41(const Uint8 *src, Sint16 *dst, size_t num_samples)
+{
+    const __m128i pow2 = _mm_setr_epi8(1, 1, 2, 4, 8, 16, 32, 64, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i leading = _mm_setr_epi8(0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i lowbyte = _mm_set1_epi16(0x8000 - 0x10000);  /* shuffle index 0x80 zeroes the high byte */
+    const __m128i mask0f = _mm_set1_epi16(0x0F);
+    const __m128i mask80 = _mm_set1_epi16(0x80);
+    const __m128i scramble = _mm_set1_epi16(0xD5);  /* 0x55, plus flipping the sign so a set bit means negative */
+    const __m128i eight = _mm_set1_epi16(8);
+    size_t i = num_samples;
+
+    while (i >= 8) {
+        const __m128i x = _mm_xor_si128(_mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *) (src + i - 8))), scramble);
+        const __m128i index = _mm_or_si128(_mm_srli_epi16(_mm_andnot_si128(mask80, x), 4), lowbyte);
+        const __m128i base = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(x, mask0f), 4), eight);
+        const __m128i full = _mm_or_si128(base, _mm_slli_epi16(_mm_shuffle_epi8(leading, index), 8));
+        const __m128i magnitude = _mm_mullo_epi16(full, _mm_shuffle_epi8(pow2, index));
+        const __m128i negative = _mm_cmpeq_epi16(_mm_and_si128(x, mask80), mask80);
+        i -= 8;
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_sub_epi16(_mm_xor_si128(magnitude, negative), negative));
+    }
+
+    while (i--) {
+        dst[i] = alaw_to_s16[src[i]];
+    }
+}
+#endif
+
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING("avx2")
+SDL_Convert_ULaw_to_S16_AVX2(const Uint8 *src, Sint16 *dst, size_t num_samples)
+{
+    const __m256i pow2 = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, (char) 128, 0, 0, 0, 0, 0, 0, 0, 0,
+                                          1, 2, 4, 8, 16, 32, 64, (char) 128, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i lowbyte = _mm256_set1_epi16(0x8000 - 0x10000);
+    const __m256i mask0f = _mm256_set1_epi16(0x0F);
+    const __m256i mask07 = _mm256_set1_epi16(0x07);
+    const __m256i mask80 = _mm256_set1_epi16(0x80);
+    const __m256i bias = _mm256_set1_epi16(0x84);
+    const __m256i invert = _mm256_set1_epi16(0xFF);
+    size_t i = num_samples;
+
+    while (i >= 16) {
+        const __m256i x = _mm256_xor_si256(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *) (src + i - 16))), invert);
+        const __m256i exponent = _mm256_and_si256(_mm256_srli_epi16(x, 4), mask07);
+        const __m256i scale = _mm256_shuffle_epi8(pow2, _mm256_or_si256(exponent, lowbyte));
+        const __m256i base = _mm256_add_epi16(_mm256_slli_epi16(_mm256_and_si256(x, mask0f), 3), bias);
+        const __m256i magnitude = _mm256_sub_epi16(_mm256_mullo_epi16(base, scale), bias);
+        const __m256i negative = _mm256_cmpeq_epi16(_mm256_and_si256(x, mask80), mask80);
+        i -= 16;
+        _mm256_storeu_si256((__m256i *) (dst + i), _mm256_sub_epi16(_mm256_xor_si256(magnitude, negative), negative));
+    }
+
+    while (i--) {
+        dst[i] = ulaw_to_s16[src[i]];
+    }
+}
+
+static void SDL_TARGETING("avx2")
+SDL_Convert_ALaw_to_S16_AVX2(const Uint8 *src, Sint16 *dst, size_t num_samples)
+{
+    const __m256i pow2 = _mm256_setr_epi8(1, 1, 2, 4, 8, 16, 32, 64, 0, 0, 0, 0, 0, 0, 0, 0,
+                                          1, 1, 2, 4, 8, 16, 32, 64, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i leading = _mm256_setr_epi8(0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+                                             0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i lowbyte = _mm256_set1_epi16(0x8000 - 0x10000);
+    const __m256i mask0f = _mm256_set1_epi16(0x0F);
+    const __m256i mask80 = _mm256_set1_epi16(0x80);
+    const __m256i scramble = _mm256_set1_epi16(0xD5);
+    const __m256i eight = _mm256_set1_epi16(8);
+    size_t i = num_samples;
+
+    while (i >= 16) {
+        const __m256i x = _mm256_xor_si256(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *) (src + i - 16))), scramble);
+        const __m256i index = _mm256_or_si256(_mm256_srli_epi16(_mm256_andnot_si256(mask80, x), 4), lowbyte);
+        const __m256i base = _mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(x, mask0f), 4), eight);
+        const __m256i full = _mm256_or_si256(base, _mm256_slli_epi16(_mm256_shuffle_epi8(leading, index), 8));
+        const __m256i magnitude = _mm256_mullo_epi16(full, _mm256_shuffle_epi8(pow2, index));
+        const __m256i negative = _mm256_cmpeq_epi16(_mm256_and_si256(x, mask80), mask80);
+        i -= 16;
+        _mm256_storeu_si256((__m256i *) (dst + i), _mm256_sub_epi16(_mm256_xor_si256(magnitude, negative), negative));
+    }
+
+    while (i--) {
+        dst[i] = alaw_to_s16[src[i]];
+    }
+}
+#endif
+
+
+void SDL_ChooseAudioConverters(void)
+{
+    static SDL_bool converters_chosen = SDL_FALSE;
+
+    if (converters_chosen) {
+        return;
+    }
+
+#define SET_INTEGER_CONVERTER_FUNCS(fntype) \
+        SDL_Convert_S8_to_S16 = SDL_Convert_S8_to_S16_##fntype; \
+        SDL_Convert_U8_to_S16 = SDL_Convert_U8_to_S16_##fntype; \
+        SDL_Convert_U16_to_S16 = SDL_Convert_U16_to_S16_##fntype; \
+        SDL_Convert_S32_to_S16 = SDL_Convert_S32_to_S16_##fntype; \
+        SDL_Convert_S16_to_S8 = SDL_Convert_S16_to_S8_##fntype; \
+        SDL_Convert_S16_to_U8 = SDL_Convert_S16_to_U8_##fntype; \
+        SDL_Convert_S16_to_U16 = SDL_Convert_S16_to_U16_##fntype; \
+        SDL_Convert_S16_to_S32 = SDL_Convert_S16_to_S32_##fntype
+
+    /* The integer converters are simple enough that AVX2 is as wide as
+       they need to go, and everything else gets the scalar versions. */
+#if HAVE_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        SET_INTEGER_CONVERTER_FUNCS(AVX2);
+    } else
+#endif
+#if HAVE_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        SET_INTEGER_CONVERTER_FUNCS(SSE2);
+    } else
+#endif
+    {
+        SET_INTEGER_CONVERTER_FUNCS(Scalar);
+    }
+
+#undef SET_INTEGER_CONVERTER_FUNCS
+
+    /* SSE4.1 is the first level with both the byte shuffle and the
+       zero-extending unpack the G.711 expanders want. */
+#if HAVE_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        SDL_Convert_ULaw_to_S16 = SDL_Convert_ULaw_to_S16_AVX2;
+        SDL_Convert_ALaw_to_S16 = SDL_Convert_ALaw_to_S16_AVX2;
+    } else
+#endif
+#if HAVE_SSE41_INTRINSICS
+    if (SDL_HasSSE41()) {
+        SDL_Convert_ULaw_to_S16 = SDL_Convert_ULaw_to_S16_SSE41;
+        SDL_Convert_ALaw_to_S16 = SDL_Convert_ALaw_to_S16_SSE41;
+    } else
+#endif
+    {
+        SDL_Convert_ULaw_to_S16 = SDL_Convert_ULaw_to_S16_Scalar;
+        SDL_Convert_ALaw_to_S16 = SDL_Convert_ALaw_to_S16_Scalar;
+    }
+
+#define SET_CONVERTER_FUNCS(fntype) \
         SDL_Convert_S8_to_F32 = SDL_Convert_S8_to_F32_##fntype; \
         SDL_Convert_U8_to_F32 = SDL_Convert_U8_to_F32_##fntype; \
         SDL_Convert_S16_to_F32 = SDL_Convert_S16_to_F32_##fntype; \
@@ -1403,6 +3207,20 @@ void SDL_ChooseAudioConverters(void)
         SDL_Convert_F32_to_S32 = SDL_Convert_F32_to_S32_##fntype; \
         converters_chosen = SDL_TRUE
 
+#if HAVE_AVX512F_INTRINSICS
+    if (SDL_HasAVX512F()) {
+        SET_CONVERTER_FUNCS(AVX512);
+        return;
+    }
+#endif
+
+#if HAVE_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        SET_CONVERTER_FUNCS(AVX2);
+        return;
+    }
+#endif
+
 #if HAVE_SSE2_INTRINSICS
     if (SDL_HasSSE2()) {
         SET_CONVERTER_FUNCS(SSE2);
@@ -27,6 +27,14 @@
 #include "SDL_audio.h"
 #include "SDL_sysaudio.h"
 
+#ifdef __ARM_NEON
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
+#ifdef __SSE2__
+#define HAVE_SSE2_INTRINSICS 1
+#endif
+
 /* This table is used to add two sound values together and pin
  * the value to avoid overflow.  (used with permission from ARDI)
  */
@@ -85,6 +93,431 @@ static const Uint8 mix8[] = {
 #define ADJUST_VOLUME_U8(s, v)  (s = (((s-128)*v)/SDL_MIX_MAXVOLUME)+128)
 #define ADJUST_VOLUME_U16(s, v)  (s = (((s-32768)*v)/SDL_MIX_MAXVOLUME)+32768)
 
+/* !!! FIXME: are these right? */
+#define MIX_MAX_F32 3.402823466e+38F
+#define MIX_MIN_F32 -3.402823466e+38F
+
+/* Native byte order S16 and F32 get SIMD versions of the code in
+   SDL_MixAudioFormat(), chosen at runtime. They produce the same results:
+   S16 volume is applied in 32 bits and divided toward zero, then saturated;
+   F32 is clamped to the same range. The scalar versions also finish off
+   whatever doesn't fill a whole vector. */
+typedef void (*SDL_MixS16Func)(Sint16 *dst, const Sint16 *src, int samples, int volume);
+typedef void (*SDL_MixF32Func)(float *dst, const float *src, int samples, int volume);
+
+static void
+SDL_Mix_S16_Scalar(Sint16 *dst, const Sint16 *src, int samples, int volume)
+{
+    const int max_audioval = SDL_MAX_SINT16;
+    const int min_audioval = SDL_MIN_SINT16;
+    int i;
+
+    for (i = 0; i < samples; i++) {
+        Sint16 src1 = src[i];
+        int dst_sample;
+        ADJUST_VOLUME(src1, volume);
+        dst_sample = src1 + dst[i];
+        if (dst_sample > max_audioval) {
+            dst_sample = max_audioval;
+        } else if (dst_sample < min_audioval) {
+            dst_sample = min_audioval;
+        }
+        dst[i] = (Sint16) dst_sample;
+    }
+}
+
+static void
+SDL_Mix_F32_Scalar(float *dst, const float *src, int samples, int volume)
+{
+    const float fmaxvolume = 1.0f / ((float) SDL_MIX_MAXVOLUME);
+    const float fvolume = (float) volume;
+    int i;
+
+    for (i = 0; i < samples; i++) {
+        const float src1 = ((src[i] * fvolume) * fmaxvolume);
+        double dst_sample = ((double) src1) + ((double) dst[i]);
+        if (dst_sample > MIX_MAX_F32) {
+            dst_sample = MIX_MAX_F32;
+        } else if (dst_sample < MIX_MIN_F32) {
+            dst_sample = MIX_MIN_F32;
+        }
+        dst[i] = (float) dst_sample;
+    }
+}
+
+#if HAVE_SSE2_INTRINSICS
+static void
+SDL_Mix_S16_SSE2(Sint16 *dst, const Sint16 *src, int samples, int volume)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i vol = _mm_set1_epi32(volume);  /* (volume, 0) pairs for _mm_madd_epi16. */
+    const __m128i bias = _mm_set1_epi32(SDL_MIX_MAXVOLUME - 1);
+    int i;
+
+    for (i = 0; (i + 8) <= samples; i += 8) {
+        const __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+        __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi16(s, zero), vol);
+        __m128i hi = _mm_madd_epi16(_mm_unpackhi_epi16(s, zero), vol);
+        /* divide by SDL_MIX_MAXVOLUME (128) toward zero, like C division does. */
+        lo = _mm_srai_epi32(_mm_add_epi32(lo, _mm_and_si128(_mm_srai_epi32(lo, 31), bias)), 7);
+        hi = _mm_srai_epi32(_mm_add_epi32(hi, _mm_and_si128(_mm_srai_epi32(hi, 31), bias)), 7);
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_adds_epi16(_mm_packs_epi32(lo, hi), _mm_loadu_si128((const __m128i *) (dst + i))));
+    }
+
+    SDL_Mix_S16_Scalar(dst + i, src + i, samples - i, volume);
+}
+
+static void
+SDL_Mix_F32_SSE2(float *dst, const float *src, int samples, int volume)
+{
+    const __m128 fvolume = _mm_set1_ps((float) volume);
+    const __m128 fmaxvolume = _mm_set1_ps(1.0f / ((float) SDL_MIX_MAXVOLUME));
+    const __m128 maxval = _mm_set1_ps(MIX_MAX_F32);
+    const __m128 minval = _mm_set1_ps(MIX_MIN_F32);
+    int i;
+
+    for (i = 0; (i + 4) <= samples; i += 4) {
+        const __m128 src1 = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(src + i), fvolume), fmaxvolume);
+        const __m128 sum = _mm_add_ps(src1, _mm_loadu_ps(dst + i));
+        /* limits go first, so NaNs pass through like they do in the scalar code. */
+        _mm_storeu_ps(dst + i, _mm_min_ps(maxval, _mm_max_ps(minval, sum)));
+    }
+
+    SDL_Mix_F32_Scalar(dst + i, src + i, samples - i, volume);
+}
+#endif
+
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING("avx2")
+SDL_Mix_S16_AVX2(Sint16 *dst, const Sint16 *src, int samples, int volume)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i vol = _mm256_set1_epi32(volume);  /* (volume, 0) pairs for _mm256_madd_epi16. */
+    const __m256i bias = _mm256_set1_epi32(SDL_MIX_MAXVOLUME - 1);
+    int i;
+
+    /* unpack and pack both work within 128-bit lanes, so samples stay in order. */
+    for (i = 0; (i + 16) <= samples; i += 16) {
+        const __m256i s = _mm256_loadu_si256((const __m256i *) (src + i));
+        __m256i lo = _mm256_madd_epi16(_mm256_unpacklo_epi16(s, zero), vol);
+        __m256i hi = _mm256_madd_epi16(_mm256_unpackhi_epi16(s, zero), vol);
+        lo = _mm256_srai_epi32(_mm256_add_epi32(lo, _mm256_and_si256(_mm256_srai_epi32(lo, 31), bias)), 7);
+        hi = _mm256_srai_epi32(_mm256_add_epi32(hi, _mm256_and_si256(_mm256_srai_epi32(hi, 31), bias)), 7);
+        _mm256_storeu_si256((__m256i *) (dst + i), _mm256_adds_epi16(_mm256_packs_epi32(lo, hi), _mm256_loadu_si256((const __m256i *) (dst + i))));
+    }
+
+    SDL_Mix_S16_Scalar(dst + i, src + i, samples - i, volume);
+}
+#endif
+
+#if HAVE_AVX_INTRINSICS
+static void SDL_TARGETING("avx")
+SDL_Mix_F32_AVX(float *dst, const float *src, int samples, int volume)
+{
+    const __m256 fvolume = _mm256_set1_ps((float) volume);
+    const __m256 fmaxvolume = _mm256_set1_ps(1.0f / ((float) SDL_MIX_MAXVOLUME));
+    const __m256 maxval = _mm256_set1_ps(MIX_MAX_F32);
+    const __m256 minval = _mm256_set1_ps(MIX_MIN_F32);
+    int i;
+
+    for (i = 0; (i + 8) <= samples; i += 8) {
+        const __m256 src1 = _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(src + i), fvolume), fmaxvolume);
+        const __m256 sum = _mm256_add_ps(src1, _mm256_loadu_ps(dst + i));
+        _mm256_storeu_ps(dst + i, _mm256_min_ps(maxval, _mm256_max_ps(minval, sum)));
+    }
+
+    SDL_Mix_F32_Scalar(dst + i, src + i, samples - i, volume);
+}
+#endif
+
+#if HAVE_NEON_INTRINSICS
+static void
+SDL_Mix_S16_NEON(Sint16 *dst, const Sint16 *src, int samples, int volume)
+{
+    const int16x4_t vol = vdup_n_s16((int16_t) volume);
+    const int32x4_t bias = vdupq_n_s32(SDL_MIX_MAXVOLUME - 1);
+    int i;
+
+    for (i = 0; (i + 8) <= samples; i += 8) {
+        const int16x8_t s = vld1q_s16(src + i);
+        int32x4_t lo = vmull_s16(vget_low_s16(s), vol);
+        int32x4_t hi = vmull_s16(vget_high_s16(s), vol);
+        lo = vshrq_n_s32(vaddq_s32(lo, vandq_s32(vshrq_n_s32(lo, 31), bias)), 7);
+        hi = vshrq_n_s32(vaddq_s32(hi, vandq_s32(vshrq_n_s32(hi, 31), bias)), 7);
+        vst1q_s16(dst + i, vqaddq_s16(vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi)), vld1q_s16(dst + i)));
+    }
+
+    SDL_Mix_S16_Scalar(dst + i, src + i, samples - i, volume);
+}
+
+static void
+SDL_Mix_F32_NEON(float *dst, const float *src, int samples, int volume)
+{
+    const float32x4_t fvolume = vdupq_n_f32((float) volume);
+    const float32x4_t fmaxvolume = vdupq_n_f32(1.0f / ((float) SDL_MIX_MAXVOLUME));
+    const float32x4_t maxval = vdupq_n_f32(MIX_MAX_F32);
+    const float32x4_t minval = vdupq_n_f32(MIX_MIN_F32);
+    int i;
+
+    for (i = 0; (i + 4) <= samples; i += 4) {
+        const float32x4_t src1 = vmulq_f32(vmulq_f32(vld1q_f32(src + i), fvolume), fmaxvolume);
+        const float32x4_t sum = vaddq_f32(src1, vld1q_f32(dst + i));
+        vst1q_f32(dst + i, vminq_f32(maxval, vmaxq_f32(minval, sum)));
+    }
+
+    SDL_Mix_F32_Scalar(dst + i, src + i, samples - i, volume);
+}
+#endif
+
+/* SDL_MixAudioSources() adds sources into a block of wider accumulators.
+   Volumes alternate between even and odd samples, so interleaved stereo
+   can be panned. Same volume math as above. The S16 version takes two
+   sources at a time, { a_even, a_odd, b_even, b_odd } volumes, so the
+   accumulators are loaded and stored half as often. */
+typedef void (*SDL_MixAccumulateS16Func)(Sint32 *acc, const Sint16 *a, const Sint16 *b, int samples, const int *volumes);
+typedef void (*SDL_MixAccumulateF32Func)(float *acc, const float *src, int samples, float volume, float scale_even, float scale_odd);
+
+static void
+SDL_MixAccumulate_S16_Scalar(Sint32 *acc, const Sint16 *a, const Sint16 *b, int samples, const int *volumes)
+{
+    int i;
+
+    for (i = 0; i < samples; i++) {
+        const int odd = i & 1;
+        acc[i] += ((a[i] * volumes[odd]) / SDL_MIX_MAXVOLUME) + ((b[i] * volumes[2 + odd]) / SDL_MIX_MAXVOLUME);
+    }
+}
+
+#if HAVE_SSE2_INTRINSICS || HAVE_AVX2_INTRINSICS
+/* (s * v) / 128, rounded toward zero like the scalar code, stays in 16 bits:
+   it's the sign of s applied to (|s| * (v << 9)) >> 16, which is a single
+   unsigned high multiply. v == 128 doesn't fit in the multiplier, so those
+   lanes get a zero multiplier and add |s| back in through a mask. */
+static void
+GetMixScaleVolumes(const int volume_even, const int volume_odd, Uint16 mul[2], Uint16 mask[2])
+{
+    mul[0] = (volume_even < SDL_MIX_MAXVOLUME) ? (Uint16) (volume_even << 9) : 0;
+    mul[1] = (volume_odd < SDL_MIX_MAXVOLUME) ? (Uint16) (volume_odd << 9) : 0;
+    mask[0] = (volume_even < SDL_MIX_MAXVOLUME) ? 0 : 0xFFFF;
+    mask[1] = (volume_odd < SDL_MIX_MAXVOLUME) ? 0 : 0xFFFF;
+}
+#endif
+
+static void
+SDL_MixAccumulate_F32_Scalar(float *acc, const float *src, int samples, float volume, float scale_even, float scale_odd)
+{
+    int i;
+
+    for (i = 0; i < samples; i++) {
+        acc[i] += (src[i] * volume) * ((i & 1) ? scale_odd : scale_even);
+    }
+}
+
+#if HAVE_SSE2_INTRINSICS
+static void
+SDL_MixAccumulate_S16_SSE2(Sint32 *acc, const Sint16 *a, const Sint16 *b, int samples, const int *volumes)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ones = _mm_set1_epi16(1);
+    Uint16 amul[2], amask[2], bmul[2], bmask[2];
+    __m128i mula, maska, mulb, maskb;
+    int i;
+
+    GetMixScaleVolumes(volumes[0], volumes[1], amul, amask);
+    GetMixScaleVolumes(volumes[2], volumes[3], bmul, bmask);
+    mula = _mm_set1_epi32((int) (amul[0] | ((Uint32) amul[1] << 16)));
+    maska = _mm_set1_epi32((int) (amask[0] | ((Uint32) amask[1] << 16)));
+    mulb = _mm_set1_epi32((int) (bmul[0] | ((Uint32) bmul[1] << 16)));
+    maskb = _mm_set1_epi32((int) (bmask[0] | ((Uint32) bmask[1] << 16)));
+
+    for (i = 0; (i + 8) <= samples; i += 8) {
+        const __m128i sa = _mm_loadu_si128((const __m128i *) (a + i));
+        const __m128i sb = _mm_loadu_si128((const __m128i *) (b + i));
+        const __m128i signa = _mm_srai_epi16(sa, 15);
+        const __m128i signb = _mm_srai_epi16(sb, 15);
+        const __m128i absa = _mm_max_epi16(sa, _mm_sub_epi16(zero, sa));  /* -32768 stays 0x8000, which is right unsigned. */
+        const __m128i absb = _mm_max_epi16(sb, _mm_sub_epi16(zero, sb));
+        __m128i ra = _mm_add_epi16(_mm_mulhi_epu16(absa, mula), _mm_and_si128(absa, maska));
+        __m128i rb = _mm_add_epi16(_mm_mulhi_epu16(absb, mulb), _mm_and_si128(absb, maskb));
+        ra = _mm_sub_epi16(_mm_xor_si128(ra, signa), signa);
+        rb = _mm_sub_epi16(_mm_xor_si128(rb, signb), signb);
+        /* madd against ones sums each a/b pair into 32 bits. */
+        _mm_storeu_si128((__m128i *) (acc + i), _mm_add_epi32(_mm_loadu_si128((const __m128i *) (acc + i)), _mm_madd_epi16(_mm_unpacklo_epi16(ra, rb), ones)));
+        _mm_storeu_si128((__m128i *) (acc + i + 4), _mm_add_epi32(_mm_loadu_si128((const __m128i *) (acc + i + 4)), _mm_madd_epi16(_mm_unpackhi_epi16(ra, rb), ones)));
+    }
+
+    SDL_MixAccumulate_S16_Scalar(acc + i, a + i, b + i, samples - i, volumes);
+}
+
+static void
+SDL_MixAccumulate_F32_SSE2(float *acc, const float *src, int samples, float volume, float scale_even, float scale_odd)
+{
+    const __m128 fvolume = _mm_set1_ps(volume);
+    const __m128 scale = _mm_setr_ps(scale_even, scale_odd, scale_even, scale_odd);
+    int i;
+
+    for (i = 0; (i + 4) <= samples; i += 4) {
+        const __m128 src1 = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(src + i), fvolume), scale);
+        _mm_storeu_ps(acc + i, _mm_add_ps(_mm_loadu_ps(acc + i), src1));
+    }
+
+    SDL_MixAccumulate_F32_Scalar(acc + i, src + i, samples - i, volume, scale_even, scale_odd);
+}
+#endif
+
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING("avx2")
+SDL_MixAccumulate_S16_AVX2(Sint32 *acc, const Sint16 *a, const Sint16 *b, int samples, const int *volumes)
+{
+    const __m256i ones = _mm256_set1_epi16(1);
+    Uint16 amul[2], amask[2], bmul[2], bmask[2];
+    __m256i mula, maska, mulb, maskb;
+    int i;
+
+    GetMixScaleVolumes(volumes[0], volumes[1], amul, amask);
+    GetMixScaleVolumes(volumes[2], volumes[3], bmul, bmask);
+    mula = _mm256_set1_epi32((int) (amul[0] | ((Uint32) amul[1] << 16)));
+    maska = _mm256_set1_epi32((int) (amask[0] | ((Uint32) amask[1] << 16)));
+    mulb = _mm256_set1_epi32((int) (bmul[0] | ((Uint32) bmul[1] << 16)));
+    maskb = _mm256_set1_epi32((int) (bmask[0] | ((Uint32) bmask[1] << 16)));
+
+    for (i = 0; (i + 16) <= samples; i += 16) {
+        const __m256i sa = _mm256_loadu_si256((const __m256i *) (a + i));
+        const __m256i sb = _mm256_loadu_si256((const __m256i *) (b + i));
+        const __m256i absa = _mm256_abs_epi16(sa);  /* -32768 stays 0x8000, which is right unsigned. */
+        const __m256i absb = _mm256_abs_epi16(sb);
+        __m256i ra = _mm256_add_epi16(_mm256_mulhi_epu16(absa, mula), _mm256_and_si256(absa, maska));
+        __m256i rb = _mm256_add_epi16(_mm256_mulhi_epu16(absb, mulb), _mm256_and_si256(absb, maskb));
+        __m256i lo, hi;
+        ra = _mm256_sign_epi16(ra, sa);
+        rb = _mm256_sign_epi16(rb, sb);
+        /* madd against ones sums each a/b pair into 32 bits. The unpacks work
+           per 128-bit lane, so lo holds samples 0-3 and 8-11, hi holds 4-7
+           and 12-15; put them back in order. */
+        lo = _mm256_madd_epi16(_mm256_unpacklo_epi16(ra, rb), ones);
+        hi = _mm256_madd_epi16(_mm256_unpackhi_epi16(ra, rb), ones);
+        _mm256_storeu_si256((__m256i *) (acc + i), _mm256_add_epi32(_mm256_loadu_si256((const __m256i *) (acc + i)), _mm256_permute2x128_si256(lo, hi, 0x20)));
+        _mm256_storeu_si256((__m256i *) (acc + i + 8), _mm256_add_epi32(_mm256_loadu_si256((const __m256i *) (acc + i + 8)), _mm256_permute2x128_si256(lo, hi, 0x31)));
+    }
+
+    SDL_MixAccumulate_S16_Scalar(acc + i, a + i, b + i, samples - i, volumes);
+}
+#endif
+
+#if HAVE_AVX_INTRINSICS
+static void SDL_TARGETING("avx")
+SDL_MixAccumulate_F32_AVX(float *acc, const float *src, int samples, float volume, float scale_even, float scale_odd)
+{
+    const __m256 fvolume = _mm256_set1_ps(volume);
+    const __m256 scale = _mm256_setr_ps(scale_even, scale_odd, scale_even, scale_odd, scale_even, scale_odd, scale_even, scale_odd);
+    int i;
+
+    for (i = 0; (i + 8) <= samples; i += 8) {
+        const __m256 src1 = _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(src + i), fvolume), scale);
+        _mm256_storeu_ps(acc + i, _mm256_add_ps(_mm256_loadu_ps(acc + i), src1));
+    }
+
+    SDL_MixAccumulate_F32_Scalar(acc + i, src + i, samples - i, volume, scale_even, scale_odd);
+}
+#endif
+
+#if HAVE_NEON_INTRINSICS
+static void
+SDL_MixAccumulate_S16_NEON(Sint32 *acc, const Sint16 *a, const Sint16 *b, int samples, const int *volumes)
+{
+    const int16_t avolumes[4] = { (int16_t) volumes[0], (int16_t) volumes[1], (int16_t) volumes[0], (int16_t) volumes[1] };
+    const int16_t bvolumes[4] = { (int16_t) volumes[2], (int16_t) volumes[3], (int16_t) volumes[2], (int16_t) volumes[3] };
+    const int16x4_t vola = vld1_s16(avolumes);
+    const int16x4_t volb = vld1_s16(bvolumes);
+    const int32x4_t bias = vdupq_n_s32(SDL_MIX_MAXVOLUME - 1);
+    int i;
+
+    for (i = 0; (i + 8) <= samples; i += 8) {
+        const int16x8_t sa = vld1q_s16(a + i);
+        const int16x8_t sb = vld1q_s16(b + i);
+        int32x4_t alo = vmull_s16(vget_low_s16(sa), vola);
+        int32x4_t ahi = vmull_s16(vget_high_s16(sa), vola);
+        int32x4_t blo = vmull_s16(vget_low_s16(sb), volb);
+        int32x4_t bhi = vmull_s16(vget_high_s16(sb), volb);
+        alo = vshrq_n_s32(vaddq_s32(alo, vandq_s32(vshrq_n_s32(alo, 31), bias)), 7);
+        ahi = vshrq_n_s32(vaddq_s32(ahi, vandq_s32(vshrq_n_s32(ahi, 31), bias)), 7);
+        blo = vshrq_n_s32(vaddq_s32(blo, vandq_s32(vshrq_n_s32(blo, 31), bias)), 7);
+        bhi = vshrq_n_s32(vaddq_s32(bhi, vandq_s32(vshrq_n_s32(bhi, 31), bias)), 7);
+        vst1q_s32(acc + i, vaddq_s32(vld1q_s32(acc + i), vaddq_s32(alo, blo)));
+        vst1q_s32(acc + i + 4, vaddq_s32(vld1q_s32(acc + i + 4), vaddq_s32(ahi, bhi)));
+    }
+
+    SDL_MixAccumulate_S16_Scalar(acc + i, a + i, b + i, samples - i, volumes);
+}
+
+static void
+SDL_MixAccumulate_F32_NEON(float *acc, const float *src, int samples, float volume, float scale_even, float scale_odd)
+{
+    const float scales[4] = { scale_even, scale_odd, scale_even, scale_odd };
+    const float32x4_t fvolume = vdupq_n_f32(volume);
+    const float32x4_t scale = vld1q_f32(scales);
+    int i;
+
+    for (i = 0; (i + 4) <= samples; i += 4) {
+        const float32x4_t src1 = vmulq_f32(vmulq_f32(vld1q_f32(src + i), fvolume), scale);
+        vst1q_f32(acc + i, vaddq_f32(vld1q_f32(acc + i), src1));
+    }
+
+    SDL_MixAccumulate_F32_Scalar(acc + i, src + i, samples - i, volume, scale_even, scale_odd);
+}
+#endif
+
+/* These start out as something that works, so a thread racing
+   SDL_ChooseMixers() never sees a NULL pointer. */
+static SDL_MixS16Func SDL_Mix_S16 = SDL_Mix_S16_Scalar;
+static SDL_MixF32Func SDL_Mix_F32 = SDL_Mix_F32_Scalar;
+static SDL_MixAccumulateS16Func SDL_MixAccumulate_S16 = SDL_MixAccumulate_S16_Scalar;
+static SDL_MixAccumulateF32Func SDL_MixAccumulate_F32 = SDL_MixAccumulate_F32_Scalar;
+
+static void
+SDL_ChooseMixers(void)
+{
+    static SDL_bool mixers_chosen = SDL_FALSE;
+
+    if (mixers_chosen) {
+        return;
+    }
+
+#if HAVE_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        SDL_Mix_S16 = SDL_Mix_S16_SSE2;
+        SDL_Mix_F32 = SDL_Mix_F32_SSE2;
+        SDL_MixAccumulate_S16 = SDL_MixAccumulate_S16_SSE2;
+        SDL_MixAccumulate_F32 = SDL_MixAccumulate_F32_SSE2;
+    }
+#endif
+
+#if HAVE_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        SDL_Mix_S16 = SDL_Mix_S16_AVX2;
+        SDL_MixAccumulate_S16 = SDL_MixAccumulate_S16_AVX2;
+    }
+#endif
+
+#if HAVE_AVX_INTRINSICS
+    if (SDL_HasAVX()) {
+        SDL_Mix_F32 = SDL_Mix_F32_AVX;
+        SDL_MixAccumulate_F32 = SDL_MixAccumulate_F32_AVX;
+    }
+#endif
+
+#if HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        SDL_Mix_S16 = SDL_Mix_S16_NEON;
+        SDL_Mix_F32 = SDL_Mix_F32_NEON;
+        SDL_MixAccumulate_S16 = SDL_MixAccumulate_S16_NEON;
+        SDL_MixAccumulate_F32 = SDL_MixAccumulate_F32_NEON;
+    }
+#endif
+
+    mixers_chosen = SDL_TRUE;
+}
+
 
 void
 SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
@@ -94,6 +527,18 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
         return;
     }
 
+    SDL_ChooseMixers();
+
+    /* Over SDL_MIX_MAXVOLUME, the scalar S16 code wraps instead of saturating,
+       so keep doing exactly that there. */
+    if ((format == AUDIO_S16SYS) && (volume <= SDL_MIX_MAXVOLUME)) {
+        SDL_Mix_S16((Sint16 *) dst, (const Sint16 *) src, (int) (len / 2), volume);
+        return;
+    } else if (format == AUDIO_F32SYS) {
+        SDL_Mix_F32((float *) dst, (const float *) src, (int) (len / 4), volume);
+        return;
+    }
+
     switch (format) {
 
     case AUDIO_U8:
@@ -354,4 +799,136 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
     }
 }
 
+/* Samples per block in SDL_MixAudioSources(). A block of accumulators and
+   the source data being added to it stay in the L1 cache, so dst is only
+   touched once per block no matter how many sources there are. Even, so
+   stereo pairs never straddle blocks. */
+#define MIX_BLOCK_SAMPLES 1024
+
+/* Gains for the even (left) and odd (right) samples of a stereo frame. */
+static void
+GetMixSourcePan(const SDL_AudioMixSource *source, const int channels, float *left, float *right)
+{
+    const float pan = SDL_clamp(source->pan, -1.0f, 1.0f);
+
+    if ((channels != 2) || (pan == 0.0f)) {
+        *left = *right = 1.0f;
+    } else {
+        *left = (pan > 0.0f) ? (1.0f - pan) : 1.0f;
+        *right = (pan < 0.0f) ? (1.0f + pan) : 1.0f;
+    }
+}
+
+static void
+SDL_MixSources_S16(Sint16 *dst, const SDL_AudioMixSource *sources, const int num_sources, const int channels, const int samples)
+{
+    Sint32 acc[MIX_BLOCK_SAMPLES];
+    const Sint16 *pending;
+    int volumes[4];
+    int block, i;
+
+    for (block = 0; block < samples; block += MIX_BLOCK_SAMPLES) {
+        const int count = SDL_min(MIX_BLOCK_SAMPLES, samples - block);
+        Sint16 *out = dst + block;
+
+        for (i = 0; i < count; i++) {
+            acc[i] = out[i];
+        }
+
+        /* pair up the audible sources; an odd one out is paired with itself at zero volume. */
+        pending = NULL;
+        for (i = 0; i < num_sources; i++) {
+            const int volume = SDL_clamp(sources[i].volume, 0, SDL_MIX_MAXVOLUME);
+            const Sint16 *src;
+            float left, right;
+            if (!sources[i].src || !volume) {
+                continue;
+            }
+            src = ((const Sint16 *) sources[i].src) + block;
+            GetMixSourcePan(&sources[i], channels, &left, &right);
+            if (!pending) {
+                pending = src;
+                volumes[0] = (int) ((volume * left) + 0.5f);
+                volumes[1] = (int) ((volume * right) + 0.5f);
+            } else {
+                volumes[2] = (int) ((volume * left) + 0.5f);
+                volumes[3] = (int) ((volume * right) + 0.5f);
+                SDL_MixAccumulate_S16(acc, pending, src, count, volumes);
+                pending = NULL;
+            }
+        }
+        if (pending) {
+            volumes[2] = volumes[3] = 0;
+            SDL_MixAccumulate_S16(acc, pending, pending, count, volumes);
+        }
+
+        for (i = 0; i < count; i++) {
+            out[i] = (Sint16) SDL_clamp(acc[i], SDL_MIN_SINT16, SDL_MAX_SINT16);
+        }
+    }
+}
+
+static void
+SDL_MixSources_F32(float *dst, const SDL_AudioMixSource *sources, const int num_sources, const int channels, const int samples)
+{
+    const float fmaxvolume = 1.0f / ((float) SDL_MIX_MAXVOLUME);
+    float acc[MIX_BLOCK_SAMPLES];
+    int block, i;
+
+    for (block = 0; block < samples; block += MIX_BLOCK_SAMPLES) {
+        const int count = SDL_min(MIX_BLOCK_SAMPLES, samples - block);
+        float *out = dst + block;
+
+        SDL_memcpy(acc, out, count * sizeof (float));
+
+        for (i = 0; i < num_sources; i++) {
+            const int volume = SDL_clamp(sources[i].volume, 0, SDL_MIX_MAXVOLUME);
+            float left, right;
+            if (!sources[i].src || !volume) {
+                continue;
+            }
+            GetMixSourcePan(&sources[i], channels, &left, &right);
+            /* unpanned, this is exactly the math SDL_MixAudioFormat() does. */
+            SDL_MixAccumulate_F32(acc, ((const float *) sources[i].src) + block, count,
+                                  (float) volume, fmaxvolume * left, fmaxvolume * right);
+        }
+
+        for (i = 0; i < count; i++) {
+            out[i] = SDL_clamp(acc[i], MIX_MIN_F32, MIX_MAX_F32);
+        }
+    }
+}
+
+int
+SDL_MixAudioSources(Uint8 * dst, const SDL_AudioMixSource * sources, int num_sources,
+                    SDL_AudioFormat format, Uint8 channels, Uint32 len)
+{
+    int i;
+
+    if (!dst) {
+        return SDL_InvalidParamError("dst");
+    } else if ((num_sources < 0) || (num_sources && !sources)) {
+        return SDL_InvalidParamError("sources");
+    } else if (!channels) {
+        return SDL_InvalidParamError("channels");
+    }
+
+    SDL_ChooseMixers();
+
+    if (format == AUDIO_S16SYS) {
+        SDL_MixSources_S16((Sint16 *) dst, sources, num_sources, channels, (int) (len / 2));
+    } else if (format == AUDIO_F32SYS) {
+        SDL_MixSources_F32((float *) dst, sources, num_sources, channels, (int) (len / 4));
+    } else {
+        /* everything else goes one source at a time. */
+        for (i = 0; i < num_sources; i++) {
+            if (sources[i].src) {
+                SDL_MixAudioFormat(dst, sources[i].src, format, len, SDL_clamp(sources[i].volume, 0, SDL_MIX_MAXVOLUME));
+            }
+        }
+    }
+
+    return 0;
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
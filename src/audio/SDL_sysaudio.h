@@ -162,7 +162,27 @@ struct SDL_AudioDevice
     SDL_threadID threadid;
 
     /* Queued buffers (if app not using callback). */
-    SDL_DataQueue *buffer_queue;
+    SDL_SPSCDataQueue *buffer_queue;  /* app thread on one end, audio thread on the other; no locking. */
+    SDL_SpinLock buffer_queue_lock;  /* keeps app threads from using the app end of buffer_queue at once. */
+
+    /* Telemetry for SDL_GetAudioDeviceStats(). The audio thread updates it under stats_lock. */
+    SDL_AudioDeviceStats stats;
+    SDL_SpinLock stats_lock;
+    Uint64 stats_last_ticks;  /* performance counter at the end of the last iteration, only used by the audio thread. */
+    SDL_bool queue_starved;  /* the last queued or lookahead buffer came up short; counts each underrun once. */
+
+    /* Runs the app's callback ahead of the device on its own thread; see SDL_HINT_AUDIO_CALLBACK_LOOKAHEAD. NULL if not used. */
+    struct SDL_AudioLookahead *lookahead;
+
+    /* Streams mixed into each buffer after the callback runs; see SDL_BindAudioStream(). Only changed with bound_streams_lock and the callback's lock held. */
+    SDL_AudioStream **bound_streams;
+    int num_bound_streams;
+    Uint8 *bound_stream_buffer;  /* callbackspec.size bytes per bound stream to pull each one into before mixing. */
+    SDL_AudioMixSource *bound_stream_sources;  /* one per bound stream, for SDL_MixAudioSources(). */
+
+    /* What SDL_BoundStreamsCallback() calls before mixing, on playback devices without a lookahead; NULL when not wrapped. */
+    SDL_AudioCallback bound_callback;
+    void *bound_userdata;
 
     /* * * */
     /* Data private to this driver */
@@ -34,9 +34,13 @@
 /* Microsoft WAVE file loading routines */
 
 #include "SDL_hints.h"
+#include "SDL_atomic.h"
 #include "SDL_audio.h"
+#include "SDL_cpuinfo.h"
 #include "SDL_wave.h"
 #include "SDL_audio_c.h"
+#include "../file/SDL_rwops_c.h"
+#include "../thread/SDL_systhread.h"
 
 /* Reads the value stored at the location of the f1 pointer, multiplies it
  * with the second argument and then stores the result to f1.
@@ -331,6 +335,139 @@ WaveAdjustToFactValue(WaveFile *file, Sint64 sampleframes)
     return sampleframes;
 }
 
+/* The blocks of MS and IMA ADPCM data are independent of each other, as the
+ * decoder state is reset by every block header. Large amounts of data get
+ * split into runs of whole blocks that are decoded on a few threads, each
+ * writing to the output position of its first block.
+ */
+#define ADPCM_PARALLEL_MIN_BLOCKS 32  /* Per thread. */
+#define ADPCM_PARALLEL_MAX_THREADS 8
+
+typedef int (*ADPCM_DecodeFunc)(ADPCM_DecoderState *state);
+
+typedef struct ADPCM_BlockRun
+{
+    ADPCM_DecoderState state;
+    size_t blockcount;
+    ADPCM_DecodeFunc decodeheader;
+    ADPCM_DecodeFunc decodedata;
+    int result;
+} ADPCM_BlockRun;
+
+static int SDLCALL
+ADPCM_DecodeBlockRun(void *data)
+{
+    ADPCM_BlockRun *run = (ADPCM_BlockRun *)data;
+    ADPCM_DecoderState *state = &run->state;
+    size_t i;
+
+    run->result = 0;
+    for (i = 0; i < run->blockcount; i++) {
+        state->block.data = state->input.data + state->input.pos;
+        state->block.size = state->blocksize;
+        state->block.pos = 0;
+
+        /* Whole blocks, so anything but success is corrupt data. */
+        if (run->decodeheader(state) < 0 || run->decodedata(state) < 0) {
+            run->result = -1;
+            break;
+        }
+
+        state->input.pos += state->blocksize;
+    }
+
+    return 0;
+}
+
+/* Decodes as many whole blocks as it's worth doing in parallel and advances
+ * the state past them. The remaining blocks, including a truncated one at the
+ * end, are left for the sequential decoder. If anything goes wrong, the state
+ * is left untouched so the sequential decoder runs into it and reports it.
+ */
+static void
+ADPCM_DecodeParallel(ADPCM_DecoderState *state, ADPCM_DecodeFunc decodeheader, ADPCM_DecodeFunc decodedata, size_t cstatesize)
+{
+#if !SDL_THREADS_DISABLED
+    ADPCM_BlockRun runs[ADPCM_PARALLEL_MAX_THREADS];
+    SDL_Thread *threads[ADPCM_PARALLEL_MAX_THREADS];
+    Uint8 *cstates;
+    size_t blockcount, first, i, runcount;
+    const size_t blockframes = state->samplesperblock * state->channels;
+    const char *hint;
+    int threadcount;
+
+    /* Only blocks that get decoded completely. */
+    blockcount = (state->input.size - state->input.pos) / state->blocksize;
+    if ((Uint64)blockcount * state->samplesperblock > (Uint64)state->framesleft) {
+        blockcount = (size_t)(state->framesleft / state->samplesperblock);
+    }
+
+    hint = SDL_GetHint(SDL_HINT_WAVE_DECODE_THREADS);
+    threadcount = (hint != NULL && *hint != '\0') ? SDL_atoi(hint) : SDL_GetCPUCount();
+    if (threadcount < 2) {
+        return;
+    }
+    runcount = blockcount / ADPCM_PARALLEL_MIN_BLOCKS;
+    if (runcount > (size_t)threadcount) {
+        runcount = (size_t)threadcount;
+    }
+    if (runcount > ADPCM_PARALLEL_MAX_THREADS) {
+        runcount = ADPCM_PARALLEL_MAX_THREADS;
+    }
+    if (runcount < 2) {
+        return;
+    }
+
+    cstates = (Uint8 *)SDL_calloc(runcount, cstatesize);
+    if (cstates == NULL) {
+        return;
+    }
+
+    first = 0;
+    for (i = 0; i < runcount; i++) {
+        ADPCM_BlockRun *run = &runs[i];
+        const size_t last = blockcount * (i + 1) / runcount;
+
+        run->state = *state;
+        run->state.cstate = cstates + i * cstatesize;
+        run->state.input.pos += first * state->blocksize;
+        run->state.output.pos += first * blockframes;
+        run->state.framesleft = (Sint64)((last - first) * state->samplesperblock);
+        run->blockcount = last - first;
+        run->decodeheader = decodeheader;
+        run->decodedata = decodedata;
+        run->result = -1;
+        first = last;
+    }
+
+    /* This thread takes the first run. */
+    for (i = 1; i < runcount; i++) {
+        threads[i] = SDL_CreateThreadInternal(ADPCM_DecodeBlockRun, "SDLWaveDecode", 64 * 1024, &runs[i]);
+        if (threads[i] == NULL) {
+            ADPCM_DecodeBlockRun(&runs[i]);
+        }
+    }
+    ADPCM_DecodeBlockRun(&runs[0]);
+
+    for (i = 1; i < runcount; i++) {
+        if (threads[i] != NULL) {
+            SDL_WaitThread(threads[i], NULL);
+        }
+    }
+    SDL_free(cstates);
+
+    for (i = 0; i < runcount; i++) {
+        if (runs[i].result < 0) {
+            return;
+        }
+    }
+
+    state->input.pos += blockcount * state->blocksize;
+    state->output.pos += blockcount * blockframes;
+    state->framesleft -= (Sint64)(blockcount * state->samplesperblock);
+#endif /* !SDL_THREADS_DISABLED */
+}
+
 static int
 MS_ADPCM_CalculateSampleFrames(WaveFile *file, size_t datalength)
 {
@@ -692,6 +829,8 @@ MS_ADPCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 
     state.cstate = cstate;
 
+    ADPCM_DecodeParallel(&state, MS_ADPCM_DecodeBlockHeader, MS_ADPCM_DecodeBlockData, sizeof(cstate));
+
     /* Decode block by block. A truncated block will stop the decoding. */
     bytesleft = state.input.size - state.input.pos;
     while (state.framesleft > 0 && bytesleft >= state.blockheadersize) {
@@ -1090,6 +1229,8 @@ IMA_ADPCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
     }
     state.cstate = cstate;
 
+    ADPCM_DecodeParallel(&state, IMA_ADPCM_DecodeBlockHeader, IMA_ADPCM_DecodeBlockData, state.channels * sizeof(Sint8));
+
     /* Decode block by block. A truncated block will stop the decoding. */
     bytesleft = state.input.size - state.input.pos;
     while (state.framesleft > 0 && bytesleft >= state.blockheadersize) {
@@ -1165,53 +1306,37 @@ LAW_Init(WaveFile *file, size_t datalength)
     return 0;
 }
 
+/* Expands sample_count companded samples at the start of data to 16-bit PCM.
+ * data must have room for the expanded samples. Works backwards, so the input
+ * and output can share the same buffer.
+ */
 static int
-LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+LAW_Expand(Uint16 encoding, Uint8 *data, size_t sample_count)
 {
-#ifdef SDL_WAVE_LAW_LUT
-    const Sint16 alaw_lut[256] = {
-        -5504, -5248, -6016, -5760, -4480, -4224, -4992, -4736, -7552, -7296, -8064, -7808, -6528, -6272, -7040, -6784, -2752,
-        -2624, -3008, -2880, -2240, -2112, -2496, -2368, -3776, -3648, -4032, -3904, -3264, -3136, -3520, -3392, -22016,
-        -20992, -24064, -23040, -17920, -16896, -19968, -18944, -30208, -29184, -32256, -31232, -26112, -25088, -28160, -27136, -11008,
-        -10496, -12032, -11520, -8960, -8448, -9984, -9472, -15104, -14592, -16128, -15616, -13056, -12544, -14080, -13568, -344,
-        -328, -376, -360, -280, -264, -312, -296, -472, -456, -504, -488, -408, -392, -440, -424, -88,
-        -72, -120, -104, -24, -8, -56, -40, -216, -200, -248, -232, -152, -136, -184, -168, -1376,
-        -1312, -1504, -1440, -1120, -1056, -1248, -1184, -1888, -1824, -2016, -1952, -1632, -1568, -1760, -1696, -688,
-        -656, -752, -720, -560, -528, -624, -592, -944, -912, -1008, -976, -816, -784, -880, -848, 5504,
-        5248, 6016, 5760, 4480, 4224, 4992, 4736, 7552, 7296, 8064, 7808, 6528, 6272, 7040, 6784, 2752,
-        2624, 3008, 2880, 2240, 2112, 2496, 2368, 3776, 3648, 4032, 3904, 3264, 3136, 3520, 3392, 22016,
-        20992, 24064, 23040, 17920, 16896, 19968, 18944, 30208, 29184, 32256, 31232, 26112, 25088, 28160, 27136, 11008,
-        10496, 12032, 11520, 8960, 8448, 9984, 9472, 15104, 14592, 16128, 15616, 13056, 12544, 14080, 13568, 344,
-        328, 376, 360, 280, 264, 312, 296, 472, 456, 504, 488, 408, 392, 440, 424, 88,
-        72, 120, 104, 24, 8, 56, 40, 216, 200, 248, 232, 152, 136, 184, 168, 1376,
-        1312, 1504, 1440, 1120, 1056, 1248, 1184, 1888, 1824, 2016, 1952, 1632, 1568, 1760, 1696, 688,
-        656, 752, 720, 560, 528, 624, 592, 944, 912, 1008, 976, 816, 784, 880, 848
-    };
-    const Sint16 mulaw_lut[256] = {
-        -32124, -31100, -30076, -29052, -28028, -27004, -25980, -24956, -23932, -22908, -21884, -20860, -19836, -18812, -17788, -16764, -15996,
-        -15484, -14972, -14460, -13948, -13436, -12924, -12412, -11900, -11388, -10876, -10364, -9852, -9340, -8828, -8316, -7932,
-        -7676, -7420, -7164, -6908, -6652, -6396, -6140, -5884, -5628, -5372, -5116, -4860, -4604, -4348, -4092, -3900,
-        -3772, -3644, -3516, -3388, -3260, -3132, -3004, -2876, -2748, -2620, -2492, -2364, -2236, -2108, -1980, -1884,
-        -1820, -1756, -1692, -1628, -1564, -1500, -1436, -1372, -1308, -1244, -1180, -1116, -1052, -988, -924, -876,
-        -844, -812, -780, -748, -716, -684, -652, -620, -588, -556, -524, -492, -460, -428, -396, -372,
-        -356, -340, -324, -308, -292, -276, -260, -244, -228, -212, -196, -180, -164, -148, -132, -120,
-        -112, -104, -96, -88, -80, -72, -64, -56, -48, -40, -32, -24, -16, -8, 0, 32124,
-        31100, 30076, 29052, 28028, 27004, 25980, 24956, 23932, 22908, 21884, 20860, 19836, 18812, 17788, 16764, 15996,
-        15484, 14972, 14460, 13948, 13436, 12924, 12412, 11900, 11388, 10876, 10364, 9852, 9340, 8828, 8316, 7932,
-        7676, 7420, 7164, 6908, 6652, 6396, 6140, 5884, 5628, 5372, 5116, 4860, 4604, 4348, 4092, 3900,
-        3772, 3644, 3516, 3388, 3260, 3132, 3004, 2876, 2748, 2620, 2492, 2364, 2236, 2108, 1980, 1884,
-        1820, 1756, 1692, 1628, 1564, 1500, 1436, 1372, 1308, 1244, 1180, 1116, 1052, 988, 924, 876,
-        844, 812, 780, 748, 716, 684, 652, 620, 588, 556, 524, 492, 460, 428, 396, 372,
-        356, 340, 324, 308, 292, 276, 260, 244, 228, 212, 196, 180, 164, 148, 132, 120,
-        112, 104, 96, 88, 80, 72, 64, 56, 48, 40, 32, 24, 16, 8, 0
-    };
-#endif
+    SDL_ChooseAudioConverters();
 
+    /* SDL_AudioSpec.format will inform the caller about the byte order. */
+    switch (encoding) {
+    case ALAW_CODE:
+        SDL_Convert_ALaw_to_S16(data, (Sint16 *)data, sample_count);
+        break;
+    case MULAW_CODE:
+        SDL_Convert_ULaw_to_S16(data, (Sint16 *)data, sample_count);
+        break;
+    default:
+        return SDL_SetError("Unknown companded encoding");
+    }
+
+    return 0;
+}
+
+static int
+LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+{
     WaveFormat *format = &file->format;
     WaveChunk *chunk = &file->chunk;
-    size_t i, sample_count, expanded_len;
+    size_t sample_count, expanded_len;
     Uint8 *src;
-    Sint16 *dst;
 
     if (chunk->length != chunk->size) {
         file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
@@ -1247,59 +1372,10 @@ LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
     chunk->data = NULL;
     chunk->size = 0;
 
-    dst = (Sint16 *)src;
-
-    /* Work backwards, since we're expanding in-place. SDL_AudioSpec.format will
-     * inform the caller about the byte order.
-     */
-    i = sample_count;
-    switch (file->format.encoding) {
-#ifdef SDL_WAVE_LAW_LUT
-    case ALAW_CODE:
-        while (i--) {
-            dst[i] = alaw_lut[src[i]];
-        }
-        break;
-    case MULAW_CODE:
-        while (i--) {
-            dst[i] = mulaw_lut[src[i]];
-        }
-        break;
-#else
-    case ALAW_CODE:
-        while (i--) {
-            Uint8 nibble = src[i];
-            Uint8 exponent = (nibble & 0x7f) ^ 0x55;
-            Sint16 mantissa = exponent & 0xf;
-
-            exponent >>= 4;
-            if (exponent > 0) {
-                mantissa |= 0x10;
-            }
-            mantissa = (mantissa << 4) | 0x8;
-            if (exponent > 1) {
-                mantissa <<= exponent - 1;
-            }
-
-            dst[i] = nibble & 0x80 ? mantissa : -mantissa;
-        }
-        break;
-    case MULAW_CODE:
-        while (i--) {
-            Uint8 nibble = ~src[i];
-            Sint16 mantissa = nibble & 0xf;
-            Uint8 exponent = (nibble >> 4) & 0x7;
-            Sint16 step = 4 << (exponent + 1);
-
-            mantissa = (0x80 << exponent) + step * mantissa + step / 2 - 132;
-
-            dst[i] = nibble & 0x80 ? -mantissa : mantissa;
-        }
-        break;
-#endif
-    default:
+    /* The expansion works backwards, so it can be done in-place. */
+    if (LAW_Expand(format->encoding, src, sample_count) < 0) {
         SDL_free(src);
-        return SDL_SetError("Unknown companded encoding");
+        return -1;
     }
 
     *audio_buf = src;
@@ -1352,12 +1428,37 @@ PCM_Init(WaveFile *file, size_t datalength)
     return 0;
 }
 
+/* Shifts sample_count packed 24-bit samples at the start of ptr to 32 bits.
+ * ptr must have room for the expanded samples.
+ */
+static void
+PCM_ExpandSint24ToSint32(Uint8 *ptr, size_t sample_count)
+{
+    size_t i;
+
+    /* work from end to start, since we're expanding in-place. */
+    for (i = sample_count; i > 0; i--) {
+        const size_t o = i - 1;
+        uint8_t b[4];
+
+        b[0] = 0;
+        b[1] = ptr[o * 3];
+        b[2] = ptr[o * 3 + 1];
+        b[3] = ptr[o * 3 + 2];
+
+        ptr[o * 4 + 0] = b[0];
+        ptr[o * 4 + 1] = b[1];
+        ptr[o * 4 + 2] = b[2];
+        ptr[o * 4 + 3] = b[3];
+    }
+}
+
 static int
 PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 {
     WaveFormat *format = &file->format;
     WaveChunk *chunk = &file->chunk;
-    size_t i, expanded_len, sample_count;
+    size_t expanded_len, sample_count;
     Uint8 *ptr;
 
     sample_count = (size_t)file->sampleframes;
@@ -1385,21 +1486,7 @@ PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
     *audio_buf = ptr;
     *audio_len = (Uint32)expanded_len;
 
-    /* work from end to start, since we're expanding in-place. */
-    for (i = sample_count; i > 0; i--) {
-        const size_t o = i - 1;
-        uint8_t b[4];
-
-        b[0] = 0;
-        b[1] = ptr[o * 3];
-        b[2] = ptr[o * 3 + 1];
-        b[3] = ptr[o * 3 + 2];
-
-        ptr[o * 4 + 0] = b[0];
-        ptr[o * 4 + 1] = b[1];
-        ptr[o * 4 + 2] = b[2];
-        ptr[o * 4 + 3] = b[3];
-    }
+    PCM_ExpandSint24ToSint32(ptr, sample_count);
 
     return 0;
 }
@@ -1783,8 +1870,12 @@ WaveCheckFormat(WaveFile *file, size_t datalength)
     return 0;
 }
 
+/* Walks the RIFF chunks and processes the fmt chunk. The data chunk is
+ * returned in datachunk without reading its data. endposition receives the
+ * position after the WAVE file.
+ */
 static int
-WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+WaveReadHeaders(SDL_RWops *src, WaveFile *file, WaveChunk *datachunk, Sint64 *endposition)
 {
     int result;
     Uint32 chunkcount = 0;
@@ -1792,15 +1883,13 @@ WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf,
     char *envchunkcountlimit;
     Sint64 RIFFstart, RIFFend, lastchunkpos;
     SDL_bool RIFFlengthknown = SDL_FALSE;
-    WaveFormat *format = &file->format;
     WaveChunk *chunk = &file->chunk;
     WaveChunk RIFFchunk;
     WaveChunk fmtchunk;
-    WaveChunk datachunk;
 
     SDL_zero(RIFFchunk);
     SDL_zero(fmtchunk);
-    SDL_zero(datachunk);
+    SDL_zerop(datachunk);
 
     envchunkcountlimit = SDL_getenv("SDL_WAVE_CHUNK_LIMIT");
     if (envchunkcountlimit != NULL) {
@@ -1891,7 +1980,7 @@ WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf,
                 /* Multiple fmt chunks. Ignore or error? */
             } else {
                 /* The fmt chunk must occur before the data chunk. */
-                if (datachunk.fourcc == DATA) {
+                if (datachunk->fourcc == DATA) {
                     return SDL_SetError("fmt chunk after data chunk in WAVE file");
                 }
                 fmtchunk = *chunk;
@@ -1900,8 +1989,8 @@ WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf,
             /* Only use the first data chunk. Handling the wavl list madness
              * may require a different approach.
              */
-            if (datachunk.fourcc != DATA) {
-                datachunk = *chunk;
+            if (datachunk->fourcc != DATA) {
+                *datachunk = *chunk;
             }
         } else if (chunk->fourcc == FACT) {
             /* The fact chunk data must be at least 4 bytes for the
@@ -1931,7 +2020,7 @@ WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf,
             if ((Uint64)RIFFend < (Uint64)chunk->position + chunk->length) {
                 return SDL_SetError("RIFF size truncates chunk");
             }
-        } else if (fmtchunk.fourcc == FMT && datachunk.fourcc == DATA) {
+        } else if (fmtchunk.fourcc == FMT && datachunk->fourcc == DATA) {
             if (file->fact.status == 1 || file->facthint == FactIgnore || file->facthint == FactNoHint) {
                 break;
             }
@@ -1948,7 +2037,7 @@ WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf,
         return SDL_SetError("Missing fmt chunk in WAVE file");
     }
     /* A data chunk must be present. */
-    if (datachunk.fourcc != DATA) {
+    if (datachunk->fourcc != DATA) {
         return SDL_SetError("Missing data chunk in WAVE file");
     }
     /* Check if the last chunk has all of its data in verystrict mode. */
@@ -1984,7 +2073,7 @@ WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf,
         return SDL_SetError("Could not read data of WAVE fmt chunk");
     } else if (WaveReadFormat(file) < 0) {
         return -1;
-    } else if (WaveCheckFormat(file, (size_t)datachunk.length) < 0) {
+    } else if (WaveCheckFormat(file, (size_t)datachunk->length) < 0) {
         return -1;
     }
 
@@ -1992,60 +2081,28 @@ WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf,
     WaveDebugLogFormat(file);
 #endif
 #ifdef SDL_WAVE_DEBUG_DUMP_FORMAT
-    WaveDebugDumpFormat(file, RIFFchunk.length, fmtchunk.length, datachunk.length);
+    WaveDebugDumpFormat(file, RIFFchunk.length, fmtchunk.length, datachunk->length);
 #endif
 
     WaveFreeChunkData(chunk);
 
-    /* Process data chunk. */
-    *chunk = datachunk;
-
-    if (chunk->length > 0) {
-        result = WaveReadChunkData(src, chunk);
-        if (result == -1) {
-            return -1;
-        } else if (result == -2) {
-            return SDL_SetError("Could not seek data of WAVE data chunk");
-        }
+    if (RIFFlengthknown) {
+        *endposition = RIFFend;
+    } else {
+        *endposition = lastchunkpos;
     }
 
-    if (chunk->length != chunk->size) {
-        /* I/O issues or corrupt file. */
-        if (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict) {
-            return SDL_SetError("Could not read data of WAVE data chunk");
-        }
-        /* The decoders handle this truncation. */
-    }
+    return 0;
+}
 
-    /* Decode or convert the data if necessary. */
-    switch (format->encoding) {
-    case PCM_CODE:
-    case IEEE_FLOAT_CODE:
-        if (PCM_Decode(file, audio_buf, audio_len) < 0) {
-            return -1;
-        }
-        break;
-    case ALAW_CODE:
-    case MULAW_CODE:
-        if (LAW_Decode(file, audio_buf, audio_len) < 0) {
-            return -1;
-        }
-        break;
-    case MS_ADPCM_CODE:
-        if (MS_ADPCM_Decode(file, audio_buf, audio_len) < 0) {
-            return -1;
-        }
-        break;
-    case IMA_ADPCM_CODE:
-        if (IMA_ADPCM_Decode(file, audio_buf, audio_len) < 0) {
-            return -1;
-        }
-        break;
-    }
+/* Sets up the SDL_AudioSpec for the decoded data. All unsupported formats
+ * were filtered out by WaveCheckFormat.
+ */
+static int
+WaveSetupSpec(WaveFile *file, SDL_AudioSpec *spec)
+{
+    WaveFormat *format = &file->format;
 
-    /* Setting up the SDL_AudioSpec. All unsupported formats were filtered out
-     * by checks earlier in this function.
-     */
     SDL_zerop(spec);
     spec->freq = format->frequency;
     spec->channels = (Uint8)format->channels;
@@ -2070,7 +2127,7 @@ WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf,
         case 16:
             spec->format = AUDIO_S16LSB;
             break;
-        case 24: /* Has been shifted to 32 bits. */
+        case 24: /* Gets shifted to 32 bits. */
         case 32:
             spec->format = AUDIO_S32LSB;
             break;
@@ -2083,18 +2140,163 @@ WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf,
 
     spec->silence = SDL_SilenceValueForFormat(spec->format);
 
-    /* Report the end position back to the cleanup code. */
-    if (RIFFlengthknown) {
-        chunk->position = RIFFend;
-    } else {
-        chunk->position = lastchunkpos;
+    return 0;
+}
+
+/* Buffers returned by SDL_LoadWAVMapped_RW that point into a mapping or a
+ * borrowed memory buffer. SDL_FreeWAV looks here before freeing.
+ */
+typedef struct WaveMappedData
+{
+    Uint8 *data;
+    SDL_RWMapping mapping;
+    struct WaveMappedData *next;
+} WaveMappedData;
+
+static WaveMappedData *wave_mapped_data = NULL;
+static SDL_SpinLock wave_mapped_data_lock = 0;
+
+static int
+WaveAddMappedData(Uint8 *data, const SDL_RWMapping *mapping)
+{
+    WaveMappedData *node = (WaveMappedData *)SDL_malloc(sizeof(*node));
+    if (node == NULL) {
+        return SDL_OutOfMemory();
     }
+    node->data = data;
+    node->mapping = *mapping;
+
+    SDL_AtomicLock(&wave_mapped_data_lock);
+    node->next = wave_mapped_data;
+    wave_mapped_data = node;
+    SDL_AtomicUnlock(&wave_mapped_data_lock);
 
     return 0;
 }
 
-SDL_AudioSpec *
-SDL_LoadWAV_RW(SDL_RWops *src, int freesrc, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+/* Points audio_buf straight into the data chunk, if the data needs no
+ * decoding and src can be mapped. Returns 1 if it did, 0 if the data has to
+ * be read instead, or -1 on error.
+ */
+static int
+WaveMapData(SDL_RWops *src, WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+    SDL_RWMapping mapping;
+    int result;
+
+    /* Only data that PCM_Decode passes through untouched can be mapped. */
+    if (format->encoding == PCM_CODE) {
+        if (format->bitspersample == 24) {
+            return 0;
+        }
+    } else if (format->encoding != IEEE_FLOAT_CODE) {
+        return 0;
+    }
+
+    if (chunk->length == 0) {
+        return 0;
+    }
+    chunk->data = (Uint8 *)SDL_MapRW(src, chunk->position, chunk->length, &mapping);
+    if (chunk->data == NULL) {
+        return 0;
+    }
+    chunk->size = chunk->length;
+
+    result = PCM_Decode(file, audio_buf, audio_len);
+    if (result == 0 && *audio_buf != NULL) {
+        result = WaveAddMappedData(*audio_buf, &mapping);
+    }
+    if (result < 0 || *audio_buf == NULL) {
+        *audio_buf = NULL;
+        *audio_len = 0;
+        SDL_UnmapRW(&mapping);
+    }
+
+    /* Must not be freed with the chunk. */
+    chunk->data = NULL;
+    chunk->size = 0;
+
+    return result < 0 ? -1 : 1;
+}
+
+static int
+WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len, SDL_bool mapdata)
+{
+    int result;
+    Sint64 endposition;
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+    WaveChunk datachunk;
+
+    if (WaveReadHeaders(src, file, &datachunk, &endposition) < 0) {
+        return -1;
+    }
+
+    /* Process data chunk. */
+    *chunk = datachunk;
+
+    result = mapdata ? WaveMapData(src, file, audio_buf, audio_len) : 0;
+    if (result < 0) {
+        return -1;
+    } else if (result == 0) {
+        if (chunk->length > 0) {
+            result = WaveReadChunkData(src, chunk);
+            if (result == -1) {
+                return -1;
+            } else if (result == -2) {
+                return SDL_SetError("Could not seek data of WAVE data chunk");
+            }
+        }
+
+        if (chunk->length != chunk->size) {
+            /* I/O issues or corrupt file. */
+            if (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict) {
+                return SDL_SetError("Could not read data of WAVE data chunk");
+            }
+            /* The decoders handle this truncation. */
+        }
+
+        /* Decode or convert the data if necessary. */
+        switch (format->encoding) {
+        case PCM_CODE:
+        case IEEE_FLOAT_CODE:
+            if (PCM_Decode(file, audio_buf, audio_len) < 0) {
+                return -1;
+            }
+            break;
+        case ALAW_CODE:
+        case MULAW_CODE:
+            if (LAW_Decode(file, audio_buf, audio_len) < 0) {
+                return -1;
+            }
+            break;
+        case MS_ADPCM_CODE:
+            if (MS_ADPCM_Decode(file, audio_buf, audio_len) < 0) {
+                return -1;
+            }
+            break;
+        case IMA_ADPCM_CODE:
+            if (IMA_ADPCM_Decode(file, audio_buf, audio_len) < 0) {
+                return -1;
+            }
+            break;
+        }
+    }
+
+    if (WaveSetupSpec(file, spec) < 0) {
+        return -1;
+    }
+
+    /* Report the end position back to the cleanup code. */
+    chunk->position = endposition;
+
+    return 0;
+}
+
+static SDL_AudioSpec *
+WaveLoadRW(SDL_RWops *src, int freesrc, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len, SDL_bool mapdata)
 {
     int result;
     WaveFile file;
@@ -2123,9 +2325,9 @@ SDL_LoadWAV_RW(SDL_RWops *src, int freesrc, SDL_AudioSpec *spec, Uint8 **audio_b
     file.trunchint = WaveGetTruncationHint();
     file.facthint = WaveGetFactChunkHint();
 
-    result = WaveLoad(src, &file, spec, audio_buf, audio_len);
+    result = WaveLoad(src, &file, spec, audio_buf, audio_len, mapdata);
     if (result < 0) {
-        SDL_free(*audio_buf);
+        SDL_FreeWAV(*audio_buf);
         spec = NULL;
         audio_buf = NULL;
         audio_len = 0;
@@ -2143,13 +2345,462 @@ SDL_LoadWAV_RW(SDL_RWops *src, int freesrc, SDL_AudioSpec *spec, Uint8 **audio_b
     return spec;
 }
 
+SDL_AudioSpec *
+SDL_LoadWAV_RW(SDL_RWops *src, int freesrc, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    return WaveLoadRW(src, freesrc, spec, audio_buf, audio_len, SDL_FALSE);
+}
+
+SDL_AudioSpec *
+SDL_LoadWAVMapped_RW(SDL_RWops *src, int freesrc, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    return WaveLoadRW(src, freesrc, spec, audio_buf, audio_len, SDL_TRUE);
+}
+
 /* Since the WAV memory is allocated in the shared library, it must also
    be freed here.  (Necessary under Win32, VC++)
  */
 void
 SDL_FreeWAV(Uint8 *audio_buf)
 {
-    SDL_free(audio_buf);
+    WaveMappedData *node = NULL;
+
+    if (audio_buf == NULL) {
+        return;
+    }
+
+    /* Mapped or borrowed data was not allocated here. */
+    SDL_AtomicLock(&wave_mapped_data_lock);
+    if (wave_mapped_data != NULL) {
+        WaveMappedData *prev = NULL;
+        for (node = wave_mapped_data; node != NULL; prev = node, node = node->next) {
+            if (node->data == audio_buf) {
+                if (prev != NULL) {
+                    prev->next = node->next;
+                } else {
+                    wave_mapped_data = node->next;
+                }
+                break;
+            }
+        }
+    }
+    SDL_AtomicUnlock(&wave_mapped_data_lock);
+
+    if (node != NULL) {
+        SDL_UnmapRW(&node->mapping);
+        SDL_free(node);
+    } else {
+        SDL_free(audio_buf);
+    }
+}
+
+/* Incremental WAVE decoding. The headers are parsed once and the data chunk
+ * is read and decoded on demand, one ADPCM block or a run of PCM sample
+ * frames at a time.
+ */
+struct _SDL_WAVDecoder
+{
+    SDL_RWops *src;
+    int freesrc;
+    WaveFile file;
+    Sint64 dataposition;    /* Position of the data chunk data in src. */
+    size_t datalength;      /* Length of the data chunk data. */
+    Sint64 endposition;     /* Position after the WAVE file. */
+    Sint64 rwposition;      /* Current position of src, -1 if unknown. */
+    size_t inframesize;     /* Size of an input sample frame (PCM and law). */
+    size_t outframesize;    /* Size of a decoded sample frame. */
+    Sint64 frames;          /* Number of decodable sample frames. */
+    Sint64 frame;           /* Next sample frame to be returned. */
+
+    /* ADPCM only. */
+    Uint8 *block;           /* Current ADPCM block data. */
+    Sint16 *blockoutput;    /* Decoded samples of the current ADPCM block. */
+    Sint64 blockindex;      /* Index of the decoded ADPCM block, -1 if none. */
+    Sint64 blockframes;     /* Number of sample frames in blockoutput. */
+    void *cstate;           /* Decoding state for each channel. */
+};
+
+static SDL_bool
+WaveDecoderIsADPCM(SDL_WAVDecoder *decoder)
+{
+    const Uint16 encoding = decoder->file.format.encoding;
+    return (encoding == MS_ADPCM_CODE || encoding == IMA_ADPCM_CODE) ? SDL_TRUE : SDL_FALSE;
+}
+
+static SDL_bool
+WaveDecoderIsStrict(SDL_WAVDecoder *decoder)
+{
+    const WaveTruncationHint trunchint = decoder->file.trunchint;
+    return (trunchint == TruncVeryStrict || trunchint == TruncStrict) ? SDL_TRUE : SDL_FALSE;
+}
+
+static int
+WaveDecoderSeekSource(SDL_WAVDecoder *decoder, Sint64 position)
+{
+    if (decoder->rwposition != position) {
+        decoder->rwposition = SDL_RWseek(decoder->src, position, RW_SEEK_SET);
+        if (decoder->rwposition != position) {
+            decoder->rwposition = -1;
+            return SDL_SetError("Could not seek data of WAVE data chunk");
+        }
+    }
+    return 0;
+}
+
+/* Reads and decodes the ADPCM block with the given index into blockoutput. */
+static int
+WaveDecoderDecodeBlock(SDL_WAVDecoder *decoder, Sint64 blockindex)
+{
+    int result;
+    WaveFile *file = &decoder->file;
+    ADPCM_DecoderState state;
+    const size_t blockalign = file->format.blockalign;
+    const Uint64 offset = (Uint64)blockindex * blockalign;
+    size_t blocksize, bytesread;
+
+    decoder->blockindex = -1;
+    decoder->blockframes = 0;
+
+    if (offset >= decoder->datalength) {
+        return 0;
+    }
+    blocksize = decoder->datalength - (size_t)offset;
+    if (blocksize > blockalign) {
+        blocksize = blockalign;
+    }
+
+    if (WaveDecoderSeekSource(decoder, decoder->dataposition + (Sint64)offset) < 0) {
+        return -1;
+    }
+    bytesread = SDL_RWread(decoder->src, decoder->block, 1, blocksize);
+    decoder->rwposition += bytesread;
+
+    SDL_zero(state);
+    state.channels = file->format.channels;
+    state.blocksize = blockalign;
+    state.samplesperblock = file->format.samplesperblock;
+    state.framesize = state.channels * sizeof(Sint16);
+    state.ddata = file->decoderdata;
+    state.cstate = decoder->cstate;
+    state.framestotal = decoder->frames;
+    state.framesleft = decoder->frames - blockindex * (Sint64)state.samplesperblock;
+
+    state.block.data = decoder->block;
+    state.block.size = bytesread;
+    state.block.pos = 0;
+
+    state.output.data = decoder->blockoutput;
+    state.output.size = state.samplesperblock * state.channels;
+    state.output.pos = 0;
+
+    if (file->format.encoding == MS_ADPCM_CODE) {
+        state.blockheadersize = (size_t)state.channels * 7;
+    } else {
+        state.blockheadersize = (size_t)state.channels * 4;
+    }
+
+    if (bytesread < state.blockheadersize) {
+        result = -1;
+    } else if (file->format.encoding == MS_ADPCM_CODE) {
+        /* An invalid block header is an error, not a truncation. */
+        if (MS_ADPCM_DecodeBlockHeader(&state) < 0) {
+            return -1;
+        }
+        result = MS_ADPCM_DecodeBlockData(&state);
+    } else {
+        result = IMA_ADPCM_DecodeBlockHeader(&state);
+        if (result == 0) {
+            result = IMA_ADPCM_DecodeBlockData(&state);
+        }
+    }
+
+    if (result == -1) {
+        /* Unexpected end. Same rules as with the decoders that load everything. */
+        if (WaveDecoderIsStrict(decoder)) {
+            return SDL_SetError("Truncated data chunk");
+        } else if (file->trunchint != TruncDropFrame || bytesread < state.blockheadersize) {
+            state.output.pos = 0;
+        }
+    }
+
+    decoder->blockindex = blockindex;
+    decoder->blockframes = (Sint64)(state.output.pos / state.channels);
+
+    return 0;
+}
+
+SDL_WAVDecoder *
+SDL_OpenWAVDecoder_RW(SDL_RWops *src, int freesrc, SDL_AudioSpec *spec)
+{
+    SDL_WAVDecoder *decoder;
+    WaveFile *file;
+    WaveFormat *format;
+    WaveChunk datachunk;
+    Sint64 srcsize;
+    size_t available;
+
+    /* Make sure we are passed a valid data source */
+    if (src == NULL) {
+        /* Error may come from RWops. */
+        return NULL;
+    } else if (spec == NULL) {
+        SDL_InvalidParamError("spec");
+        if (freesrc) {
+            SDL_RWclose(src);
+        }
+        return NULL;
+    }
+
+    decoder = (SDL_WAVDecoder *)SDL_calloc(1, sizeof(*decoder));
+    if (decoder == NULL) {
+        SDL_OutOfMemory();
+        if (freesrc) {
+            SDL_RWclose(src);
+        }
+        return NULL;
+    }
+    decoder->src = src;
+    decoder->freesrc = freesrc;
+    decoder->rwposition = -1;
+    decoder->blockindex = -1;
+
+    file = &decoder->file;
+    format = &file->format;
+    file->riffhint = WaveGetRiffSizeHint();
+    file->trunchint = WaveGetTruncationHint();
+    file->facthint = WaveGetFactChunkHint();
+
+    if (WaveReadHeaders(src, file, &datachunk, &decoder->endposition) < 0) {
+        /* Leave src where SDL_LoadWAV_RW would have left it. */
+        decoder->endposition = file->chunk.position;
+        goto failed;
+    }
+    WaveFreeChunkData(&file->chunk);
+    file->chunk = datachunk;
+
+    decoder->dataposition = datachunk.position;
+    decoder->datalength = datachunk.length;
+
+    /* Find out up front if the data chunk is cut short by the end of src. The
+     * sample frame count is then recalculated like the decoders do after a
+     * short read.
+     */
+    available = decoder->datalength;
+    srcsize = SDL_RWsize(src);
+    if (srcsize >= 0 && (Uint64)srcsize < (Uint64)decoder->dataposition + available) {
+        available = srcsize > decoder->dataposition ? (size_t)(srcsize - decoder->dataposition) : 0;
+    }
+    if (available != decoder->datalength) {
+        /* I/O issues or corrupt file. */
+        if (WaveDecoderIsStrict(decoder)) {
+            SDL_SetError("Could not read data of WAVE data chunk");
+            goto failed;
+        }
+        decoder->datalength = available;
+        switch (format->encoding) {
+        case MS_ADPCM_CODE:
+            if (MS_ADPCM_CalculateSampleFrames(file, available) < 0) {
+                goto failed;
+            }
+            break;
+        case IMA_ADPCM_CODE:
+            if (IMA_ADPCM_CalculateSampleFrames(file, available) < 0) {
+                goto failed;
+            }
+            break;
+        default:
+            file->sampleframes = WaveAdjustToFactValue(file, available / format->blockalign);
+            if (file->sampleframes < 0) {
+                goto failed;
+            }
+            break;
+        }
+    }
+
+    if (WaveSetupSpec(file, spec) < 0) {
+        goto failed;
+    }
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+        decoder->outframesize = (size_t)format->channels * sizeof(Sint16);
+        decoder->frames = file->sampleframes;
+        decoder->block = (Uint8 *)SDL_malloc(format->blockalign);
+        decoder->blockoutput = (Sint16 *)SDL_malloc(decoder->outframesize * format->samplesperblock);
+        if (format->encoding == MS_ADPCM_CODE) {
+            decoder->cstate = SDL_calloc(2, sizeof(MS_ADPCM_ChannelState));
+        } else {
+            decoder->cstate = SDL_calloc(format->channels, sizeof(Sint8));
+        }
+        if (decoder->block == NULL || decoder->blockoutput == NULL || decoder->cstate == NULL) {
+            SDL_OutOfMemory();
+            goto failed;
+        }
+        break;
+    default:
+        /* The block alignment may be smaller than the sample frame. Go by the
+         * number of bytes SDL_LoadWAV_RW would return instead.
+         */
+        decoder->inframesize = (size_t)format->channels * (format->bitspersample / 8);
+        decoder->outframesize = (size_t)format->channels * SDL_AUDIO_BITSIZE(spec->format) / 8;
+        decoder->frames = file->sampleframes * format->blockalign / (Sint64)decoder->inframesize;
+        break;
+    }
+
+    return decoder;
+
+failed:
+    SDL_CloseWAVDecoder(decoder);
+    return NULL;
+}
+
+int
+SDL_WAVDecoderRead(SDL_WAVDecoder *decoder, void *buf, int len)
+{
+    Uint8 *dst = (Uint8 *)buf;
+    Sint64 frames;
+    int total = 0;
+
+    if (decoder == NULL) {
+        return SDL_InvalidParamError("decoder");
+    } else if (buf == NULL) {
+        return SDL_InvalidParamError("buf");
+    } else if (len < 0) {
+        return SDL_InvalidParamError("len");
+    }
+
+    frames = (Sint64)((size_t)len / decoder->outframesize);
+    if (frames > decoder->frames - decoder->frame) {
+        frames = decoder->frames - decoder->frame;
+    }
+    if (frames <= 0) {
+        return 0;
+    }
+
+    if (WaveDecoderIsADPCM(decoder)) {
+        const Sint64 samplesperblock = decoder->file.format.samplesperblock;
+        const Uint32 channels = decoder->file.format.channels;
+
+        while (frames > 0) {
+            const Sint64 blockindex = decoder->frame / samplesperblock;
+            const Sint64 blockframe = decoder->frame - blockindex * samplesperblock;
+            Sint64 count;
+
+            if (blockindex != decoder->blockindex) {
+                if (WaveDecoderDecodeBlock(decoder, blockindex) < 0) {
+                    return -1;
+                }
+            }
+
+            count = decoder->blockframes - blockframe;
+            if (count <= 0) {
+                /* The data ended early. Nothing more to decode. */
+                decoder->frames = decoder->frame;
+                break;
+            } else if (count > frames) {
+                count = frames;
+            }
+
+            SDL_memcpy(dst, decoder->blockoutput + blockframe * channels, (size_t)count * decoder->outframesize);
+            dst += (size_t)count * decoder->outframesize;
+            total += (int)((size_t)count * decoder->outframesize);
+            decoder->frame += count;
+            frames -= count;
+        }
+    } else {
+        WaveFormat *format = &decoder->file.format;
+        const size_t inlength = (size_t)frames * decoder->inframesize;
+        size_t bytesread, sample_count;
+
+        if (WaveDecoderSeekSource(decoder, decoder->dataposition + decoder->frame * (Sint64)decoder->inframesize) < 0) {
+            return -1;
+        }
+
+        /* Read into the start of buf and expand from there, in-place. */
+        bytesread = SDL_RWread(decoder->src, dst, 1, inlength);
+        decoder->rwposition += bytesread;
+        if (bytesread < inlength) {
+            /* I/O issues or corrupt file. */
+            if (WaveDecoderIsStrict(decoder)) {
+                return SDL_SetError("Could not read data of WAVE data chunk");
+            }
+            frames = (Sint64)(bytesread / decoder->inframesize);
+            decoder->frames = decoder->frame + frames;
+        }
+
+        sample_count = (size_t)frames * format->channels;
+        switch (format->encoding) {
+        case ALAW_CODE:
+        case MULAW_CODE:
+            if (LAW_Expand(format->encoding, dst, sample_count) < 0) {
+                return -1;
+            }
+            break;
+        case PCM_CODE:
+            if (format->bitspersample == 24) {
+                PCM_ExpandSint24ToSint32(dst, sample_count);
+            }
+            break;
+        }
+
+        total = (int)((size_t)frames * decoder->outframesize);
+        decoder->frame += frames;
+    }
+
+    return total;
+}
+
+int
+SDL_WAVDecoderSeek(SDL_WAVDecoder *decoder, Sint64 frame)
+{
+    if (decoder == NULL) {
+        return SDL_InvalidParamError("decoder");
+    } else if (frame < 0 || frame > decoder->frames) {
+        return SDL_InvalidParamError("frame");
+    }
+
+    /* The ADPCM block holding this frame gets decoded on the next read. */
+    decoder->frame = frame;
+    return 0;
+}
+
+Sint64
+SDL_WAVDecoderTell(SDL_WAVDecoder *decoder)
+{
+    if (decoder == NULL) {
+        return SDL_InvalidParamError("decoder");
+    }
+    return decoder->frame;
+}
+
+Sint64
+SDL_WAVDecoderFrames(SDL_WAVDecoder *decoder)
+{
+    if (decoder == NULL) {
+        return SDL_InvalidParamError("decoder");
+    }
+    return decoder->frames;
+}
+
+void
+SDL_CloseWAVDecoder(SDL_WAVDecoder *decoder)
+{
+    if (decoder == NULL) {
+        return;
+    }
+
+    if (decoder->freesrc) {
+        SDL_RWclose(decoder->src);
+    } else {
+        SDL_RWseek(decoder->src, decoder->endposition, RW_SEEK_SET);
+    }
+    WaveFreeChunkData(&decoder->file.chunk);
+    SDL_free(decoder->file.decoderdata);
+    SDL_free(decoder->block);
+    SDL_free(decoder->blockoutput);
+    SDL_free(decoder->cstate);
+    SDL_free(decoder);
 }
 
 /* vi: set ts=4 sw=4 expandtab: */
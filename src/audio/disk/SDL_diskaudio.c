@@ -33,6 +33,7 @@
 #include "SDL_audio.h"
 #include "../SDL_audio_c.h"
 #include "SDL_diskaudio.h"
+#include "../../thread/SDL_systhread.h"
 
 /* !!! FIXME: these should be SDL hints, not environment variables. */
 /* environment variables and defaults. */
@@ -41,18 +42,76 @@
 #define DISKENVR_INFILE         "SDL_DISKAUDIOFILEIN"
 #define DISKDEFAULT_INFILE      "sdlaudio-in.raw"
 #define DISKENVR_IODELAY      "SDL_DISKAUDIODELAY"
+#define DISKENVR_FREEWHEEL    "SDL_DISKAUDIOFREEWHEEL"
+
+/* Freewheel mode writes the file in batches of at least this many bytes. */
+#define DISKAUDIO_MIN_BATCH_SIZE (64 * 1024)
+
+/* The writer thread for freewheel mode, so the audio thread never waits on the disk
+   unless it gets DISKAUDIO_NUM_BATCHES batches ahead. */
+static int SDLCALL
+DISKAUDIO_WriterThread(void *data)
+{
+    struct SDL_PrivateAudioData *h = (struct SDL_PrivateAudioData *) data;
+    int i = 0;
+
+    for (;;) {
+        SDL_SemWait(h->full_batches);
+        if (h->batch_lens[i] == 0) {
+            break;
+        }
+        if (!SDL_AtomicGet(&h->write_failed)) {
+            if (SDL_RWwrite(h->io, h->batches[i], 1, h->batch_lens[i]) != h->batch_lens[i]) {
+                SDL_AtomicSet(&h->write_failed, 1);
+            }
+        }
+        i = (i + 1) % DISKAUDIO_NUM_BATCHES;
+        SDL_SemPost(h->free_batches);
+    }
+
+    return 0;
+}
+
+/* Hands the batch being filled to the writer thread; a zero length tells it to stop. */
+static void
+DISKAUDIO_SubmitBatch(struct SDL_PrivateAudioData *h, size_t len)
+{
+    h->batch_lens[h->fill_batch] = len;
+    h->fill_batch = (h->fill_batch + 1) % DISKAUDIO_NUM_BATCHES;
+    h->fill_len = 0;
+    SDL_SemPost(h->full_batches);
+}
 
 /* This function waits until it is possible to write a full sound buffer */
 static void
 DISKAUDIO_WaitDevice(_THIS)
 {
-    SDL_Delay(_this->hidden->io_delay);
+    /* freewheeling goes as fast as the callback can run, but a paused device
+       still plays its silence in real time instead of filling up the disk. */
+    if (!_this->hidden->freewheel || SDL_AtomicGet(&_this->paused)) {
+        SDL_Delay(_this->hidden->io_delay);
+    }
 }
 
 static void
 DISKAUDIO_PlayDevice(_THIS)
 {
-    const size_t written = SDL_RWwrite(_this->hidden->io,
+    struct SDL_PrivateAudioData *h = _this->hidden;
+    size_t written;
+
+    if (h->freewheel) {
+        /* the buffer was mixed in place, so just move along. */
+        h->fill_len += _this->spec.size;
+        if (h->fill_len == h->batch_size) {
+            DISKAUDIO_SubmitBatch(h, h->fill_len);
+        }
+        if (SDL_AtomicGet(&h->write_failed)) {
+            SDL_OpenedAudioDeviceDisconnected(_this);
+        }
+        return;
+    }
+
+    written = SDL_RWwrite(_this->hidden->io,
                                        _this->hidden->mixbuf,
                                        1, _this->spec.size);
 
@@ -68,6 +127,15 @@ DISKAUDIO_PlayDevice(_THIS)
 static Uint8 *
 DISKAUDIO_GetDeviceBuf(_THIS)
 {
+    struct SDL_PrivateAudioData *h = _this->hidden;
+
+    if (h->freewheel) {
+        /* mix straight into the next batch, waiting for the writer if it's that far behind. */
+        if (h->fill_len == 0) {
+            SDL_SemWait(h->free_batches);
+        }
+        return h->batches[h->fill_batch] + h->fill_len;
+    }
     return (_this->hidden->mixbuf);
 }
 
@@ -105,6 +173,36 @@ DISKAUDIO_FlushCapture(_THIS)
 static void
 DISKAUDIO_CloseDevice(_THIS)
 {
+    struct SDL_PrivateAudioData *h = _this->hidden;
+    int i;
+
+    if (h->writer != NULL) {
+        /* a partial batch already holds its slot; the stop request needs one more. */
+        if (h->fill_len > 0) {
+            DISKAUDIO_SubmitBatch(h, h->fill_len);
+        }
+        SDL_SemWait(h->free_batches);
+        DISKAUDIO_SubmitBatch(h, 0);
+        SDL_WaitThread(h->writer, NULL);
+    }
+    if (h->freewheel && _this->stats.unpaused_ns > 0) {
+        /* the audio thread is done, so the stats hold still. */
+        const double seconds = (double) _this->stats.unpaused_ns / 1000000000.0;
+        const double audio_seconds = (double) _this->stats.unpaused_frames / _this->callbackspec.freq;
+        SDL_LogInfo(SDL_LOG_CATEGORY_AUDIO,
+                    "Disk audio freewheel: %.3f seconds of audio in %.3f seconds, %.2fx real time.\n",
+                    audio_seconds, seconds, audio_seconds / seconds);
+    }
+    if (h->free_batches != NULL) {
+        SDL_DestroySemaphore(h->free_batches);
+    }
+    if (h->full_batches != NULL) {
+        SDL_DestroySemaphore(h->full_batches);
+    }
+    for (i = 0; i < DISKAUDIO_NUM_BATCHES; i++) {
+        SDL_free(h->batches[i]);
+    }
+
     if (_this->hidden->io != NULL) {
         SDL_RWclose(_this->hidden->io);
     }
@@ -153,8 +251,32 @@ DISKAUDIO_OpenDevice(_THIS, const char *devname)
         return -1;
     }
 
-    /* Allocate mixing buffer */
-    if (!iscapture) {
+    envr = SDL_getenv(DISKENVR_FREEWHEEL);
+    if (!iscapture && envr != NULL && SDL_atoi(envr) != 0) {
+        /* Batches of whole buffers, written by their own thread. */
+        struct SDL_PrivateAudioData *h = _this->hidden;
+        const size_t buffers = (DISKAUDIO_MIN_BATCH_SIZE + _this->spec.size - 1) / _this->spec.size;
+        int i;
+
+        h->freewheel = SDL_TRUE;
+        h->batch_size = buffers * _this->spec.size;
+        for (i = 0; i < DISKAUDIO_NUM_BATCHES; i++) {
+            h->batches[i] = (Uint8 *) SDL_malloc(h->batch_size);
+            if (h->batches[i] == NULL) {
+                return SDL_OutOfMemory();
+            }
+        }
+        h->free_batches = SDL_CreateSemaphore(DISKAUDIO_NUM_BATCHES);
+        h->full_batches = SDL_CreateSemaphore(0);
+        if (h->free_batches == NULL || h->full_batches == NULL) {
+            return -1;
+        }
+        h->writer = SDL_CreateThreadInternal(DISKAUDIO_WriterThread, "SDLDiskAudioWriter", 64 * 1024, h);
+        if (h->writer == NULL) {
+            return -1;
+        }
+    } else if (!iscapture) {
+        /* Allocate mixing buffer */
         _this->hidden->mixbuf = (Uint8 *) SDL_malloc(_this->spec.size);
         if (_this->hidden->mixbuf == NULL) {
             return SDL_OutOfMemory();
@@ -165,8 +287,8 @@ DISKAUDIO_OpenDevice(_THIS, const char *devname)
     SDL_LogCritical(SDL_LOG_CATEGORY_AUDIO,
                 "You are using the SDL disk i/o audio driver!\n");
     SDL_LogCritical(SDL_LOG_CATEGORY_AUDIO,
-                " %s file [%s].\n", iscapture ? "Reading from" : "Writing to",
-                fname);
+                " %s file [%s]%s.\n", iscapture ? "Reading from" : "Writing to",
+                fname, _this->hidden->freewheel ? ", freewheeling" : "");
 
     /* We're ready to rock and roll. :-) */
     return 0;
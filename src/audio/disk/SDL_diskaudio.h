@@ -29,12 +29,27 @@
 /* Hidden "this" pointer for the audio functions */
 #define _THIS   SDL_AudioDevice *_this
 
+/* Number of batches in flight between the audio thread and the writer thread in freewheel mode. */
+#define DISKAUDIO_NUM_BATCHES 4
+
 struct SDL_PrivateAudioData
 {
     /* The file descriptor for the audio device */
     SDL_RWops *io;
     Uint32 io_delay;
     Uint8 *mixbuf;
+
+    /* Freewheel mode: the audio thread fills batches of whole buffers, which a writer thread saves. */
+    SDL_bool freewheel;
+    SDL_Thread *writer;
+    SDL_sem *free_batches;
+    SDL_sem *full_batches;
+    Uint8 *batches[DISKAUDIO_NUM_BATCHES];
+    size_t batch_lens[DISKAUDIO_NUM_BATCHES];  /* bytes to write; 0 tells the writer to stop. */
+    size_t batch_size;
+    int fill_batch;   /* batch being filled by the audio thread. */
+    size_t fill_len;
+    SDL_atomic_t write_failed;
 };
 
 #endif /* SDL_diskaudio_h_ */
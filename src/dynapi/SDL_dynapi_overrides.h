@@ -880,3 +880,22 @@
 #define SDL_GetOriginalMemoryFunctions SDL_GetOriginalMemoryFunctions_REAL
 #define SDL_ResetKeyboard SDL_ResetKeyboard_REAL
 #define SDL_GetDefaultAudioInfo SDL_GetDefaultAudioInfo_REAL
+#define SDL_AudioStreamSetResampleQuality SDL_AudioStreamSetResampleQuality_REAL
+#define SDL_AudioStreamBeginPut SDL_AudioStreamBeginPut_REAL
+#define SDL_AudioStreamEndPut SDL_AudioStreamEndPut_REAL
+#define SDL_AudioStreamBeginGet SDL_AudioStreamBeginGet_REAL
+#define SDL_AudioStreamEndGet SDL_AudioStreamEndGet_REAL
+#define SDL_MixAudioSources SDL_MixAudioSources_REAL
+#define SDL_OpenWAVDecoder_RW SDL_OpenWAVDecoder_RW_REAL
+#define SDL_WAVDecoderRead SDL_WAVDecoderRead_REAL
+#define SDL_WAVDecoderSeek SDL_WAVDecoderSeek_REAL
+#define SDL_WAVDecoderTell SDL_WAVDecoderTell_REAL
+#define SDL_WAVDecoderFrames SDL_WAVDecoderFrames_REAL
+#define SDL_CloseWAVDecoder SDL_CloseWAVDecoder_REAL
+#define SDL_LoadWAVMapped_RW SDL_LoadWAVMapped_RW_REAL
+#define SDL_DecodeG711 SDL_DecodeG711_REAL
+#define SDL_GetAudioDeviceStats SDL_GetAudioDeviceStats_REAL
+#define SDL_ResetAudioDeviceStats SDL_ResetAudioDeviceStats_REAL
+#define SDL_AudioStreamSetChannelMatrix SDL_AudioStreamSetChannelMatrix_REAL
+#define SDL_BindAudioStream SDL_BindAudioStream_REAL
+#define SDL_UnbindAudioStream SDL_UnbindAudioStream_REAL
@@ -963,3 +963,22 @@ SDL_DYNAPI_PROC(int,SDL_GDKRunApp,(SDL_main_func a, void *b),(a,b),return)
 SDL_DYNAPI_PROC(void,SDL_GetOriginalMemoryFunctions,(SDL_malloc_func *a, SDL_calloc_func *b, SDL_realloc_func *c, SDL_free_func *d),(a,b,c,d),)
 SDL_DYNAPI_PROC(void,SDL_ResetKeyboard,(void),(),)
 SDL_DYNAPI_PROC(int,SDL_GetDefaultAudioInfo,(char **a, SDL_AudioSpec *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_AudioStreamSetResampleQuality,(SDL_AudioStream *a, SDL_AudioResampleQuality b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_AudioStreamBeginPut,(SDL_AudioStream *a, int b, void **c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_AudioStreamEndPut,(SDL_AudioStream *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_AudioStreamBeginGet,(SDL_AudioStream *a, const void **b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_AudioStreamEndGet,(SDL_AudioStream *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_MixAudioSources,(Uint8 *a, const SDL_AudioMixSource *b, int c, SDL_AudioFormat d, Uint8 e, Uint32 f),(a,b,c,d,e,f),return)
+SDL_DYNAPI_PROC(SDL_WAVDecoder*,SDL_OpenWAVDecoder_RW,(SDL_RWops *a, int b, SDL_AudioSpec *c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_WAVDecoderRead,(SDL_WAVDecoder *a, void *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_WAVDecoderSeek,(SDL_WAVDecoder *a, Sint64 b),(a,b),return)
+SDL_DYNAPI_PROC(Sint64,SDL_WAVDecoderTell,(SDL_WAVDecoder *a),(a),return)
+SDL_DYNAPI_PROC(Sint64,SDL_WAVDecoderFrames,(SDL_WAVDecoder *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_CloseWAVDecoder,(SDL_WAVDecoder *a),(a),)
+SDL_DYNAPI_PROC(SDL_AudioSpec*,SDL_LoadWAVMapped_RW,(SDL_RWops *a, int b, SDL_AudioSpec *c, Uint8 **d, Uint32 *e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(int,SDL_DecodeG711,(SDL_G711Law a, const void *b, Sint16 *c, int d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(int,SDL_GetAudioDeviceStats,(SDL_AudioDeviceID a, SDL_AudioDeviceStats *b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_ResetAudioDeviceStats,(SDL_AudioDeviceID a),(a),)
+SDL_DYNAPI_PROC(int,SDL_AudioStreamSetChannelMatrix,(SDL_AudioStream *a, const float *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_BindAudioStream,(SDL_AudioDeviceID a, SDL_AudioStream *b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_UnbindAudioStream,(SDL_AudioStream *a),(a),)
@@ -48,6 +48,14 @@
 
 #include "SDL_endian.h"
 #include "SDL_rwops.h"
+#include "SDL_rwops_c.h"
+
+#if defined(HAVE_STDIO_H) && defined(HAVE_MMAP) && defined(HAVE_SYSCONF)
+#define SDL_RWOPS_MMAP 1
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 #ifdef __APPLE__
 #include "cocoa/SDL_rwopsbundlesupport.h"
@@ -721,6 +729,100 @@ SDL_FreeRW(SDL_RWops * area)
     SDL_free(area);
 }
 
+void *
+SDL_MapRW(SDL_RWops *context, Sint64 offset, size_t length, SDL_RWMapping *mapping)
+{
+    Sint64 size;
+
+    SDL_zerop(mapping);
+
+    if (offset < 0 || length == 0) {
+        return NULL;
+    }
+
+    /* Mapping pages past the end of a file would fault when touched. */
+    size = SDL_RWsize(context);
+    if (size < 0 || (Uint64)offset + length > (Uint64)size) {
+        return NULL;
+    }
+
+    switch (context->type) {
+    case SDL_RWOPS_MEMORY:
+    case SDL_RWOPS_MEMORY_RO:
+        /* Borrow the buffer. It belongs to the caller, not the RWops. */
+        return context->hidden.mem.base + offset;
+
+#if (defined(__WIN32__) || defined(__GDK__)) && !defined(__XBOXONE__) && !defined(__XBOXSERIES__)
+    case SDL_RWOPS_WINFILE:
+    {
+        SYSTEM_INFO info;
+        Uint64 start;
+        HANDLE filemapping;
+
+        /* Views have to start at a multiple of the allocation granularity. */
+        GetSystemInfo(&info);
+        start = (Uint64)offset - ((Uint64)offset % info.dwAllocationGranularity);
+
+        filemapping = CreateFileMappingW((HANDLE)context->hidden.windowsio.h, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (filemapping == NULL) {
+            return NULL;
+        }
+        mapping->size = (size_t)((Uint64)offset + length - start);
+        mapping->base = MapViewOfFile(filemapping, FILE_MAP_READ, (DWORD)(start >> 32), (DWORD)start, mapping->size);
+        /* The view keeps the file mapping alive. */
+        CloseHandle(filemapping);
+        if (mapping->base == NULL) {
+            SDL_zerop(mapping);
+            return NULL;
+        }
+        return (Uint8 *)mapping->base + (size_t)((Uint64)offset - start);
+    }
+#endif
+
+#ifdef SDL_RWOPS_MMAP
+    case SDL_RWOPS_STDFILE:
+    {
+        const long pagesize = sysconf(_SC_PAGESIZE);
+        Uint64 start;
+        void *base;
+
+        if (pagesize <= 0) {
+            return NULL;
+        }
+        start = (Uint64)offset - ((Uint64)offset % (Uint64)pagesize);
+        if ((Uint64)(off_t)start != start) {
+            return NULL;
+        }
+
+        mapping->size = (size_t)((Uint64)offset + length - start);
+        base = mmap(NULL, mapping->size, PROT_READ, MAP_SHARED, fileno(context->hidden.stdio.fp), (off_t)start);
+        if (base == MAP_FAILED) {
+            SDL_zerop(mapping);
+            return NULL;
+        }
+        mapping->base = base;
+        return (Uint8 *)base + (size_t)((Uint64)offset - start);
+    }
+#endif
+
+    default:
+        return NULL;
+    }
+}
+
+void
+SDL_UnmapRW(SDL_RWMapping *mapping)
+{
+    if (mapping->base != NULL) {
+#if (defined(__WIN32__) || defined(__GDK__)) && !defined(__XBOXONE__) && !defined(__XBOXSERIES__)
+        UnmapViewOfFile(mapping->base);
+#elif defined(SDL_RWOPS_MMAP)
+        munmap(mapping->base, mapping->size);
+#endif
+    }
+    SDL_zerop(mapping);
+}
+
 /* Load all the data from an SDL data stream */
 void *
 SDL_LoadFile_RW(SDL_RWops * src, size_t *datasize, int freesrc)
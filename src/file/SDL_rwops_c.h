@@ -0,0 +1,47 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2022 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL_rwops_c_h_
+#define SDL_rwops_c_h_
+
+#include "../SDL_internal.h"
+
+#include "SDL_rwops.h"
+
+/* A read-only view of a range of an SDL_RWops, see SDL_MapRW(). */
+typedef struct SDL_RWMapping
+{
+    void *base;     /* Start of the mapped pages, NULL if the data is borrowed. */
+    size_t size;    /* Size of the mapped pages. */
+} SDL_RWMapping;
+
+/* Makes length bytes at offset of context readable in memory without copying
+ * them. Memory streams lend their buffer, files are memory-mapped where the
+ * platform supports it. Returns a pointer to the data, or NULL if the range
+ * can't be mapped, in which case the caller should read the data instead.
+ * The view stays valid after context is closed, until SDL_UnmapRW().
+ */
+extern void *SDL_MapRW(SDL_RWops *context, Sint64 offset, size_t length, SDL_RWMapping *mapping);
+extern void SDL_UnmapRW(SDL_RWMapping *mapping);
+
+#endif /* SDL_rwops_c_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
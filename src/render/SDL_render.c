@@ -1108,6 +1108,9 @@ SDL_CreateSoftwareRenderer(SDL_Surface * surface)
         /* Software renderer always uses line method, for speed */
         renderer->line_method = SDL_RENDERLINEMETHOD_LINES;
 
+        /* Draws go straight to the app's surface, so only batch if the app asks to. */
+        renderer->batching = SDL_GetHintBoolean(SDL_HINT_RENDER_BATCHING, SDL_FALSE);
+
         SDL_RenderSetViewport(renderer, NULL);
     }
     return renderer;
@@ -3811,6 +3814,28 @@ remap_indices(
     return k;
 }
 
+/* Queues the triangles SDL_SW_RenderGeometryRaw() has collected in 'tris' as one command */
+static int
+QueueSWTriangles(SDL_Renderer *renderer, SDL_Texture *texture,
+                 const float *xy, int xy_stride, const SDL_Color *color, int color_stride,
+                 const float *uv, int uv_stride, int num_vertices, const int *tris, int *num_tris)
+{
+    int retval;
+
+    if (*num_tris == 0) {
+        return 0;
+    }
+
+    retval = QueueCmdGeometry(renderer, texture,
+                              xy, xy_stride, color, color_stride, uv, uv_stride,
+                              num_vertices, tris, *num_tris, 4, renderer->scale.x, renderer->scale.y);
+    *num_tris = 0;
+    if (retval == 0) {
+        FlushRenderCommandsIfNotBatching(renderer);
+    }
+    return retval;
+}
+
 #define DEBUG_SW_RENDER_GEOMETRY 0
 /* For the software renderer, try to reinterpret triangles as SDL_Rect */
 static int SDLCALL
@@ -3826,10 +3851,18 @@ SDL_SW_RenderGeometryRaw(SDL_Renderer *renderer,
     int retval = 0;
     int count = indices ? num_indices : num_vertices;
     int prev[3]; /* Previous triangle vertex indices */
+    int *tris;   /* Indices of the triangles to queue as one command */
+    int num_tris = 0;
+    SDL_bool isstack;
     int texw = 0, texh = 0;
     SDL_BlendMode blendMode = SDL_BLENDMODE_NONE;
     Uint8 r = 0, g = 0, b = 0, a = 0;
 
+    tris = SDL_small_alloc(int, count, &isstack);
+    if (!tris) {
+        return SDL_OutOfMemory();
+    }
+
     /* Save */
     SDL_GetRenderDrawBlendMode(renderer, &blendMode);
     SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
@@ -4007,6 +4040,13 @@ SDL_SW_RenderGeometryRaw(SDL_Renderer *renderer,
             const float *xy0_, *xy1_, *uv0_, *uv1_;
             SDL_Color col0_ = *(const SDL_Color *)((const char*)color + k0 * color_stride);
 
+            /* The triangles before it are drawn first, and with the current state */
+            retval = QueueSWTriangles(renderer, texture, xy, xy_stride, color, color_stride,
+                                      uv, uv_stride, num_vertices, tris, &num_tris);
+            if (retval < 0) {
+                goto end;
+            }
+
             xy0_ = (const float *)((const char*)xy + A * xy_stride);
             xy1_ = (const float *)((const char*)xy + B * xy_stride);
 
@@ -4069,14 +4109,8 @@ SDL_SW_RenderGeometryRaw(SDL_Renderer *renderer,
 #if DEBUG_SW_RENDER_GEOMETRY
                 SDL_Log("Triangle %d %d %d - is_uniform:%d is_rectangle:%d", prev[0], prev[1], prev[2], is_uniform, is_rectangle);
 #endif
-                retval = QueueCmdGeometry(renderer, texture,
-                                          xy, xy_stride, color, color_stride, uv, uv_stride,
-                                          num_vertices, prev, 3, 4, renderer->scale.x, renderer->scale.y);
-                if (retval < 0) {
-                    goto end;
-                } else {
-                    FlushRenderCommandsIfNotBatching(renderer);
-                }
+                SDL_memcpy(&tris[num_tris], prev, sizeof (prev));
+                num_tris += 3;
             }
 
             prev[0] = k0;
@@ -4090,17 +4124,16 @@ SDL_SW_RenderGeometryRaw(SDL_Renderer *renderer,
 #if DEBUG_SW_RENDER_GEOMETRY
         SDL_Log("Last triangle %d %d %d", prev[0], prev[1], prev[2]);
 #endif
-        retval = QueueCmdGeometry(renderer, texture,
-                                  xy, xy_stride, color, color_stride, uv, uv_stride,
-                                  num_vertices, prev, 3, 4, renderer->scale.x, renderer->scale.y);
-        if (retval < 0) {
-            goto end;
-        } else {
-            FlushRenderCommandsIfNotBatching(renderer);
-        }
+        SDL_memcpy(&tris[num_tris], prev, sizeof (prev));
+        num_tris += 3;
     }
 
+    retval = QueueSWTriangles(renderer, texture, xy, xy_stride, color, color_stride,
+                              uv, uv_stride, num_vertices, tris, &num_tris);
+
 end:
+    SDL_small_free(tris, isstack);
+
     /* Restore */
     SDL_SetRenderDrawBlendMode(renderer, blendMode);
     SDL_SetRenderDrawColor(renderer, r, g, b, a);
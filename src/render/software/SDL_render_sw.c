@@ -35,8 +35,22 @@
 #include "SDL_rotate.h"
 #include "SDL_triangle.h"
 
+#include "../../thread/SDL_systhread.h"
+#include "../../video/SDL_blit.h"
+#include "../../video/SDL_pixels_c.h"
+
 /* SDL surface based renderer implementation */
 
+/* Tiled drawing splits the target into squares this many pixels wide. */
+#define SW_TILE_SIZE    128
+#define SW_MAX_THREADS  64
+
+/* How many other copies a copy may be moved ahead of to join a batch of its texture's copies. */
+#define SW_MAX_BATCH_SKIPPED    32
+
+/* How many separate areas of the window a present updates before it merges them. */
+#define SW_MAX_DIRTY_RECTS      16
+
 typedef struct
 {
     const SDL_Rect *viewport;
@@ -44,10 +58,55 @@ typedef struct
     SDL_bool surface_cliprect_dirty;
 } SW_DrawStateCache;
 
+/* A drawing command waiting to be run on every tile it touches. */
+typedef struct
+{
+    const SDL_RenderCommand *cmd;
+    void *verts;
+    SDL_Rect clip;    /* the command's clip rect on the target. */
+    SDL_Rect bounds;  /* the part of clip the command can actually draw to. */
+    Uint32 color;     /* the draw color mapped to the target, for unblended draws. */
+    SDL_BlitInfo blit_info;  /* copies: the texture's blit setup, so tiles don't share src->map. */
+    SDL_BlitFunc blit;
+} SW_TileCommand;
+
+struct SW_TilePool;
+
+typedef struct
+{
+    struct SW_TilePool *pool;
+    SDL_Surface *view;  /* the target's pixels, with a clip rect of this thread's own. */
+    SDL_Thread *thread;
+} SW_TileWorker;
+
+/* Threads that draw the queued commands a tile at a time; see SDL_HINT_RENDER_SOFTWARE_THREADS. */
+typedef struct SW_TilePool
+{
+    int num_threads;  /* counting the thread that flushes the queue, which is workers[0]. */
+    SW_TileWorker *workers;
+    SDL_sem *start;
+    SDL_sem *done;
+    SDL_atomic_t quit;
+    SDL_atomic_t next_tile;
+    int tiles_x;
+    int tiles_y;
+    SW_TileCommand *commands;
+    int num_commands;
+    int max_commands;
+    SDL_SW_TriangleSpanFunc span_func;  /* the renderer's, for geometry. */
+} SW_TilePool;
+
 typedef struct
 {
     SDL_Surface *surface;
     SDL_Surface *window;
+    SW_TilePool *tiles;
+    SDL_SW_TriangleSpanFunc span_func;  /* see SDL_SW_ChooseTriangleSpan(). */
+
+    /* The parts of the window surface drawn since the last present, which is all it updates. */
+    SDL_Rect dirty[SW_MAX_DIRTY_RECTS];
+    int num_dirty;
+    SDL_bool all_dirty;
 } SW_RenderData;
 
 
@@ -63,6 +122,7 @@ SW_ActivateRenderer(SDL_Renderer * renderer)
         SDL_Surface *surface = SDL_GetWindowSurface(renderer->window);
         if (surface) {
             data->surface = data->window = surface;
+            data->all_dirty = SDL_TRUE;
         }
     }
     return data->surface;
@@ -76,6 +136,9 @@ SW_WindowEvent(SDL_Renderer * renderer, const SDL_WindowEvent *event)
     if (event->event == SDL_WINDOWEVENT_SIZE_CHANGED) {
         data->surface = NULL;
         data->window = NULL;
+    } else if (event->event == SDL_WINDOWEVENT_EXPOSED) {
+        /* the system lost what we showed before, so show all of it again. */
+        data->all_dirty = SDL_TRUE;
     }
 }
 
@@ -534,19 +597,6 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * tex
 }
 
 
-typedef struct GeometryFillData
-{
-    SDL_Point dst;
-    SDL_Color color;
-} GeometryFillData;
-
-typedef struct GeometryCopyData
-{
-    SDL_Point src;
-    SDL_Point dst;
-    SDL_Color color;
-} GeometryCopyData;
-
 static int
 SW_QueueGeometry(SDL_Renderer *renderer, SDL_RenderCommand *cmd, SDL_Texture *texture,
         const float *xy, int xy_stride, const SDL_Color *color, int color_stride, const float *uv, int uv_stride,
@@ -655,34 +705,758 @@ PrepTextureForCopy(const SDL_RenderCommand *cmd)
     SDL_SetSurfaceBlendMode(surface, blend);
 }
 
+static void
+GetDrawClipRect(const SW_DrawStateCache *drawstate, SDL_Rect *clip_rect)
+{
+    const SDL_Rect *viewport = drawstate->viewport;
+    const SDL_Rect *cliprect = drawstate->cliprect;
+    SDL_assert(viewport != NULL);  /* the higher level should have forced a SDL_RENDERCMD_SETVIEWPORT */
+
+    if (cliprect != NULL) {
+        clip_rect->x = cliprect->x + viewport->x;
+        clip_rect->y = cliprect->y + viewport->y;
+        clip_rect->w = cliprect->w;
+        clip_rect->h = cliprect->h;
+        SDL_IntersectRect(viewport, clip_rect, clip_rect);
+    } else {
+        *clip_rect = *viewport;
+    }
+}
+
 static void
 SetDrawState(SDL_Surface *surface, SW_DrawStateCache *drawstate)
 {
     if (drawstate->surface_cliprect_dirty) {
-        const SDL_Rect *viewport = drawstate->viewport;
-        const SDL_Rect *cliprect = drawstate->cliprect;
-        SDL_assert(viewport != NULL);  /* the higher level should have forced a SDL_RENDERCMD_SETVIEWPORT */
-
-        if (cliprect != NULL) {
-            SDL_Rect clip_rect;
-            clip_rect.x = cliprect->x + viewport->x;
-            clip_rect.y = cliprect->y + viewport->y;
-            clip_rect.w = cliprect->w;
-            clip_rect.h = cliprect->h;
-            SDL_IntersectRect(viewport, &clip_rect, &clip_rect);
-            SDL_SetClipRect(surface, &clip_rect);
-        } else {
-            SDL_SetClipRect(surface, drawstate->viewport);
-        }
+        SDL_Rect clip_rect;
+        GetDrawClipRect(drawstate, &clip_rect);
+        SDL_SetClipRect(surface, &clip_rect);
         drawstate->surface_cliprect_dirty = SDL_FALSE;
     }
 }
 
+/* Sets up src->map for an unscaled copy to surface, the way SDL_UpperBlit() and
+   SDL_LowerBlit() would. Returns SDL_FALSE if the copy needs SDL_BlitSurface()
+   itself, as RLE and locked surfaces do. */
+static SDL_bool
+PrepBlitForCopy(SDL_Surface *src, SDL_Surface *surface)
+{
+    if (src->map->info.flags & SDL_COPY_NEAREST) {
+        src->map->info.flags &= ~SDL_COPY_NEAREST;
+        SDL_InvalidateMap(src->map);
+    }
+    if ((src->map->dst != surface) ||
+        (surface->format->palette && src->map->dst_palette_version != surface->format->palette->version) ||
+        (src->format->palette && src->map->src_palette_version != src->format->palette->version)) {
+        if (SDL_MapSurface(src, surface) < 0) {
+            return SDL_FALSE;
+        }
+    }
+    if (SDL_MUSTLOCK(src) || SDL_MUSTLOCK(surface) || !src->map->data) {
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
+/* Tiled drawing...
+   Commands that only ever touch pixels inside the surface's clip rect, and
+   come out the same however that clip rect is cut up, are collected until
+   something else has to be drawn. Then every thread takes tiles in turn and
+   runs all collected commands on each, clipped to the tile, so each pixel
+   sees the same commands in the same order as it would on one thread. */
+
+/* Copies srcrect of src to dstrect, clipping the way SDL_UpperBlit() does.
+   setup is the blit info from src->map, with dst pointing at the target's pixels. */
+static void
+SW_BlitClipped(const SDL_BlitInfo *setup, SDL_BlitFunc blit, SDL_Surface *src,
+               const SDL_Rect *srcrect, const SDL_Rect *dstrect, const SDL_Rect *clip)
+{
+    SDL_BlitInfo info;
+    int srcx, srcy, dstx, dsty, w, h, maxw, maxh, dx, dy;
+
+    srcx = srcrect->x;
+    srcy = srcrect->y;
+    dstx = dstrect->x;
+    dsty = dstrect->y;
+    w = srcrect->w;
+    h = srcrect->h;
+
+    /* clip the source rectangle to the source surface */
+    if (srcx < 0) {
+        w += srcx;
+        dstx -= srcx;
+        srcx = 0;
+    }
+    maxw = src->w - srcx;
+    if (maxw < w) {
+        w = maxw;
+    }
+    if (srcy < 0) {
+        h += srcy;
+        dsty -= srcy;
+        srcy = 0;
+    }
+    maxh = src->h - srcy;
+    if (maxh < h) {
+        h = maxh;
+    }
+
+    /* clip the destination rectangle against the clip rectangle */
+    dx = clip->x - dstx;
+    if (dx > 0) {
+        w -= dx;
+        dstx += dx;
+        srcx += dx;
+    }
+    dx = dstx + w - clip->x - clip->w;
+    if (dx > 0) {
+        w -= dx;
+    }
+    dy = clip->y - dsty;
+    if (dy > 0) {
+        h -= dy;
+        dsty += dy;
+        srcy += dy;
+    }
+    dy = dsty + h - clip->y - clip->h;
+    if (dy > 0) {
+        h -= dy;
+    }
+
+    if (w <= 0 || h <= 0) {
+        return;
+    }
+
+    /* what SDL_SoftBlit() does, with our own copy of the blit info */
+    info = *setup;
+    info.src = (Uint8 *) src->pixels + (Uint16) srcy * src->pitch + (Uint16) srcx * info.src_fmt->BytesPerPixel;
+    info.src_w = w;
+    info.src_h = h;
+    info.src_pitch = src->pitch;
+    info.src_skip = info.src_pitch - info.src_w * info.src_fmt->BytesPerPixel;
+    info.dst = (Uint8 *) info.dst + (Uint16) dsty * info.dst_pitch + (Uint16) dstx * info.dst_fmt->BytesPerPixel;
+    info.dst_w = w;
+    info.dst_h = h;
+    info.dst_skip = info.dst_pitch - info.dst_w * info.dst_fmt->BytesPerPixel;
+    blit(&info);
+}
+
+static void
+SW_DrawTile(SW_TilePool *pool, SDL_Surface *view, const SDL_Rect *tile)
+{
+    int i;
+
+    for (i = 0; i < pool->num_commands; i++) {
+        const SW_TileCommand *entry = &pool->commands[i];
+        const SDL_RenderCommand *cmd = entry->cmd;
+        SDL_Rect clip;
+
+        if (!SDL_HasIntersection(&entry->bounds, tile)) {
+            continue;
+        }
+        SDL_IntersectRect(&entry->clip, tile, &clip);
+        SDL_SetClipRect(view, &clip);
+
+        switch (cmd->command) {
+            case SDL_RENDERCMD_CLEAR:
+                SDL_FillRect(view, NULL, entry->color);
+                break;
+
+            case SDL_RENDERCMD_DRAW_POINTS:
+                if (cmd->data.draw.blend == SDL_BLENDMODE_NONE) {
+                    SDL_DrawPoints(view, (const SDL_Point *) entry->verts, (int) cmd->data.draw.count, entry->color);
+                } else {
+                    SDL_BlendPoints(view, (const SDL_Point *) entry->verts, (int) cmd->data.draw.count, cmd->data.draw.blend,
+                                    cmd->data.draw.r, cmd->data.draw.g, cmd->data.draw.b, cmd->data.draw.a);
+                }
+                break;
+
+            case SDL_RENDERCMD_FILL_RECTS:
+                if (cmd->data.draw.blend == SDL_BLENDMODE_NONE) {
+                    SDL_FillRects(view, (const SDL_Rect *) entry->verts, (int) cmd->data.draw.count, entry->color);
+                } else {
+                    SDL_BlendFillRects(view, (const SDL_Rect *) entry->verts, (int) cmd->data.draw.count, cmd->data.draw.blend,
+                                       cmd->data.draw.r, cmd->data.draw.g, cmd->data.draw.b, cmd->data.draw.a);
+                }
+                break;
+
+            case SDL_RENDERCMD_COPY: {
+                const SDL_Rect *rects = (const SDL_Rect *) entry->verts;
+                SW_BlitClipped(&entry->blit_info, entry->blit, (SDL_Surface *) cmd->data.draw.texture->driverdata,
+                               &rects[0], &rects[1], &view->clip_rect);
+                break;
+            }
+
+            case SDL_RENDERCMD_GEOMETRY:
+                if (cmd->data.draw.texture) {
+                    SDL_Surface *src = (SDL_Surface *) cmd->data.draw.texture->driverdata;
+                    SDL_SW_BlitTriangles(src, (const GeometryCopyData *) entry->verts, (int) cmd->data.draw.count, view, pool->span_func);
+                } else {
+                    SDL_SW_FillTriangles(view, (const GeometryFillData *) entry->verts, (int) cmd->data.draw.count, cmd->data.draw.blend, pool->span_func);
+                }
+                break;
+
+            default:
+                SDL_assert(!"Command shouldn't have been drawn in tiles");
+                break;
+        }
+    }
+}
+
+static void
+SW_DrawTiles(SW_TileWorker *worker)
+{
+    SW_TilePool *pool = worker->pool;
+    const int num_tiles = pool->tiles_x * pool->tiles_y;
+    int index;
+
+    while ((index = SDL_AtomicAdd(&pool->next_tile, 1)) < num_tiles) {
+        SDL_Rect tile;
+        tile.x = (index % pool->tiles_x) * SW_TILE_SIZE;
+        tile.y = (index / pool->tiles_x) * SW_TILE_SIZE;
+        tile.w = SW_TILE_SIZE;
+        tile.h = SW_TILE_SIZE;
+        SW_DrawTile(pool, worker->view, &tile);
+    }
+}
+
+static int SDLCALL
+SW_TileThread(void *data)
+{
+    SW_TileWorker *worker = (SW_TileWorker *) data;
+    SW_TilePool *pool = worker->pool;
+
+    for (;;) {
+        SDL_SemWait(pool->start);
+        if (SDL_AtomicGet(&pool->quit)) {
+            break;
+        }
+        SW_DrawTiles(worker);
+        SDL_SemPost(pool->done);
+    }
+    return 0;
+}
+
+/* Draws everything collected so far, on all threads, and waits for it. */
+static void
+SW_FlushTiles(SW_TilePool *pool)
+{
+    int i;
+
+    if (pool->num_commands == 0) {
+        return;
+    }
+
+    SDL_AtomicSet(&pool->next_tile, 0);
+    for (i = 1; i < pool->num_threads; i++) {
+        SDL_SemPost(pool->start);
+    }
+    SW_DrawTiles(&pool->workers[0]);
+    for (i = 1; i < pool->num_threads; i++) {
+        SDL_SemWait(pool->done);
+    }
+
+    pool->num_commands = 0;
+}
+
+static void
+SW_DestroyTilePool(SW_TilePool *pool)
+{
+    int i;
+
+    if (!pool) {
+        return;
+    }
+
+    SDL_AtomicSet(&pool->quit, 1);
+    for (i = 1; i < pool->num_threads; i++) {
+        if (pool->workers[i].thread) {
+            SDL_SemPost(pool->start);
+        }
+    }
+    for (i = 0; i < pool->num_threads; i++) {
+        if (pool->workers[i].thread) {
+            SDL_WaitThread(pool->workers[i].thread, NULL);
+        }
+        SDL_FreeSurface(pool->workers[i].view);
+    }
+    if (pool->start) {
+        SDL_DestroySemaphore(pool->start);
+    }
+    if (pool->done) {
+        SDL_DestroySemaphore(pool->done);
+    }
+    SDL_free(pool->workers);
+    SDL_free(pool->commands);
+    SDL_free(pool);
+}
+
+static SW_TilePool *
+SW_CreateTilePool(int num_threads)
+{
+    SW_TilePool *pool = (SW_TilePool *) SDL_calloc(1, sizeof (*pool));
+    int i;
+
+    if (!pool) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    pool->num_threads = num_threads;
+    pool->workers = (SW_TileWorker *) SDL_calloc(num_threads, sizeof (*pool->workers));
+    pool->start = SDL_CreateSemaphore(0);
+    pool->done = SDL_CreateSemaphore(0);
+    if (!pool->workers || !pool->start || !pool->done) {
+        pool->num_threads = 0;
+        SW_DestroyTilePool(pool);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    for (i = 0; i < num_threads; i++) {
+        pool->workers[i].pool = pool;
+    }
+    for (i = 1; i < num_threads; i++) {
+        pool->workers[i].thread = SDL_CreateThreadInternal(SW_TileThread, "SDLRenderTiles", 0, &pool->workers[i]);
+        if (!pool->workers[i].thread) {
+            SW_DestroyTilePool(pool);
+            return NULL;
+        }
+    }
+    return pool;
+}
+
+/* Points every thread's view at the current target. */
+static int
+SW_SetTileTarget(SW_TilePool *pool, SDL_Surface *surface)
+{
+    int i;
+
+    for (i = 0; i < pool->num_threads; i++) {
+        SDL_Surface *view = pool->workers[i].view;
+        if (view && view->pixels == surface->pixels && view->w == surface->w && view->h == surface->h &&
+            view->pitch == surface->pitch && view->format->format == surface->format->format) {
+            continue;
+        }
+        SDL_FreeSurface(view);
+        pool->workers[i].view = SDL_CreateRGBSurfaceWithFormatFrom(surface->pixels, surface->w, surface->h,
+                                                                   surface->format->BitsPerPixel, surface->pitch,
+                                                                   surface->format->format);
+        if (!pool->workers[i].view) {
+            return -1;
+        }
+    }
+
+    pool->tiles_x = (surface->w + SW_TILE_SIZE - 1) / SW_TILE_SIZE;
+    pool->tiles_y = (surface->h + SW_TILE_SIZE - 1) / SW_TILE_SIZE;
+    return 0;
+}
+
+/* Returns the thread pool to draw this flush with, or NULL to draw on this thread. */
+static SW_TilePool *
+SW_GetTilePool(SW_RenderData *data, SDL_Surface *surface)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SOFTWARE_THREADS);
+    int num_threads = hint ? SDL_atoi(hint) : 0;
+
+    num_threads = SDL_min(num_threads, SW_MAX_THREADS);
+    if (data->tiles && data->tiles->num_threads != num_threads) {
+        SW_DestroyTilePool(data->tiles);
+        data->tiles = NULL;
+    }
+
+    /* locked surfaces (RLE) and palettes need the blitter's own bookkeeping. */
+    if (num_threads <= 1 || SDL_MUSTLOCK(surface) || surface->format->palette) {
+        return NULL;
+    }
+
+    if (!data->tiles) {
+        data->tiles = SW_CreateTilePool(num_threads);
+        if (!data->tiles) {
+            return NULL;
+        }
+        data->tiles->span_func = data->span_func;
+    }
+    if (SW_SetTileTarget(data->tiles, surface) < 0) {
+        return NULL;
+    }
+    return data->tiles;
+}
+
+/* Whether PrepTextureForCopy() would change the texture's color mod, alpha mod or blend mode. */
+static SDL_bool
+TextureStateChanges(const SDL_RenderCommand *cmd)
+{
+    SDL_Surface *surface = (SDL_Surface *) cmd->data.draw.texture->driverdata;
+    SDL_BlendMode blend;
+    Uint8 r, g, b, a;
+
+    SDL_GetSurfaceColorMod(surface, &r, &g, &b);
+    SDL_GetSurfaceAlphaMod(surface, &a);
+    SDL_GetSurfaceBlendMode(surface, &blend);
+    return (r != cmd->data.draw.r || g != cmd->data.draw.g || b != cmd->data.draw.b ||
+            a != cmd->data.draw.a || blend != cmd->data.draw.blend) ? SDL_TRUE : SDL_FALSE;
+}
+
+/* Collects a drawing command to run in tiles. Returns SDL_FALSE if the caller
+   should run it itself; anything collected before it is drawn first. */
+static SDL_bool
+SW_AddTileCommand(SW_TilePool *pool, SDL_Surface *surface, const SDL_RenderCommand *cmd, void *vertices, const SW_DrawStateCache *drawstate)
+{
+    SDL_Texture *texture = NULL;
+    SW_TileCommand *entry;
+    SDL_Rect clip, bounds;
+    void *verts = ((Uint8 *) vertices) + cmd->data.draw.first;
+    int i;
+
+    switch (cmd->command) {
+        case SDL_RENDERCMD_SETDRAWCOLOR:
+        case SDL_RENDERCMD_SETVIEWPORT:
+        case SDL_RENDERCMD_SETCLIPRECT:
+        case SDL_RENDERCMD_NO_OP:
+            return SDL_FALSE;  /* these only change the draw state; keep collecting. */
+
+        case SDL_RENDERCMD_CLEAR:
+            verts = NULL;
+            break;
+
+        case SDL_RENDERCMD_DRAW_POINTS:
+        case SDL_RENDERCMD_FILL_RECTS:
+            break;
+
+        case SDL_RENDERCMD_COPY: {
+            const SDL_Rect *rects = (const SDL_Rect *) verts;
+            if (rects[0].w != rects[1].w || rects[0].h != rects[1].h) {
+                SW_FlushTiles(pool);
+                return SDL_FALSE;  /* scaling clips in floating point, so it has to see the whole rect. */
+            }
+            texture = cmd->data.draw.texture;
+            break;
+        }
+
+        case SDL_RENDERCMD_GEOMETRY:
+            texture = cmd->data.draw.texture;
+            break;
+
+        case SDL_RENDERCMD_DRAW_LINES:  /* clipping moves the line's endpoints, which changes its pixels. */
+        case SDL_RENDERCMD_COPY_EX:
+        default:
+            SW_FlushTiles(pool);
+            return SDL_FALSE;
+    }
+
+    if (texture) {
+        SDL_Surface *src = (SDL_Surface *) texture->driverdata;
+
+        /* Tiles read the texture's state as they draw, so it can't change while a collected command uses it. */
+        if (TextureStateChanges(cmd)) {
+            for (i = 0; i < pool->num_commands; i++) {
+                if (pool->commands[i].cmd->command != SDL_RENDERCMD_CLEAR && pool->commands[i].cmd->data.draw.texture == texture) {
+                    SW_FlushTiles(pool);
+                    break;
+                }
+            }
+        }
+        PrepTextureForCopy(cmd);
+
+        if (cmd->command == SDL_RENDERCMD_COPY ? !PrepBlitForCopy(src, surface) : SDL_MUSTLOCK(src)) {
+            SW_FlushTiles(pool);
+            return SDL_FALSE;  /* RLE blits decode the texture as they go. */
+        }
+    }
+
+    if (pool->num_commands == pool->max_commands) {
+        const int max_commands = pool->max_commands ? pool->max_commands * 2 : 64;
+        SW_TileCommand *commands = (SW_TileCommand *) SDL_realloc(pool->commands, max_commands * sizeof (*commands));
+        if (!commands) {
+            SW_FlushTiles(pool);
+            return SDL_FALSE;
+        }
+        pool->commands = commands;
+        pool->max_commands = max_commands;
+    }
+
+    if (cmd->command == SDL_RENDERCMD_CLEAR) {
+        /* By definition the clear ignores the clip rect */
+        clip.x = clip.y = 0;
+        clip.w = surface->w;
+        clip.h = surface->h;
+    } else {
+        GetDrawClipRect(drawstate, &clip);
+        bounds.x = bounds.y = 0;
+        bounds.w = surface->w;
+        bounds.h = surface->h;
+        SDL_IntersectRect(&clip, &bounds, &clip);
+    }
+    bounds = clip;
+
+    /* Apply viewport, as the serial path does */
+    if (cmd->command == SDL_RENDERCMD_DRAW_POINTS) {
+        SDL_Point *points = (SDL_Point *) verts;
+        for (i = 0; i < (int) cmd->data.draw.count; i++) {
+            points[i].x += drawstate->viewport->x;
+            points[i].y += drawstate->viewport->y;
+        }
+    } else if (cmd->command == SDL_RENDERCMD_FILL_RECTS) {
+        SDL_Rect *rects = (SDL_Rect *) verts;
+        SDL_Rect area;
+        SDL_zero(area);
+        for (i = 0; i < (int) cmd->data.draw.count; i++) {
+            rects[i].x += drawstate->viewport->x;
+            rects[i].y += drawstate->viewport->y;
+            SDL_UnionRect(&area, &rects[i], &area);
+        }
+        SDL_IntersectRect(&bounds, &area, &bounds);
+    } else if (cmd->command == SDL_RENDERCMD_COPY) {
+        SDL_Rect *dstrect = ((SDL_Rect *) verts) + 1;
+        dstrect->x += drawstate->viewport->x;
+        dstrect->y += drawstate->viewport->y;
+        SDL_IntersectRect(&bounds, dstrect, &bounds);
+    } else if (cmd->command == SDL_RENDERCMD_GEOMETRY) {
+        SDL_Point vp;
+        vp.x = drawstate->viewport->x;
+        vp.y = drawstate->viewport->y;
+        trianglepoint_2_fixedpoint(&vp);
+        for (i = 0; i < (int) cmd->data.draw.count; i++) {
+            SDL_Point *dst = texture ? &((GeometryCopyData *) verts)[i].dst : &((GeometryFillData *) verts)[i].dst;
+            dst->x += vp.x;
+            dst->y += vp.y;
+        }
+    }
+
+    if (SDL_RectEmpty(&bounds)) {
+        return SDL_TRUE;  /* nothing to draw. */
+    }
+
+    entry = &pool->commands[pool->num_commands++];
+    entry->cmd = cmd;
+    entry->verts = verts;
+    entry->clip = clip;
+    entry->bounds = bounds;
+    if (cmd->command == SDL_RENDERCMD_CLEAR) {
+        entry->color = SDL_MapRGBA(surface->format, cmd->data.color.r, cmd->data.color.g, cmd->data.color.b, cmd->data.color.a);
+    } else {
+        entry->color = SDL_MapRGBA(surface->format, cmd->data.draw.r, cmd->data.draw.g, cmd->data.draw.b, cmd->data.draw.a);
+    }
+    if (cmd->command == SDL_RENDERCMD_COPY) {
+        SDL_Surface *src = (SDL_Surface *) texture->driverdata;
+        entry->blit_info = src->map->info;
+        entry->blit_info.dst = (Uint8 *) surface->pixels;
+        entry->blit_info.dst_pitch = surface->pitch;
+        entry->blit = (SDL_BlitFunc) src->map->data;
+    }
+    return SDL_TRUE;
+}
+
+/* Whether a copy draws its source at its own size. */
+static SDL_bool
+IsUnscaledCopy(const SDL_RenderCommand *cmd, void *vertices)
+{
+    const SDL_Rect *rects = (const SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+    return (rects[0].w == rects[1].w && rects[0].h == rects[1].h) ? SDL_TRUE : SDL_FALSE;
+}
+
+/* Draws an unscaled copy, along with every later copy of the same texture, in
+   the same state, that can be pulled forward to join it: the copies it moves
+   ahead of must not overlap it, so every pixel still sees its draws in order.
+   The blit map, clip and blitter are set up once for the whole run, and the
+   copies that were drawn are turned into no-ops. Returns SDL_FALSE if the
+   copy has to go through SDL_BlitSurface() instead. */
+static SDL_bool
+SW_RunCopyBatch(SDL_Surface *surface, SDL_RenderCommand *cmd, void *vertices, const SW_DrawStateCache *drawstate)
+{
+    SDL_Texture *texture = cmd->data.draw.texture;
+    SDL_Surface *src = (SDL_Surface *) texture->driverdata;
+    const SDL_Rect *rects = (const SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+    SDL_Rect skipped[SW_MAX_BATCH_SKIPPED];  /* where the copies we've jumped over draw. */
+    int num_skipped = 0;
+    SDL_RenderCommand *next;
+    SDL_BlitInfo setup;
+    SDL_BlitFunc blit;
+
+    if (!PrepBlitForCopy(src, surface)) {
+        return SDL_FALSE;
+    }
+    setup = src->map->info;
+    setup.dst = (Uint8 *) surface->pixels;
+    setup.dst_pitch = surface->pitch;
+    blit = (SDL_BlitFunc) src->map->data;
+
+    SW_BlitClipped(&setup, blit, src, &rects[0], &rects[1], &surface->clip_rect);
+
+    for (next = cmd->next; next; next = next->next) {
+        SDL_Rect dstrect;
+        int i;
+
+        if (next->command == SDL_RENDERCMD_SETDRAWCOLOR || next->command == SDL_RENDERCMD_NO_OP) {
+            continue;  /* copies don't use the draw color. */
+        } else if (next->command != SDL_RENDERCMD_COPY) {
+            break;  /* anything else might change the clip rect or draw anywhere. */
+        }
+
+        rects = (const SDL_Rect *) (((Uint8 *) vertices) + next->data.draw.first);
+        dstrect = rects[1];
+        dstrect.x += drawstate->viewport->x;
+        dstrect.y += drawstate->viewport->y;
+
+        if (next->data.draw.texture == texture && IsUnscaledCopy(next, vertices) &&
+            next->data.draw.r == cmd->data.draw.r && next->data.draw.g == cmd->data.draw.g &&
+            next->data.draw.b == cmd->data.draw.b && next->data.draw.a == cmd->data.draw.a &&
+            next->data.draw.blend == cmd->data.draw.blend) {
+            for (i = 0; i < num_skipped; i++) {
+                if (SDL_HasIntersection(&dstrect, &skipped[i])) {
+                    break;
+                }
+            }
+            if (i == num_skipped) {
+                SW_BlitClipped(&setup, blit, src, &rects[0], &dstrect, &surface->clip_rect);
+                next->command = SDL_RENDERCMD_NO_OP;
+                continue;
+            }
+        }
+
+        /* this copy stays where it is; later ones can only pass it if they don't overlap it. */
+        if (num_skipped == SDL_arraysize(skipped)) {
+            break;
+        }
+        skipped[num_skipped++] = dstrect;
+    }
+    return SDL_TRUE;
+}
+
+/* Adds an area the next present has to update, merging it into one that touches it. */
+static void
+SW_AddDirtyRect(SW_RenderData *data, const SDL_Rect *rect)
+{
+    SDL_Rect merged;
+    int i, best = 0, best_area = 0;
+
+    for (i = 0; i < data->num_dirty; i++) {
+        if (SDL_HasIntersection(rect, &data->dirty[i])) {
+            SDL_UnionRect(rect, &data->dirty[i], &data->dirty[i]);
+            return;
+        }
+    }
+
+    if (data->num_dirty < SW_MAX_DIRTY_RECTS) {
+        data->dirty[data->num_dirty++] = *rect;
+        return;
+    }
+
+    /* Out of room; grow whichever area gains the least from taking this one in. */
+    for (i = 0; i < data->num_dirty; i++) {
+        int area;
+        SDL_UnionRect(rect, &data->dirty[i], &merged);
+        area = merged.w * merged.h - data->dirty[i].w * data->dirty[i].h;
+        if (i == 0 || area < best_area) {
+            best = i;
+            best_area = area;
+        }
+    }
+    SDL_UnionRect(rect, &data->dirty[best], &data->dirty[best]);
+}
+
+/* Works out which parts of the window surface a command queue draws to. */
+static void
+SW_TrackDirtyRects(SW_RenderData *data, SDL_Surface *surface, const SDL_RenderCommand *cmd, void *vertices)
+{
+    SW_DrawStateCache drawstate;
+
+    drawstate.viewport = NULL;
+    drawstate.cliprect = NULL;
+
+    for (; cmd && !data->all_dirty; cmd = cmd->next) {
+        void *verts = ((Uint8 *) vertices) + cmd->data.draw.first;
+        const int count = (int) cmd->data.draw.count;
+        SDL_Rect clip, bounds;
+        int i;
+
+        switch (cmd->command) {
+            case SDL_RENDERCMD_SETVIEWPORT:
+                drawstate.viewport = &cmd->data.viewport.rect;
+                continue;
+
+            case SDL_RENDERCMD_SETCLIPRECT:
+                drawstate.cliprect = cmd->data.cliprect.enabled ? &cmd->data.cliprect.rect : NULL;
+                continue;
+
+            case SDL_RENDERCMD_CLEAR:
+                data->all_dirty = SDL_TRUE;
+                continue;
+
+            case SDL_RENDERCMD_DRAW_POINTS:
+            case SDL_RENDERCMD_DRAW_LINES:
+                if (!SDL_EnclosePoints((const SDL_Point *) verts, count, NULL, &bounds)) {
+                    continue;
+                }
+                break;
+
+            case SDL_RENDERCMD_FILL_RECTS:
+                SDL_zero(bounds);
+                for (i = 0; i < count; i++) {
+                    SDL_UnionRect(&bounds, &((const SDL_Rect *) verts)[i], &bounds);
+                }
+                break;
+
+            case SDL_RENDERCMD_COPY:
+                bounds = ((const SDL_Rect *) verts)[1];
+                break;
+
+            case SDL_RENDERCMD_GEOMETRY: {
+                /* the points are in the triangle code's fixed point; pad for its rounding. */
+                SDL_Point one, minp, maxp;
+                one.x = one.y = 1;
+                trianglepoint_2_fixedpoint(&one);
+                minp.x = minp.y = SDL_MAX_SINT32;
+                maxp.x = maxp.y = SDL_MIN_SINT32;
+                for (i = 0; i < count; i++) {
+                    const SDL_Point *dst = cmd->data.draw.texture ? &((const GeometryCopyData *) verts)[i].dst
+                                                                  : &((const GeometryFillData *) verts)[i].dst;
+                    minp.x = SDL_min(minp.x, dst->x);
+                    minp.y = SDL_min(minp.y, dst->y);
+                    maxp.x = SDL_max(maxp.x, dst->x);
+                    maxp.y = SDL_max(maxp.y, dst->y);
+                }
+                if (count == 0) {
+                    continue;
+                }
+                bounds.x = minp.x / one.x - 1;
+                bounds.y = minp.y / one.y - 1;
+                bounds.w = maxp.x / one.x + 2 - bounds.x;
+                bounds.h = maxp.y / one.y + 2 - bounds.y;
+                break;
+            }
+
+            case SDL_RENDERCMD_COPY_EX:  /* rotated and scaled on the way; count all it could touch. */
+                bounds.x = bounds.y = 0;
+                bounds.w = drawstate.viewport->w;
+                bounds.h = drawstate.viewport->h;
+                break;
+
+            default:
+                continue;
+        }
+
+        bounds.x += drawstate.viewport->x;
+        bounds.y += drawstate.viewport->y;
+        GetDrawClipRect(&drawstate, &clip);
+        if (SDL_IntersectRect(&bounds, &clip, &bounds)) {
+            clip.x = clip.y = 0;
+            clip.w = surface->w;
+            clip.h = surface->h;
+            if (SDL_IntersectRect(&bounds, &clip, &bounds)) {
+                SW_AddDirtyRect(data, &bounds);
+            }
+        }
+    }
+}
+
 static int
 SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
 {
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
     SW_DrawStateCache drawstate;
+    SW_TilePool *tiles;
 
     if (!surface) {
         return -1;
@@ -692,7 +1466,18 @@ SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
     drawstate.cliprect = NULL;
     drawstate.surface_cliprect_dirty = SDL_TRUE;
 
+    if (renderer->window && surface == data->window) {
+        SW_TrackDirtyRects(data, surface, cmd, vertices);
+    }
+
+    tiles = SW_GetTilePool(data, surface);
+
     while (cmd) {
+        if (tiles && SW_AddTileCommand(tiles, surface, cmd, vertices, &drawstate)) {
+            cmd = cmd->next;
+            continue;  /* drawn in tiles later. */
+        }
+
         switch (cmd->command) {
             case SDL_RENDERCMD_SETDRAWCOLOR: {
                 break;  /* Not used in this backend. */
@@ -821,7 +1606,9 @@ SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
                 }
 
                 if ( srcrect->w == dstrect->w && srcrect->h == dstrect->h ) {
-                    SDL_BlitSurface(src, srcrect, surface, dstrect);
+                    if (!SW_RunCopyBatch(surface, cmd, vertices, &drawstate)) {
+                        SDL_BlitSurface(src, srcrect, surface, dstrect);
+                    }
                 } else {
                     /* If scaling is ever done, permanently disable RLE (which doesn't support scaling)
                      * to avoid potentially frequent RLE encoding/decoding.
@@ -912,14 +1699,7 @@ SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
                         }
                     }
 
-                    for (i = 0; i < count; i += 3, ptr += 3) {
-                        SDL_SW_BlitTriangle(
-                                src,
-                                &(ptr[0].src), &(ptr[1].src), &(ptr[2].src),
-                                surface,
-                                &(ptr[0].dst), &(ptr[1].dst), &(ptr[2].dst),
-                                ptr[0].color, ptr[1].color, ptr[2].color);
-                    }
+                    SDL_SW_BlitTriangles(src, ptr, count, surface, data->span_func);
                 } else {
                     GeometryFillData *ptr = (GeometryFillData *) verts;
 
@@ -935,9 +1715,7 @@ SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
                         }
                     }
 
-                    for (i = 0; i < count; i += 3, ptr += 3) {
-                        SDL_SW_FillTriangle(surface, &(ptr[0].dst), &(ptr[1].dst), &(ptr[2].dst), blend, ptr[0].color, ptr[1].color, ptr[2].color);
-                    }
+                    SDL_SW_FillTriangles(surface, ptr, count, blend, data->span_func);
                 }
                 break;
             }
@@ -949,6 +1727,10 @@ SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
         cmd = cmd->next;
     }
 
+    if (tiles) {
+        SW_FlushTiles(tiles);
+    }
+
     return 0;
 }
 
@@ -986,11 +1768,20 @@ SW_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
 static void
 SW_RenderPresent(SDL_Renderer * renderer)
 {
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
     SDL_Window *window = renderer->window;
 
     if (window) {
-        SDL_UpdateWindowSurface(window);
+        /* Only update what was drawn; with nothing drawn this still gives
+           the system a chance to pace frames, as a full update would. */
+        if (data->all_dirty) {
+            SDL_UpdateWindowSurface(window);
+        } else {
+            SDL_UpdateWindowSurfaceRects(window, data->dirty, data->num_dirty);
+        }
     }
+    data->num_dirty = 0;
+    data->all_dirty = SDL_FALSE;
 }
 
 static void
@@ -1006,6 +1797,9 @@ SW_DestroyRenderer(SDL_Renderer * renderer)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
 
+    if (data) {
+        SW_DestroyTilePool(data->tiles);
+    }
     SDL_free(data);
     SDL_free(renderer);
 }
@@ -1035,6 +1829,8 @@ SW_CreateRendererForSurface(SDL_Surface * surface)
     }
     data->surface = surface;
     data->window = surface;
+    data->all_dirty = SDL_TRUE;
+    data->span_func = SDL_SW_ChooseTriangleSpan();
 
     renderer->WindowEvent = SW_WindowEvent;
     renderer->GetOutputSize = SW_GetOutputSize;
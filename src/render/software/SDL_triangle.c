@@ -22,11 +22,17 @@
 
 #if SDL_VIDEO_RENDER_SW && !SDL_RENDER_DISABLED
 
+#include "SDL_cpuinfo.h"
+#include "SDL_hints.h"
 #include "SDL_surface.h"
 #include "SDL_triangle.h"
 
 #include "../../video/SDL_blit.h"
 
+#ifdef __ARM_NEON
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
 /* fixed points bits precision
  * Set to 1, so that it can start rendering wth middle of a pixel precision.
  * It doesn't need to be increased.
@@ -883,6 +889,1193 @@ SDL_BlitTriangle_Slow(SDL_BlitInfo *info,
     TRIANGLE_END_LOOP
 }
 
+/* Batched triangles
+ *
+ * SDL_SW_FillTriangles() and SDL_SW_BlitTriangles() draw a whole vertex buffer
+ * with the same edge functions, top-left rule and interpolation as the
+ * functions above, but set the target up once for the batch. Triangles are
+ * set up a chunk at a time, then walked in 8x8 blocks: blocks outside an
+ * edge are skipped, and blocks inside all three edges are drawn without
+ * testing each pixel.
+ *
+ * Targets and textures with 8 bits per channel in 32 bit pixels get inner
+ * loops specialized for the blend mode and for flat or interpolated vertex
+ * colors. Blended fills are blended in place, with the arithmetic of
+ * SDL_BlitTriangle_Slow(). Anything else, and triangles too big to
+ * interpolate in 32 bits, goes through the functions above.
+ */
+
+#define TRIANGLE_BLOCK  8
+#define TRIANGLE_CHUNK  64
+
+typedef struct
+{
+    SDL_Rect dstrect;
+    int area;
+    int bias_w0, bias_w1, bias_w2;
+    int d2d1_y, d1d2_x, d0d2_y, d2d0_x, d1d0_y, d0d1_x;
+    int w0_row, w1_row, w2_row;
+    int first;  /* index of the triangle's first vertex in the batch */
+} TriangleSetup;
+
+/* The per-triangle setup of SDL_SW_FillTriangle() and SDL_SW_BlitTriangle(). Returns SDL_FALSE if nothing gets drawn. */
+static SDL_bool
+SetupTriangle(const SDL_Point *d0, const SDL_Point *d1, const SDL_Point *d2, const SDL_Rect *clip, TriangleSetup *t)
+{
+    SDL_Point p;
+    int is_clockwise;
+
+    t->area = cross_product(d0, d1, d2->x, d2->y);
+
+    /* Flat triangle */
+    if (t->area == 0) {
+        return SDL_FALSE;
+    }
+
+    bounding_rect_fixedpoint(d0, d1, d2, &t->dstrect);
+    if (!SDL_IntersectRect(&t->dstrect, clip, &t->dstrect)) {
+        return SDL_FALSE;
+    }
+
+    is_clockwise = t->area > 0;
+    t->area = SDL_abs(t->area);
+
+    t->d2d1_y = (d1->y - d2->y) << FP_BITS;
+    t->d0d2_y = (d2->y - d0->y) << FP_BITS;
+    t->d1d0_y = (d0->y - d1->y) << FP_BITS;
+    t->d1d2_x = (d2->x - d1->x) << FP_BITS;
+    t->d2d0_x = (d0->x - d2->x) << FP_BITS;
+    t->d0d1_x = (d1->x - d0->x) << FP_BITS;
+
+    /* Starting point for rendering, at the middle of a pixel */
+    p.x = t->dstrect.x;
+    p.y = t->dstrect.y;
+    trianglepoint_2_fixedpoint(&p);
+    p.x += (1 << FP_BITS) / 2;
+    p.y += (1 << FP_BITS) / 2;
+    t->w0_row = cross_product(d1, d2, p.x, p.y);
+    t->w1_row = cross_product(d2, d0, p.x, p.y);
+    t->w2_row = cross_product(d0, d1, p.x, p.y);
+
+    /* Handle anti-clockwise triangles */
+    if (!is_clockwise) {
+        t->d2d1_y *= -1;
+        t->d0d2_y *= -1;
+        t->d1d0_y *= -1;
+        t->d1d2_x *= -1;
+        t->d2d0_x *= -1;
+        t->d0d1_x *= -1;
+        t->w0_row *= -1;
+        t->w1_row *= -1;
+        t->w2_row *= -1;
+    }
+
+    /* Add a bias to respect top-left rasterization rule */
+    t->bias_w0 = (is_top_left(d1, d2, is_clockwise) ? 0 : -1);
+    t->bias_w1 = (is_top_left(d2, d0, is_clockwise) ? 0 : -1);
+    t->bias_w2 = (is_top_left(d0, d1, is_clockwise) ? 0 : -1);
+    return SDL_TRUE;
+}
+
+/* Largest and smallest value of an edge function over a bw x bh block, from its value at the top-left pixel. */
+#define EDGE_MAX(e, step_x, step_y)     ((e) + SDL_max(step_x, 0) * (bw - 1) + SDL_max(step_y, 0) * (bh - 1))
+#define EDGE_MIN(e, step_x, step_y)     ((e) + SDL_min(step_x, 0) * (bw - 1) + SDL_min(step_y, 0) * (bh - 1))
+
+/* Walks triangle 't' in blocks, with 'dptr' at each covered pixel of 'dst_base' and
+ * (w0, w1, w2) its barycentric coordinates; like TRIANGLE_BEGIN_LOOP, for 32 bit pixels.
+ * If 'span_func' isn't NULL, it draws the start of each block row from 'span'. */
+#define TRIANGLE_BLOCKS_BEGIN                                                                           \
+    {                                                                                                   \
+        int bx, by, x, y;                                                                               \
+        for (by = 0; by < t->dstrect.h; by += TRIANGLE_BLOCK) {                                         \
+            const int bh = SDL_min(TRIANGLE_BLOCK, t->dstrect.h - by);                                  \
+            for (bx = 0; bx < t->dstrect.w; bx += TRIANGLE_BLOCK) {                                     \
+                const int bw = SDL_min(TRIANGLE_BLOCK, t->dstrect.w - bx);                              \
+                const int b0 = t->w0_row + bx * t->d2d1_y + by * t->d1d2_x;                             \
+                const int b1 = t->w1_row + bx * t->d0d2_y + by * t->d2d0_x;                             \
+                const int b2 = t->w2_row + bx * t->d1d0_y + by * t->d0d1_x;                             \
+                int partial;                                                                            \
+                if (EDGE_MAX(b0 + t->bias_w0, t->d2d1_y, t->d1d2_x) < 0 ||                              \
+                    EDGE_MAX(b1 + t->bias_w1, t->d0d2_y, t->d2d0_x) < 0 ||                              \
+                    EDGE_MAX(b2 + t->bias_w2, t->d1d0_y, t->d0d1_x) < 0) {                              \
+                    continue; /* block is outside an edge */                                            \
+                }                                                                                       \
+                partial = (EDGE_MIN(b0 + t->bias_w0, t->d2d1_y, t->d1d2_x) < 0 ||                       \
+                           EDGE_MIN(b1 + t->bias_w1, t->d0d2_y, t->d2d0_x) < 0 ||                       \
+                           EDGE_MIN(b2 + t->bias_w2, t->d1d0_y, t->d0d1_x) < 0);                        \
+                for (y = 0; y < bh; y++) {                                                              \
+                    int w0 = b0 + y * t->d1d2_x;                                                        \
+                    int w1 = b1 + y * t->d2d0_x;                                                        \
+                    int w2 = b2 + y * t->d0d1_x;                                                        \
+                    Uint32 *dptr = (Uint32 *) (dst_base + (t->dstrect.y + by + y) * dst_pitch) +        \
+                                   t->dstrect.x + bx;                                                   \
+                    x = 0;                                                                              \
+                    if (span_func) {                                                                    \
+                        x = span_func(&span, dptr, w0, w1, w2, bw, partial);                            \
+                        dptr += x;                                                                      \
+                        w0 += x * t->d2d1_y;                                                            \
+                        w1 += x * t->d0d2_y;                                                            \
+                        w2 += x * t->d1d0_y;                                                            \
+                    }                                                                                   \
+                    for (; x < bw; x++, dptr++, w0 += t->d2d1_y, w1 += t->d0d2_y, w2 += t->d1d0_y) {    \
+                        if (partial &&                                                                  \
+                            (w0 + t->bias_w0 < 0 || w1 + t->bias_w1 < 0 || w2 + t->bias_w2 < 0)) {      \
+                            continue;                                                                   \
+                        }                                                                               \
+
+#define TRIANGLE_BLOCKS_END                                                                             \
+                    }                                                                                   \
+                }                                                                                       \
+            }                                                                                           \
+        }                                                                                               \
+    }                                                                                                   \
+
+/* Whether a format has 8 bits per channel in 32 bit pixels, so channels can be read and written with shifts. */
+static SDL_bool
+is_8888(const SDL_PixelFormat *fmt)
+{
+    return (fmt->BytesPerPixel == 4 && fmt->Rloss == 0 && fmt->Gloss == 0 && fmt->Bloss == 0 &&
+            (fmt->Amask == 0 || fmt->Aloss == 0)) ? SDL_TRUE : SDL_FALSE;
+}
+
+/* The blending of SDL_BlitTriangle_Slow(), for an 8888 target */
+SDL_FORCE_INLINE void
+blend_8888(Uint32 *dptr, const SDL_PixelFormat *fmt, Uint32 srcR, Uint32 srcG, Uint32 srcB, Uint32 srcA, const int blendflags)
+{
+    const Uint32 dstpixel = *dptr;
+    Uint32 dstR = (dstpixel >> fmt->Rshift) & 0xFF;
+    Uint32 dstG = (dstpixel >> fmt->Gshift) & 0xFF;
+    Uint32 dstB = (dstpixel >> fmt->Bshift) & 0xFF;
+    Uint32 dstA = fmt->Amask ? ((dstpixel >> fmt->Ashift) & 0xFF) : 0xFF;
+
+    if (blendflags & (SDL_COPY_BLEND | SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        if (srcA < 255) {
+            srcR = (srcR * srcA) / 255;
+            srcG = (srcG * srcA) / 255;
+            srcB = (srcB * srcA) / 255;
+        }
+    }
+    switch (blendflags) {
+    case 0:
+        dstR = srcR;
+        dstG = srcG;
+        dstB = srcB;
+        dstA = srcA;
+        break;
+    case SDL_COPY_BLEND:
+        dstR = srcR + ((255 - srcA) * dstR) / 255;
+        dstG = srcG + ((255 - srcA) * dstG) / 255;
+        dstB = srcB + ((255 - srcA) * dstB) / 255;
+        dstA = srcA + ((255 - srcA) * dstA) / 255;
+        break;
+    case SDL_COPY_ADD:
+        dstR = SDL_min(srcR + dstR, 255);
+        dstG = SDL_min(srcG + dstG, 255);
+        dstB = SDL_min(srcB + dstB, 255);
+        break;
+    case SDL_COPY_MOD:
+        dstR = (srcR * dstR) / 255;
+        dstG = (srcG * dstG) / 255;
+        dstB = (srcB * dstB) / 255;
+        break;
+    case SDL_COPY_MUL:
+        dstR = SDL_min(((srcR * dstR) + (dstR * (255 - srcA))) / 255, 255);
+        dstG = SDL_min(((srcG * dstG) + (dstG * (255 - srcA))) / 255, 255);
+        dstB = SDL_min(((srcB * dstB) + (dstB * (255 - srcA))) / 255, 255);
+        dstA = SDL_min(((srcA * dstA) + (dstA * (255 - srcA))) / 255, 255);
+        break;
+    }
+    *dptr = (dstR << fmt->Rshift) | (dstG << fmt->Gshift) | (dstB << fmt->Bshift) |
+            (fmt->Amask ? (dstA << fmt->Ashift) : 0);
+}
+
+/* The copy flags SDL_BlitTriangle_Slow() would blend with, or -1 for blend modes it doesn't know. */
+static int
+blend_mode_to_copy_flags(SDL_BlendMode blend)
+{
+    switch (blend) {
+    case SDL_BLENDMODE_NONE:
+        return 0;
+    case SDL_BLENDMODE_BLEND:
+        return SDL_COPY_BLEND;
+    case SDL_BLENDMODE_ADD:
+        return SDL_COPY_ADD;
+    case SDL_BLENDMODE_MOD:
+        return SDL_COPY_MOD;
+    case SDL_BLENDMODE_MUL:
+        return SDL_COPY_MUL;
+    default:
+        return -1;
+    }
+}
+
+/* Texture coordinates of a textured triangle, as SDL_SW_BlitTriangle() works them out */
+typedef struct
+{
+    int s2s0_x, s2s1_x, s2s0_y, s2s1_y;
+    SDL_Point s2_x_area;
+} TriangleTexCoords;
+
+/* SIMD spans
+ *
+ * A span draws the start of a block row, 4 or 8 pixels at a time, and
+ * returns how many pixels it drew; the scalar loop does the rest.
+ * There's no vector integer division, so num / area is estimated with a
+ * float reciprocal and then corrected from the remainder. The estimate is
+ * off by at most one while quotients stay below 2^16, and the remainder is
+ * exact in 32 bits whatever the estimate. x / 255 is (x * 0x8081) >> 23,
+ * which is exact for x up to 65025.
+ */
+
+#define TRIANGLE_SPAN_FILL  0   /* vertex colors */
+#define TRIANGLE_SPAN_BLIT  1   /* texture modulated by the vertex colors */
+#define TRIANGLE_SPAN_COPY  2   /* same-format texture, no modulation or blending */
+
+typedef struct TriangleSpan
+{
+    const TriangleSetup *t;
+    int mode;
+    int blendflags;
+    int modflags;
+    int is_uniform;
+    Uint32 color;           /* a uniform unblended fill, mapped to the target */
+    int c0[4], c1[4], c2[4];  /* vertex colors, as r, g, b, a */
+    float inv_area;
+
+    int dst_shift[4];
+    int dst_has_alpha;
+
+    const Uint8 *src_base;
+    int src_pitch;
+    int src_shift[4];
+    int src_has_alpha;
+    const TriangleTexCoords *tc;
+} TriangleSpan;
+
+typedef SDL_SW_TriangleSpanFunc TriangleSpanFunc;
+
+static void
+init_span(TriangleSpan *span, const TriangleSetup *t, int mode, const SDL_PixelFormat *dst_fmt,
+          SDL_Color c0, SDL_Color c1, SDL_Color c2, int blendflags, int is_uniform)
+{
+    span->t = t;
+    span->mode = mode;
+    span->blendflags = blendflags;
+    span->modflags = 0;
+    span->is_uniform = is_uniform;
+    span->color = SDL_MapRGBA(dst_fmt, c0.r, c0.g, c0.b, c0.a);
+    span->c0[0] = c0.r; span->c0[1] = c0.g; span->c0[2] = c0.b; span->c0[3] = c0.a;
+    span->c1[0] = c1.r; span->c1[1] = c1.g; span->c1[2] = c1.b; span->c1[3] = c1.a;
+    span->c2[0] = c2.r; span->c2[1] = c2.g; span->c2[2] = c2.b; span->c2[3] = c2.a;
+    span->inv_area = 1.0f / t->area;
+    span->dst_shift[0] = dst_fmt->Rshift;
+    span->dst_shift[1] = dst_fmt->Gshift;
+    span->dst_shift[2] = dst_fmt->Bshift;
+    span->dst_shift[3] = dst_fmt->Ashift;
+    span->dst_has_alpha = dst_fmt->Amask ? 1 : 0;
+    span->src_base = NULL;
+    span->src_pitch = 0;
+    span->tc = NULL;
+}
+
+static void
+init_span_texture(TriangleSpan *span, SDL_Surface *src, const TriangleTexCoords *tc, int modflags)
+{
+    span->modflags = modflags;
+    span->src_base = (const Uint8 *) src->pixels;
+    span->src_pitch = src->pitch;
+    span->src_shift[0] = src->format->Rshift;
+    span->src_shift[1] = src->format->Gshift;
+    span->src_shift[2] = src->format->Bshift;
+    span->src_shift[3] = src->format->Ashift;
+    span->src_has_alpha = src->format->Amask ? 1 : 0;
+    span->tc = tc;
+}
+
+#if HAVE_SSE41_INTRINSICS
+static __m128i SDL_TARGETING("sse4.1")
+DivideByArea_SSE41(__m128i num, __m128 inv_area, __m128i area)
+{
+    __m128i q = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(num), inv_area));
+    __m128i r = _mm_sub_epi32(num, _mm_mullo_epi32(q, area));
+    const __m128i under = _mm_srai_epi32(r, 31);
+    q = _mm_add_epi32(q, under);
+    r = _mm_add_epi32(r, _mm_and_si128(under, area));
+    return _mm_sub_epi32(q, _mm_cmpgt_epi32(r, _mm_sub_epi32(area, _mm_set1_epi32(1))));
+}
+
+static __m128i SDL_TARGETING("sse4.1")
+Divide255_SSE41(__m128i x)
+{
+    return _mm_srli_epi32(_mm_mullo_epi32(x, _mm_set1_epi32(0x8081)), 23);
+}
+
+static __m128i SDL_TARGETING("sse4.1")
+Interpolate_SSE41(__m128i w0, __m128i w1, __m128i w2, int v0, int v1, int v2)
+{
+    return _mm_add_epi32(_mm_add_epi32(_mm_mullo_epi32(w0, _mm_set1_epi32(v0)),
+                                       _mm_mullo_epi32(w1, _mm_set1_epi32(v1))),
+                         _mm_mullo_epi32(w2, _mm_set1_epi32(v2)));
+}
+
+static __m128i SDL_TARGETING("sse4.1")
+Channel_SSE41(__m128i pixels, int shift)
+{
+    return _mm_and_si128(_mm_srl_epi32(pixels, _mm_cvtsi32_si128(shift)), _mm_set1_epi32(0xFF));
+}
+
+static int SDL_TARGETING("sse4.1")
+TriangleSpan_SSE41(const TriangleSpan *span, Uint32 *dptr, int w0, int w1, int w2, int n, int partial)
+{
+    const TriangleSetup *t = span->t;
+    const __m128i lane = _mm_setr_epi32(0, 1, 2, 3);
+    const __m128i step0 = _mm_set1_epi32(t->d2d1_y * 4);
+    const __m128i step1 = _mm_set1_epi32(t->d0d2_y * 4);
+    const __m128i step2 = _mm_set1_epi32(t->d1d0_y * 4);
+    /* (w + bias >= 0) is (w > -bias - 1) */
+    const __m128i min0 = _mm_set1_epi32(-t->bias_w0 - 1);
+    const __m128i min1 = _mm_set1_epi32(-t->bias_w1 - 1);
+    const __m128i min2 = _mm_set1_epi32(-t->bias_w2 - 1);
+    const __m128 inv_area = _mm_set1_ps(span->inv_area);
+    const __m128i area = _mm_set1_epi32(t->area);
+    const __m128i x255 = _mm_set1_epi32(255);
+    __m128i vw0 = _mm_add_epi32(_mm_set1_epi32(w0), _mm_mullo_epi32(lane, _mm_set1_epi32(t->d2d1_y)));
+    __m128i vw1 = _mm_add_epi32(_mm_set1_epi32(w1), _mm_mullo_epi32(lane, _mm_set1_epi32(t->d0d2_y)));
+    __m128i vw2 = _mm_add_epi32(_mm_set1_epi32(w2), _mm_mullo_epi32(lane, _mm_set1_epi32(t->d1d0_y)));
+    int x;
+
+    for (x = 0; x + 4 <= n; x += 4, dptr += 4, vw0 = _mm_add_epi32(vw0, step0), vw1 = _mm_add_epi32(vw1, step1), vw2 = _mm_add_epi32(vw2, step2)) {
+        __m128i mask = _mm_set1_epi32(-1);
+        __m128i pixels, sR, sG, sB, sA;
+
+        if (partial) {
+            mask = _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi32(vw0, min0), _mm_cmpgt_epi32(vw1, min1)), _mm_cmpgt_epi32(vw2, min2));
+            if (_mm_testz_si128(mask, mask)) {
+                continue;
+            }
+        }
+
+        if (span->mode == TRIANGLE_SPAN_FILL) {
+            if (span->is_uniform && span->blendflags == 0) {
+                pixels = _mm_set1_epi32(span->color);
+                goto store;
+            }
+            if (span->is_uniform) {
+                sR = _mm_set1_epi32(span->c0[0]);
+                sG = _mm_set1_epi32(span->c0[1]);
+                sB = _mm_set1_epi32(span->c0[2]);
+                sA = _mm_set1_epi32(span->c0[3]);
+            } else {
+                sR = DivideByArea_SSE41(Interpolate_SSE41(vw0, vw1, vw2, span->c0[0], span->c1[0], span->c2[0]), inv_area, area);
+                sG = DivideByArea_SSE41(Interpolate_SSE41(vw0, vw1, vw2, span->c0[1], span->c1[1], span->c2[1]), inv_area, area);
+                sB = DivideByArea_SSE41(Interpolate_SSE41(vw0, vw1, vw2, span->c0[2], span->c1[2], span->c2[2]), inv_area, area);
+                sA = DivideByArea_SSE41(Interpolate_SSE41(vw0, vw1, vw2, span->c0[3], span->c1[3], span->c2[3]), inv_area, area);
+            }
+        } else {
+            const TriangleTexCoords *tc = span->tc;
+            const __m128i srcx = DivideByArea_SSE41(_mm_add_epi32(Interpolate_SSE41(vw0, vw1, vw2, tc->s2s0_x, tc->s2s1_x, 0), _mm_set1_epi32(tc->s2_x_area.x)), inv_area, area);
+            const __m128i srcy = DivideByArea_SSE41(_mm_add_epi32(Interpolate_SSE41(vw0, vw1, vw2, tc->s2s0_y, tc->s2s1_y, 0), _mm_set1_epi32(tc->s2_x_area.y)), inv_area, area);
+            /* lanes outside the triangle read the first texel rather than anything out of bounds */
+            const __m128i offset = _mm_and_si128(_mm_add_epi32(_mm_mullo_epi32(srcy, _mm_set1_epi32(span->src_pitch)), _mm_slli_epi32(srcx, 2)), mask);
+            pixels = _mm_setr_epi32(*(const int *) (span->src_base + _mm_extract_epi32(offset, 0)),
+                                    *(const int *) (span->src_base + _mm_extract_epi32(offset, 1)),
+                                    *(const int *) (span->src_base + _mm_extract_epi32(offset, 2)),
+                                    *(const int *) (span->src_base + _mm_extract_epi32(offset, 3)));
+            if (span->mode == TRIANGLE_SPAN_COPY) {
+                goto store;
+            }
+            sR = Channel_SSE41(pixels, span->src_shift[0]);
+            sG = Channel_SSE41(pixels, span->src_shift[1]);
+            sB = Channel_SSE41(pixels, span->src_shift[2]);
+            sA = span->src_has_alpha ? Channel_SSE41(pixels, span->src_shift[3]) : x255;
+            if (span->modflags) {
+                __m128i mR, mG, mB, mA;
+                if (span->is_uniform) {
+                    mR = _mm_set1_epi32(span->c0[0]);
+                    mG = _mm_set1_epi32(span->c0[1]);
+                    mB = _mm_set1_epi32(span->c0[2]);
+                    mA = _mm_set1_epi32(span->c0[3]);
+                } else {
+                    mR = DivideByArea_SSE41(Interpolate_SSE41(vw0, vw1, vw2, span->c0[0], span->c1[0], span->c2[0]), inv_area, area);
+                    mG = DivideByArea_SSE41(Interpolate_SSE41(vw0, vw1, vw2, span->c0[1], span->c1[1], span->c2[1]), inv_area, area);
+                    mB = DivideByArea_SSE41(Interpolate_SSE41(vw0, vw1, vw2, span->c0[2], span->c1[2], span->c2[2]), inv_area, area);
+                    mA = DivideByArea_SSE41(Interpolate_SSE41(vw0, vw1, vw2, span->c0[3], span->c1[3], span->c2[3]), inv_area, area);
+                }
+                if (span->modflags & SDL_COPY_MODULATE_COLOR) {
+                    sR = Divide255_SSE41(_mm_mullo_epi32(sR, mR));
+                    sG = Divide255_SSE41(_mm_mullo_epi32(sG, mG));
+                    sB = Divide255_SSE41(_mm_mullo_epi32(sB, mB));
+                }
+                if (span->modflags & SDL_COPY_MODULATE_ALPHA) {
+                    sA = Divide255_SSE41(_mm_mullo_epi32(sA, mA));
+                }
+            }
+        }
+
+        if (span->blendflags) {
+            const __m128i dst = _mm_loadu_si128((const __m128i *) dptr);
+            const __m128i inv_sA = _mm_sub_epi32(x255, sA);
+            __m128i dR = Channel_SSE41(dst, span->dst_shift[0]);
+            __m128i dG = Channel_SSE41(dst, span->dst_shift[1]);
+            __m128i dB = Channel_SSE41(dst, span->dst_shift[2]);
+            __m128i dA = span->dst_has_alpha ? Channel_SSE41(dst, span->dst_shift[3]) : x255;
+            const __m128i max = _mm_set1_epi32(255 * 255);
+
+            switch (span->blendflags) {
+            case SDL_COPY_BLEND:
+                sR = Divide255_SSE41(_mm_mullo_epi32(sR, sA));
+                sG = Divide255_SSE41(_mm_mullo_epi32(sG, sA));
+                sB = Divide255_SSE41(_mm_mullo_epi32(sB, sA));
+                dR = _mm_add_epi32(sR, Divide255_SSE41(_mm_mullo_epi32(inv_sA, dR)));
+                dG = _mm_add_epi32(sG, Divide255_SSE41(_mm_mullo_epi32(inv_sA, dG)));
+                dB = _mm_add_epi32(sB, Divide255_SSE41(_mm_mullo_epi32(inv_sA, dB)));
+                dA = _mm_add_epi32(sA, Divide255_SSE41(_mm_mullo_epi32(inv_sA, dA)));
+                break;
+            case SDL_COPY_ADD:
+                sR = Divide255_SSE41(_mm_mullo_epi32(sR, sA));
+                sG = Divide255_SSE41(_mm_mullo_epi32(sG, sA));
+                sB = Divide255_SSE41(_mm_mullo_epi32(sB, sA));
+                dR = _mm_min_epi32(_mm_add_epi32(sR, dR), x255);
+                dG = _mm_min_epi32(_mm_add_epi32(sG, dG), x255);
+                dB = _mm_min_epi32(_mm_add_epi32(sB, dB), x255);
+                break;
+            case SDL_COPY_MOD:
+                dR = Divide255_SSE41(_mm_mullo_epi32(sR, dR));
+                dG = Divide255_SSE41(_mm_mullo_epi32(sG, dG));
+                dB = Divide255_SSE41(_mm_mullo_epi32(sB, dB));
+                break;
+            case SDL_COPY_MUL:
+                /* min(x / 255, 255) is min(x, 255 * 255) / 255 */
+                dR = Divide255_SSE41(_mm_min_epi32(_mm_mullo_epi32(dR, _mm_add_epi32(sR, inv_sA)), max));
+                dG = Divide255_SSE41(_mm_min_epi32(_mm_mullo_epi32(dG, _mm_add_epi32(sG, inv_sA)), max));
+                dB = Divide255_SSE41(_mm_min_epi32(_mm_mullo_epi32(dB, _mm_add_epi32(sB, inv_sA)), max));
+                dA = Divide255_SSE41(_mm_min_epi32(_mm_mullo_epi32(dA, _mm_add_epi32(sA, inv_sA)), max));
+                break;
+            }
+            sR = dR;
+            sG = dG;
+            sB = dB;
+            sA = dA;
+        }
+
+        pixels = _mm_or_si128(_mm_or_si128(_mm_sll_epi32(sR, _mm_cvtsi32_si128(span->dst_shift[0])),
+                                           _mm_sll_epi32(sG, _mm_cvtsi32_si128(span->dst_shift[1]))),
+                              _mm_sll_epi32(sB, _mm_cvtsi32_si128(span->dst_shift[2])));
+        if (span->dst_has_alpha) {
+            pixels = _mm_or_si128(pixels, _mm_sll_epi32(sA, _mm_cvtsi32_si128(span->dst_shift[3])));
+        }
+
+    store:
+        if (partial) {
+            pixels = _mm_blendv_epi8(_mm_loadu_si128((const __m128i *) dptr), pixels, mask);
+        }
+        _mm_storeu_si128((__m128i *) dptr, pixels);
+    }
+    return x;
+}
+#endif /* HAVE_SSE41_INTRINSICS */
+
+#if HAVE_AVX2_INTRINSICS
+static __m256i SDL_TARGETING("avx2")
+DivideByArea_AVX2(__m256i num, __m256 inv_area, __m256i area)
+{
+    __m256i q = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(num), inv_area));
+    __m256i r = _mm256_sub_epi32(num, _mm256_mullo_epi32(q, area));
+    const __m256i under = _mm256_srai_epi32(r, 31);
+    q = _mm256_add_epi32(q, under);
+    r = _mm256_add_epi32(r, _mm256_and_si256(under, area));
+    return _mm256_sub_epi32(q, _mm256_cmpgt_epi32(r, _mm256_sub_epi32(area, _mm256_set1_epi32(1))));
+}
+
+static __m256i SDL_TARGETING("avx2")
+Divide255_AVX2(__m256i x)
+{
+    return _mm256_srli_epi32(_mm256_mullo_epi32(x, _mm256_set1_epi32(0x8081)), 23);
+}
+
+static __m256i SDL_TARGETING("avx2")
+Interpolate_AVX2(__m256i w0, __m256i w1, __m256i w2, int v0, int v1, int v2)
+{
+    return _mm256_add_epi32(_mm256_add_epi32(_mm256_mullo_epi32(w0, _mm256_set1_epi32(v0)),
+                                             _mm256_mullo_epi32(w1, _mm256_set1_epi32(v1))),
+                            _mm256_mullo_epi32(w2, _mm256_set1_epi32(v2)));
+}
+
+static __m256i SDL_TARGETING("avx2")
+Channel_AVX2(__m256i pixels, int shift)
+{
+    return _mm256_and_si256(_mm256_srl_epi32(pixels, _mm_cvtsi32_si128(shift)), _mm256_set1_epi32(0xFF));
+}
+
+static int SDL_TARGETING("avx2")
+TriangleSpan_AVX2(const TriangleSpan *span, Uint32 *dptr, int w0, int w1, int w2, int n, int partial)
+{
+    const TriangleSetup *t = span->t;
+    const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i step0 = _mm256_set1_epi32(t->d2d1_y * 8);
+    const __m256i step1 = _mm256_set1_epi32(t->d0d2_y * 8);
+    const __m256i step2 = _mm256_set1_epi32(t->d1d0_y * 8);
+    /* (w + bias >= 0) is (w > -bias - 1) */
+    const __m256i min0 = _mm256_set1_epi32(-t->bias_w0 - 1);
+    const __m256i min1 = _mm256_set1_epi32(-t->bias_w1 - 1);
+    const __m256i min2 = _mm256_set1_epi32(-t->bias_w2 - 1);
+    const __m256 inv_area = _mm256_set1_ps(span->inv_area);
+    const __m256i area = _mm256_set1_epi32(t->area);
+    const __m256i x255 = _mm256_set1_epi32(255);
+    __m256i vw0 = _mm256_add_epi32(_mm256_set1_epi32(w0), _mm256_mullo_epi32(lane, _mm256_set1_epi32(t->d2d1_y)));
+    __m256i vw1 = _mm256_add_epi32(_mm256_set1_epi32(w1), _mm256_mullo_epi32(lane, _mm256_set1_epi32(t->d0d2_y)));
+    __m256i vw2 = _mm256_add_epi32(_mm256_set1_epi32(w2), _mm256_mullo_epi32(lane, _mm256_set1_epi32(t->d1d0_y)));
+    int x;
+
+    for (x = 0; x + 8 <= n; x += 8, dptr += 8, vw0 = _mm256_add_epi32(vw0, step0), vw1 = _mm256_add_epi32(vw1, step1), vw2 = _mm256_add_epi32(vw2, step2)) {
+        __m256i mask = _mm256_set1_epi32(-1);
+        __m256i pixels, sR, sG, sB, sA;
+
+        if (partial) {
+            mask = _mm256_and_si256(_mm256_and_si256(_mm256_cmpgt_epi32(vw0, min0), _mm256_cmpgt_epi32(vw1, min1)), _mm256_cmpgt_epi32(vw2, min2));
+            if (_mm256_testz_si256(mask, mask)) {
+                continue;
+            }
+        }
+
+        if (span->mode == TRIANGLE_SPAN_FILL) {
+            if (span->is_uniform && span->blendflags == 0) {
+                pixels = _mm256_set1_epi32(span->color);
+                goto store;
+            }
+            if (span->is_uniform) {
+                sR = _mm256_set1_epi32(span->c0[0]);
+                sG = _mm256_set1_epi32(span->c0[1]);
+                sB = _mm256_set1_epi32(span->c0[2]);
+                sA = _mm256_set1_epi32(span->c0[3]);
+            } else {
+                sR = DivideByArea_AVX2(Interpolate_AVX2(vw0, vw1, vw2, span->c0[0], span->c1[0], span->c2[0]), inv_area, area);
+                sG = DivideByArea_AVX2(Interpolate_AVX2(vw0, vw1, vw2, span->c0[1], span->c1[1], span->c2[1]), inv_area, area);
+                sB = DivideByArea_AVX2(Interpolate_AVX2(vw0, vw1, vw2, span->c0[2], span->c1[2], span->c2[2]), inv_area, area);
+                sA = DivideByArea_AVX2(Interpolate_AVX2(vw0, vw1, vw2, span->c0[3], span->c1[3], span->c2[3]), inv_area, area);
+            }
+        } else {
+            const TriangleTexCoords *tc = span->tc;
+            const __m256i srcx = DivideByArea_AVX2(_mm256_add_epi32(Interpolate_AVX2(vw0, vw1, vw2, tc->s2s0_x, tc->s2s1_x, 0), _mm256_set1_epi32(tc->s2_x_area.x)), inv_area, area);
+            const __m256i srcy = DivideByArea_AVX2(_mm256_add_epi32(Interpolate_AVX2(vw0, vw1, vw2, tc->s2s0_y, tc->s2s1_y, 0), _mm256_set1_epi32(tc->s2_x_area.y)), inv_area, area);
+            /* lanes outside the triangle read the first texel rather than anything out of bounds */
+            const __m256i offset = _mm256_and_si256(_mm256_add_epi32(_mm256_mullo_epi32(srcy, _mm256_set1_epi32(span->src_pitch)), _mm256_slli_epi32(srcx, 2)), mask);
+            pixels = _mm256_i32gather_epi32((const int *) span->src_base, offset, 1);
+            if (span->mode == TRIANGLE_SPAN_COPY) {
+                goto store;
+            }
+            sR = Channel_AVX2(pixels, span->src_shift[0]);
+            sG = Channel_AVX2(pixels, span->src_shift[1]);
+            sB = Channel_AVX2(pixels, span->src_shift[2]);
+            sA = span->src_has_alpha ? Channel_AVX2(pixels, span->src_shift[3]) : x255;
+            if (span->modflags) {
+                __m256i mR, mG, mB, mA;
+                if (span->is_uniform) {
+                    mR = _mm256_set1_epi32(span->c0[0]);
+                    mG = _mm256_set1_epi32(span->c0[1]);
+                    mB = _mm256_set1_epi32(span->c0[2]);
+                    mA = _mm256_set1_epi32(span->c0[3]);
+                } else {
+                    mR = DivideByArea_AVX2(Interpolate_AVX2(vw0, vw1, vw2, span->c0[0], span->c1[0], span->c2[0]), inv_area, area);
+                    mG = DivideByArea_AVX2(Interpolate_AVX2(vw0, vw1, vw2, span->c0[1], span->c1[1], span->c2[1]), inv_area, area);
+                    mB = DivideByArea_AVX2(Interpolate_AVX2(vw0, vw1, vw2, span->c0[2], span->c1[2], span->c2[2]), inv_area, area);
+                    mA = DivideByArea_AVX2(Interpolate_AVX2(vw0, vw1, vw2, span->c0[3], span->c1[3], span->c2[3]), inv_area, area);
+                }
+                if (span->modflags & SDL_COPY_MODULATE_COLOR) {
+                    sR = Divide255_AVX2(_mm256_mullo_epi32(sR, mR));
+                    sG = Divide255_AVX2(_mm256_mullo_epi32(sG, mG));
+                    sB = Divide255_AVX2(_mm256_mullo_epi32(sB, mB));
+                }
+                if (span->modflags & SDL_COPY_MODULATE_ALPHA) {
+                    sA = Divide255_AVX2(_mm256_mullo_epi32(sA, mA));
+                }
+            }
+        }
+
+        if (span->blendflags) {
+            const __m256i dst = _mm256_loadu_si256((const __m256i *) dptr);
+            const __m256i inv_sA = _mm256_sub_epi32(x255, sA);
+            __m256i dR = Channel_AVX2(dst, span->dst_shift[0]);
+            __m256i dG = Channel_AVX2(dst, span->dst_shift[1]);
+            __m256i dB = Channel_AVX2(dst, span->dst_shift[2]);
+            __m256i dA = span->dst_has_alpha ? Channel_AVX2(dst, span->dst_shift[3]) : x255;
+            const __m256i max = _mm256_set1_epi32(255 * 255);
+
+            switch (span->blendflags) {
+            case SDL_COPY_BLEND:
+                sR = Divide255_AVX2(_mm256_mullo_epi32(sR, sA));
+                sG = Divide255_AVX2(_mm256_mullo_epi32(sG, sA));
+                sB = Divide255_AVX2(_mm256_mullo_epi32(sB, sA));
+                dR = _mm256_add_epi32(sR, Divide255_AVX2(_mm256_mullo_epi32(inv_sA, dR)));
+                dG = _mm256_add_epi32(sG, Divide255_AVX2(_mm256_mullo_epi32(inv_sA, dG)));
+                dB = _mm256_add_epi32(sB, Divide255_AVX2(_mm256_mullo_epi32(inv_sA, dB)));
+                dA = _mm256_add_epi32(sA, Divide255_AVX2(_mm256_mullo_epi32(inv_sA, dA)));
+                break;
+            case SDL_COPY_ADD:
+                sR = Divide255_AVX2(_mm256_mullo_epi32(sR, sA));
+                sG = Divide255_AVX2(_mm256_mullo_epi32(sG, sA));
+                sB = Divide255_AVX2(_mm256_mullo_epi32(sB, sA));
+                dR = _mm256_min_epi32(_mm256_add_epi32(sR, dR), x255);
+                dG = _mm256_min_epi32(_mm256_add_epi32(sG, dG), x255);
+                dB = _mm256_min_epi32(_mm256_add_epi32(sB, dB), x255);
+                break;
+            case SDL_COPY_MOD:
+                dR = Divide255_AVX2(_mm256_mullo_epi32(sR, dR));
+                dG = Divide255_AVX2(_mm256_mullo_epi32(sG, dG));
+                dB = Divide255_AVX2(_mm256_mullo_epi32(sB, dB));
+                break;
+            case SDL_COPY_MUL:
+                /* min(x / 255, 255) is min(x, 255 * 255) / 255 */
+                dR = Divide255_AVX2(_mm256_min_epi32(_mm256_mullo_epi32(dR, _mm256_add_epi32(sR, inv_sA)), max));
+                dG = Divide255_AVX2(_mm256_min_epi32(_mm256_mullo_epi32(dG, _mm256_add_epi32(sG, inv_sA)), max));
+                dB = Divide255_AVX2(_mm256_min_epi32(_mm256_mullo_epi32(dB, _mm256_add_epi32(sB, inv_sA)), max));
+                dA = Divide255_AVX2(_mm256_min_epi32(_mm256_mullo_epi32(dA, _mm256_add_epi32(sA, inv_sA)), max));
+                break;
+            }
+            sR = dR;
+            sG = dG;
+            sB = dB;
+            sA = dA;
+        }
+
+        pixels = _mm256_or_si256(_mm256_or_si256(_mm256_sll_epi32(sR, _mm_cvtsi32_si128(span->dst_shift[0])),
+                                                 _mm256_sll_epi32(sG, _mm_cvtsi32_si128(span->dst_shift[1]))),
+                                 _mm256_sll_epi32(sB, _mm_cvtsi32_si128(span->dst_shift[2])));
+        if (span->dst_has_alpha) {
+            pixels = _mm256_or_si256(pixels, _mm256_sll_epi32(sA, _mm_cvtsi32_si128(span->dst_shift[3])));
+        }
+
+    store:
+        if (partial) {
+            pixels = _mm256_blendv_epi8(_mm256_loadu_si256((const __m256i *) dptr), pixels, mask);
+        }
+        _mm256_storeu_si256((__m256i *) dptr, pixels);
+    }
+    return x;
+}
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static int32x4_t
+DivideByArea_NEON(int32x4_t num, float32x4_t inv_area, int32x4_t area)
+{
+    int32x4_t q = vcvtq_s32_f32(vmulq_f32(vcvtq_f32_s32(num), inv_area));
+    int32x4_t r = vsubq_s32(num, vmulq_s32(q, area));
+    const int32x4_t under = vshrq_n_s32(r, 31);
+    q = vaddq_s32(q, under);
+    r = vaddq_s32(r, vandq_s32(under, area));
+    return vsubq_s32(q, vreinterpretq_s32_u32(vcgeq_s32(r, area)));
+}
+
+static int32x4_t
+Divide255_NEON(int32x4_t x)
+{
+    return vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(vmulq_n_s32(x, 0x8081)), 23));
+}
+
+static int32x4_t
+Interpolate_NEON(int32x4_t w0, int32x4_t w1, int32x4_t w2, int v0, int v1, int v2)
+{
+    return vaddq_s32(vaddq_s32(vmulq_n_s32(w0, v0), vmulq_n_s32(w1, v1)), vmulq_n_s32(w2, v2));
+}
+
+static int32x4_t
+Channel_NEON(uint32x4_t pixels, int shift)
+{
+    return vreinterpretq_s32_u32(vandq_u32(vshlq_u32(pixels, vdupq_n_s32(-shift)), vdupq_n_u32(0xFF)));
+}
+
+static uint32x4_t
+Pack_NEON(int32x4_t channel, int shift)
+{
+    return vshlq_u32(vreinterpretq_u32_s32(channel), vdupq_n_s32(shift));
+}
+
+static int
+TriangleSpan_NEON(const TriangleSpan *span, Uint32 *dptr, int w0, int w1, int w2, int n, int partial)
+{
+    static const int32_t lanes[4] = { 0, 1, 2, 3 };
+    const TriangleSetup *t = span->t;
+    const int32x4_t lane = vld1q_s32(lanes);
+    const int32x4_t step0 = vdupq_n_s32(t->d2d1_y * 4);
+    const int32x4_t step1 = vdupq_n_s32(t->d0d2_y * 4);
+    const int32x4_t step2 = vdupq_n_s32(t->d1d0_y * 4);
+    /* (w + bias >= 0) is (w > -bias - 1) */
+    const int32x4_t min0 = vdupq_n_s32(-t->bias_w0 - 1);
+    const int32x4_t min1 = vdupq_n_s32(-t->bias_w1 - 1);
+    const int32x4_t min2 = vdupq_n_s32(-t->bias_w2 - 1);
+    const float32x4_t inv_area = vdupq_n_f32(span->inv_area);
+    const int32x4_t area = vdupq_n_s32(t->area);
+    const int32x4_t x255 = vdupq_n_s32(255);
+    int32x4_t vw0 = vmlaq_n_s32(vdupq_n_s32(w0), lane, t->d2d1_y);
+    int32x4_t vw1 = vmlaq_n_s32(vdupq_n_s32(w1), lane, t->d0d2_y);
+    int32x4_t vw2 = vmlaq_n_s32(vdupq_n_s32(w2), lane, t->d1d0_y);
+    int x;
+
+    for (x = 0; x + 4 <= n; x += 4, dptr += 4, vw0 = vaddq_s32(vw0, step0), vw1 = vaddq_s32(vw1, step1), vw2 = vaddq_s32(vw2, step2)) {
+        uint32x4_t mask = vdupq_n_u32(0xFFFFFFFF);
+        uint32x4_t pixels;
+        int32x4_t sR, sG, sB, sA;
+
+        if (partial) {
+            uint32x2_t any;
+            mask = vandq_u32(vandq_u32(vcgtq_s32(vw0, min0), vcgtq_s32(vw1, min1)), vcgtq_s32(vw2, min2));
+            any = vorr_u32(vget_low_u32(mask), vget_high_u32(mask));
+            if ((vget_lane_u32(any, 0) | vget_lane_u32(any, 1)) == 0) {
+                continue;
+            }
+        }
+
+        if (span->mode == TRIANGLE_SPAN_FILL) {
+            if (span->is_uniform && span->blendflags == 0) {
+                pixels = vdupq_n_u32(span->color);
+                goto store;
+            }
+            if (span->is_uniform) {
+                sR = vdupq_n_s32(span->c0[0]);
+                sG = vdupq_n_s32(span->c0[1]);
+                sB = vdupq_n_s32(span->c0[2]);
+                sA = vdupq_n_s32(span->c0[3]);
+            } else {
+                sR = DivideByArea_NEON(Interpolate_NEON(vw0, vw1, vw2, span->c0[0], span->c1[0], span->c2[0]), inv_area, area);
+                sG = DivideByArea_NEON(Interpolate_NEON(vw0, vw1, vw2, span->c0[1], span->c1[1], span->c2[1]), inv_area, area);
+                sB = DivideByArea_NEON(Interpolate_NEON(vw0, vw1, vw2, span->c0[2], span->c1[2], span->c2[2]), inv_area, area);
+                sA = DivideByArea_NEON(Interpolate_NEON(vw0, vw1, vw2, span->c0[3], span->c1[3], span->c2[3]), inv_area, area);
+            }
+        } else {
+            const TriangleTexCoords *tc = span->tc;
+            const int32x4_t srcx = DivideByArea_NEON(vaddq_s32(Interpolate_NEON(vw0, vw1, vw2, tc->s2s0_x, tc->s2s1_x, 0), vdupq_n_s32(tc->s2_x_area.x)), inv_area, area);
+            const int32x4_t srcy = DivideByArea_NEON(vaddq_s32(Interpolate_NEON(vw0, vw1, vw2, tc->s2s0_y, tc->s2s1_y, 0), vdupq_n_s32(tc->s2_x_area.y)), inv_area, area);
+            /* lanes outside the triangle read the first texel rather than anything out of bounds */
+            const int32x4_t offset = vandq_s32(vaddq_s32(vmulq_n_s32(srcy, span->src_pitch), vshlq_n_s32(srcx, 2)), vreinterpretq_s32_u32(mask));
+            Uint32 texels[4];
+            texels[0] = *(const Uint32 *) (span->src_base + vgetq_lane_s32(offset, 0));
+            texels[1] = *(const Uint32 *) (span->src_base + vgetq_lane_s32(offset, 1));
+            texels[2] = *(const Uint32 *) (span->src_base + vgetq_lane_s32(offset, 2));
+            texels[3] = *(const Uint32 *) (span->src_base + vgetq_lane_s32(offset, 3));
+            pixels = vld1q_u32(texels);
+            if (span->mode == TRIANGLE_SPAN_COPY) {
+                goto store;
+            }
+            sR = Channel_NEON(pixels, span->src_shift[0]);
+            sG = Channel_NEON(pixels, span->src_shift[1]);
+            sB = Channel_NEON(pixels, span->src_shift[2]);
+            sA = span->src_has_alpha ? Channel_NEON(pixels, span->src_shift[3]) : x255;
+            if (span->modflags) {
+                int32x4_t mR, mG, mB, mA;
+                if (span->is_uniform) {
+                    mR = vdupq_n_s32(span->c0[0]);
+                    mG = vdupq_n_s32(span->c0[1]);
+                    mB = vdupq_n_s32(span->c0[2]);
+                    mA = vdupq_n_s32(span->c0[3]);
+                } else {
+                    mR = DivideByArea_NEON(Interpolate_NEON(vw0, vw1, vw2, span->c0[0], span->c1[0], span->c2[0]), inv_area, area);
+                    mG = DivideByArea_NEON(Interpolate_NEON(vw0, vw1, vw2, span->c0[1], span->c1[1], span->c2[1]), inv_area, area);
+                    mB = DivideByArea_NEON(Interpolate_NEON(vw0, vw1, vw2, span->c0[2], span->c1[2], span->c2[2]), inv_area, area);
+                    mA = DivideByArea_NEON(Interpolate_NEON(vw0, vw1, vw2, span->c0[3], span->c1[3], span->c2[3]), inv_area, area);
+                }
+                if (span->modflags & SDL_COPY_MODULATE_COLOR) {
+                    sR = Divide255_NEON(vmulq_s32(sR, mR));
+                    sG = Divide255_NEON(vmulq_s32(sG, mG));
+                    sB = Divide255_NEON(vmulq_s32(sB, mB));
+                }
+                if (span->modflags & SDL_COPY_MODULATE_ALPHA) {
+                    sA = Divide255_NEON(vmulq_s32(sA, mA));
+                }
+            }
+        }
+
+        if (span->blendflags) {
+            const uint32x4_t dst = vld1q_u32(dptr);
+            const int32x4_t inv_sA = vsubq_s32(x255, sA);
+            int32x4_t dR = Channel_NEON(dst, span->dst_shift[0]);
+            int32x4_t dG = Channel_NEON(dst, span->dst_shift[1]);
+            int32x4_t dB = Channel_NEON(dst, span->dst_shift[2]);
+            int32x4_t dA = span->dst_has_alpha ? Channel_NEON(dst, span->dst_shift[3]) : x255;
+            const int32x4_t max = vdupq_n_s32(255 * 255);
+
+            switch (span->blendflags) {
+            case SDL_COPY_BLEND:
+                sR = Divide255_NEON(vmulq_s32(sR, sA));
+                sG = Divide255_NEON(vmulq_s32(sG, sA));
+                sB = Divide255_NEON(vmulq_s32(sB, sA));
+                dR = vaddq_s32(sR, Divide255_NEON(vmulq_s32(inv_sA, dR)));
+                dG = vaddq_s32(sG, Divide255_NEON(vmulq_s32(inv_sA, dG)));
+                dB = vaddq_s32(sB, Divide255_NEON(vmulq_s32(inv_sA, dB)));
+                dA = vaddq_s32(sA, Divide255_NEON(vmulq_s32(inv_sA, dA)));
+                break;
+            case SDL_COPY_ADD:
+                sR = Divide255_NEON(vmulq_s32(sR, sA));
+                sG = Divide255_NEON(vmulq_s32(sG, sA));
+                sB = Divide255_NEON(vmulq_s32(sB, sA));
+                dR = vminq_s32(vaddq_s32(sR, dR), x255);
+                dG = vminq_s32(vaddq_s32(sG, dG), x255);
+                dB = vminq_s32(vaddq_s32(sB, dB), x255);
+                break;
+            case SDL_COPY_MOD:
+                dR = Divide255_NEON(vmulq_s32(sR, dR));
+                dG = Divide255_NEON(vmulq_s32(sG, dG));
+                dB = Divide255_NEON(vmulq_s32(sB, dB));
+                break;
+            case SDL_COPY_MUL:
+                /* min(x / 255, 255) is min(x, 255 * 255) / 255 */
+                dR = Divide255_NEON(vminq_s32(vmulq_s32(dR, vaddq_s32(sR, inv_sA)), max));
+                dG = Divide255_NEON(vminq_s32(vmulq_s32(dG, vaddq_s32(sG, inv_sA)), max));
+                dB = Divide255_NEON(vminq_s32(vmulq_s32(dB, vaddq_s32(sB, inv_sA)), max));
+                dA = Divide255_NEON(vminq_s32(vmulq_s32(dA, vaddq_s32(sA, inv_sA)), max));
+                break;
+            }
+            sR = dR;
+            sG = dG;
+            sB = dB;
+            sA = dA;
+        }
+
+        pixels = vorrq_u32(vorrq_u32(Pack_NEON(sR, span->dst_shift[0]), Pack_NEON(sG, span->dst_shift[1])),
+                           Pack_NEON(sB, span->dst_shift[2]));
+        if (span->dst_has_alpha) {
+            pixels = vorrq_u32(pixels, Pack_NEON(sA, span->dst_shift[3]));
+        }
+
+    store:
+        if (partial) {
+            pixels = vbslq_u32(mask, pixels, vld1q_u32(dptr));
+        }
+        vst1q_u32(dptr, pixels);
+    }
+    return x;
+}
+#endif /* HAVE_NEON_INTRINSICS */
+
+TriangleSpanFunc
+SDL_SW_ChooseTriangleSpan(void)
+{
+    /* "0" is plain C, "sse4.1" goes no further than that, anything else is whatever the CPU has. */
+    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SOFTWARE_SIMD);
+    TriangleSpanFunc span_func = NULL;
+
+    if (hint && SDL_strcmp(hint, "0") == 0) {
+        return NULL;
+    }
+#if HAVE_SSE41_INTRINSICS
+    if (SDL_HasSSE41()) {
+        span_func = TriangleSpan_SSE41;
+    }
+#endif
+#if HAVE_AVX2_INTRINSICS
+    if (SDL_HasAVX2() && !(hint && SDL_strcasecmp(hint, "sse4.1") == 0)) {
+        span_func = TriangleSpan_AVX2;
+    }
+#endif
+#if HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        span_func = TriangleSpan_NEON;
+    }
+#endif
+    return span_func;
+}
+
+SDL_FORCE_INLINE void
+fill_triangle_8888(const TriangleSetup *t, const GeometryFillData *v, SDL_Surface *dst, const int blendflags, const int is_uniform,
+                   TriangleSpanFunc span_func)
+{
+    const SDL_PixelFormat *fmt = dst->format;
+    Uint8 *dst_base = (Uint8 *) dst->pixels;
+    const int dst_pitch = dst->pitch;
+    const int area = t->area;
+    const SDL_Color c0 = v[0].color;
+    const SDL_Color c1 = v[1].color;
+    const SDL_Color c2 = v[2].color;
+    const Uint32 color = SDL_MapRGBA(dst->format, c0.r, c0.g, c0.b, c0.a);
+    TriangleSpan span;
+
+    if (span_func) {
+        init_span(&span, t, TRIANGLE_SPAN_FILL, fmt, c0, c1, c2, blendflags, is_uniform);
+    }
+
+    TRIANGLE_BLOCKS_BEGIN
+    {
+        if (is_uniform) {
+            if (blendflags == 0) {
+                *dptr = color;
+            } else {
+                blend_8888(dptr, fmt, c0.r, c0.g, c0.b, c0.a, blendflags);
+            }
+        } else {
+            const Uint32 r = (Uint32) ((w0 * c0.r + w1 * c1.r + w2 * c2.r) / area);
+            const Uint32 g = (Uint32) ((w0 * c0.g + w1 * c1.g + w2 * c2.g) / area);
+            const Uint32 b = (Uint32) ((w0 * c0.b + w1 * c1.b + w2 * c2.b) / area);
+            const Uint32 a = (Uint32) ((w0 * c0.a + w1 * c1.a + w2 * c2.a) / area);
+            if (blendflags == 0) {
+                *dptr = (r << fmt->Rshift) | (g << fmt->Gshift) | (b << fmt->Bshift) | ((a << fmt->Ashift) & fmt->Amask);
+            } else {
+                blend_8888(dptr, fmt, r, g, b, a, blendflags);
+            }
+        }
+    }
+    TRIANGLE_BLOCKS_END
+}
+
+int
+SDL_SW_FillTriangles(SDL_Surface *dst, const GeometryFillData *verts, int count, SDL_BlendMode blend,
+                     SDL_SW_TriangleSpanFunc span_func)
+{
+    TriangleSetup setup[TRIANGLE_CHUNK];
+    const int blendflags = blend_mode_to_copy_flags(blend);
+    int ret = 0;
+    int i, j, n;
+
+    if (dst == NULL) {
+        return -1;
+    }
+
+    for (i = 0; i + 2 < count; ) {
+        /* Set up a chunk of triangles, dropping the ones that draw nothing */
+        n = 0;
+        for (; i + 2 < count && n < TRIANGLE_CHUNK; i += 3) {
+            if (SetupTriangle(&verts[i].dst, &verts[i + 1].dst, &verts[i + 2].dst, &dst->clip_rect, &setup[n])) {
+                setup[n++].first = i;
+            }
+        }
+
+        for (j = 0; j < n; j++) {
+            const TriangleSetup *t = &setup[j];
+            const GeometryFillData *v = &verts[t->first];
+            const int is_uniform = COLOR_EQ(v[0].color, v[1].color) && COLOR_EQ(v[1].color, v[2].color);
+
+            if (!is_8888(dst->format) || SDL_MUSTLOCK(dst) || blendflags < 0 ||
+                (!is_uniform && t->area > SDL_MAX_SINT32 / 255)) {
+                SDL_Point d0 = v[0].dst, d1 = v[1].dst, d2 = v[2].dst;
+                if (SDL_SW_FillTriangle(dst, &d0, &d1, &d2, blend, v[0].color, v[1].color, v[2].color) < 0) {
+                    ret = -1;
+                }
+                continue;
+            }
+
+#define FILL_CASE(flags)                                        \
+            case flags:                                         \
+                if (is_uniform) {                               \
+                    fill_triangle_8888(t, v, dst, flags, 1, span_func); \
+                } else {                                        \
+                    fill_triangle_8888(t, v, dst, flags, 0, span_func); \
+                }                                               \
+                break;
+
+            switch (blendflags) {
+                FILL_CASE(0)
+                FILL_CASE(SDL_COPY_BLEND)
+                FILL_CASE(SDL_COPY_ADD)
+                FILL_CASE(SDL_COPY_MOD)
+                FILL_CASE(SDL_COPY_MUL)
+            }
+#undef FILL_CASE
+        }
+    }
+    return ret;
+}
+
+/* Same-format copy of an unmodulated texture, the fast path of SDL_SW_BlitTriangle() */
+static void
+copy_triangle_8888(const TriangleSetup *t, const TriangleTexCoords *tc, const GeometryCopyData *v,
+                   SDL_Surface *src, SDL_Surface *dst, TriangleSpanFunc span_func)
+{
+    const Uint8 *src_base = (const Uint8 *) src->pixels;
+    const int src_pitch = src->pitch;
+    Uint8 *dst_base = (Uint8 *) dst->pixels;
+    const int dst_pitch = dst->pitch;
+    const int area = t->area;
+    TriangleSpan span;
+
+    if (span_func) {
+        init_span(&span, t, TRIANGLE_SPAN_COPY, dst->format, v[0].color, v[1].color, v[2].color, 0, 1);
+        init_span_texture(&span, src, tc, 0);
+    }
+
+    TRIANGLE_BLOCKS_BEGIN
+    {
+        const int srcx = (w0 * tc->s2s0_x + w1 * tc->s2s1_x + tc->s2_x_area.x) / area;
+        const int srcy = (w0 * tc->s2s0_y + w1 * tc->s2s1_y + tc->s2_x_area.y) / area;
+        *dptr = ((const Uint32 *) (src_base + srcy * src_pitch))[srcx];
+    }
+    TRIANGLE_BLOCKS_END
+}
+
+SDL_FORCE_INLINE void
+blit_triangle_8888(const TriangleSetup *t, const TriangleTexCoords *tc, const GeometryCopyData *v,
+                   SDL_Surface *src, SDL_Surface *dst, int modflags, const int blendflags, const int is_uniform,
+                   TriangleSpanFunc span_func)
+{
+    const SDL_PixelFormat *src_fmt = src->format;
+    const SDL_PixelFormat *fmt = dst->format;
+    const Uint8 *src_base = (const Uint8 *) src->pixels;
+    const int src_pitch = src->pitch;
+    Uint8 *dst_base = (Uint8 *) dst->pixels;
+    const int dst_pitch = dst->pitch;
+    const int area = t->area;
+    const SDL_Color c0 = v[0].color;
+    const SDL_Color c1 = v[1].color;
+    const SDL_Color c2 = v[2].color;
+    TriangleSpan span;
+
+    if (span_func) {
+        init_span(&span, t, TRIANGLE_SPAN_BLIT, fmt, c0, c1, c2, blendflags, is_uniform);
+        init_span_texture(&span, src, tc, modflags);
+    }
+
+    TRIANGLE_BLOCKS_BEGIN
+    {
+        const int srcx = (w0 * tc->s2s0_x + w1 * tc->s2s1_x + tc->s2_x_area.x) / area;
+        const int srcy = (w0 * tc->s2s0_y + w1 * tc->s2s1_y + tc->s2_x_area.y) / area;
+        const Uint32 srcpixel = ((const Uint32 *) (src_base + srcy * src_pitch))[srcx];
+        Uint32 srcR = (srcpixel >> src_fmt->Rshift) & 0xFF;
+        Uint32 srcG = (srcpixel >> src_fmt->Gshift) & 0xFF;
+        Uint32 srcB = (srcpixel >> src_fmt->Bshift) & 0xFF;
+        Uint32 srcA = src_fmt->Amask ? ((srcpixel >> src_fmt->Ashift) & 0xFF) : 0xFF;
+        Uint32 modulateR = c0.r, modulateG = c0.g, modulateB = c0.b, modulateA = c0.a;
+
+        if (!is_uniform) {
+            modulateR = (Uint32) ((w0 * c0.r + w1 * c1.r + w2 * c2.r) / area);
+            modulateG = (Uint32) ((w0 * c0.g + w1 * c1.g + w2 * c2.g) / area);
+            modulateB = (Uint32) ((w0 * c0.b + w1 * c1.b + w2 * c2.b) / area);
+            modulateA = (Uint32) ((w0 * c0.a + w1 * c1.a + w2 * c2.a) / area);
+        }
+        if (modflags & SDL_COPY_MODULATE_COLOR) {
+            srcR = (srcR * modulateR) / 255;
+            srcG = (srcG * modulateG) / 255;
+            srcB = (srcB * modulateB) / 255;
+        }
+        if (modflags & SDL_COPY_MODULATE_ALPHA) {
+            srcA = (srcA * modulateA) / 255;
+        }
+        blend_8888(dptr, fmt, srcR, srcG, srcB, srcA, blendflags);
+    }
+    TRIANGLE_BLOCKS_END
+}
+
+int
+SDL_SW_BlitTriangles(SDL_Surface *src, const GeometryCopyData *verts, int count, SDL_Surface *dst,
+                     SDL_SW_TriangleSpanFunc spans)
+{
+    TriangleSetup setup[TRIANGLE_CHUNK];
+    int blendflags, fast;
+    int ret = 0;
+    int i, j, n;
+
+    if (src == NULL || dst == NULL) {
+        return -1;
+    }
+
+    blendflags = src->map->info.flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    fast = is_8888(src->format) && is_8888(dst->format) && !SDL_MUSTLOCK(src) && !SDL_MUSTLOCK(dst) &&
+           !(src->map->info.flags & SDL_COPY_COLORKEY);
+
+    for (i = 0; i + 2 < count; ) {
+        /* Set up a chunk of triangles, dropping the ones that draw nothing */
+        n = 0;
+        for (; i + 2 < count && n < TRIANGLE_CHUNK; i += 3) {
+            if (SetupTriangle(&verts[i].dst, &verts[i + 1].dst, &verts[i + 2].dst, &dst->clip_rect, &setup[n])) {
+                setup[n++].first = i;
+            }
+        }
+
+        for (j = 0; j < n; j++) {
+            const TriangleSetup *t = &setup[j];
+            const GeometryCopyData *v = &verts[t->first];
+            const SDL_Color c0 = v[0].color, c1 = v[1].color, c2 = v[2].color;
+            const int is_uniform = COLOR_EQ(c0, c1) && COLOR_EQ(c1, c2);
+            /* SDL_SW_BlitTriangle() adjusts the source points, so give it copies */
+            SDL_Point s0 = v[0].src, s1 = v[1].src, s2 = v[2].src;
+            TriangleTexCoords tc;
+            int modflags = 0;
+
+            if (fast) {
+                /* TRIANGLE_GET_TEXTCOORD interpolates up to the max values included, so reduce by 1 */
+                SDL_Rect srcrect;
+                int maxx, maxy;
+                bounding_rect(&s0, &s1, &s2, &srcrect);
+                maxx = srcrect.x + srcrect.w;
+                maxy = srcrect.y + srcrect.h;
+                if (srcrect.w > 0) {
+                    if (s0.x == maxx) s0.x--;
+                    if (s1.x == maxx) s1.x--;
+                    if (s2.x == maxx) s2.x--;
+                }
+                if (srcrect.h > 0) {
+                    if (s0.y == maxy) s0.y--;
+                    if (s1.y == maxy) s1.y--;
+                    if (s2.y == maxy) s2.y--;
+                }
+                tc.s2s0_x = s0.x - s2.x;
+                tc.s2s1_x = s1.x - s2.x;
+                tc.s2s0_y = s0.y - s2.y;
+                tc.s2s1_y = s1.y - s2.y;
+
+                /* the interpolation has to fit in 32 bits */
+                if ((Sint64) t->area * (SDL_abs(tc.s2s0_x) + SDL_abs(tc.s2s1_x) + SDL_abs(s2.x)) > SDL_MAX_SINT32 ||
+                    (Sint64) t->area * (SDL_abs(tc.s2s0_y) + SDL_abs(tc.s2s1_y) + SDL_abs(s2.y)) > SDL_MAX_SINT32 ||
+                    (!is_uniform && t->area > SDL_MAX_SINT32 / 255)) {
+                    s0 = v[0].src;
+                    s1 = v[1].src;
+                    s2 = v[2].src;
+                } else {
+                    TriangleSpanFunc span_func = NULL;
+
+                    tc.s2_x_area.x = s2.x * t->area;
+                    tc.s2_x_area.y = s2.y * t->area;
+
+                    /* the spans' division is exact for texture coordinates from 0 to 2^16 */
+                    if (SDL_min(SDL_min(s0.x, s1.x), SDL_min(s2.x, SDL_min(s0.y, SDL_min(s1.y, s2.y)))) >= 0 &&
+                        SDL_max(SDL_max(s0.x, s1.x), SDL_max(s2.x, SDL_max(s0.y, SDL_max(s1.y, s2.y)))) < 0x10000) {
+                        span_func = spans;
+                    }
+
+                    if (c0.r != 255 || c1.r != 255 || c2.r != 255 ||
+                        c0.g != 255 || c1.g != 255 || c2.g != 255 ||
+                        c0.b != 255 || c1.b != 255 || c2.b != 255) {
+                        modflags |= SDL_COPY_MODULATE_COLOR;
+                    }
+                    if (c0.a != 255 || c1.a != 255 || c2.a != 255) {
+                        modflags |= SDL_COPY_MODULATE_ALPHA;
+                    }
+
+                    if (blendflags == 0 && src->format->format == dst->format->format && modflags == 0) {
+                        copy_triangle_8888(t, &tc, v, src, dst, span_func);
+                        continue;
+                    }
+
+#define BLIT_CASE(flags)                                                        \
+                    case flags:                                                 \
+                        if (is_uniform) {                                       \
+                            blit_triangle_8888(t, &tc, v, src, dst, modflags, flags, 1, span_func); \
+                        } else {                                                \
+                            blit_triangle_8888(t, &tc, v, src, dst, modflags, flags, 0, span_func); \
+                        }                                                       \
+                        break;
+
+                    switch (blendflags) {
+                        BLIT_CASE(0)
+                        BLIT_CASE(SDL_COPY_BLEND)
+                        BLIT_CASE(SDL_COPY_ADD)
+                        BLIT_CASE(SDL_COPY_MOD)
+                        BLIT_CASE(SDL_COPY_MUL)
+                    }
+#undef BLIT_CASE
+                    continue;
+                }
+            }
+
+            {
+                SDL_Point d0 = v[0].dst, d1 = v[1].dst, d2 = v[2].dst;
+                if (SDL_SW_BlitTriangle(src, &s0, &s1, &s2, dst, &d0, &d1, &d2, c0, c1, c2) < 0) {
+                    ret = -1;
+                }
+            }
+        }
+    }
+    return ret;
+}
+
 #endif /* SDL_VIDEO_RENDER_SW && !SDL_RENDER_DISABLED */
 
 /* vi: set ts=4 sw=4 expandtab: */
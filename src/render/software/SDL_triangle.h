@@ -37,6 +37,36 @@ extern int SDL_SW_BlitTriangle(
 
 extern void trianglepoint_2_fixedpoint(SDL_Point *a);
 
+/* Vertices of SDL_RenderGeometry() triangles, as the software renderer queues them */
+typedef struct GeometryFillData
+{
+    SDL_Point dst;
+    SDL_Color color;
+} GeometryFillData;
+
+typedef struct GeometryCopyData
+{
+    SDL_Point src;
+    SDL_Point dst;
+    SDL_Color color;
+} GeometryCopyData;
+
+/* Draws the start of a row of one triangle with SIMD, returning how many pixels it drew */
+struct TriangleSpan;
+typedef int (*SDL_SW_TriangleSpanFunc)(const struct TriangleSpan *span, Uint32 *dptr, int w0, int w1, int w2, int n, int partial);
+
+/* The widest span this CPU has, limited by SDL_HINT_RENDER_SOFTWARE_SIMD, or
+   NULL to draw every pixel with plain C. Renderers choose it once, when they're
+   created, and hand it to every draw, from whichever thread. */
+extern SDL_SW_TriangleSpanFunc SDL_SW_ChooseTriangleSpan(void);
+
+/* Draw count / 3 triangles, three vertices each, in order. The destination
+   points are in fixed point, see trianglepoint_2_fixedpoint(). */
+extern int SDL_SW_FillTriangles(SDL_Surface *dst, const GeometryFillData *verts, int count, SDL_BlendMode blend,
+                                SDL_SW_TriangleSpanFunc span_func);
+extern int SDL_SW_BlitTriangles(SDL_Surface *src, const GeometryCopyData *verts, int count, SDL_Surface *dst,
+                                SDL_SW_TriangleSpanFunc span_func);
+
 #endif /* SDL_triangle_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
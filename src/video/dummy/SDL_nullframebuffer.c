@@ -23,14 +23,16 @@
 #if SDL_VIDEO_DRIVER_DUMMY
 
 #include "../SDL_sysvideo.h"
+#include "../../SDL_hints_c.h"
 #include "SDL_nullframebuffer_c.h"
+#include "SDL_nullscreen.h"
 
 
 #define DUMMY_SURFACE   "_SDL_DummySurface"
 
 int SDL_DUMMY_CreateWindowFramebuffer(_THIS, SDL_Window * window, Uint32 * format, void ** pixels, int *pitch)
 {
-    SDL_Surface *surface;
+    SDL_Surface *surface, *screen = NULL;
     const Uint32 surface_format = SDL_PIXELFORMAT_RGB888;
     int w, h;
 
@@ -43,9 +45,19 @@ int SDL_DUMMY_CreateWindowFramebuffer(_THIS, SDL_Window * window, Uint32 * forma
     if (!surface) {
         return -1;
     }
+    if (SDL_GetStringBoolean(SDL_getenv(DUMMY_SCREEN_ENV), SDL_FALSE)) {
+        screen = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, surface_format);
+        if (!screen) {
+            SDL_FreeSurface(surface);
+            return -1;
+        }
+    }
 
     /* Save the info and return! */
     SDL_SetWindowData(window, DUMMY_SURFACE, surface);
+    if (screen) {
+        SDL_SetWindowData(window, DUMMY_SCREEN, screen);
+    }
     *format = surface_format;
     *pixels = surface->pixels;
     *pitch = surface->pitch;
@@ -55,19 +67,28 @@ int SDL_DUMMY_CreateWindowFramebuffer(_THIS, SDL_Window * window, Uint32 * forma
 int SDL_DUMMY_UpdateWindowFramebuffer(_THIS, SDL_Window * window, const SDL_Rect * rects, int numrects)
 {
     static int frame_number;
-    SDL_Surface *surface;
+    SDL_Surface *surface, *screen;
+    int i;
 
     surface = (SDL_Surface *) SDL_GetWindowData(window, DUMMY_SURFACE);
+    screen = (SDL_Surface *) SDL_GetWindowData(window, DUMMY_SCREEN);
     if (!surface) {
         return SDL_SetError("Couldn't find dummy surface for window");
     }
 
     /* Send the data to the display */
+    if (screen) {
+        for (i = 0; i < numrects; i++) {
+            SDL_Rect srcrect = rects[i];
+            SDL_Rect dstrect = rects[i];
+            SDL_BlitSurface(surface, &srcrect, screen, &dstrect);
+        }
+    }
     if (SDL_getenv("SDL_VIDEO_DUMMY_SAVE_FRAMES")) {
         char file[128];
         SDL_snprintf(file, sizeof(file), "SDL_window%" SDL_PRIu32 "-%8.8d.bmp",
                      SDL_GetWindowID(window), ++frame_number);
-        SDL_SaveBMP(surface, file);
+        SDL_SaveBMP(screen ? screen : surface, file);
     }
     return 0;
 }
@@ -78,6 +99,8 @@ void SDL_DUMMY_DestroyWindowFramebuffer(_THIS, SDL_Window * window)
 
     surface = (SDL_Surface *) SDL_SetWindowData(window, DUMMY_SURFACE, NULL);
     SDL_FreeSurface(surface);
+    surface = (SDL_Surface *) SDL_SetWindowData(window, DUMMY_SCREEN, NULL);
+    SDL_FreeSurface(surface);
 }
 
 #endif /* SDL_VIDEO_DRIVER_DUMMY */
@@ -0,0 +1,32 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2022 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL_nullscreen_h_
+#define SDL_nullscreen_h_
+
+/* Tests can have the dummy driver keep what a display would show: with this
+   set in the environment when a window's framebuffer is created, the window
+   gets an RGB888 surface that only the rects passed to each update reach,
+   under the DUMMY_SCREEN window data key. Off by default, or when set to "0". */
+#define DUMMY_SCREEN_ENV    "SDL_VIDEO_DUMMY_SCREEN"
+#define DUMMY_SCREEN        "_SDL_DummyScreen"
+
+#endif /* SDL_nullscreen_h_ */
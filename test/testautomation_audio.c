@@ -968,6 +968,1809 @@ int audio_openCloseAudioDeviceConnected()
 }
 
 
+/**
+ * \brief Check signal-to-noise ratio of a sine wave resampled through SDL_AudioStream.
+ *
+ * \sa https://wiki.libsdl.org/SDL_NewAudioStream
+ * \sa https://wiki.libsdl.org/SDL_AudioStreamPut
+ * \sa https://wiki.libsdl.org/SDL_AudioStreamGet
+ */
+int audio_resampleLoss()
+{
+  /* Note: use a long input, an imprecise implementation can drift when
+   * accumulating time in floats over many frames. */
+  static const struct {
+    int channels;
+    int freq;
+    int rate_in;
+    int rate_out;
+    int quality;  /* -1 leaves the stream's default. */
+    double signal_to_noise;
+  } test_specs[] = {
+    { 1, 440, 44100, 48000, -1, 60.0 },
+    { 2, 440, 22050, 44100, -1, 50.0 },
+    { 4, 1000, 48000, 44100, -1, 60.0 },
+    { 6, 440, 44100, 48000, -1, 60.0 },
+    { 8, 440, 48000, 44100, -1, 60.0 },
+    { 8, 440, 22050, 48000, -1, 60.0 },
+    { 1, 440, 44100, 48001, -1, 60.0 },  /* too many phases for the table, uses the fallback. */
+    { 2, 440, 44100, 48000, SDL_AUDIO_RESAMPLE_NEAREST, 30.0 },
+    { 2, 440, 44100, 48000, SDL_AUDIO_RESAMPLE_LINEAR, 60.0 },
+    { 2, 440, 44100, 48000, SDL_AUDIO_RESAMPLE_CUBIC, 90.0 },
+    { 2, 440, 44100, 48000, SDL_AUDIO_RESAMPLE_DEFAULT, 60.0 },
+    { 2, 440, 44100, 48000, SDL_AUDIO_RESAMPLE_BEST, 95.0 },
+    { 6, 440, 48000, 44100, SDL_AUDIO_RESAMPLE_CUBIC, 90.0 },
+    { 6, 440, 48000, 44100, SDL_AUDIO_RESAMPLE_BEST, 95.0 },
+    { 3, 440, 44100, 48001, SDL_AUDIO_RESAMPLE_LINEAR, 60.0 },  /* fallback */
+    { 3, 440, 44100, 48001, SDL_AUDIO_RESAMPLE_BEST, 95.0 },  /* fallback */
+  };
+  const int seconds = 5;
+  int t;
+
+  for (t = 0; t < (int) SDL_arraysize(test_specs); t++) {
+    const int channels = test_specs[t].channels;
+    const int rate_in = test_specs[t].rate_in;
+    const int rate_out = test_specs[t].rate_out;
+    const int freq = test_specs[t].freq;
+    const int frames_in = rate_in * seconds;
+    const int len_in = frames_in * channels * (int) sizeof (float);
+    const int len_out = ((int) (((Sint64) frames_in * rate_out) / rate_in) + 1) * channels * (int) sizeof (float);
+    float *buf_in = (float *) SDL_malloc(len_in);
+    float *buf_out = (float *) SDL_malloc(len_out);
+    double signal = 0.0;
+    double noise = 0.0;
+    double snr;
+    SDL_AudioStream *stream;
+    int i, j, frames_out;
+
+    SDLTest_AssertCheck(buf_in != NULL && buf_out != NULL, "Check buffers were allocated");
+    if (buf_in == NULL || buf_out == NULL) {
+      SDL_free(buf_in);
+      SDL_free(buf_out);
+      return TEST_ABORTED;
+    }
+
+    /* Give each channel its own frequency, so mixed up channels show up as noise. */
+    for (i = 0; i < frames_in; i++) {
+      for (j = 0; j < channels; j++) {
+        buf_in[(i * channels) + j] = (float) SDL_sin(2.0 * M_PI * (freq + (j * 100)) * i / rate_in);
+      }
+    }
+
+    stream = SDL_NewAudioStream(AUDIO_F32SYS, channels, rate_in, AUDIO_F32SYS, channels, rate_out);
+    SDLTest_AssertPass("Call to SDL_NewAudioStream(AUDIO_F32SYS, %i, %i, AUDIO_F32SYS, %i, %i)", channels, rate_in, channels, rate_out);
+    SDLTest_AssertCheck(stream != NULL, "Validate stream is not NULL");
+    if (stream == NULL) {
+      SDL_free(buf_in);
+      SDL_free(buf_out);
+      return TEST_ABORTED;
+    }
+
+    if (test_specs[t].quality >= 0) {
+      SDLTest_AssertCheck(SDL_AudioStreamSetResampleQuality(stream, (SDL_AudioResampleQuality) test_specs[t].quality) == 0,
+                          "Set resample quality %i", test_specs[t].quality);
+    }
+
+    SDLTest_AssertCheck(SDL_AudioStreamPut(stream, buf_in, len_in) == 0, "Put %i bytes into the stream", len_in);
+    SDLTest_AssertCheck(SDL_AudioStreamFlush(stream) == 0, "Flush the stream");
+    frames_out = SDL_AudioStreamGet(stream, buf_out, len_out) / (channels * (int) sizeof (float));
+    SDLTest_AssertCheck(frames_out > rate_out, "Got more than one second of resampled audio; got: %i frames", frames_out);
+    SDL_FreeAudioStream(stream);
+
+    /* Skip the start, where the resampler is still reading leading silence. */
+    for (i = 64; i < frames_out; i++) {
+      for (j = 0; j < channels; j++) {
+        const double target = SDL_sin(2.0 * M_PI * (freq + (j * 100)) * i / rate_out);
+        const double error = buf_out[(i * channels) + j] - target;
+        signal += target * target;
+        noise += error * error;
+      }
+    }
+
+    snr = (noise > 0.0) ? 10.0 * SDL_log10(signal / noise) : 999.0;
+    SDLTest_AssertCheck(snr >= test_specs[t].signal_to_noise,
+                        "Check signal-to-noise ratio of %i channel(s) %i Hz -> %i Hz, quality %i; expected: >=%.1f dB, got: %.1f dB",
+                        channels, rate_in, rate_out, test_specs[t].quality, test_specs[t].signal_to_noise, snr);
+
+    SDL_free(buf_in);
+    SDL_free(buf_out);
+  }
+
+  return TEST_COMPLETED;
+}
+
+
+/**
+ * \brief Checks calls with invalid input to SDL_AudioStreamSetResampleQuality
+ *
+ * \sa https://wiki.libsdl.org/SDL_AudioStreamSetResampleQuality
+ */
+int audio_setResampleQualityNegative()
+{
+  SDL_AudioStream *stream;
+  int result;
+
+  result = SDL_AudioStreamSetResampleQuality(NULL, SDL_AUDIO_RESAMPLE_DEFAULT);
+  SDLTest_AssertPass("Call to SDL_AudioStreamSetResampleQuality(NULL, SDL_AUDIO_RESAMPLE_DEFAULT)");
+  SDLTest_AssertCheck(result == -1, "Verify result value; expected: -1, got: %i", result);
+
+  stream = SDL_NewAudioStream(AUDIO_S16SYS, 2, 22050, AUDIO_S16SYS, 2, 44100);
+  SDLTest_AssertPass("Call to SDL_NewAudioStream(AUDIO_S16SYS, 2, 22050, AUDIO_S16SYS, 2, 44100)");
+  SDLTest_AssertCheck(stream != NULL, "Validate stream is not NULL");
+  if (stream == NULL) {
+    return TEST_ABORTED;
+  }
+
+  result = SDL_AudioStreamSetResampleQuality(stream, (SDL_AudioResampleQuality) -1);
+  SDLTest_AssertPass("Call to SDL_AudioStreamSetResampleQuality(stream, -1)");
+  SDLTest_AssertCheck(result == -1, "Verify result value; expected: -1, got: %i", result);
+
+  result = SDL_AudioStreamSetResampleQuality(stream, (SDL_AudioResampleQuality) (SDL_AUDIO_RESAMPLE_BEST + 1));
+  SDLTest_AssertPass("Call to SDL_AudioStreamSetResampleQuality(stream, SDL_AUDIO_RESAMPLE_BEST + 1)");
+  SDLTest_AssertCheck(result == -1, "Verify result value; expected: -1, got: %i", result);
+
+  SDL_FreeAudioStream(stream);
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Put and get stream data in place with SDL_AudioStreamBeginPut/EndPut and SDL_AudioStreamBeginGet/EndGet
+ *
+ * \sa https://wiki.libsdl.org/SDL_AudioStreamBeginPut
+ * \sa https://wiki.libsdl.org/SDL_AudioStreamBeginGet
+ */
+int audio_streamSpans()
+{
+  const int frames = 10000;
+  const int len_in = frames * 2 * (int) sizeof (Sint16);
+  Sint16 *buf_in = (Sint16 *) SDL_malloc(len_in);
+  float *buf_out = (float *) SDL_malloc(frames * 2 * sizeof (float));
+  SDL_AudioStream *stream;
+  int i, t, result, put, got;
+
+  SDLTest_AssertCheck(buf_in != NULL && buf_out != NULL, "Check buffers were allocated");
+  if (buf_in == NULL || buf_out == NULL) {
+    SDL_free(buf_in);
+    SDL_free(buf_out);
+    return TEST_ABORTED;
+  }
+
+  for (i = 0; i < frames * 2; i++) {
+    buf_in[i] = (Sint16) (i - frames);
+  }
+
+  /* t == 0 is a passthrough stream, t == 1 converts S16 to F32 at the same rate. */
+  for (t = 0; t < 2; t++) {
+    const SDL_AudioFormat dst_format = (t == 0) ? AUDIO_S16SYS : AUDIO_F32SYS;
+    const int dst_frame_size = (t == 0) ? 4 : 8;
+    void *span = NULL;
+    const void *out = NULL;
+    SDL_bool matched = SDL_TRUE;
+
+    stream = SDL_NewAudioStream(AUDIO_S16SYS, 2, 44100, dst_format, 2, 44100);
+    SDLTest_AssertPass("Call to SDL_NewAudioStream(AUDIO_S16SYS, 2, 44100, 0x%.4x, 2, 44100)", dst_format);
+    SDLTest_AssertCheck(stream != NULL, "Validate stream is not NULL");
+    if (stream == NULL) {
+      SDL_free(buf_in);
+      SDL_free(buf_out);
+      return TEST_ABORTED;
+    }
+
+    result = SDL_AudioStreamEndPut(stream, 4);
+    SDLTest_AssertCheck(result == -1, "Verify SDL_AudioStreamEndPut() without SDL_AudioStreamBeginPut() fails; got: %i", result);
+
+    for (put = 0; put < len_in; put += result) {
+      const int want = len_in - put;
+      result = SDL_AudioStreamBeginPut(stream, want, &span);
+      if (result <= 0 || result > want || (result % 4) != 0 || span == NULL) {
+        SDLTest_AssertCheck(SDL_FALSE, "Verify SDL_AudioStreamBeginPut(stream, %i) result; got: %i", want, result);
+        break;
+      }
+      if (put == 0) {
+        const int busy = SDL_AudioStreamPut(stream, buf_in, 4);
+        SDLTest_AssertCheck(busy == -1, "Verify SDL_AudioStreamPut() fails while a put is in progress; got: %i", busy);
+      }
+      SDL_memcpy(span, ((const Uint8 *) buf_in) + put, result);
+      SDLTest_AssertCheck(SDL_AudioStreamEndPut(stream, result) == 0, "Call to SDL_AudioStreamEndPut(stream, %i)", result);
+    }
+
+    result = SDL_AudioStreamAvailable(stream);
+    SDLTest_AssertCheck(result == frames * dst_frame_size, "Verify available bytes; expected: %i, got: %i", frames * dst_frame_size, result);
+
+    for (got = 0; (result = SDL_AudioStreamBeginGet(stream, &out)) > 0; got += result) {
+      if ((result % dst_frame_size) != 0 || (got + result) > frames * dst_frame_size) {
+        SDLTest_AssertCheck(SDL_FALSE, "Verify SDL_AudioStreamBeginGet() result; got: %i", result);
+        break;
+      }
+      if (t == 0) {
+        matched = matched && (SDL_memcmp(out, ((const Uint8 *) buf_in) + got, result) == 0);
+      } else {
+        SDL_memcpy(((Uint8 *) buf_out) + got, out, result);
+      }
+      SDLTest_AssertCheck(SDL_AudioStreamEndGet(stream, result) == result, "Call to SDL_AudioStreamEndGet(stream, %i)", result);
+    }
+    SDLTest_AssertCheck(got == frames * dst_frame_size, "Verify all data was read back; expected: %i, got: %i", frames * dst_frame_size, got);
+    SDLTest_AssertCheck(out == NULL, "Verify SDL_AudioStreamBeginGet() on an empty stream gives NULL");
+
+    if (t == 1) {
+      for (i = 0; i < frames * 2; i++) {
+        const float expected = buf_in[i] / 32768.0f;
+        if (SDL_fabs(buf_out[i] - expected) > 1e-6) {
+          matched = SDL_FALSE;
+          break;
+        }
+      }
+    }
+    SDLTest_AssertCheck(matched, "Verify data read back matches what was put in");
+
+    SDL_FreeAudioStream(stream);
+  }
+
+  SDL_free(buf_in);
+  SDL_free(buf_out);
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Queue audio to a playback device while its audio thread drains it
+ *
+ * \sa https://wiki.libsdl.org/SDL_QueueAudio
+ * \sa https://wiki.libsdl.org/SDL_GetQueuedAudioSize
+ * \sa https://wiki.libsdl.org/SDL_ClearQueuedAudio
+ */
+int audio_queueAudio()
+{
+  Uint8 chunk[1000];
+  SDL_AudioSpec desired, obtained;
+  SDL_AudioDeviceID id;
+  Uint32 queued, total = 0;
+  int i, result;
+
+  SDL_memset(chunk, 0, sizeof (chunk));
+
+  desired.freq = 22050;
+  desired.format = AUDIO_S16SYS;
+  desired.channels = 2;
+  desired.samples = 512;
+  desired.callback = NULL;  /* queue audio instead. */
+  desired.userdata = NULL;
+
+  id = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+  SDLTest_AssertPass("SDL_OpenAudioDevice(NULL, 0, ...)");
+  if (id < 2) {
+    SDLTest_Log("No device to test with: %s", SDL_GetError());
+    return TEST_SKIPPED;
+  }
+
+  /* More than fits in one queue packet, so packets get linked and recycled. */
+  for (i = 0; i < 100; i++) {
+    result = SDL_QueueAudio(id, chunk, sizeof (chunk));
+    if (result != 0) {
+      SDLTest_AssertCheck(result == 0, "Call to SDL_QueueAudio(); expected: 0, got: %i", result);
+      break;
+    }
+    total += sizeof (chunk);
+  }
+  queued = SDL_GetQueuedAudioSize(id);
+  SDLTest_AssertCheck(queued == total, "Verify queued size while paused; expected: %u, got: %u", (unsigned int) total, (unsigned int) queued);
+
+  SDL_ClearQueuedAudio(id);
+  queued = SDL_GetQueuedAudioSize(id);
+  SDLTest_AssertCheck(queued == 0, "Verify queued size after SDL_ClearQueuedAudio(); expected: 0, got: %u", (unsigned int) queued);
+
+  /* A quarter second of audio, queued while the device plays. */
+  SDL_PauseAudioDevice(id, 0);
+  for (i = 0; i < 22; i++) {
+    SDL_QueueAudio(id, chunk, sizeof (chunk));
+  }
+  for (i = 0; (i < 200) && (SDL_GetQueuedAudioSize(id) > 0); i++) {
+    SDL_Delay(10);
+  }
+  queued = SDL_GetQueuedAudioSize(id);
+  SDLTest_AssertCheck(queued == 0, "Verify the device drained the queue; expected: 0, got: %u", (unsigned int) queued);
+
+  SDL_CloseAudioDevice(id);
+  SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Mix S16 and F32 audio and compare to the per-sample formula
+ *
+ * \sa https://wiki.libsdl.org/SDL_MixAudioFormat
+ */
+int audio_mixAudioFormat()
+{
+  /* odd lengths, so vectorized mixers have leftovers to handle too. */
+  const int samples = 1021;
+  const int volumes[] = { 1, 37, 64, 127, SDL_MIX_MAXVOLUME };
+  Sint16 *src16 = (Sint16 *) SDL_malloc(samples * sizeof (Sint16));
+  Sint16 *dst16 = (Sint16 *) SDL_malloc(samples * sizeof (Sint16));
+  Sint16 *expected16 = (Sint16 *) SDL_malloc(samples * sizeof (Sint16));
+  float *src32 = (float *) SDL_malloc(samples * sizeof (float));
+  float *dst32 = (float *) SDL_malloc(samples * sizeof (float));
+  float *expected32 = (float *) SDL_malloc(samples * sizeof (float));
+  int i, v;
+
+  SDLTest_AssertCheck(src16 && dst16 && expected16 && src32 && dst32 && expected32, "Check buffers were allocated");
+  if (!src16 || !dst16 || !expected16 || !src32 || !dst32 || !expected32) {
+    SDL_free(src16);
+    SDL_free(dst16);
+    SDL_free(expected16);
+    SDL_free(src32);
+    SDL_free(dst32);
+    SDL_free(expected32);
+    return TEST_ABORTED;
+  }
+
+  for (v = 0; v < (int) SDL_arraysize(volumes); v++) {
+    const int volume = volumes[v];
+    int mismatches16 = 0;
+    int mismatches32 = 0;
+
+    for (i = 0; i < samples; i++) {
+      int sample16;
+      double sample32;
+
+      src16[i] = SDLTest_RandomSint16();
+      dst16[i] = SDLTest_RandomSint16();
+      src32[i] = SDLTest_RandomUnitFloat() * 4.0f - 2.0f;
+      dst32[i] = SDLTest_RandomUnitFloat() * 4.0f - 2.0f;
+      if (i == 3) {
+        src32[i] = dst32[i] = 3.0e38f;  /* overflows, and should clamp. */
+      }
+
+      /* volume is scaled toward zero, then the sum is clamped. */
+      sample16 = ((src16[i] * volume) / SDL_MIX_MAXVOLUME) + dst16[i];
+      expected16[i] = (Sint16) SDL_max(SDL_MIN_SINT16, SDL_min(SDL_MAX_SINT16, sample16));
+      sample32 = ((double) ((src32[i] * (float) volume) * (1.0f / SDL_MIX_MAXVOLUME))) + dst32[i];
+      expected32[i] = (float) SDL_max(-3.402823466e+38F, SDL_min(3.402823466e+38F, sample32));
+    }
+
+    SDL_MixAudioFormat((Uint8 *) dst16, (const Uint8 *) src16, AUDIO_S16SYS, samples * sizeof (Sint16), volume);
+    SDL_MixAudioFormat((Uint8 *) dst32, (const Uint8 *) src32, AUDIO_F32SYS, samples * sizeof (float), volume);
+    SDLTest_AssertPass("Call to SDL_MixAudioFormat() with volume %i", volume);
+
+    for (i = 0; i < samples; i++) {
+      mismatches16 += (dst16[i] != expected16[i]) ? 1 : 0;
+      mismatches32 += (dst32[i] != expected32[i]) ? 1 : 0;
+    }
+    SDLTest_AssertCheck(mismatches16 == 0 && mismatches32 == 0, "Verify mixed samples; expected: 0 mismatches, got: %i (S16), %i (F32)", mismatches16, mismatches32);
+  }
+
+  SDL_free(src16);
+  SDL_free(dst16);
+  SDL_free(expected16);
+  SDL_free(src32);
+  SDL_free(dst32);
+  SDL_free(expected32);
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Mix several sources at once and compare to mixing them one at a time
+ *
+ * \sa https://wiki.libsdl.org/SDL_MixAudioSources
+ */
+int audio_mixAudioSources()
+{
+  /* more than one mixing block, with an odd number of stereo frames. */
+  const int frames = 1501;
+  const int samples = frames * 2;
+  const int volumes[] = { SDL_MIX_MAXVOLUME, 37, 0, 200, 64 };
+  const int num_sources = (int) SDL_arraysize(volumes);
+  SDL_AudioMixSource sources[5];
+  Sint16 *src16 = (Sint16 *) SDL_malloc(num_sources * samples * sizeof (Sint16));
+  Sint16 *dst16 = (Sint16 *) SDL_malloc(samples * sizeof (Sint16));
+  Sint16 *expected16 = (Sint16 *) SDL_malloc(samples * sizeof (Sint16));
+  float *src32 = (float *) SDL_malloc(num_sources * samples * sizeof (float));
+  float *dst32 = (float *) SDL_malloc(samples * sizeof (float));
+  float *expected32 = (float *) SDL_malloc(samples * sizeof (float));
+  int mismatches16 = 0;
+  int mismatches32 = 0;
+  int i, s, result;
+
+  SDLTest_AssertCheck(src16 && dst16 && expected16 && src32 && dst32 && expected32, "Check buffers were allocated");
+  if (!src16 || !dst16 || !expected16 || !src32 || !dst32 || !expected32) {
+    SDL_free(src16);
+    SDL_free(dst16);
+    SDL_free(expected16);
+    SDL_free(src32);
+    SDL_free(dst32);
+    SDL_free(expected32);
+    return TEST_ABORTED;
+  }
+
+  /* small enough that nothing clips, so clamping once at the end matches clamping every time. */
+  for (i = 0; i < num_sources * samples; i++) {
+    src16[i] = (Sint16) SDLTest_RandomIntegerInRange(-4000, 4000);
+    src32[i] = SDLTest_RandomUnitFloat() * 0.2f - 0.1f;
+  }
+  for (i = 0; i < samples; i++) {
+    dst16[i] = expected16[i] = (Sint16) SDLTest_RandomIntegerInRange(-4000, 4000);
+    dst32[i] = expected32[i] = SDLTest_RandomUnitFloat() * 0.2f - 0.1f;
+  }
+
+  /* Case 1: centered sources match SDL_MixAudioFormat() one at a time. */
+  for (s = 0; s < num_sources; s++) {
+    const int volume = SDL_min(volumes[s], SDL_MIX_MAXVOLUME);
+    SDL_MixAudioFormat((Uint8 *) expected16, (const Uint8 *) (src16 + s * samples), AUDIO_S16SYS, samples * sizeof (Sint16), volume);
+    SDL_MixAudioFormat((Uint8 *) expected32, (const Uint8 *) (src32 + s * samples), AUDIO_F32SYS, samples * sizeof (float), volume);
+  }
+
+  for (s = 0; s < num_sources; s++) {
+    sources[s].src = (const Uint8 *) (src16 + s * samples);
+    sources[s].volume = volumes[s];
+    sources[s].pan = 0.0f;
+  }
+  result = SDL_MixAudioSources((Uint8 *) dst16, sources, num_sources, AUDIO_S16SYS, 2, samples * sizeof (Sint16));
+  SDLTest_AssertPass("Call to SDL_MixAudioSources() with AUDIO_S16SYS");
+  SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %i", result);
+
+  for (s = 0; s < num_sources; s++) {
+    sources[s].src = (const Uint8 *) (src32 + s * samples);
+  }
+  result = SDL_MixAudioSources((Uint8 *) dst32, sources, num_sources, AUDIO_F32SYS, 2, samples * sizeof (float));
+  SDLTest_AssertPass("Call to SDL_MixAudioSources() with AUDIO_F32SYS");
+  SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %i", result);
+
+  for (i = 0; i < samples; i++) {
+    mismatches16 += (dst16[i] != expected16[i]) ? 1 : 0;
+    mismatches32 += (dst32[i] != expected32[i]) ? 1 : 0;
+  }
+  SDLTest_AssertCheck(mismatches16 == 0 && mismatches32 == 0, "Verify mixed samples; expected: 0 mismatches, got: %i (S16), %i (F32)", mismatches16, mismatches32);
+
+  /* Case 2: a source panned hard left leaves the right channel alone. */
+  SDL_memcpy(expected32, dst32, samples * sizeof (float));
+  sources[0].src = (const Uint8 *) src32;
+  sources[0].volume = SDL_MIX_MAXVOLUME;
+  sources[0].pan = -1.0f;
+  result = SDL_MixAudioSources((Uint8 *) dst32, sources, 1, AUDIO_F32SYS, 2, samples * sizeof (float));
+  SDLTest_AssertPass("Call to SDL_MixAudioSources() panned hard left");
+  SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %i", result);
+  mismatches32 = 0;
+  for (i = 1; i < samples; i += 2) {
+    mismatches32 += (dst32[i] != expected32[i]) ? 1 : 0;
+  }
+  SDLTest_AssertCheck(mismatches32 == 0, "Verify right channel is untouched; expected: 0 changes, got: %i", mismatches32);
+
+  /* Case 3: invalid parameters. */
+  result = SDL_MixAudioSources(NULL, sources, 1, AUDIO_F32SYS, 2, samples * sizeof (float));
+  SDLTest_AssertCheck(result == -1, "Verify result value with NULL dst; expected: -1, got: %i", result);
+  result = SDL_MixAudioSources((Uint8 *) dst32, NULL, 1, AUDIO_F32SYS, 2, samples * sizeof (float));
+  SDLTest_AssertCheck(result == -1, "Verify result value with NULL sources; expected: -1, got: %i", result);
+  result = SDL_MixAudioSources((Uint8 *) dst32, sources, 1, AUDIO_F32SYS, 0, samples * sizeof (float));
+  SDLTest_AssertCheck(result == -1, "Verify result value with 0 channels; expected: -1, got: %i", result);
+
+  SDL_free(src16);
+  SDL_free(dst16);
+  SDL_free(expected16);
+  SDL_free(src32);
+  SDL_free(dst32);
+  SDL_free(expected32);
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Convert between each integer format and AUDIO_F32SYS and check every sample
+ *
+ * \sa https://wiki.libsdl.org/SDL_ConvertAudio
+ */
+int audio_convertSampleFormats()
+{
+  const SDL_AudioFormat formats[] = { AUDIO_S8, AUDIO_U8, AUDIO_S16SYS, AUDIO_U16SYS, AUDIO_S32SYS };
+  const char *names[] = { "AUDIO_S8", "AUDIO_U8", "AUDIO_S16SYS", "AUDIO_U16SYS", "AUDIO_S32SYS" };
+  /* odd length, so vectorized converters have leftovers to handle too. */
+  const int samples = 1021;
+  Uint8 *buffer = (Uint8 *) SDL_malloc(samples * sizeof (float) * 2 + 64);
+  float *expected = (float *) SDL_malloc(samples * sizeof (float));
+  SDL_AudioCVT cvt;
+  int f, offset, i, result;
+
+  SDLTest_AssertCheck(buffer && expected, "Check buffers were allocated");
+  if (!buffer || !expected) {
+    SDL_free(buffer);
+    SDL_free(expected);
+    return TEST_ABORTED;
+  }
+
+  for (f = 0; f < (int) SDL_arraysize(formats); f++) {
+    /* different offsets move the start of the buffer around, so alignment
+       prologues in the vectorized converters get exercised too. */
+    for (offset = 0; offset < 64; offset += 12) {
+      const int size = SDL_AUDIO_BITSIZE(formats[f]) / 8;
+      const int tolerance = (formats[f] == AUDIO_U16SYS) ? 2 : 1;
+      int mismatches = 0;
+
+      /* Case 1: integer to float, which should be exact. */
+      result = SDL_BuildAudioCVT(&cvt, formats[f], 1, 44100, AUDIO_F32SYS, 1, 44100);
+      SDLTest_AssertCheck(result == 1, "Verify result value; expected: 1, got: %i", result);
+      cvt.buf = buffer + offset;
+      cvt.len = samples * size;
+      for (i = 0; i < samples; i++) {
+        switch (formats[f]) {
+        case AUDIO_S8: ((Sint8 *) cvt.buf)[i] = (Sint8) SDLTest_RandomSint8(); expected[i] = ((Sint8 *) cvt.buf)[i] * (1.0f / 128.0f); break;
+        case AUDIO_U8: cvt.buf[i] = SDLTest_RandomUint8(); expected[i] = (cvt.buf[i] * (1.0f / 128.0f)) - 1.0f; break;
+        case AUDIO_S16SYS: ((Sint16 *) cvt.buf)[i] = SDLTest_RandomSint16(); expected[i] = ((Sint16 *) cvt.buf)[i] * (1.0f / 32768.0f); break;
+        case AUDIO_U16SYS: ((Uint16 *) cvt.buf)[i] = SDLTest_RandomUint16(); expected[i] = (((Uint16 *) cvt.buf)[i] * (1.0f / 32768.0f)) - 1.0f; break;
+        default: ((Sint32 *) cvt.buf)[i] = SDLTest_RandomSint32(); expected[i] = (((Sint32 *) cvt.buf)[i] >> 8) * 0.00000011920930376163766f; break;
+        }
+      }
+      result = SDL_ConvertAudio(&cvt);
+      SDLTest_AssertCheck(result == 0, "Verify result value of %s to AUDIO_F32SYS at offset %i; expected: 0, got: %i", names[f], offset, result);
+      SDLTest_AssertCheck(cvt.len_cvt == samples * (int) sizeof (float), "Verify converted length; expected: %i, got: %i", samples * (int) sizeof (float), cvt.len_cvt);
+      for (i = 0; i < samples; i++) {
+        mismatches += (((float *) cvt.buf)[i] != expected[i]) ? 1 : 0;
+      }
+      SDLTest_AssertCheck(mismatches == 0, "Verify converted samples; expected: 0 mismatches, got: %i", mismatches);
+
+      /* Case 2: float to integer, clamping out of range samples. Vectorized
+         code rounds where the scalar code truncates, so allow one step of
+         error; two for AUDIO_U16SYS, which SIMD offsets by 32768, not 32767. */
+      result = SDL_BuildAudioCVT(&cvt, AUDIO_F32SYS, 1, 44100, formats[f], 1, 44100);
+      SDLTest_AssertCheck(result == 1, "Verify result value; expected: 1, got: %i", result);
+      cvt.buf = buffer + offset;
+      cvt.len = samples * sizeof (float);
+      for (i = 0; i < samples; i++) {
+        expected[i] = SDLTest_RandomUnitFloat() * 3.0f - 1.5f;
+      }
+      expected[0] = 1.0f;
+      expected[1] = -1.0f;
+      SDL_memcpy(cvt.buf, expected, samples * sizeof (float));
+      result = SDL_ConvertAudio(&cvt);
+      SDLTest_AssertCheck(result == 0, "Verify result value of AUDIO_F32SYS to %s at offset %i; expected: 0, got: %i", names[f], offset, result);
+      SDLTest_AssertCheck(cvt.len_cvt == samples * size, "Verify converted length; expected: %i, got: %i", samples * size, cvt.len_cvt);
+      mismatches = 0;
+      for (i = 0; i < samples; i++) {
+        const float sample = SDL_max(-1.0f, SDL_min(1.0f, expected[i]));
+        int got, want;
+        switch (formats[f]) {
+        case AUDIO_S8: got = ((Sint8 *) cvt.buf)[i]; want = (sample <= -1.0f) ? -128 : (int) (sample * 127.0f); break;
+        case AUDIO_U8: got = cvt.buf[i]; want = (sample >= 1.0f) ? 255 : (int) ((sample + 1.0f) * 127.0f); break;
+        case AUDIO_S16SYS: got = ((Sint16 *) cvt.buf)[i]; want = (sample <= -1.0f) ? -32768 : (int) (sample * 32767.0f); break;
+        case AUDIO_U16SYS: got = ((Uint16 *) cvt.buf)[i]; want = (sample >= 1.0f) ? 65535 : (int) ((sample + 1.0f) * 32767.0f); break;
+        default: got = ((Sint32 *) cvt.buf)[i] >> 8; want = (sample >= 1.0f) ? 8388607 : ((sample <= -1.0f) ? -8388608 : (int) (sample * 8388607.0f)); break;
+        }
+        mismatches += ((got - want) > tolerance || (want - got) > tolerance) ? 1 : 0;
+      }
+      SDLTest_AssertCheck(mismatches == 0, "Verify converted samples; expected: 0 mismatches, got: %i", mismatches);
+    }
+  }
+
+  SDL_free(buffer);
+  SDL_free(expected);
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Convert large buffers, which SDL converts a chunk at a time, and check them against running each filter over the whole buffer
+ *
+ * \sa https://wiki.libsdl.org/SDL_ConvertAudio
+ */
+int audio_convertAudioChunked()
+{
+  const struct {
+      SDL_AudioFormat src_format; Uint8 src_channels; int src_rate;
+      SDL_AudioFormat dst_format; Uint8 dst_channels; int dst_rate;
+  } cases[] = {
+      { AUDIO_S16SYS, 2, 44100, AUDIO_F32SYS, 6, 48000 },
+      { AUDIO_S16MSB, 6, 48000, AUDIO_F32MSB, 2, 48000 },
+      { AUDIO_U8, 1, 22050, AUDIO_F32SYS, 8, 48000 },
+      { AUDIO_F32SYS, 4, 96000, AUDIO_F32LSB, 1, 44100 },
+      { AUDIO_S32LSB, 3, 44100, AUDIO_F32SYS, 4, 44101 }
+  };
+  /* not a multiple of the chunk size, so there's a partial chunk at the end. */
+  const int frames = 48000 + 7;
+  SDL_AudioCVT cvt, expected;
+  int c, i, result;
+
+  for (c = 0; c < (int) SDL_arraysize(cases); c++) {
+    const int len = frames * cases[c].src_channels * (SDL_AUDIO_BITSIZE(cases[c].src_format) / 8);
+    Uint8 *buf, *expectedbuf;
+
+    result = SDL_BuildAudioCVT(&cvt, cases[c].src_format, cases[c].src_channels, cases[c].src_rate,
+                               cases[c].dst_format, cases[c].dst_channels, cases[c].dst_rate);
+    SDLTest_AssertCheck(result == 1, "Verify result value of case %i; expected: 1, got: %i", c, result);
+    if (result != 1) {
+      continue;
+    }
+
+    buf = (Uint8 *) SDL_malloc(len * cvt.len_mult);
+    expectedbuf = (Uint8 *) SDL_malloc(len * cvt.len_mult);
+    SDLTest_AssertCheck(buf && expectedbuf, "Check buffers were allocated");
+    if (!buf || !expectedbuf) {
+      SDL_free(buf);
+      SDL_free(expectedbuf);
+      return TEST_ABORTED;
+    }
+
+    if (SDL_AUDIO_ISFLOAT(cases[c].src_format)) {
+      for (i = 0; i < len / (int) sizeof (float); i++) {
+        ((float *) buf)[i] = SDLTest_RandomUnitFloat() * 2.0f - 1.0f;
+      }
+    } else {
+      for (i = 0; i < len; i++) {
+        buf[i] = SDLTest_RandomUint8();
+      }
+    }
+    SDL_memcpy(expectedbuf, buf, len);
+
+    /* Run the filters one after another over the whole buffer, like SDL_ConvertAudio() does for small buffers. */
+    expected = cvt;
+    expected.buf = expectedbuf;
+    expected.len = len;
+    expected.len_cvt = len;
+    expected.filter_index = 0;
+    expected.filters[0](&expected, expected.src_format);
+
+    /* Converting to float doesn't round, so the results should match exactly. */
+    cvt.buf = buf;
+    cvt.len = len;
+    result = SDL_ConvertAudio(&cvt);
+    SDLTest_AssertCheck(result == 0, "Verify result value of case %i; expected: 0, got: %i", c, result);
+    SDLTest_AssertCheck(cvt.len_cvt == expected.len_cvt, "Verify converted length; expected: %i, got: %i", expected.len_cvt, cvt.len_cvt);
+    SDLTest_AssertCheck(SDL_memcmp(cvt.buf, expected.buf, SDL_min(cvt.len_cvt, expected.len_cvt)) == 0, "Verify converted samples match");
+
+    SDL_free(buf);
+    SDL_free(expectedbuf);
+  }
+
+  return TEST_COMPLETED;
+}
+
+/* Reads sample i of buf and scales it to a signed 16-bit value, the way integer format conversions do. */
+static Sint32 _readSampleAsS16(const Uint8 *buf, SDL_AudioFormat format, int i)
+{
+  const int size = SDL_AUDIO_BITSIZE(format) / 8;
+  Uint32 value = 0;
+  int k;
+
+  for (k = 0; k < size; k++) {
+    value = (value << 8) | buf[(i * size) + (SDL_AUDIO_ISBIGENDIAN(format) ? k : (size - 1 - k))];
+  }
+  if (!SDL_AUDIO_ISSIGNED(format)) {
+    value ^= 1u << ((size * 8) - 1);  /* flip the sign bit. */
+  }
+
+  switch (size) {
+  case 1: return ((Sint32) (Sint8) value) * 256;
+  case 2: return (Sint16) value;
+  default: return ((Sint32) value) >> 16;
+  }
+}
+
+/**
+ * \brief Convert between integer formats, which doesn't go through float, and check every sample
+ *
+ * \sa https://wiki.libsdl.org/SDL_ConvertAudio
+ */
+int audio_convertIntegerFormats()
+{
+  const SDL_AudioFormat formats[] = { AUDIO_S8, AUDIO_U8, AUDIO_S16LSB, AUDIO_S16MSB, AUDIO_U16LSB, AUDIO_U16MSB, AUDIO_S32LSB, AUDIO_S32MSB };
+  /* odd length, so vectorized converters have leftovers to handle too. */
+  const int samples = 1021;
+  Uint8 *buffer = (Uint8 *) SDL_malloc(samples * 4 * 4 + 64);
+  Uint8 *source = (Uint8 *) SDL_malloc(samples * 4);
+  SDL_AudioCVT cvt;
+  int s, d, i, result;
+
+  SDLTest_AssertCheck(buffer && source, "Check buffers were allocated");
+  if (!buffer || !source) {
+    SDL_free(buffer);
+    SDL_free(source);
+    return TEST_ABORTED;
+  }
+
+  for (s = 0; s < (int) SDL_arraysize(formats); s++) {
+    for (d = 0; d < (int) SDL_arraysize(formats); d++) {
+      const SDL_AudioFormat src_format = formats[s];
+      const SDL_AudioFormat dst_format = formats[d];
+      const int src_size = SDL_AUDIO_BITSIZE(src_format) / 8;
+      const int dst_size = SDL_AUDIO_BITSIZE(dst_format) / 8;
+      const int offset = (s * 3 + d * 5) % 64;  /* move the alignment around. */
+      int mismatches = 0;
+
+      /* 32-bit to 32-bit keeps all 32 bits, so it doesn't fit this check. */
+      if (s == d || (src_size == 4 && dst_size == 4)) {
+        continue;
+      }
+
+      result = SDL_BuildAudioCVT(&cvt, src_format, 1, 44100, dst_format, 1, 44100);
+      SDLTest_AssertCheck(result == 1, "Verify result value of 0x%.4x to 0x%.4x; expected: 1, got: %i", src_format, dst_format, result);
+      for (i = 0; i < samples * src_size; i++) {
+        source[i] = SDLTest_RandomUint8();
+      }
+      cvt.buf = buffer + offset;
+      cvt.len = samples * src_size;
+      SDL_memcpy(cvt.buf, source, cvt.len);
+      result = SDL_ConvertAudio(&cvt);
+      SDLTest_AssertCheck(result == 0, "Verify result value of 0x%.4x to 0x%.4x; expected: 0, got: %i", src_format, dst_format, result);
+      SDLTest_AssertCheck(cvt.len_cvt == samples * dst_size, "Verify converted length; expected: %i, got: %i", samples * dst_size, cvt.len_cvt);
+
+      /* Integer conversions shift and flip sign bits, so they should be exact. */
+      for (i = 0; i < samples; i++) {
+        Sint32 want = _readSampleAsS16(source, src_format, i);
+        if (dst_size == 1) {
+          want &= ~0xFF;  /* the low byte gets dropped. */
+        }
+        mismatches += (_readSampleAsS16(cvt.buf, dst_format, i) != want) ? 1 : 0;
+      }
+      SDLTest_AssertCheck(mismatches == 0, "Verify converted samples of 0x%.4x to 0x%.4x; expected: 0 mismatches, got: %i", src_format, dst_format, mismatches);
+    }
+  }
+
+  SDL_free(buffer);
+  SDL_free(source);
+
+  return TEST_COMPLETED;
+}
+
+/* Writes a little-endian value of size bytes to buf. */
+static Uint8 *_putLE(Uint8 *buf, Uint32 value, int size)
+{
+  int i;
+  for (i = 0; i < size; i++) {
+    *(buf++) = (Uint8) (value >> (i * 8));
+  }
+  return buf;
+}
+
+/**
+ * \brief Decode WAVE files incrementally and compare with SDL_LoadWAV_RW, including seeking
+ *
+ * \sa https://wiki.libsdl.org/SDL_OpenWAVDecoder_RW
+ */
+int audio_decodeWAVIncrementally()
+{
+  const struct {
+    Uint16 tag;
+    Uint16 channels;
+    Uint16 bits;
+    Uint16 blockalign;
+    Uint16 samplesperblock;
+    Uint32 datalen;
+  } cases[] = {
+    { 0x0001, 2, 16, 4, 0, 4000 },      /* PCM */
+    { 0x0001, 1, 24, 3, 0, 999 },       /* 24-bit PCM, gets shifted to 32 bits. */
+    { 0x0007, 2, 8, 2, 0, 2002 },       /* mu-law */
+    { 0x0011, 2, 4, 256, 249, 256 * 5 },  /* IMA ADPCM */
+    { 0x0002, 1, 4, 128, 244, 128 * 6 },  /* MS ADPCM */
+    /* Enough blocks for SDL_LoadWAV_RW to split them across threads. */
+    { 0x0011, 2, 4, 256, 249, 256 * 300 + 100 },
+    { 0x0002, 2, 4, 256, 244, 256 * 300 + 100 },
+  };
+  const Sint16 mscoeffs[14] = { 256, 0, 512, -256, 0, 0, 192, 64, 240, 0, 460, -208, 392, -232 };
+  const int wavsize = 256 * 300 + 100 + 128;
+  Uint8 *wav = (Uint8 *) SDL_malloc(wavsize);
+  Uint8 *decoded = (Uint8 *) SDL_malloc(wavsize * 4);
+  int t, i, result;
+
+  SDLTest_AssertCheck(wav && decoded, "Check buffers were allocated");
+  if (!wav || !decoded) {
+    SDL_free(wav);
+    SDL_free(decoded);
+    return TEST_ABORTED;
+  }
+
+  for (t = 0; t < (int) SDL_arraysize(cases); t++) {
+    const Uint16 tag = cases[t].tag;
+    const Uint16 channels = cases[t].channels;
+    const Uint16 blockalign = cases[t].blockalign;
+    const Uint32 datalen = cases[t].datalen;
+    const Uint32 fmtlen = tag == 0x0001 ? 16 : (tag == 0x0002 ? 18 + 32 : (tag == 0x0011 ? 18 + 2 : 18));
+    const Sint64 seeks[] = { 1, 300, 250, 0 };
+    SDL_AudioSpec spec, decoderspec;
+    SDL_WAVDecoder *decoder;
+    Uint8 *audio_buf = NULL;
+    Uint32 audio_len = 0;
+    Uint8 *ptr = wav;
+    Uint8 *data;
+    Sint64 frames;
+    int framesize, len, total;
+
+    /* Build the WAVE file in memory. */
+    ptr = _putLE(ptr, 0x46464952, 4);  /* RIFF */
+    ptr = _putLE(ptr, 4 + 8 + fmtlen + 8 + datalen, 4);
+    ptr = _putLE(ptr, 0x45564157, 4);  /* WAVE */
+    ptr = _putLE(ptr, 0x20746D66, 4);  /* fmt */
+    ptr = _putLE(ptr, fmtlen, 4);
+    ptr = _putLE(ptr, tag, 2);
+    ptr = _putLE(ptr, channels, 2);
+    ptr = _putLE(ptr, 22050, 4);
+    ptr = _putLE(ptr, 22050 * blockalign, 4);
+    ptr = _putLE(ptr, blockalign, 2);
+    ptr = _putLE(ptr, cases[t].bits, 2);
+    if (fmtlen > 16) {
+      ptr = _putLE(ptr, fmtlen - 18, 2);
+    }
+    if (tag == 0x0011) {
+      ptr = _putLE(ptr, cases[t].samplesperblock, 2);
+    } else if (tag == 0x0002) {
+      ptr = _putLE(ptr, cases[t].samplesperblock, 2);
+      ptr = _putLE(ptr, 7, 2);
+      for (i = 0; i < 14; i++) {
+        ptr = _putLE(ptr, (Uint16) mscoeffs[i], 2);
+      }
+    }
+    ptr = _putLE(ptr, 0x61746164, 4);  /* data */
+    ptr = _putLE(ptr, datalen, 4);
+    data = ptr;
+    for (i = 0; i < (int) datalen; i++) {
+      data[i] = SDLTest_RandomUint8();
+    }
+
+    /* Keep the ADPCM block headers valid. */
+    for (i = 0; i < (int) datalen; i += blockalign) {
+      int c;
+      for (c = 0; c < channels; c++) {
+        if (tag == 0x0011) {
+          data[i + c * 4 + 2] = SDLTest_RandomIntegerInRange(0, 88);
+          data[i + c * 4 + 3] = 0;
+        } else if (tag == 0x0002) {
+          data[i + c] = SDLTest_RandomIntegerInRange(0, 6);
+        }
+      }
+    }
+
+    SDL_ClearError();
+    SDL_LoadWAV_RW(SDL_RWFromConstMem(wav, (int) (ptr - wav + datalen)), 1, &spec, &audio_buf, &audio_len);
+    SDLTest_AssertCheck(audio_buf != NULL, "Verify SDL_LoadWAV_RW of format tag 0x%.4x; error: %s", tag, SDL_GetError());
+    decoder = SDL_OpenWAVDecoder_RW(SDL_RWFromConstMem(wav, (int) (ptr - wav + datalen)), 1, &decoderspec);
+    SDLTest_AssertCheck(decoder != NULL, "Verify SDL_OpenWAVDecoder_RW of format tag 0x%.4x; error: %s", tag, SDL_GetError());
+    if (audio_buf == NULL || decoder == NULL) {
+      SDL_FreeWAV(audio_buf);
+      SDL_CloseWAVDecoder(decoder);
+      continue;
+    }
+
+    /* Decode the many blocks on threads whatever the CPU count, and check that matches decoding them one after another. */
+    if (cases[t].samplesperblock > 0 && datalen / blockalign >= 64) {
+      Uint8 *serial_buf = NULL, *parallel_buf = NULL;
+      Uint32 serial_len = 0, parallel_len = 0;
+
+      SDL_SetHint(SDL_HINT_WAVE_DECODE_THREADS, "1");
+      SDL_LoadWAV_RW(SDL_RWFromConstMem(wav, (int) (ptr - wav + datalen)), 1, &spec, &serial_buf, &serial_len);
+      SDL_SetHint(SDL_HINT_WAVE_DECODE_THREADS, "4");
+      SDL_LoadWAV_RW(SDL_RWFromConstMem(wav, (int) (ptr - wav + datalen)), 1, &spec, &parallel_buf, &parallel_len);
+      SDL_SetHint(SDL_HINT_WAVE_DECODE_THREADS, NULL);
+      SDLTest_AssertCheck(serial_buf != NULL && parallel_buf != NULL, "Verify SDL_LoadWAV_RW of format tag 0x%.4x on one and on four threads", tag);
+      SDLTest_AssertCheck(serial_len == audio_len && parallel_len == audio_len, "Verify decoded lengths; expected: %i, got: %i and %i", (int) audio_len, (int) serial_len, (int) parallel_len);
+      SDLTest_AssertCheck(serial_len == parallel_len && serial_buf && parallel_buf && SDL_memcmp(serial_buf, parallel_buf, serial_len) == 0, "Verify threaded decoding matches decoding on one thread");
+      SDL_FreeWAV(serial_buf);
+      SDL_FreeWAV(parallel_buf);
+    }
+
+    SDLTest_AssertCheck(decoderspec.format == spec.format && decoderspec.channels == spec.channels && decoderspec.freq == spec.freq,
+                        "Verify decoder spec; expected: 0x%.4x %i %i, got: 0x%.4x %i %i",
+                        spec.format, spec.channels, spec.freq, decoderspec.format, decoderspec.channels, decoderspec.freq);
+    framesize = SDL_AUDIO_BITSIZE(spec.format) / 8 * spec.channels;
+    frames = SDL_WAVDecoderFrames(decoder);
+    SDLTest_AssertCheck(frames == (Sint64) (audio_len / framesize), "Verify frame count; expected: %i, got: %i", (int) (audio_len / framesize), (int) frames);
+
+    /* Read everything, in pieces that don't line up with blocks or frames. */
+    total = 0;
+    while ((len = SDL_WAVDecoderRead(decoder, decoded + total, 1001)) > 0) {
+      total += len;
+    }
+    SDLTest_AssertCheck(len == 0, "Verify last read result; expected: 0, got: %i", len);
+    SDLTest_AssertCheck(total == (int) audio_len, "Verify decoded length; expected: %i, got: %i", (int) audio_len, total);
+    SDLTest_AssertCheck(total == (int) audio_len && SDL_memcmp(decoded, audio_buf, audio_len) == 0, "Verify decoded data matches SDL_LoadWAV_RW");
+
+    /* Seek around, including into the middle of ADPCM blocks. */
+    for (i = 0; i < (int) SDL_arraysize(seeks); i++) {
+      const Sint64 frame = seeks[i] < frames ? seeks[i] : frames - 1;
+      result = SDL_WAVDecoderSeek(decoder, frame);
+      SDLTest_AssertCheck(result == 0, "Verify seek result; expected: 0, got: %i", result);
+      SDLTest_AssertCheck(SDL_WAVDecoderTell(decoder) == frame, "Verify position after seek to frame %i", (int) frame);
+      len = SDL_WAVDecoderRead(decoder, decoded, framesize * 10);
+      total = (int) SDL_min(10, frames - frame) * framesize;
+      SDLTest_AssertCheck(len == total, "Verify read length after seek; expected: %i, got: %i", total, len);
+      SDLTest_AssertCheck(len == total && SDL_memcmp(decoded, audio_buf + frame * framesize, total) == 0, "Verify decoded data after seek to frame %i", (int) frame);
+    }
+
+    result = SDL_WAVDecoderSeek(decoder, frames);
+    SDLTest_AssertCheck(result == 0, "Verify seek to end; expected: 0, got: %i", result);
+    len = SDL_WAVDecoderRead(decoder, decoded, framesize);
+    SDLTest_AssertCheck(len == 0, "Verify read at end; expected: 0, got: %i", len);
+    result = SDL_WAVDecoderSeek(decoder, frames + 1);
+    SDLTest_AssertCheck(result == -1, "Verify seek past end fails; expected: -1, got: %i", result);
+
+    SDL_CloseWAVDecoder(decoder);
+    SDL_FreeWAV(audio_buf);
+  }
+
+  SDL_free(wav);
+  SDL_free(decoded);
+
+  return TEST_COMPLETED;
+}
+
+/* Builds a PCM WAVE file in buf and returns its size. */
+static int _buildPCMWAV(Uint8 *buf, Uint16 channels, Uint16 bits, const Uint8 *data, Uint32 datalen)
+{
+  const Uint16 blockalign = channels * bits / 8;
+  Uint8 *ptr = buf;
+
+  ptr = _putLE(ptr, 0x46464952, 4);  /* RIFF */
+  ptr = _putLE(ptr, 4 + 8 + 16 + 8 + datalen, 4);
+  ptr = _putLE(ptr, 0x45564157, 4);  /* WAVE */
+  ptr = _putLE(ptr, 0x20746D66, 4);  /* fmt */
+  ptr = _putLE(ptr, 16, 4);
+  ptr = _putLE(ptr, 0x0001, 2);
+  ptr = _putLE(ptr, channels, 2);
+  ptr = _putLE(ptr, 44100, 4);
+  ptr = _putLE(ptr, 44100 * blockalign, 4);
+  ptr = _putLE(ptr, blockalign, 2);
+  ptr = _putLE(ptr, bits, 2);
+  ptr = _putLE(ptr, 0x61746164, 4);  /* data */
+  ptr = _putLE(ptr, datalen, 4);
+  SDL_memcpy(ptr, data, datalen);
+  return (int) (ptr - buf + datalen);
+}
+
+/**
+ * \brief Load PCM WAVE data without copying, from memory and from a mapped file
+ *
+ * \sa https://wiki.libsdl.org/SDL_LoadWAVMapped_RW
+ */
+int audio_loadWAVMapped()
+{
+  const char *filename = "audio_loadWAVMapped.wav";
+  const Uint32 datalen = 3000;
+  Uint8 *wav = (Uint8 *) SDL_malloc(datalen + 64);
+  Uint8 *data = (Uint8 *) SDL_malloc(datalen);
+  Uint8 *audio_buf = NULL;
+  Uint8 *copy_buf = NULL;
+  Uint32 audio_len = 0, copy_len = 0;
+  SDL_AudioSpec spec, *result;
+  SDL_RWops *rw;
+  int wavlen, i;
+
+  SDLTest_AssertCheck(wav && data, "Check buffers were allocated");
+  if (!wav || !data) {
+    SDL_free(wav);
+    SDL_free(data);
+    return TEST_ABORTED;
+  }
+  for (i = 0; i < (int) datalen; i++) {
+    data[i] = SDLTest_RandomUint8();
+  }
+
+  /* 16-bit data from memory is borrowed. */
+  wavlen = _buildPCMWAV(wav, 2, 16, data, datalen);
+  result = SDL_LoadWAVMapped_RW(SDL_RWFromConstMem(wav, wavlen), 1, &spec, &audio_buf, &audio_len);
+  SDLTest_AssertCheck(result == &spec, "Verify result of SDL_LoadWAVMapped_RW from memory; error: %s", SDL_GetError());
+  SDLTest_AssertCheck(audio_buf == wav + wavlen - datalen, "Verify audio data points into the memory buffer");
+  SDLTest_AssertCheck(audio_len == datalen, "Verify audio length; expected: %i, got: %i", (int) datalen, (int) audio_len);
+  SDLTest_AssertCheck(spec.format == AUDIO_S16LSB && spec.channels == 2, "Verify format; expected: 0x%.4x 2, got: 0x%.4x %i", AUDIO_S16LSB, spec.format, spec.channels);
+  SDL_FreeWAV(audio_buf);
+  SDLTest_AssertPass("Call to SDL_FreeWAV() with borrowed data");
+
+  /* 24-bit data has to be converted, so it is copied. */
+  wavlen = _buildPCMWAV(wav, 1, 24, data, datalen);
+  result = SDL_LoadWAVMapped_RW(SDL_RWFromConstMem(wav, wavlen), 1, &spec, &audio_buf, &audio_len);
+  SDLTest_AssertCheck(result == &spec, "Verify result of SDL_LoadWAVMapped_RW with 24-bit data; error: %s", SDL_GetError());
+  SDLTest_AssertCheck(audio_buf < wav || audio_buf >= wav + wavlen, "Verify 24-bit audio data is a copy");
+  SDL_LoadWAV_RW(SDL_RWFromConstMem(wav, wavlen), 1, &spec, &copy_buf, &copy_len);
+  SDLTest_AssertCheck(audio_len == copy_len && SDL_memcmp(audio_buf, copy_buf, copy_len) == 0, "Verify 24-bit audio data matches SDL_LoadWAV_RW");
+  SDL_FreeWAV(audio_buf);
+  SDL_FreeWAV(copy_buf);
+
+  /* 8-bit data from a file gets mapped where supported, and read otherwise. */
+  wavlen = _buildPCMWAV(wav, 1, 8, data, datalen);
+  rw = SDL_RWFromFile(filename, "wb");
+  SDLTest_AssertCheck(rw != NULL, "Verify creation of file '%s'", filename);
+  if (rw != NULL) {
+    SDL_RWwrite(rw, wav, 1, wavlen);
+    SDL_RWclose(rw);
+
+    result = SDL_LoadWAVMapped(filename, &spec, &audio_buf, &audio_len);
+    SDLTest_AssertCheck(result == &spec, "Verify result of SDL_LoadWAVMapped from a file; error: %s", SDL_GetError());
+    SDLTest_AssertCheck(audio_len == datalen && SDL_memcmp(audio_buf, data, datalen) == 0, "Verify audio data from the file");
+    SDLTest_AssertCheck(spec.format == AUDIO_U8, "Verify format; expected: 0x%.4x, got: 0x%.4x", AUDIO_U8, spec.format);
+    SDL_FreeWAV(audio_buf);
+    SDLTest_AssertPass("Call to SDL_FreeWAV() with mapped data");
+    remove(filename);
+  }
+
+  SDL_free(wav);
+  SDL_free(data);
+
+  return TEST_COMPLETED;
+}
+
+/* Reference G.711 expansion, written out the long way. */
+static Sint16 _expandG711(SDL_G711Law law, Uint8 code)
+{
+  if (law == SDL_G711_ULAW) {
+    const Uint8 x = ~code;
+    const int exponent = (x >> 4) & 0x7;
+    const int magnitude = ((((x & 0xf) << 3) + 0x84) << exponent) - 0x84;
+    return (Sint16) ((x & 0x80) ? -magnitude : magnitude);
+  } else {
+    const Uint8 x = (code & 0x7f) ^ 0x55;
+    const int exponent = x >> 4;
+    int magnitude = ((x & 0xf) << 4) | 0x8;
+    if (exponent > 0) {
+      magnitude |= 0x100;
+    }
+    if (exponent > 1) {
+      magnitude <<= exponent - 1;
+    }
+    return (Sint16) ((code & 0x80) ? magnitude : -magnitude);
+  }
+}
+
+/**
+ * \brief Expand mu-law and A-law data, in place and between buffers
+ *
+ * \sa https://wiki.libsdl.org/SDL_DecodeG711
+ */
+int audio_decodeG711()
+{
+  const SDL_G711Law laws[] = { SDL_G711_ULAW, SDL_G711_ALAW };
+  const int lengths[] = { 0, 1, 7, 8, 15, 16, 17, 33, 256, 1000 };
+  Uint8 src[1003];
+  Sint16 dst[1003];
+  Sint16 buf[1003];
+  int i, j, k, offset, result;
+
+  for (i = 0; i < (int) SDL_arraysize(laws); i++) {
+    const char *name = laws[i] == SDL_G711_ULAW ? "mu-law" : "A-law";
+
+    /* Every code, between buffers. */
+    for (k = 0; k < 256; k++) {
+      src[k] = (Uint8) k;
+    }
+    result = SDL_DecodeG711(laws[i], src, dst, 256);
+    SDLTest_AssertCheck(result == 0, "Verify result of SDL_DecodeG711(%s), expected: 0, got: %i", name, result);
+    for (k = 0; k < 256; k++) {
+      if (dst[k] != _expandG711(laws[i], (Uint8) k)) {
+        break;
+      }
+    }
+    SDLTest_AssertCheck(k == 256, "Verify all 256 %s codes, first mismatch at: %i", name, k);
+
+    /* Random data at odd lengths and alignments, in place. */
+    for (j = 0; j < (int) SDL_arraysize(lengths); j++) {
+      for (offset = 0; offset < 3; offset++) {
+        Uint8 *inplace = ((Uint8 *) buf) + offset;
+        const int samples = lengths[j];
+        for (k = 0; k < samples; k++) {
+          src[k] = inplace[k] = SDLTest_RandomUint8();
+        }
+        result = SDL_DecodeG711(laws[i], inplace, (Sint16 *) inplace, samples);
+        SDLTest_AssertCheck(result == 0, "Verify result of in-place SDL_DecodeG711(%s), expected: 0, got: %i", name, result);
+        for (k = 0; k < samples; k++) {
+          Sint16 sample;
+          SDL_memcpy(&sample, inplace + k * 2, sizeof (sample));
+          if (sample != _expandG711(laws[i], src[k])) {
+            break;
+          }
+        }
+        SDLTest_AssertCheck(k == samples, "Verify in-place %s expansion of %i samples at offset %i, first mismatch at: %i", name, samples, offset, k);
+      }
+    }
+  }
+
+  result = SDL_DecodeG711(SDL_G711_ULAW, NULL, dst, 1);
+  SDLTest_AssertCheck(result < 0, "Verify SDL_DecodeG711 fails without a source buffer");
+  result = SDL_DecodeG711((SDL_G711Law) 42, src, dst, 1);
+  SDLTest_AssertCheck(result < 0, "Verify SDL_DecodeG711 fails with an unknown law");
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Gather telemetry from callback and queued devices on the dummy driver
+ *
+ * \sa https://wiki.libsdl.org/SDL_GetAudioDeviceStats
+ * \sa https://wiki.libsdl.org/SDL_ResetAudioDeviceStats
+ */
+int audio_getAudioDeviceStats()
+{
+  SDL_AudioDeviceStats stats;
+  SDL_AudioSpec desired, obtained;
+  SDL_AudioDeviceID id;
+  Uint8 *silence;
+  Uint64 total;
+  int i, result;
+
+  /* The dummy driver has no device buffers, so every iteration sleeps for a buffer's duration. */
+  SDL_QuitSubSystem(SDL_INIT_AUDIO);
+  SDLTest_AssertPass("Call to SDL_QuitSubSystem(SDL_INIT_AUDIO)");
+  result = SDL_AudioInit("dummy");
+  SDLTest_AssertCheck(result == 0, "Validate result of SDL_AudioInit('dummy'); expected: 0, got: %i", result);
+
+  SDL_zero(desired);
+  desired.freq = 22050;
+  desired.format = AUDIO_S16SYS;
+  desired.channels = 2;
+  desired.samples = 512;
+  desired.callback = _audio_testCallback;
+
+  /* A callback device. */
+  _audio_testCallbackCounter = 0;
+  id = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+  SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >=2, got: %i", id);
+  if (id > 1) {
+    SDL_PauseAudioDevice(id, 0);
+    for (i = 0; i < 100 && _audio_testCallbackCounter < 4; i++) {
+      SDL_Delay(10);
+    }
+    result = SDL_GetAudioDeviceStats(id, &stats);
+    SDLTest_AssertCheck(result == 0, "Validate result of SDL_GetAudioDeviceStats; expected: 0, got: %i", result);
+    SDLTest_AssertCheck(stats.callback.count > 0, "Verify callback timings were recorded; got: %i", (int) stats.callback.count);
+    SDLTest_AssertCheck(stats.iterations > 0 && stats.stalls > 0, "Verify iterations and stalls; got: %i, %i", (int) stats.iterations, (int) stats.stalls);
+    SDLTest_AssertCheck(stats.wait.count > 0 && stats.wait.total_ns > 0, "Verify wait timings were recorded; got: %i", (int) stats.wait.count);
+    SDLTest_AssertCheck(stats.callback.max_ns * stats.callback.count >= stats.callback.total_ns, "Verify callback maximum is consistent with the total");
+    for (total = 0, i = 0; i < SDL_AUDIO_STATS_BUCKETS; i++) {
+      total += stats.callback.histogram[i];
+    }
+    SDLTest_AssertCheck(total == stats.callback.count, "Verify callback histogram adds up; expected: %i, got: %i", (int) stats.callback.count, (int) total);
+    SDLTest_AssertCheck(stats.underruns == 0, "Verify no underruns on a callback device; got: %i", (int) stats.underruns);
+
+    SDL_PauseAudioDevice(id, 1);
+    SDL_ResetAudioDeviceStats(id);
+    SDLTest_AssertPass("Call to SDL_ResetAudioDeviceStats()");
+    SDL_GetAudioDeviceStats(id, &stats);
+    SDLTest_AssertCheck(stats.callback.count == 0 && stats.callback.histogram[0] == 0 && stats.stalls == 0, "Verify callback statistics were reset");
+    SDL_CloseAudioDevice(id);
+  }
+
+  /* A queued device that is given two buffers runs dry exactly once. */
+  desired.callback = NULL;
+  id = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+  SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >=2, got: %i", id);
+  silence = (Uint8 *) SDL_calloc(2, obtained.size);
+  if (id > 1 && silence) {
+    SDL_QueueAudio(id, silence, obtained.size * 2);
+    SDL_PauseAudioDevice(id, 0);
+    for (i = 0; i < 100; i++) {
+      SDL_GetAudioDeviceStats(id, &stats);
+      if (stats.iterations >= 4) {
+        break;
+      }
+      SDL_Delay(10);
+    }
+    SDLTest_AssertCheck(stats.iterations >= 4, "Verify the device ran; got: %i iterations", (int) stats.iterations);
+    SDLTest_AssertCheck(stats.underruns == 1, "Verify underruns; expected: 1, got: %i", (int) stats.underruns);
+    SDLTest_AssertCheck(stats.fill_max_bytes >= obtained.size && stats.fill_min_bytes == 0 && stats.fill_bytes == 0,
+                        "Verify fill levels; got: min %i, max %i, last %i", (int) stats.fill_min_bytes, (int) stats.fill_max_bytes, (int) stats.fill_bytes);
+  }
+  if (id > 1) {
+    SDL_CloseAudioDevice(id);
+  }
+  SDL_free(silence);
+
+  result = SDL_GetAudioDeviceStats(0, &stats);
+  SDLTest_AssertCheck(result < 0, "Verify SDL_GetAudioDeviceStats fails on an invalid device");
+
+  SDL_AudioQuit();
+  SDLTest_AssertPass("Call to SDL_AudioQuit()");
+  _audioSetUp(NULL);
+
+  return TEST_COMPLETED;
+}
+
+static SDL_atomic_t _audio_lookaheadCounter;
+
+/* Fills each buffer with its sequence number, and now and then takes longer than the buffer plays. */
+void SDLCALL _audio_lookaheadCallback(void *userdata, Uint8 *stream, int len)
+{
+  const int count = SDL_AtomicAdd(&_audio_lookaheadCounter, 1) + 1;
+  SDL_memset(stream, count, len);
+  if ((count % 8) == 0) {
+    SDL_Delay(10);
+  }
+}
+
+/**
+ * \brief Run the audio callback ahead of the device, and check the device plays its buffers in order
+ *
+ * \sa https://wiki.libsdl.org/SDL_HINT_AUDIO_CALLBACK_LOOKAHEAD
+ */
+int audio_callbackLookahead()
+{
+  const char *filename = "sdlaudio.raw";
+  SDL_AudioDeviceStats stats;
+  SDL_AudioSpec desired, obtained;
+  SDL_AudioDeviceID id;
+  SDL_RWops *rw;
+  Uint8 *buffer;
+  Uint64 iterations;
+  int i, count, result, expected, played, uniform;
+
+  /* The disk driver writes everything it plays to a file, so the order can be checked. */
+  SDL_QuitSubSystem(SDL_INIT_AUDIO);
+  SDLTest_AssertPass("Call to SDL_QuitSubSystem(SDL_INIT_AUDIO)");
+  result = SDL_AudioInit("disk");
+  SDLTest_AssertCheck(result == 0, "Validate result of SDL_AudioInit('disk'); expected: 0, got: %i", result);
+  SDL_SetHint(SDL_HINT_AUDIO_CALLBACK_LOOKAHEAD, "4");
+
+  SDL_zero(desired);
+  desired.freq = 8000;
+  desired.format = AUDIO_U8;
+  desired.channels = 1;
+  desired.samples = 64;
+  desired.callback = _audio_lookaheadCallback;
+  SDL_AtomicSet(&_audio_lookaheadCounter, 0);
+
+  id = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+  SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >=2, got: %i", id);
+  if (id > 1) {
+    SDL_PauseAudioDevice(id, 0);
+    for (i = 0; i < 200 && SDL_AtomicGet(&_audio_lookaheadCounter) < 40; i++) {
+      SDL_Delay(10);
+    }
+    SDLTest_AssertCheck(SDL_AtomicGet(&_audio_lookaheadCounter) >= 40, "Verify callback counter; expected: >=40, got: %i", SDL_AtomicGet(&_audio_lookaheadCounter));
+
+    /* Locking the device holds the callback back, but not the device, which keeps playing what was prepared. */
+    SDL_LockAudioDevice(id);
+    count = SDL_AtomicGet(&_audio_lookaheadCounter);
+    SDL_GetAudioDeviceStats(id, &stats);
+    iterations = stats.iterations;
+    SDL_Delay(50);
+    SDLTest_AssertCheck(count == SDL_AtomicGet(&_audio_lookaheadCounter), "Verify the callback does not run while the device is locked");
+    SDL_GetAudioDeviceStats(id, &stats);
+    SDLTest_AssertCheck(stats.iterations > iterations, "Verify the device thread runs while the device is locked; expected: >%i iterations, got: %i", (int) iterations, (int) stats.iterations);
+    SDL_UnlockAudioDevice(id);
+
+    SDL_PauseAudioDevice(id, 1);
+    SDL_GetAudioDeviceStats(id, &stats);
+    SDLTest_AssertCheck(stats.fill_max_bytes >= obtained.size * 2, "Verify buffers were prepared ahead; expected: >=%i, got: %i", (int) obtained.size * 2, (int) stats.fill_max_bytes);
+    SDLTest_Log("Lookahead: %i underruns, %i late buffers in %i iterations", (int) stats.underruns, (int) stats.late_buffers, (int) stats.iterations);
+    SDL_CloseAudioDevice(id);
+
+    /* Every played buffer is whole, and they come out in the order the callback made them. */
+    buffer = (Uint8 *) SDL_malloc(obtained.size);
+    rw = SDL_RWFromFile(filename, "rb");
+    SDLTest_AssertCheck(rw != NULL && buffer != NULL, "Verify the output file '%s' can be read", filename);
+    if (rw != NULL && buffer != NULL) {
+      expected = 1;
+      played = 0;
+      uniform = 1;
+      while (SDL_RWread(rw, buffer, obtained.size, 1) == 1) {
+        for (i = 1; i < (int) obtained.size; i++) {
+          if (buffer[i] != buffer[0]) {
+            uniform = 0;
+          }
+        }
+        if (buffer[0] != obtained.silence) {
+          SDLTest_AssertCheck(buffer[0] == expected, "Verify buffer order; expected: %i, got: %i", expected, buffer[0]);
+          expected = buffer[0] + 1;
+          played++;
+        }
+      }
+      SDLTest_AssertCheck(uniform, "Verify no buffer was torn");
+      SDLTest_AssertCheck(played >= 10, "Verify buffers were played; expected: >=10, got: %i", played);
+    }
+    if (rw != NULL) {
+      SDL_RWclose(rw);
+    }
+    SDL_free(buffer);
+  }
+
+  SDL_SetHint(SDL_HINT_AUDIO_CALLBACK_LOOKAHEAD, "0");
+  SDL_AudioQuit();
+  SDLTest_AssertPass("Call to SDL_AudioQuit()");
+  _audioSetUp(NULL);
+
+  return TEST_COMPLETED;
+}
+
+static SDL_atomic_t _audio_freewheelCounter;
+
+/* Fills each buffer with its sequence number. */
+void SDLCALL _audio_freewheelCallback(void *userdata, Uint8 *stream, int len)
+{
+  const Sint32 count = SDL_AtomicAdd(&_audio_freewheelCounter, 1) + 1;
+  Sint32 *samples = (Sint32 *) stream;
+  int i;
+  for (i = 0; i < len / 4; i++) {
+    samples[i] = count;
+  }
+}
+
+/**
+ * \brief Render audio faster than real time with the disk driver's freewheel mode
+ */
+int audio_diskFreewheel()
+{
+  const char *filename = "sdlaudio.raw";
+  SDL_AudioDeviceStats stats;
+  SDL_AudioSpec desired, obtained;
+  SDL_AudioDeviceID id;
+  SDL_RWops *rw;
+  Sint32 *buffer;
+  double factor;
+  int i, count, result, expected, played;
+
+  SDL_QuitSubSystem(SDL_INIT_AUDIO);
+  SDLTest_AssertPass("Call to SDL_QuitSubSystem(SDL_INIT_AUDIO)");
+  SDL_setenv("SDL_DISKAUDIOFREEWHEEL", "1", 1);
+  result = SDL_AudioInit("disk");
+  SDLTest_AssertCheck(result == 0, "Validate result of SDL_AudioInit('disk'); expected: 0, got: %i", result);
+
+  SDL_zero(desired);
+  desired.freq = 8000;
+  desired.format = AUDIO_S32SYS;
+  desired.channels = 1;
+  desired.samples = 256;
+  desired.callback = _audio_freewheelCallback;
+  SDL_AtomicSet(&_audio_freewheelCounter, 0);
+
+  id = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+  SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >=2, got: %i", id);
+  if (id > 1) {
+    /* 2000 buffers are 64 seconds of audio; the test gives up after 5. */
+    SDL_PauseAudioDevice(id, 0);
+    for (i = 0; i < 500 && SDL_AtomicGet(&_audio_freewheelCounter) < 2000; i++) {
+      SDL_Delay(10);
+    }
+    SDL_PauseAudioDevice(id, 1);
+    count = SDL_AtomicGet(&_audio_freewheelCounter);
+    SDLTest_AssertCheck(count >= 2000, "Verify the callback ran faster than real time; expected: >=2000 buffers, got: %i", count);
+
+    /* The stats keep the real-time factor: how long the unpaused audio plays, over how long it took. */
+    SDL_GetAudioDeviceStats(id, &stats);
+    SDLTest_AssertCheck(stats.unpaused_frames > 0 && stats.unpaused_ns > 0, "Verify unpaused time was counted; got: %i frames in %i ms",
+                        (int) stats.unpaused_frames, (int) (stats.unpaused_ns / 1000000));
+    factor = stats.unpaused_ns ? ((double) stats.unpaused_frames / obtained.freq) / ((double) stats.unpaused_ns / 1000000000.0) : 0.0;
+    SDLTest_AssertCheck(factor > 1.0, "Verify the real-time factor is above 1; got: %.2f", factor);
+    SDL_CloseAudioDevice(id);
+
+    /* Every buffer the callback made was written, in order. */
+    buffer = (Sint32 *) SDL_malloc(obtained.size);
+    rw = SDL_RWFromFile(filename, "rb");
+    SDLTest_AssertCheck(rw != NULL && buffer != NULL, "Verify the output file '%s' can be read", filename);
+    if (rw != NULL && buffer != NULL) {
+      expected = 1;
+      played = 0;
+      while (SDL_RWread(rw, buffer, obtained.size, 1) == 1) {
+        if (buffer[0] != 0) {
+          if (buffer[0] != expected || buffer[obtained.samples - 1] != expected) {
+            break;
+          }
+          expected++;
+          played++;
+        }
+      }
+      SDLTest_AssertCheck(played == count, "Verify all buffers were written in order; expected: %i, got: %i", count, played);
+    }
+    if (rw != NULL) {
+      SDL_RWclose(rw);
+    }
+    SDL_free(buffer);
+  }
+
+  SDL_setenv("SDL_DISKAUDIOFREEWHEEL", "0", 1);
+  SDL_AudioQuit();
+  SDLTest_AssertPass("Call to SDL_AudioQuit()");
+  _audioSetUp(NULL);
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Convert between every pair of channel layouts, and check whole buffers against converting one frame at a time
+ *
+ * \sa https://wiki.libsdl.org/SDL_ConvertAudio
+ */
+int audio_convertChannels()
+{
+  /* odd frame count, so the vectorized converters run whole blocks and leftovers. */
+  const int frames = 37;
+  float *buffer = (float *) SDL_malloc(frames * 8 * sizeof (float));
+  float *frame = (float *) SDL_malloc(8 * sizeof (float));
+  float *input = (float *) SDL_malloc(frames * 8 * sizeof (float));
+  SDL_AudioCVT cvt;
+  int from, to, i, j, result;
+
+  SDLTest_AssertCheck(buffer && frame && input, "Check buffers were allocated");
+  if (!buffer || !frame || !input) {
+    SDL_free(buffer);
+    SDL_free(frame);
+    SDL_free(input);
+    return TEST_ABORTED;
+  }
+
+  for (i = 0; i < frames * 8; i++) {
+    input[i] = SDLTest_RandomUnitFloat() * 2.0f - 1.0f;
+  }
+
+  for (from = 1; from <= 8; from++) {
+    for (to = 1; to <= 8; to++) {
+      int mismatches = 0;
+
+      if (from == to) {
+        continue;
+      }
+
+      result = SDL_BuildAudioCVT(&cvt, AUDIO_F32SYS, from, 48000, AUDIO_F32SYS, to, 48000);
+      SDLTest_AssertCheck(result == 1, "Verify result value of %i to %i channels; expected: 1, got: %i", from, to, result);
+      cvt.buf = (Uint8 *) buffer;
+      cvt.len = frames * from * sizeof (float);
+      SDL_memcpy(buffer, input, cvt.len);
+      result = SDL_ConvertAudio(&cvt);
+      SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %i", result);
+      SDLTest_AssertCheck(cvt.len_cvt == frames * to * (int) sizeof (float), "Verify converted length; expected: %i, got: %i", frames * to * (int) sizeof (float), cvt.len_cvt);
+
+      /* a single frame only ever goes through the scalar math. */
+      for (i = 0; i < frames; i++) {
+        cvt.buf = (Uint8 *) frame;
+        cvt.len = from * sizeof (float);
+        SDL_memcpy(frame, input + (i * from), cvt.len);
+        result = SDL_ConvertAudio(&cvt);
+        for (j = 0; j < to; j++) {
+          const float diff = frame[j] - buffer[(i * to) + j];
+          mismatches += ((diff > 0.000001f) || (diff < -0.000001f)) ? 1 : 0;
+        }
+      }
+      SDLTest_AssertCheck(mismatches == 0, "Verify %i to %i channels matches converting a frame at a time; expected: 0 mismatches, got: %i", from, to, mismatches);
+    }
+  }
+
+  SDL_free(buffer);
+  SDL_free(frame);
+  SDL_free(input);
+
+  return TEST_COMPLETED;
+}
+
+/* Puts all of the input through a stream, flushes it and gets everything back; returns the bytes we got. */
+static int _convertThroughStream(SDL_AudioStream *stream, const void *in, int inlen, void *out, int outlen)
+{
+  if (SDL_AudioStreamPut(stream, in, inlen) < 0 || SDL_AudioStreamFlush(stream) < 0) {
+    return -1;
+  }
+  return SDL_AudioStreamGet(stream, out, outlen);
+}
+
+/**
+ * \brief Mix stream channels through a custom matrix, with and without resampling
+ *
+ * \sa https://wiki.libsdl.org/SDL_AudioStreamSetChannelMatrix
+ */
+int audio_streamChannelMatrix()
+{
+  /* { src_channels, dst_channels, src_rate, dst_rate }: growing and shrinking, before and after resampling, and a straight gain change. */
+  const int cases[][4] = { { 4, 2, 48000, 48000 }, { 2, 6, 48000, 48000 }, { 2, 2, 48000, 48000 }, { 6, 2, 44100, 48000 }, { 2, 8, 44100, 48000 }, { 8, 8, 22050, 48000 } };
+  const int frames = 1003;
+  const int maxout = frames * 3 * 8;  /* room for 22050 -> 48000 at 8 channels. */
+  float *input = (float *) SDL_malloc(frames * 8 * sizeof (float));
+  float *mixed = (float *) SDL_malloc(maxout * sizeof (float));
+  float *reference = (float *) SDL_malloc(maxout * sizeof (float));
+  float *converted = (float *) SDL_malloc(maxout * sizeof (float));
+  float matrix[64];
+  SDL_AudioStream *stream;
+  int c, i, j, k, result;
+
+  SDLTest_AssertCheck(input && mixed && reference && converted, "Check buffers were allocated");
+  if (!input || !mixed || !reference || !converted) {
+    SDL_free(input);
+    SDL_free(mixed);
+    SDL_free(reference);
+    SDL_free(converted);
+    return TEST_ABORTED;
+  }
+
+  result = SDL_AudioStreamSetChannelMatrix(NULL, matrix);
+  SDLTest_AssertCheck(result == -1, "Verify SDL_AudioStreamSetChannelMatrix(NULL, matrix) fails; got: %i", result);
+
+  for (i = 0; i < frames * 8; i++) {
+    input[i] = SDLTest_RandomUnitFloat() * 2.0f - 1.0f;
+  }
+  for (i = 0; i < (int) SDL_arraysize(matrix); i++) {
+    matrix[i] = SDLTest_RandomUnitFloat() - 0.5f;
+  }
+
+  for (c = 0; c < (int) SDL_arraysize(cases); c++) {
+    const int src_channels = cases[c][0];
+    const int dst_channels = cases[c][1];
+    const int src_rate = cases[c][2];
+    const int dst_rate = cases[c][3];
+    const int inlen = frames * src_channels * (int) sizeof (float);
+    int reflen, mismatches = 0;
+
+    /* resampling is linear, so it doesn't matter if we mix before or after it: do it on whichever side has fewer channels. */
+    if (src_channels <= dst_channels) {
+      stream = SDL_NewAudioStream(AUDIO_F32SYS, src_channels, src_rate, AUDIO_F32SYS, src_channels, dst_rate);
+      reflen = stream ? _convertThroughStream(stream, input, inlen, converted, maxout * sizeof (float)) : -1;
+      SDL_FreeAudioStream(stream);
+      for (i = 0; i < reflen / (src_channels * (int) sizeof (float)); i++) {
+        for (j = 0; j < dst_channels; j++) {
+          float sum = 0.0f;
+          for (k = 0; k < src_channels; k++) {
+            sum += matrix[(j * src_channels) + k] * converted[(i * src_channels) + k];
+          }
+          reference[(i * dst_channels) + j] = sum;
+        }
+      }
+      reflen = (reflen / src_channels) * dst_channels;
+    } else {
+      for (i = 0; i < frames; i++) {
+        for (j = 0; j < dst_channels; j++) {
+          float sum = 0.0f;
+          for (k = 0; k < src_channels; k++) {
+            sum += matrix[(j * src_channels) + k] * input[(i * src_channels) + k];
+          }
+          mixed[(i * dst_channels) + j] = sum;
+        }
+      }
+      stream = SDL_NewAudioStream(AUDIO_F32SYS, dst_channels, src_rate, AUDIO_F32SYS, dst_channels, dst_rate);
+      reflen = stream ? _convertThroughStream(stream, mixed, frames * dst_channels * sizeof (float), reference, maxout * sizeof (float)) : -1;
+      SDL_FreeAudioStream(stream);
+    }
+    SDLTest_AssertCheck(reflen > 0, "Verify reference conversion for case %i; got: %i bytes", c, reflen);
+
+    stream = SDL_NewAudioStream(AUDIO_F32SYS, src_channels, src_rate, AUDIO_F32SYS, dst_channels, dst_rate);
+    SDLTest_AssertPass("Call to SDL_NewAudioStream(AUDIO_F32SYS, %i, %i, AUDIO_F32SYS, %i, %i)", src_channels, src_rate, dst_channels, dst_rate);
+    SDLTest_AssertCheck(stream != NULL, "Validate stream is not NULL");
+    if (!stream) {
+      continue;
+    }
+    result = SDL_AudioStreamSetChannelMatrix(stream, matrix);
+    SDLTest_AssertCheck(result == 0, "Verify SDL_AudioStreamSetChannelMatrix() result; expected: 0, got: %i", result);
+    result = _convertThroughStream(stream, input, inlen, converted, maxout * sizeof (float));
+    SDLTest_AssertCheck(result == reflen, "Verify converted length; expected: %i, got: %i", reflen, result);
+    for (i = 0; i < SDL_min(result, reflen) / (int) sizeof (float); i++) {
+      const float diff = converted[i] - reference[i];
+      mismatches += ((diff > 0.0001f) || (diff < -0.0001f)) ? 1 : 0;
+    }
+    SDLTest_AssertCheck(mismatches == 0, "Verify %i to %i channels at %i to %i Hz through the matrix; expected: 0 mismatches, got: %i", src_channels, dst_channels, src_rate, dst_rate, mismatches);
+
+    /* and back to the built-in conversion, which has to match a stream that never had a matrix. */
+    SDL_AudioStreamClear(stream);
+    result = SDL_AudioStreamSetChannelMatrix(stream, NULL);
+    SDLTest_AssertCheck(result == 0, "Verify SDL_AudioStreamSetChannelMatrix(stream, NULL) result; expected: 0, got: %i", result);
+    result = _convertThroughStream(stream, input, inlen, converted, maxout * sizeof (float));
+    SDL_FreeAudioStream(stream);
+    stream = SDL_NewAudioStream(AUDIO_F32SYS, src_channels, src_rate, AUDIO_F32SYS, dst_channels, dst_rate);
+    reflen = stream ? _convertThroughStream(stream, input, inlen, reference, maxout * sizeof (float)) : -1;
+    SDL_FreeAudioStream(stream);
+    SDLTest_AssertCheck(result == reflen && result > 0 && SDL_memcmp(converted, reference, result) == 0, "Verify clearing the matrix goes back to the built-in conversion");
+  }
+
+  SDL_free(input);
+  SDL_free(mixed);
+  SDL_free(reference);
+  SDL_free(converted);
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Bind streams at different formats and rates to one device, and check the device plays their mix
+ *
+ * \sa https://wiki.libsdl.org/SDL_BindAudioStream
+ */
+int audio_bindAudioStreams()
+{
+  const char *filename = "sdlaudio.raw";
+  const int frames = 4000;
+  SDL_AudioSpec desired, obtained;
+  SDL_AudioDeviceID id;
+  SDL_AudioStream *direct, *resampled, *mismatched;
+  SDL_RWops *rw;
+  Sint16 *samples;
+  float *stereo;
+  Sint16 sample;
+  int i, result, available, direct_only, both, total;
+  int mixed = 0;
+
+  /* Freewheeling disk output plays the mix as fast as it can, into a file to check. */
+  SDL_QuitSubSystem(SDL_INIT_AUDIO);
+  SDLTest_AssertPass("Call to SDL_QuitSubSystem(SDL_INIT_AUDIO)");
+  SDL_setenv("SDL_DISKAUDIOFREEWHEEL", "1", 1);
+  result = SDL_AudioInit("disk");
+  SDLTest_AssertCheck(result == 0, "Validate result of SDL_AudioInit('disk'); expected: 0, got: %i", result);
+
+  /* No callback, so the device plays silence plus whatever the bound streams have. */
+  SDL_zero(desired);
+  desired.freq = 8000;
+  desired.format = AUDIO_S16SYS;
+  desired.channels = 1;
+  desired.samples = 256;
+  id = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+  SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >=2, got: %i", id);
+  if (id > 1) {
+    direct = SDL_NewAudioStream(AUDIO_S16SYS, 1, 8000, AUDIO_S16SYS, 1, 8000);
+    resampled = SDL_NewAudioStream(AUDIO_F32SYS, 2, 16000, AUDIO_S16SYS, 1, 8000);
+    mismatched = SDL_NewAudioStream(AUDIO_S16SYS, 1, 8000, AUDIO_S16SYS, 1, 44100);
+    samples = (Sint16 *) SDL_malloc(frames * sizeof (Sint16));
+    stereo = (float *) SDL_malloc(frames * 2 * sizeof (float));
+    SDLTest_AssertCheck(direct && resampled && mismatched && samples && stereo, "Validate streams and buffers were created");
+    if (direct && resampled && mismatched && samples && stereo) {
+      result = SDL_BindAudioStream(id, NULL);
+      SDLTest_AssertCheck(result == -1, "Verify SDL_BindAudioStream(id, NULL) result; expected: -1, got: %i", result);
+      result = SDL_BindAudioStream(id, mismatched);
+      SDLTest_AssertCheck(result == -1, "Verify binding a stream with the wrong output rate fails; got: %i", result);
+      result = SDL_BindAudioStream(id, direct);
+      SDLTest_AssertCheck(result == 0, "Verify SDL_BindAudioStream(id, direct) result; expected: 0, got: %i", result);
+      result = SDL_BindAudioStream(id, direct);
+      SDLTest_AssertCheck(result == -1, "Verify binding a stream twice fails; got: %i", result);
+      result = SDL_BindAudioStream(id, resampled);
+      SDLTest_AssertCheck(result == 0, "Verify SDL_BindAudioStream(id, resampled) result; expected: 0, got: %i", result);
+      SDL_UnbindAudioStream(mismatched);
+      SDLTest_AssertPass("Call to SDL_UnbindAudioStream() on a stream that isn't bound");
+
+      /* 4000 frames of 1000 on one stream, and 4000 frames at twice the rate (so about half as long) of 0.25 on the other. */
+      for (i = 0; i < frames; i++) {
+        samples[i] = 1000;
+        stereo[i * 2] = stereo[i * 2 + 1] = 0.25f;
+      }
+      SDL_LockAudioDevice(id);
+      SDL_AudioStreamPut(direct, samples, frames * sizeof (Sint16));
+      SDL_AudioStreamPut(resampled, stereo, frames * 2 * sizeof (float));
+      SDL_AudioStreamFlush(resampled);
+      mixed = SDL_AudioStreamAvailable(resampled) / sizeof (Sint16);
+      SDL_UnlockAudioDevice(id);
+
+      SDL_PauseAudioDevice(id, 0);
+      for (i = 0; i < 500; i++) {
+        SDL_LockAudioDevice(id);
+        available = SDL_AudioStreamAvailable(direct) + SDL_AudioStreamAvailable(resampled);
+        SDL_UnlockAudioDevice(id);
+        if (available == 0) {
+          break;
+        }
+        SDL_Delay(10);
+      }
+      SDLTest_AssertCheck(available == 0, "Verify the device drained both streams; %i bytes left", available);
+      SDL_PauseAudioDevice(id, 1);
+
+      /* Freeing a bound stream unbinds it, so the device never touches it again. */
+      SDL_FreeAudioStream(resampled);
+      resampled = NULL;
+    }
+    SDL_CloseAudioDevice(id);
+
+    /* Count the samples that had only the direct stream, and the ones that had both. */
+    rw = SDL_RWFromFile(filename, "rb");
+    SDLTest_AssertCheck(rw != NULL, "Verify the output file '%s' can be read", filename);
+    if (rw != NULL) {
+      direct_only = both = total = 0;
+      while (SDL_RWread(rw, &sample, sizeof (sample), 1) == 1) {
+        if (sample != 0) {
+          total++;
+        }
+        if (sample == 1000) {
+          direct_only++;
+        } else if (SDL_abs(sample - (1000 + 8192)) <= 64) {
+          both++;
+        }
+      }
+      SDL_RWclose(rw);
+      SDLTest_AssertCheck(both >= mixed - 64, "Verify both streams were mixed; expected: >=%i samples, got: %i", mixed - 64, both);
+      SDLTest_AssertCheck(direct_only >= frames - mixed - 64, "Verify the direct stream kept playing on its own; expected: >=%i samples, got: %i", frames - mixed - 64, direct_only);
+      SDLTest_AssertCheck(total <= frames + 64, "Verify nothing else was played; expected: <=%i samples, got: %i", frames + 64, total);
+    }
+
+    SDL_FreeAudioStream(direct);
+    SDL_FreeAudioStream(resampled);
+    SDL_FreeAudioStream(mismatched);
+    SDL_free(samples);
+    SDL_free(stereo);
+  }
+
+  SDL_setenv("SDL_DISKAUDIOFREEWHEEL", "0", 1);
+  SDL_AudioQuit();
+  SDLTest_AssertPass("Call to SDL_AudioQuit()");
+  _audioSetUp(NULL);
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Queue audio on a device that also has a bound stream, and check the device plays both
+ *
+ * \sa https://wiki.libsdl.org/SDL_QueueAudio
+ * \sa https://wiki.libsdl.org/SDL_BindAudioStream
+ */
+int audio_queueWithBoundStream()
+{
+  const char *filename = "sdlaudio.raw";
+  const int frames = 2000;
+  SDL_AudioSpec desired, obtained;
+  SDL_AudioDeviceID id;
+  SDL_AudioStream *stream;
+  SDL_RWops *rw;
+  Sint16 *samples;
+  Sint16 sample;
+  Uint32 queued;
+  int i, result, both, total;
+
+  SDL_QuitSubSystem(SDL_INIT_AUDIO);
+  SDLTest_AssertPass("Call to SDL_QuitSubSystem(SDL_INIT_AUDIO)");
+  SDL_setenv("SDL_DISKAUDIOFREEWHEEL", "1", 1);
+  result = SDL_AudioInit("disk");
+  SDLTest_AssertCheck(result == 0, "Validate result of SDL_AudioInit('disk'); expected: 0, got: %i", result);
+
+  SDL_zero(desired);
+  desired.freq = 8000;
+  desired.format = AUDIO_S16SYS;
+  desired.channels = 1;
+  desired.samples = 256;
+  id = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+  SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >=2, got: %i", id);
+  if (id > 1) {
+    stream = SDL_NewAudioStream(AUDIO_S16SYS, 1, 8000, AUDIO_S16SYS, 1, 8000);
+    samples = (Sint16 *) SDL_malloc(frames * sizeof (Sint16));
+    SDLTest_AssertCheck(stream && samples, "Validate stream and buffer were created");
+    if (stream && samples) {
+      result = SDL_BindAudioStream(id, stream);
+      SDLTest_AssertCheck(result == 0, "Verify SDL_BindAudioStream() result; expected: 0, got: %i", result);
+
+      /* The same number of frames of 300 in the queue and of 1000 in the stream. */
+      for (i = 0; i < frames; i++) {
+        samples[i] = 300;
+      }
+      result = SDL_QueueAudio(id, samples, frames * sizeof (Sint16));
+      SDLTest_AssertCheck(result == 0, "Verify SDL_QueueAudio() with a bound stream; expected: 0, got: %i, error: %s", result, SDL_GetError());
+      queued = SDL_GetQueuedAudioSize(id);
+      SDLTest_AssertCheck(queued == frames * sizeof (Sint16), "Verify SDL_GetQueuedAudioSize(); expected: %i, got: %i", (int) (frames * sizeof (Sint16)), (int) queued);
+      for (i = 0; i < frames; i++) {
+        samples[i] = 1000;
+      }
+      SDL_LockAudioDevice(id);
+      SDL_AudioStreamPut(stream, samples, frames * sizeof (Sint16));
+      SDL_UnlockAudioDevice(id);
+
+      SDL_PauseAudioDevice(id, 0);
+      for (i = 0; i < 500; i++) {
+        queued = SDL_GetQueuedAudioSize(id);
+        if (queued == 0) {
+          break;
+        }
+        SDL_Delay(10);
+      }
+      SDLTest_AssertCheck(queued == 0, "Verify the device drained the queue; %i bytes left", (int) queued);
+      SDL_PauseAudioDevice(id, 1);
+
+      result = SDL_QueueAudio(id, samples, frames * sizeof (Sint16));
+      SDLTest_AssertCheck(result == 0, "Verify SDL_QueueAudio() again; expected: 0, got: %i", result);
+      SDL_ClearQueuedAudio(id);
+      queued = SDL_GetQueuedAudioSize(id);
+      SDLTest_AssertCheck(queued == 0, "Verify SDL_ClearQueuedAudio() with a bound stream; expected: 0 bytes left, got: %i", (int) queued);
+    }
+    SDL_CloseAudioDevice(id);
+
+    /* Every queued sample should have had the stream's mixed in. */
+    rw = SDL_RWFromFile(filename, "rb");
+    SDLTest_AssertCheck(rw != NULL, "Verify the output file '%s' can be read", filename);
+    if (rw != NULL) {
+      both = total = 0;
+      while (SDL_RWread(rw, &sample, sizeof (sample), 1) == 1) {
+        if (sample != 0) {
+          total++;
+        }
+        if (sample == 1300) {
+          both++;
+        }
+      }
+      SDL_RWclose(rw);
+      SDLTest_AssertCheck(both == frames, "Verify the queue and the stream were mixed; expected: %i samples, got: %i", frames, both);
+      SDLTest_AssertCheck(total == frames, "Verify nothing else was played; expected: %i samples, got: %i", frames, total);
+    }
+
+    SDL_FreeAudioStream(stream);
+    SDL_free(samples);
+  }
+
+  SDL_setenv("SDL_DISKAUDIOFREEWHEEL", "0", 1);
+  SDL_AudioQuit();
+  SDLTest_AssertPass("Call to SDL_AudioQuit()");
+  _audioSetUp(NULL);
+
+  return TEST_COMPLETED;
+}
 
 /* ================= Test Case References ================== */
 
@@ -1022,11 +2825,72 @@ static const SDLTest_TestCaseReference audioTest14 =
 static const SDLTest_TestCaseReference audioTest15 =
         { (SDLTest_TestCaseFp)audio_pauseUnpauseAudio, "audio_pauseUnpauseAudio", "Pause and Unpause audio for various audio specs while testing callback.", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference audioTest16 =
+        { (SDLTest_TestCaseFp)audio_resampleLoss, "audio_resampleLoss", "Check signal-to-noise ratio of resampled audio.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest17 =
+        { (SDLTest_TestCaseFp)audio_setResampleQualityNegative, "audio_setResampleQualityNegative", "Checks calls with invalid input to SDL_AudioStreamSetResampleQuality", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest18 =
+        { (SDLTest_TestCaseFp)audio_streamSpans, "audio_streamSpans", "Put and get audio stream data in place.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest19 =
+        { (SDLTest_TestCaseFp)audio_queueAudio, "audio_queueAudio", "Queue audio while the device drains it.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest20 =
+        { (SDLTest_TestCaseFp)audio_mixAudioFormat, "audio_mixAudioFormat", "Mix S16 and F32 audio and check the results.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest21 =
+        { (SDLTest_TestCaseFp)audio_mixAudioSources, "audio_mixAudioSources", "Mix many sources in one pass and check the results.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest22 =
+        { (SDLTest_TestCaseFp)audio_convertSampleFormats, "audio_convertSampleFormats", "Convert between integer and float sample formats and check the results.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest23 =
+        { (SDLTest_TestCaseFp)audio_convertAudioChunked, "audio_convertAudioChunked", "Convert large buffers a chunk at a time and check the results.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest24 =
+        { (SDLTest_TestCaseFp)audio_convertIntegerFormats, "audio_convertIntegerFormats", "Convert between integer sample formats and check the results.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest25 =
+        { (SDLTest_TestCaseFp)audio_decodeWAVIncrementally, "audio_decodeWAVIncrementally", "Decode WAVE files incrementally and with seeking, and compare with SDL_LoadWAV_RW.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest26 =
+        { (SDLTest_TestCaseFp)audio_loadWAVMapped, "audio_loadWAVMapped", "Load PCM WAVE data without copying it.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest27 =
+        { (SDLTest_TestCaseFp)audio_decodeG711, "audio_decodeG711", "Expand mu-law and A-law data and check every code.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest28 =
+        { (SDLTest_TestCaseFp)audio_getAudioDeviceStats, "audio_getAudioDeviceStats", "Gather timing, underrun and fill level statistics from audio devices.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest29 =
+        { (SDLTest_TestCaseFp)audio_callbackLookahead, "audio_callbackLookahead", "Run the audio callback ahead of the device on its own thread.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest30 =
+        { (SDLTest_TestCaseFp)audio_diskFreewheel, "audio_diskFreewheel", "Render audio faster than real time with the disk driver.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest31 =
+        { (SDLTest_TestCaseFp)audio_convertChannels, "audio_convertChannels", "Convert between every pair of channel layouts.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest32 =
+        { (SDLTest_TestCaseFp)audio_streamChannelMatrix, "audio_streamChannelMatrix", "Mix stream channels through a custom matrix.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest33 =
+        { (SDLTest_TestCaseFp)audio_bindAudioStreams, "audio_bindAudioStreams", "Mix several streams into one device.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest34 =
+        { (SDLTest_TestCaseFp)audio_queueWithBoundStream, "audio_queueWithBoundStream", "Queue audio on a device with a bound stream.", TEST_ENABLED };
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] =  {
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
-    &audioTest12, &audioTest13, &audioTest14, &audioTest15, NULL
+    &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16,
+    &audioTest17, &audioTest18, &audioTest19,
+    &audioTest20, &audioTest21, &audioTest22, &audioTest23, &audioTest24,
+    &audioTest25, &audioTest26, &audioTest27,
+    &audioTest28, &audioTest29, &audioTest30, &audioTest31, &audioTest32, &audioTest33, &audioTest34, NULL
 };
 
 /* Audio test suite (global) */
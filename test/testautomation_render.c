@@ -7,6 +7,7 @@
 
 #include "SDL.h"
 #include "SDL_test.h"
+#include "../src/video/dummy/SDL_nullscreen.h"
 
 /* ================= Test Case Implementation ================== */
 
@@ -771,6 +772,735 @@ render_testBlitBlend (void *arg)
 }
 
 
+/**
+ * @brief Draws a scene with every kind of render command. Helper function.
+ */
+static void
+_drawSoftwareScene(SDL_Renderer *swrenderer, SDL_Texture *face, SDL_Texture *opaque)
+{
+   SDL_Vertex verts[6];
+   SDL_Rect rect, src;
+   SDL_FPoint center;
+   int i;
+
+   SDL_SetRenderDrawColor(swrenderer, 10, 20, 30, 255);
+   SDL_RenderClear(swrenderer);
+
+   /* Filled rects, opaque and blended, across tile edges */
+   for (i = 0; i < 40; i++) {
+      rect.x = (i * 97) % 900 - 50;
+      rect.y = (i * 53) % 600 - 30;
+      rect.w = 20 + (i * 31) % 200;
+      rect.h = 10 + (i * 17) % 150;
+      SDL_SetRenderDrawBlendMode(swrenderer, (i & 1) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+      SDL_SetRenderDrawColor(swrenderer, i * 6, 255 - i * 5, i * 3, 100 + i);
+      SDL_RenderFillRect(swrenderer, &rect);
+   }
+
+   /* Points and lines */
+   SDL_SetRenderDrawBlendMode(swrenderer, SDL_BLENDMODE_ADD);
+   for (i = 0; i < 500; i++) {
+      SDL_SetRenderDrawColor(swrenderer, 200, i % 256, 50, 128);
+      SDL_RenderDrawPoint(swrenderer, (i * 37) % 1000, (i * 11) % 700);
+   }
+   SDL_SetRenderDrawBlendMode(swrenderer, SDL_BLENDMODE_NONE);
+   SDL_SetRenderDrawColor(swrenderer, 255, 255, 0, 255);
+   SDL_RenderDrawLine(swrenderer, -20, 5, 1010, 690);
+
+   /* Copies with changing color mod, alpha mod and blend modes, partly off the target */
+   for (i = 0; i < 60; i++) {
+      rect.x = (i * 71) % 1040 - 40;
+      rect.y = (i * 43) % 740 - 40;
+      SDL_QueryTexture(face, NULL, NULL, &rect.w, &rect.h);
+      SDL_SetTextureColorMod(face, 255, (i * 40) % 256, 255 - (i % 3) * 60);
+      SDL_SetTextureAlphaMod(face, (i % 4) ? 255 : 90);
+      SDL_SetTextureBlendMode(face, (i % 5) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_ADD);
+      SDL_RenderCopy(swrenderer, face, NULL, &rect);
+      if ((i % 10) == 0) {
+         SDL_RenderCopy(swrenderer, opaque, NULL, &rect);
+      }
+   }
+
+   /* Scaled and rotated copies */
+   rect.x = 300;
+   rect.y = 200;
+   rect.w = 250;
+   rect.h = 170;
+   SDL_RenderCopy(swrenderer, face, NULL, &rect);
+   src.x = 5;
+   src.y = 5;
+   src.w = 60;
+   src.h = 40;
+   center.x = 10.0f;
+   center.y = 20.0f;
+   SDL_RenderCopyExF(swrenderer, face, &src, NULL, 33.0, &center, SDL_FLIP_HORIZONTAL);
+
+   /* Geometry, flat and textured, under a viewport and a clip rect */
+   rect.x = 40;
+   rect.y = 60;
+   rect.w = 900;
+   rect.h = 600;
+   SDL_RenderSetViewport(swrenderer, &rect);
+   rect.x = 10;
+   rect.y = 10;
+   rect.w = 700;
+   rect.h = 500;
+   SDL_RenderSetClipRect(swrenderer, &rect);
+   for (i = 0; i < 6; i++) {
+      verts[i].position.x = (float) ((i * 157) % 800);
+      verts[i].position.y = (float) ((i * 263) % 550);
+      verts[i].color.r = i * 40;
+      verts[i].color.g = 255 - i * 40;
+      verts[i].color.b = 128;
+      verts[i].color.a = 160 + i * 10;
+      verts[i].tex_coord.x = (float) (i & 1);
+      verts[i].tex_coord.y = (float) ((i >> 1) & 1);
+   }
+   SDL_RenderGeometry(swrenderer, NULL, verts, 6, NULL, 0);
+   SDL_SetTextureColorMod(face, 255, 255, 255);
+   SDL_SetTextureAlphaMod(face, 255);
+   SDL_SetTextureBlendMode(face, SDL_BLENDMODE_BLEND);
+   SDL_RenderGeometry(swrenderer, face, verts, 6, NULL, 0);
+   SDL_RenderSetClipRect(swrenderer, NULL);
+   SDL_RenderSetViewport(swrenderer, NULL);
+
+   SDL_RenderFlush(swrenderer);
+}
+
+/**
+ * @brief Draws interleaved sprites from two textures, some overlapping. Helper function.
+ */
+static void
+_drawSoftwareSprites(SDL_Renderer *swrenderer, SDL_Texture *face, SDL_Texture *opaque)
+{
+   SDL_Rect rect, src;
+   int i;
+
+   SDL_SetRenderDrawColor(swrenderer, 40, 40, 40, 255);
+   SDL_RenderClear(swrenderer);
+
+   rect.x = 20;
+   rect.y = 30;
+   rect.w = 900;
+   rect.h = 600;
+   SDL_RenderSetViewport(swrenderer, &rect);
+   SDL_SetTextureBlendMode(face, SDL_BLENDMODE_BLEND);
+
+   for (i = 0; i < 400; i++) {
+      SDL_Texture *texture = (i % 3) ? face : opaque;
+      SDL_QueryTexture(texture, NULL, NULL, &rect.w, &rect.h);
+      rect.x = (i % 30) * 31 - 16;
+      rect.y = (i / 30) * 45 - 10;
+      if ((i % 7) == 0) {
+         rect.x += 20;  /* overlap the next sprite along. */
+      }
+      if ((i % 50) == 0) {
+         SDL_SetTextureColorMod(face, 255, 128 + i / 4, 255 - i / 2);
+      }
+      src.x = (i % 4) * 4;
+      src.y = 0;
+      src.w = rect.w - src.x;
+      src.h = rect.h;
+      rect.w = src.w;
+      SDL_RenderCopy(swrenderer, texture, &src, &rect);
+
+      if ((i % 90) == 45) {
+         /* a scaled copy the sprites around it can't be moved past */
+         rect.w *= 3;
+         rect.h *= 2;
+         SDL_RenderCopy(swrenderer, face, NULL, &rect);
+      }
+   }
+   SDL_SetTextureColorMod(face, 255, 255, 255);
+   SDL_RenderSetViewport(swrenderer, NULL);
+
+   SDL_RenderFlush(swrenderer);
+}
+
+/**
+ * @brief Draws the same thing on two software renderers, each created with a
+ *        different value of a hint, and checks they drew the same. Helper function.
+ */
+static void
+_compareSoftwareRenderers(const char *hint, const char *values[2],
+                          void (*draw)(SDL_Renderer *, SDL_Texture *, SDL_Texture *))
+{
+   SDL_Surface *targets[2] = { NULL, NULL };
+   SDL_Surface *face, *opaque;
+   int i, y, result, mismatched_rows;
+
+   face = SDLTest_ImageFace();
+   opaque = face ? SDL_ConvertSurfaceFormat(face, SDL_PIXELFORMAT_RGB888, 0) : NULL;
+   SDLTest_AssertCheck(face != NULL && opaque != NULL, "Verify the test images were loaded");
+   if (face == NULL || opaque == NULL) {
+      SDL_FreeSurface(face);
+      return;
+   }
+
+   for (i = 0; i < 2; i++) {
+      SDL_Renderer *swrenderer;
+      SDL_Texture *tface, *topaque;
+
+      targets[i] = SDL_CreateRGBSurfaceWithFormat(0, 1000, 700, 32, SDL_PIXELFORMAT_ARGB8888);
+      SDLTest_AssertCheck(targets[i] != NULL, "Verify target surface was created");
+      if (targets[i] == NULL) {
+         continue;
+      }
+      SDL_SetHint(SDL_HINT_RENDER_BATCHING, "1");
+      SDL_SetHint(hint, values[i]);
+      swrenderer = SDL_CreateSoftwareRenderer(targets[i]);
+      SDLTest_AssertCheck(swrenderer != NULL, "Verify SDL_CreateSoftwareRenderer() result");
+      if (swrenderer == NULL) {
+         continue;
+      }
+      tface = SDL_CreateTextureFromSurface(swrenderer, face);
+      topaque = SDL_CreateTextureFromSurface(swrenderer, opaque);
+      SDLTest_AssertCheck(tface != NULL && topaque != NULL, "Verify textures were created");
+      if (tface != NULL && topaque != NULL) {
+         draw(swrenderer, tface, topaque);
+         SDLTest_AssertPass("Drew the scene with %s=%s", hint, values[i]);
+      }
+      SDL_DestroyTexture(tface);
+      SDL_DestroyTexture(topaque);
+      SDL_DestroyRenderer(swrenderer);
+   }
+   SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, "0");
+   SDL_SetHint(SDL_HINT_RENDER_BATCHING, NULL);
+
+   if (targets[0] != NULL && targets[1] != NULL) {
+      mismatched_rows = 0;
+      for (y = 0; y < targets[0]->h; y++) {
+         result = SDL_memcmp((Uint8 *) targets[0]->pixels + y * targets[0]->pitch,
+                             (Uint8 *) targets[1]->pixels + y * targets[1]->pitch, targets[0]->w * 4);
+         if (result != 0) {
+            mismatched_rows++;
+         }
+      }
+      SDLTest_AssertCheck(mismatched_rows == 0, "Verify drawing with %s=%s matches; expected: 0 differing rows, got: %i", hint, values[1], mismatched_rows);
+   }
+
+   SDL_FreeSurface(targets[0]);
+   SDL_FreeSurface(targets[1]);
+   SDL_FreeSurface(opaque);
+   SDL_FreeSurface(face);
+}
+
+/**
+ * @brief Tests that the software renderer draws the same with several threads as with one.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_HINT_RENDER_SOFTWARE_THREADS
+ */
+int
+render_testSoftwareThreads(void *arg)
+{
+   const char *threads[2] = { "0", "4" };
+
+   _compareSoftwareRenderers(SDL_HINT_RENDER_SOFTWARE_THREADS, threads, _drawSoftwareScene);
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that the software renderer draws batched sprites the same as it draws them one at a time.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_HINT_RENDER_BATCHING
+ */
+int
+render_testSoftwareSpriteBatch(void *arg)
+{
+   const char *batching[2] = { "0", "1" };
+
+   _compareSoftwareRenderers(SDL_HINT_RENDER_BATCHING, batching, _drawSoftwareSprites);
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Lays out a 16x16 grid of quads, shifted right by dx: gouraud colored
+ *        for pass 0, white for pass 1, and colored and translucent for pass 2.
+ *        Helper function.
+ */
+static void
+_makeSoftwareMesh(SDL_Vertex verts[17 * 17], int indices[16 * 16 * 6], int pass, float dx)
+{
+   int i, x, y;
+
+   i = 0;
+   for (y = 0; y < 16; y++) {
+      for (x = 0; x < 16; x++) {
+         const int corner = y * 17 + x;
+         indices[i++] = corner;
+         indices[i++] = corner + 1;
+         indices[i++] = corner + 18;
+         indices[i++] = corner;
+         indices[i++] = corner + 18;
+         indices[i++] = corner + 17;
+      }
+   }
+
+   for (y = 0; y <= 16; y++) {
+      for (x = 0; x <= 16; x++) {
+         SDL_Vertex *vert = &verts[y * 17 + x];
+         vert->position.x = 12.5f + x * 37.3f + (y % 3) * 5.1f + dx;
+         vert->position.y = 3.0f + y * 27.7f + (x % 4) * 3.3f;
+         vert->color.r = (pass == 1) ? 255 : x * 15;
+         vert->color.g = (pass == 1) ? 255 : y * 15;
+         vert->color.b = (pass == 1) ? 255 : (x + y) * 7;
+         vert->color.a = (pass == 2) ? 200 - x * 5 : 255;
+         vert->tex_coord.x = x / 16.0f;
+         vert->tex_coord.y = y / 16.0f;
+      }
+   }
+}
+
+/**
+ * @brief Draws meshes of triangles: gouraud filled, copied from an opaque texture,
+ *        and modulated and blended. Helper function.
+ */
+static void
+_drawSoftwareMesh(SDL_Renderer *swrenderer, SDL_Texture *face, SDL_Texture *opaque)
+{
+   SDL_Vertex verts[17 * 17];
+   int indices[16 * 16 * 6];
+   SDL_Rect rect;
+   int pass;
+
+   SDL_SetRenderDrawColor(swrenderer, 40, 40, 40, 255);
+   SDL_RenderClear(swrenderer);
+
+   rect.x = 5;
+   rect.y = 8;
+   rect.w = 600;
+   rect.h = 450;
+   SDL_RenderSetClipRect(swrenderer, &rect);
+   SDL_SetRenderDrawBlendMode(swrenderer, SDL_BLENDMODE_NONE);
+   SDL_SetTextureBlendMode(opaque, SDL_BLENDMODE_NONE);
+   SDL_SetTextureBlendMode(face, SDL_BLENDMODE_BLEND);
+
+   for (pass = 0; pass < 3; pass++) {
+      _makeSoftwareMesh(verts, indices, pass, pass * 3.0f);
+      SDL_RenderGeometry(swrenderer, (pass == 0) ? NULL : (pass == 1) ? opaque : face,
+                         verts, SDL_arraysize(verts), indices, SDL_arraysize(indices));
+   }
+   SDL_RenderSetClipRect(swrenderer, NULL);
+
+   SDL_RenderFlush(swrenderer);
+}
+
+/**
+ * @brief Tests that the software renderer draws triangles into 32 bit targets the same as into 24 bit ones.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_RenderGeometry
+ */
+int
+render_testSoftwareGeometry(void *arg)
+{
+   const Uint32 formats[2] = { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB24 };
+   SDL_Surface *targets[2] = { NULL, NULL };
+   SDL_Surface *face, *opaque, *converted;
+   int i, x, y, mismatched;
+
+   face = SDLTest_ImageFace();
+   opaque = face ? SDL_ConvertSurfaceFormat(face, SDL_PIXELFORMAT_RGB888, 0) : NULL;
+   SDLTest_AssertCheck(face != NULL && opaque != NULL, "Verify the test images were loaded");
+   if (face == NULL || opaque == NULL) {
+      SDL_FreeSurface(face);
+      return TEST_ABORTED;
+   }
+
+   for (i = 0; i < 2; i++) {
+      SDL_Renderer *swrenderer;
+      SDL_Texture *tface, *topaque;
+
+      targets[i] = SDL_CreateRGBSurfaceWithFormat(0, 640, 480, SDL_BITSPERPIXEL(formats[i]), formats[i]);
+      SDLTest_AssertCheck(targets[i] != NULL, "Verify target surface was created");
+      if (targets[i] == NULL) {
+         continue;
+      }
+      swrenderer = SDL_CreateSoftwareRenderer(targets[i]);
+      SDLTest_AssertCheck(swrenderer != NULL, "Verify SDL_CreateSoftwareRenderer() result");
+      if (swrenderer == NULL) {
+         continue;
+      }
+      tface = SDL_CreateTextureFromSurface(swrenderer, face);
+      topaque = SDL_CreateTextureFromSurface(swrenderer, opaque);
+      SDLTest_AssertCheck(tface != NULL && topaque != NULL, "Verify textures were created");
+      if (tface != NULL && topaque != NULL) {
+         _drawSoftwareMesh(swrenderer, tface, topaque);
+         SDLTest_AssertPass("Drew the meshes into a %s target", SDL_GetPixelFormatName(formats[i]));
+      }
+      SDL_DestroyTexture(tface);
+      SDL_DestroyTexture(topaque);
+      SDL_DestroyRenderer(swrenderer);
+   }
+
+   converted = targets[1] ? SDL_ConvertSurfaceFormat(targets[1], SDL_PIXELFORMAT_RGB888, 0) : NULL;
+   if (targets[0] != NULL && converted != NULL) {
+      mismatched = 0;
+      for (y = 0; y < converted->h; y++) {
+         const Uint32 *row0 = (const Uint32 *) ((Uint8 *) targets[0]->pixels + y * targets[0]->pitch);
+         const Uint32 *row1 = (const Uint32 *) ((Uint8 *) converted->pixels + y * converted->pitch);
+         for (x = 0; x < converted->w; x++) {
+            if ((row0[x] & 0x00FFFFFF) != (row1[x] & 0x00FFFFFF)) {
+               mismatched++;
+            }
+         }
+      }
+      SDLTest_AssertCheck(mismatched == 0, "Verify the targets match; expected: 0 differing pixels, got: %i", mismatched);
+   }
+
+   SDL_FreeSurface(converted);
+   SDL_FreeSurface(targets[0]);
+   SDL_FreeSurface(targets[1]);
+   SDL_FreeSurface(opaque);
+   SDL_FreeSurface(face);
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Draws the meshes in every blend mode, untextured, textured and from a
+ *        texture in the target's own format. Helper function.
+ */
+static void
+_drawSoftwareSpans(SDL_Renderer *swrenderer, SDL_Texture *face, SDL_Texture *native)
+{
+   const SDL_BlendMode modes[] = {
+      SDL_BLENDMODE_NONE, SDL_BLENDMODE_BLEND, SDL_BLENDMODE_ADD, SDL_BLENDMODE_MOD, SDL_BLENDMODE_MUL
+   };
+   SDL_Vertex verts[17 * 17];
+   int indices[16 * 16 * 6];
+   int i;
+
+   /* a textured background gives the blend modes something to work with. */
+   SDL_SetRenderDrawColor(swrenderer, 40, 80, 120, 255);
+   SDL_RenderClear(swrenderer);
+   SDL_SetTextureBlendMode(native, SDL_BLENDMODE_NONE);
+   _makeSoftwareMesh(verts, indices, 0, 0.0f);
+   SDL_RenderGeometry(swrenderer, native, verts, SDL_arraysize(verts), indices, SDL_arraysize(indices));
+
+   for (i = 0; i < SDL_arraysize(modes); i++) {
+      SDL_SetRenderDrawBlendMode(swrenderer, modes[i]);
+      SDL_SetTextureBlendMode(face, modes[i]);
+      SDL_SetTextureBlendMode(native, modes[i]);
+
+      _makeSoftwareMesh(verts, indices, 2, i * 4.0f);
+      SDL_RenderGeometry(swrenderer, NULL, verts, SDL_arraysize(verts), indices, SDL_arraysize(indices));
+      SDL_RenderGeometry(swrenderer, face, verts, SDL_arraysize(verts), indices, SDL_arraysize(indices));
+
+      /* white and opaque: unmodulated, which is a straight copy with SDL_BLENDMODE_NONE. */
+      _makeSoftwareMesh(verts, indices, 1, i * 4.0f + 2.0f);
+      SDL_RenderGeometry(swrenderer, native, verts, SDL_arraysize(verts), indices, SDL_arraysize(indices));
+   }
+
+   SDL_RenderFlush(swrenderer);
+}
+
+/**
+ * @brief Draws _drawSoftwareSpans() into a new target of the given format with
+ *        SDL_HINT_RENDER_SOFTWARE_SIMD set to simd. Helper function.
+ */
+static SDL_Surface *
+_drawWithSoftwareSpans(Uint32 format, const char *simd, SDL_Surface *face)
+{
+   SDL_Surface *target, *converted;
+   SDL_Renderer *swrenderer;
+   SDL_Texture *tface, *tnative;
+
+   target = SDL_CreateRGBSurfaceWithFormat(0, 640, 480, 32, format);
+   converted = SDL_ConvertSurfaceFormat(face, format, 0);
+   SDLTest_AssertCheck(target != NULL && converted != NULL, "Verify %s surfaces were created", SDL_GetPixelFormatName(format));
+   if (target == NULL || converted == NULL) {
+      SDL_FreeSurface(target);
+      SDL_FreeSurface(converted);
+      return NULL;
+   }
+
+   SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_SIMD, simd);
+   swrenderer = SDL_CreateSoftwareRenderer(target);
+   SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_SIMD, NULL);
+   SDLTest_AssertCheck(swrenderer != NULL, "Verify SDL_CreateSoftwareRenderer() result");
+   if (swrenderer == NULL) {
+      SDL_FreeSurface(converted);
+      SDL_FreeSurface(target);
+      return NULL;
+   }
+
+   tface = SDL_CreateTextureFromSurface(swrenderer, face);
+   tnative = SDL_CreateTexture(swrenderer, format, SDL_TEXTUREACCESS_STATIC, converted->w, converted->h);
+   SDLTest_AssertCheck(tface != NULL && tnative != NULL, "Verify textures were created");
+   if (tface != NULL && tnative != NULL) {
+      SDL_UpdateTexture(tnative, NULL, converted->pixels, converted->pitch);
+      _drawSoftwareSpans(swrenderer, tface, tnative);
+      SDLTest_AssertPass("Drew the meshes into a %s target with %s=%s", SDL_GetPixelFormatName(format), SDL_HINT_RENDER_SOFTWARE_SIMD, simd);
+   }
+   SDL_DestroyTexture(tface);
+   SDL_DestroyTexture(tnative);
+   SDL_DestroyRenderer(swrenderer);
+   SDL_FreeSurface(converted);
+   return target;
+}
+
+/**
+ * @brief Tests that each SIMD span the CPU has draws triangles the same as plain C,
+ *        in every 32 bit target format the spans handle and every blend mode.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_HINT_RENDER_SOFTWARE_SIMD
+ */
+int
+render_testSoftwareSpans(void *arg)
+{
+   const Uint32 formats[] = {
+      SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888
+   };
+   const char *simd[] = { "sse4.1", "1" };
+   SDL_Surface *face;
+   int f, i, y, mismatched_rows;
+
+   SDLTest_Log("CPU has SSE4.1: %s, AVX2: %s", SDL_HasSSE41() ? "yes" : "no", SDL_HasAVX2() ? "yes" : "no");
+
+   face = SDLTest_ImageFace();
+   SDLTest_AssertCheck(face != NULL, "Verify the test image was loaded");
+   if (face == NULL) {
+      return TEST_ABORTED;
+   }
+
+   for (f = 0; f < SDL_arraysize(formats); f++) {
+      SDL_Surface *reference = _drawWithSoftwareSpans(formats[f], "0", face);
+      if (reference == NULL) {
+         continue;
+      }
+      for (i = 0; i < SDL_arraysize(simd); i++) {
+         SDL_Surface *drawn = _drawWithSoftwareSpans(formats[f], simd[i], face);
+         if (drawn == NULL) {
+            continue;
+         }
+         mismatched_rows = 0;
+         for (y = 0; y < reference->h; y++) {
+            if (SDL_memcmp((Uint8 *) reference->pixels + y * reference->pitch,
+                           (Uint8 *) drawn->pixels + y * drawn->pitch, reference->w * 4) != 0) {
+               mismatched_rows++;
+            }
+         }
+         SDLTest_AssertCheck(mismatched_rows == 0, "Verify %s=%s into %s matches plain C; expected: 0 differing rows, got: %i",
+                             SDL_HINT_RENDER_SOFTWARE_SIMD, simd[i], SDL_GetPixelFormatName(formats[f]), mismatched_rows);
+         SDL_FreeSurface(drawn);
+      }
+      SDL_FreeSurface(reference);
+   }
+
+   SDL_FreeSurface(face);
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Checks that what the dummy driver's window shows is what a full
+ *        present would show, which is the whole window surface. Helper function.
+ */
+static void
+_checkPartialPresent(SDL_Window *swwindow, const char *what)
+{
+   SDL_Surface *surface = SDL_GetWindowSurface(swwindow);
+   SDL_Surface *screen = (SDL_Surface *) SDL_GetWindowData(swwindow, DUMMY_SCREEN);
+   int y, mismatched_rows = 0;
+
+   SDLTest_AssertCheck(surface != NULL && screen != NULL, "Verify the window surface and what the window shows were found");
+   if (surface == NULL || screen == NULL) {
+      return;
+   }
+   SDLTest_AssertCheck(surface->w == screen->w && surface->h == screen->h && surface->format->format == screen->format->format,
+                       "Verify the window shows a %ix%i frame; got: %ix%i", surface->w, surface->h, screen->w, screen->h);
+   if (surface->w != screen->w || surface->h != screen->h || surface->format->format != screen->format->format) {
+      return;
+   }
+
+   for (y = 0; y < surface->h; y++) {
+      if (SDL_memcmp((Uint8 *) surface->pixels + y * surface->pitch,
+                     (Uint8 *) screen->pixels + y * screen->pitch, surface->w * surface->format->BytesPerPixel) != 0) {
+         mismatched_rows++;
+      }
+   }
+   SDLTest_AssertCheck(mismatched_rows == 0, "Verify the window matches a full present after %s; expected: 0 differing rows, got: %i", what, mismatched_rows);
+}
+
+/**
+ * @brief Scribbles over what the dummy driver's window shows, so only a full
+ *        present can put it right. Helper function.
+ */
+static void
+_scribbleOnDummyScreen(SDL_Window *swwindow)
+{
+   SDL_Surface *screen = (SDL_Surface *) SDL_GetWindowData(swwindow, DUMMY_SCREEN);
+
+   if (screen != NULL) {
+      SDL_FillRect(screen, NULL, SDL_MapRGB(screen->format, 255, 0, 255));
+   }
+}
+
+/**
+ * @brief Draws one of everything the software renderer tracks, somewhere that
+ *        moves from frame to frame, without a clear. Helper function.
+ */
+static void
+_drawPartialFrame(SDL_Renderer *swrenderer, SDL_Texture *face, int frame)
+{
+   const int x = 10 + (frame * 37) % 200;
+   const int y = 10 + (frame * 23) % 140;
+   SDL_Rect rect, viewport;
+   SDL_Point points[3];
+   SDL_Vertex verts[3];
+   int i;
+
+   SDL_SetRenderDrawColor(swrenderer, (Uint8) (frame * 40), 200, (Uint8) (255 - frame * 30), 255);
+   rect.x = x;
+   rect.y = y;
+   rect.w = 30;
+   rect.h = 20;
+   SDL_RenderFillRect(swrenderer, &rect);
+   SDL_RenderDrawLine(swrenderer, x + 40, y, x + 70, y + 25);
+   for (i = 0; i < SDL_arraysize(points); i++) {
+      points[i].x = x + 5 + i * 9;
+      points[i].y = y + 45;
+   }
+   SDL_RenderDrawPoints(swrenderer, points, SDL_arraysize(points));
+
+   rect.x = x + 80;
+   rect.y = y + 5;
+   rect.w = 24;
+   rect.h = 24;
+   SDL_RenderCopy(swrenderer, face, NULL, &rect);
+
+   for (i = 0; i < SDL_arraysize(verts); i++) {
+      verts[i].color.r = (Uint8) (i * 120);
+      verts[i].color.g = 80;
+      verts[i].color.b = (Uint8) (frame * 25);
+      verts[i].color.a = 255;
+      verts[i].tex_coord.x = verts[i].tex_coord.y = 0.0f;
+   }
+   verts[0].position.x = x + 0.5f;
+   verts[0].position.y = y + 60.5f;
+   verts[1].position.x = x + 40.25f;
+   verts[1].position.y = y + 58.0f;
+   verts[2].position.x = x + 20.75f;
+   verts[2].position.y = y + 85.5f;
+   SDL_RenderGeometry(swrenderer, NULL, verts, SDL_arraysize(verts), NULL, 0);
+
+   /* a rotated copy, in a clipped viewport of its own. */
+   viewport.x = x + 50;
+   viewport.y = y + 40;
+   viewport.w = 60;
+   viewport.h = 50;
+   SDL_RenderSetViewport(swrenderer, &viewport);
+   rect.x = 5;
+   rect.y = 5;
+   rect.w = 40;
+   rect.h = 30;
+   SDL_RenderSetClipRect(swrenderer, &rect);
+   rect.x = 10;
+   rect.y = 8;
+   SDL_RenderCopyEx(swrenderer, face, NULL, &rect, frame * 33.0, NULL, SDL_FLIP_NONE);
+   SDL_RenderSetClipRect(swrenderer, NULL);
+   SDL_RenderSetViewport(swrenderer, NULL);
+}
+
+/**
+ * @brief Tests that the software renderer's window presents, which only update
+ *        what was drawn, show the same as updating the whole window.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_RenderPresent
+ * http://wiki.libsdl.org/SDL_UpdateWindowSurfaceRects
+ */
+int
+render_testSoftwarePartialPresent(void *arg)
+{
+   const char *driver = SDL_GetCurrentVideoDriver();
+   SDL_Window *swwindow;
+   SDL_Renderer *swrenderer;
+   SDL_Surface *face;
+   SDL_Texture *tface;
+   SDL_Event event;
+   int frame;
+
+   /* only the dummy driver lets us see what the window shows. */
+   if (driver == NULL || SDL_strcmp(driver, "dummy") != 0) {
+      SDLTest_Log("Skipping partial present test; needs the dummy video driver, got: %s", driver ? driver : "(none)");
+      return TEST_SKIPPED;
+   }
+
+   /* the driver keeps what the window shows for as long as this is set. */
+   SDL_setenv(DUMMY_SCREEN_ENV, "1", 1);
+   swwindow = SDL_CreateWindow("render_testSoftwarePartialPresent", 100, 100, 320, 240, 0);
+   SDLTest_AssertCheck(swwindow != NULL, "Check SDL_CreateWindow result");
+   if (swwindow == NULL) {
+      SDL_setenv(DUMMY_SCREEN_ENV, "0", 1);
+      return TEST_ABORTED;
+   }
+   swrenderer = SDL_CreateRenderer(swwindow, -1, SDL_RENDERER_SOFTWARE);
+   SDLTest_AssertCheck(swrenderer != NULL, "Check SDL_CreateRenderer(SDL_RENDERER_SOFTWARE) result");
+   face = SDLTest_ImageFace();
+   tface = (swrenderer && face) ? SDL_CreateTextureFromSurface(swrenderer, face) : NULL;
+   SDL_FreeSurface(face);
+   SDLTest_AssertCheck(tface != NULL, "Verify the test texture was created");
+   if (tface == NULL) {
+      SDL_DestroyRenderer(swrenderer);
+      SDL_DestroyWindow(swwindow);
+      SDL_setenv(DUMMY_SCREEN_ENV, "0", 1);
+      return TEST_ABORTED;
+   }
+   SDL_SetTextureBlendMode(tface, SDL_BLENDMODE_BLEND);
+
+   SDL_SetRenderDrawColor(swrenderer, 20, 30, 40, 255);
+   SDL_RenderClear(swrenderer);
+   SDL_RenderPresent(swrenderer);
+   _checkPartialPresent(swwindow, "the first frame");
+
+   for (frame = 1; frame <= 8; frame++) {
+      _drawPartialFrame(swrenderer, tface, frame);
+      SDL_RenderPresent(swrenderer);
+      _checkPartialPresent(swwindow, "a frame without a clear");
+   }
+
+   /* each of these has to update the whole window. */
+   SDL_SetRenderDrawColor(swrenderer, 60, 10, 90, 255);
+   SDL_RenderClear(swrenderer);
+   _drawPartialFrame(swrenderer, tface, 9);
+   SDL_RenderFlush(swrenderer);
+   _scribbleOnDummyScreen(swwindow);
+   SDL_RenderPresent(swrenderer);
+   _checkPartialPresent(swwindow, "a clear");
+
+   _scribbleOnDummyScreen(swwindow);
+   SDL_zero(event);
+   event.type = SDL_WINDOWEVENT;
+   event.window.event = SDL_WINDOWEVENT_EXPOSED;
+   event.window.windowID = SDL_GetWindowID(swwindow);
+   SDL_PushEvent(&event);
+   SDL_RenderPresent(swrenderer);
+   _checkPartialPresent(swwindow, "an expose");
+
+   SDL_SetWindowSize(swwindow, 400, 300);
+   SDL_PumpEvents();
+   _drawPartialFrame(swrenderer, tface, 10);
+   SDL_RenderFlush(swrenderer);
+   _scribbleOnDummyScreen(swwindow);
+   SDL_RenderPresent(swrenderer);
+   _checkPartialPresent(swwindow, "a resize");
+
+   /* and after those, back to drawing only what changed. */
+   _drawPartialFrame(swrenderer, tface, 11);
+   SDL_RenderPresent(swrenderer);
+   _checkPartialPresent(swwindow, "a frame without a clear");
+
+   SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+   SDL_DestroyTexture(tface);
+   SDL_DestroyRenderer(swrenderer);
+   SDL_DestroyWindow(swwindow);
+   SDL_setenv(DUMMY_SCREEN_ENV, "0", 1);
+   return TEST_COMPLETED;
+}
+
 /**
  * @brief Checks to see if functionality is supported. Helper function.
  */
@@ -1090,9 +1820,24 @@ static const SDLTest_TestCaseReference renderTest6 =
 static const SDLTest_TestCaseReference renderTest7 =
         {  (SDLTest_TestCaseFp)render_testBlitBlend, "render_testBlitBlend", "Tests blitting with blending", TEST_DISABLED };
 
+static const SDLTest_TestCaseReference renderTest8 =
+        { (SDLTest_TestCaseFp)render_testSoftwareThreads, "render_testSoftwareThreads", "Tests the software renderer draws the same on several threads", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest9 =
+        { (SDLTest_TestCaseFp)render_testSoftwareSpriteBatch, "render_testSoftwareSpriteBatch", "Tests the software renderer draws batched sprites the same as single ones", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest10 =
+        { (SDLTest_TestCaseFp)render_testSoftwareGeometry, "render_testSoftwareGeometry", "Tests the software renderer draws triangles the same into 32 bit and other targets", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest11 =
+        { (SDLTest_TestCaseFp)render_testSoftwareSpans, "render_testSoftwareSpans", "Tests the software renderer's SIMD triangle spans draw the same as plain C", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest12 =
+        { (SDLTest_TestCaseFp)render_testSoftwarePartialPresent, "render_testSoftwarePartialPresent", "Tests the software renderer's partial window presents show the same as full ones", TEST_ENABLED };
+
 /* Sequence of Render test cases */
 static const SDLTest_TestCaseReference *renderTests[] =  {
-    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, NULL
+    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, &renderTest8, &renderTest9, &renderTest10, &renderTest11, &renderTest12, NULL
 };
 
 /* Render test suite (global) */